@@ -9,10 +9,18 @@
 #include "jtest_systick.h"
 #include "jtest_util.h"         /* STR() */
 
+#if defined(JTEST_HOST)
+#include "jtest_host.h"
+#include <inttypes.h>
+#endif
+
 /*--------------------------------------------------------------------------------*/
 /* Declare Module Variables */
 /*--------------------------------------------------------------------------------*/
 extern const char * JTEST_CYCLE_STRF;
+#if defined(JTEST_HOST)
+extern const char * JTEST_HOST_CYCLE_STRF;
+#endif
 
 /*--------------------------------------------------------------------------------*/
 /* Macros and Defines */
@@ -43,7 +51,44 @@ extern const char * JTEST_CYCLE_STRF;
                          __jtest_cycle_end_count));     \
     } while (0)
 */
-#ifndef ARMv7A
+#if defined(JTEST_HOST)
+
+#define JTEST_COUNT_CYCLES(fn_call)                                 \
+    do                                                              \
+    {                                                               \
+        uint64_t __jtest_cycle_count = UINT64_MAX;                  \
+        uint64_t __jtest_ns_count    = UINT64_MAX;                  \
+        uint32_t __jtest_repeat;                                    \
+                                                                    \
+        for (__jtest_repeat = 0;                                    \
+             __jtest_repeat < JTEST_HOST_REPEAT;                    \
+             ++__jtest_repeat)                                      \
+        {                                                           \
+            uint64_t __jtest_cycles;                                \
+            uint64_t __jtest_ns;                                    \
+                                                                    \
+            jtest_host_start();                                     \
+                                                                    \
+            fn_call;                                                \
+                                                                    \
+            jtest_host_stop(&__jtest_cycles, &__jtest_ns);          \
+                                                                    \
+            if (__jtest_cycles < __jtest_cycle_count)               \
+            {                                                       \
+                __jtest_cycle_count = __jtest_cycles;               \
+            }                                                       \
+            if (__jtest_ns < __jtest_ns_count)                      \
+            {                                                       \
+                __jtest_ns_count = __jtest_ns;                      \
+            }                                                       \
+        }                                                           \
+                                                                    \
+        JTEST_DUMP_STRF(JTEST_HOST_CYCLE_STRF,                      \
+                        __jtest_cycle_count,                        \
+                        __jtest_ns_count);                          \
+    } while (0)
+
+#elif !defined(ARMv7A)
 
 #define JTEST_COUNT_CYCLES(fn_call)                     \
     do                                                  \
@@ -0,0 +1,90 @@
+#ifndef _JTEST_HOST_H_
+#define _JTEST_HOST_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Purpose */
+/*--------------------------------------------------------------------------------*/
+/* jtest_host.h Replaces the SysTick cycle counting when the framework is built
+ * as a native executable (JTEST_HOST defined). */
+
+/*--------------------------------------------------------------------------------*/
+/* Includes */
+/*--------------------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Number of calls of the function under test for each measurement. The
+ *  smallest count is reported.
+ *
+ *  @warning With more than one call, functions working in-place or keeping a
+ *  state are called again on their own output and the comparisons with the
+ *  reference functions are failing. Use 1 to validate the library.
+ */
+#ifndef JTEST_HOST_REPEAT
+#define JTEST_HOST_REPEAT 1
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Function Prototypes */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Select the cycle counter and measure the overhead of a start/stop pair.
+ *
+ *  The core cycles are read from the Linux perf events when they are
+ *  accessible. Otherwise, the time stamp counter is used on x86 and the
+ *  monotonic clock (in ns) on other hosts.
+ */
+void jtest_host_init(void);
+
+/**
+ *  Name of the counter selected by jtest_host_init(): "perf", "tsc" or "ns".
+ */
+const char * jtest_host_counter_name(void);
+
+/**
+ *  Start a measurement.
+ */
+void jtest_host_start(void);
+
+/**
+ *  Stop the measurement and return the elapsed cycles and nanoseconds, without
+ *  the overhead of the measurement itself.
+ */
+void jtest_host_stop(uint64_t * cycles, uint64_t * ns);
+
+/**
+ *  Run the tests in several processes when the option "-j N" is passed to the
+ *  executable.
+ *
+ *  The tests are shared between N jobs (test i is run by job i modulo N). Each
+ *  job is a forked process with its own copy of the global input and output
+ *  buffers of the tests.
+ *
+ *  The function returns in each job, which must run all the groups and then
+ *  call jtest_host_end_job(). It returns only once in the parent process. The
+ *  parent waits for the jobs, prints their traces one after the other and a
+ *  summary of all the tests, and exits.
+ *
+ *  Without "-j" (or with "-j 1") the function returns and the tests are run by
+ *  the current process.
+ */
+void jtest_host_start_jobs(int argc, char ** argv);
+
+/**
+ *  Report the results of a job to the parent process and exit. Does nothing
+ *  when the tests are not run by several jobs.
+ */
+void jtest_host_end_job(uint32_t passed, uint32_t failed);
+
+/**
+ *  Evaluate to 1 if the next enabled test must be run by the current job.
+ */
+int jtest_host_test_selected(void);
+
+#endif /* _JTEST_HOST_H_ */
@@ -42,6 +42,8 @@
   #include "ARMv8MML_DP.h"
 #elif defined ARMv8MML_DSP_DP
   #include "ARMv8MML_DSP_DP.h"
+#elif defined JTEST_HOST
+  /* Native host : cycles are counted by jtest_host.c */
 #elif defined ARMv7A
   /* TODO */
 #else
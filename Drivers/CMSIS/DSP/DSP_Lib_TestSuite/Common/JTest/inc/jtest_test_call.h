@@ -8,10 +8,24 @@
 #include "jtest_test_define.h"
 #include "jtest_fw.h"
 
+#if defined(JTEST_HOST)
+#include "jtest_host.h"
+#endif
+
 /*--------------------------------------------------------------------------------*/
 /* Macros and Defines */
 /*--------------------------------------------------------------------------------*/
 
+/**
+ *  Evaluate to true if the test must be run by this process. Always true except
+ *  when the tests of a native host build are shared between several jobs.
+ */
+#if defined(JTEST_HOST)
+#define JTEST_TEST_IS_SELECTED() (jtest_host_test_selected())
+#else
+#define JTEST_TEST_IS_SELECTED() (1)
+#endif
+
 /**
  *  Exectute the test in the #JTEST_TEST_t struct associated with the identifier
  *  test_fn and store the result in retval.
@@ -102,7 +116,8 @@
 #define JTEST_TEST_CALL(test_fn)                                        \
     do                                                                  \
     {                                                                   \
-        if (JTEST_TEST_IS_ENABLED(&JTEST_TEST_STRUCT_NAME(test_fn)))    \
+        if (JTEST_TEST_IS_ENABLED(&JTEST_TEST_STRUCT_NAME(test_fn)) &&  \
+            JTEST_TEST_IS_SELECTED())                                   \
         {                                                               \
             /* Default to failure */                                    \
             JTEST_TEST_RET_t __jtest_test_ret = JTEST_TEST_FAILED;      \
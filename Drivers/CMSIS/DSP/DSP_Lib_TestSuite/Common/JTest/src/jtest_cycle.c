@@ -7,3 +7,8 @@
 
 /* const char * JTEST_CYCLE_STRF = "Running: %s\nCycles: %" PRIu32 "\n"; */
 const char * JTEST_CYCLE_STRF = "Cycles: %" PRIu32 "\n"; /* function name + parameter string skipped */
+
+#if defined(JTEST_HOST)
+/* Native host : the counter is selected by jtest_host_init() */
+const char * JTEST_HOST_CYCLE_STRF = "Cycles: %" PRIu64 "\nTime: %" PRIu64 " ns\n";
+#endif
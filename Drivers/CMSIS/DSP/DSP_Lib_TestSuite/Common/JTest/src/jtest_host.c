@@ -0,0 +1,396 @@
+#if defined(JTEST_HOST)
+
+#include "../inc/jtest_host.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define JTEST_HOST_JOBS_SUPPORTED
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Define Module Variables */
+/*--------------------------------------------------------------------------------*/
+
+typedef enum
+{
+    JTEST_HOST_COUNTER_NS = 0,
+    JTEST_HOST_COUNTER_TSC,
+    JTEST_HOST_COUNTER_PERF
+} JTEST_HOST_COUNTER_t;
+
+static JTEST_HOST_COUNTER_t jtest_host_counter = JTEST_HOST_COUNTER_NS;
+static int                  jtest_host_perf_fd = -1;
+
+static uint64_t jtest_host_start_cycles = 0;
+static uint64_t jtest_host_start_ns     = 0;
+
+/* Cost of a jtest_host_start()/jtest_host_stop() pair */
+static uint64_t jtest_host_overhead_cycles = 0;
+static uint64_t jtest_host_overhead_ns     = 0;
+
+/* Results of a job, shared with the parent process */
+typedef struct
+{
+    uint32_t passed;
+    uint32_t failed;
+    uint32_t done;
+} JTEST_HOST_JOB_RESULT_t;
+
+static uint32_t jtest_host_nb_jobs     = 1;
+static uint32_t jtest_host_job         = 0;
+static uint32_t jtest_host_test_index  = 0;
+static JTEST_HOST_JOB_RESULT_t * jtest_host_results = NULL;
+
+/*--------------------------------------------------------------------------------*/
+/* Counters */
+/*--------------------------------------------------------------------------------*/
+
+static uint64_t jtest_host_read_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000U + (uint64_t) ts.tv_nsec);
+}
+
+static uint64_t jtest_host_read_cycles(void)
+{
+#if defined(__linux__)
+    if (jtest_host_counter == JTEST_HOST_COUNTER_PERF)
+    {
+        uint64_t count = 0;
+
+        if (read(jtest_host_perf_fd, &count, sizeof(count)) != sizeof(count))
+        {
+            return 0;
+        }
+        return count;
+    }
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (jtest_host_counter == JTEST_HOST_COUNTER_TSC)
+    {
+        uint64_t count;
+
+        _mm_lfence();
+        count = __rdtsc();
+        _mm_lfence();
+        return count;
+    }
+#endif
+
+    return jtest_host_read_ns();
+}
+
+#if defined(__linux__)
+static int jtest_host_open_perf(void)
+{
+    struct perf_event_attr attr;
+    int fd;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_CPU_CYCLES;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    fd = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    return fd;
+}
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Functions */
+/*--------------------------------------------------------------------------------*/
+
+void jtest_host_init(void)
+{
+    uint64_t cycles;
+    uint64_t ns;
+    uint32_t i;
+
+#if defined(__x86_64__) || defined(__i386__)
+    jtest_host_counter = JTEST_HOST_COUNTER_TSC;
+#endif
+
+#if defined(__linux__)
+    jtest_host_perf_fd = jtest_host_open_perf();
+    if (jtest_host_perf_fd >= 0)
+    {
+        jtest_host_counter = JTEST_HOST_COUNTER_PERF;
+
+        /* Some virtual machines accept the event but never count */
+        jtest_host_start();
+        for (i = 0; i < 1000U; ++i)
+        {
+            jtest_host_read_ns();
+        }
+        jtest_host_stop(&cycles, &ns);
+
+        if (cycles == 0)
+        {
+            close(jtest_host_perf_fd);
+            jtest_host_perf_fd = -1;
+#if defined(__x86_64__) || defined(__i386__)
+            jtest_host_counter = JTEST_HOST_COUNTER_TSC;
+#else
+            jtest_host_counter = JTEST_HOST_COUNTER_NS;
+#endif
+        }
+    }
+#endif
+
+    /* Keep the smallest cost of an empty measurement */
+    jtest_host_overhead_cycles = 0;
+    jtest_host_overhead_ns     = 0;
+    jtest_host_start();
+    jtest_host_stop(&jtest_host_overhead_cycles, &jtest_host_overhead_ns);
+
+    for (i = 0; i < 1000U; ++i)
+    {
+        jtest_host_start();
+        jtest_host_stop(&cycles, &ns);
+
+        if (cycles < jtest_host_overhead_cycles)
+        {
+            jtest_host_overhead_cycles = cycles;
+        }
+        if (ns < jtest_host_overhead_ns)
+        {
+            jtest_host_overhead_ns = ns;
+        }
+    }
+}
+
+const char * jtest_host_counter_name(void)
+{
+    switch (jtest_host_counter)
+    {
+        case JTEST_HOST_COUNTER_PERF:
+            return "perf";
+        case JTEST_HOST_COUNTER_TSC:
+            return "tsc";
+        default:
+            return "ns";
+    }
+}
+
+void jtest_host_start(void)
+{
+    jtest_host_start_ns     = jtest_host_read_ns();
+    jtest_host_start_cycles = jtest_host_read_cycles();
+}
+
+void jtest_host_stop(uint64_t * cycles, uint64_t * ns)
+{
+    uint64_t stop_cycles = jtest_host_read_cycles();
+    uint64_t stop_ns     = jtest_host_read_ns();
+
+    *cycles = stop_cycles - jtest_host_start_cycles;
+    *ns     = stop_ns     - jtest_host_start_ns;
+
+    *cycles = (*cycles > jtest_host_overhead_cycles) ?
+        (*cycles - jtest_host_overhead_cycles) : 0;
+    *ns     = (*ns > jtest_host_overhead_ns) ?
+        (*ns - jtest_host_overhead_ns) : 0;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Jobs */
+/*--------------------------------------------------------------------------------*/
+
+static uint32_t jtest_host_parse_jobs(int argc, char ** argv)
+{
+    int nb = 1;
+    int i;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if ((strcmp(argv[i], "-j") == 0) && (i + 1 < argc))
+        {
+            nb = atoi(argv[++i]);
+        }
+        else if (strncmp(argv[i], "-j", 2) == 0)
+        {
+            nb = atoi(argv[i] + 2);
+        }
+    }
+
+#if defined(JTEST_HOST_JOBS_SUPPORTED)
+    /* -j 0 : one job per core */
+    if (nb == 0)
+    {
+        nb = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    }
+#endif
+
+    return (nb > 1) ? (uint32_t) nb : 1U;
+}
+
+void jtest_host_start_jobs(int argc, char ** argv)
+{
+    uint32_t nb = jtest_host_parse_jobs(argc, argv);
+
+#if defined(JTEST_HOST_JOBS_SUPPORTED)
+    FILE ** traces;
+    pid_t * pids;
+    uint32_t passed = 0;
+    uint32_t failed = 0;
+    uint32_t crashed = 0;
+    uint32_t j;
+    int c;
+
+    if (nb <= 1)
+    {
+        return;
+    }
+
+    jtest_host_results = mmap(NULL, nb * sizeof(JTEST_HOST_JOB_RESULT_t),
+                              PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS,
+                              -1, 0);
+    traces = malloc(nb * sizeof(FILE *));
+    pids   = malloc(nb * sizeof(pid_t));
+    if ((jtest_host_results == MAP_FAILED) || (traces == NULL) || (pids == NULL))
+    {
+        printf("Jobs: cannot be started, the tests are run serially\n");
+        jtest_host_results = NULL;
+        free(traces);
+        free(pids);
+        return;
+    }
+    memset(jtest_host_results, 0, nb * sizeof(JTEST_HOST_JOB_RESULT_t));
+
+    printf("Jobs: %" PRIu32 "\n", nb);
+    fflush(stdout);
+
+    for (j = 0; j < nb; ++j)
+    {
+        traces[j] = tmpfile();
+        pids[j] = (traces[j] != NULL) ? fork() : -1;
+
+        if (pids[j] == 0)
+        {
+            /* Job j : its trace is kept until all the jobs are finished */
+            jtest_host_nb_jobs = nb;
+            jtest_host_job     = j;
+            dup2(fileno(traces[j]), STDOUT_FILENO);
+
+            /* The perf event of the parent does not count this process */
+            if (jtest_host_perf_fd >= 0)
+            {
+                close(jtest_host_perf_fd);
+                jtest_host_perf_fd = -1;
+            }
+            jtest_host_init();
+            return;
+        }
+    }
+
+    for (j = 0; j < nb; ++j)
+    {
+        if (pids[j] > 0)
+        {
+            waitpid(pids[j], NULL, 0);
+        }
+    }
+
+    for (j = 0; j < nb; ++j)
+    {
+        if (traces[j] != NULL)
+        {
+            rewind(traces[j]);
+            while ((c = fgetc(traces[j])) != EOF)
+            {
+                putchar(c);
+            }
+            fclose(traces[j]);
+        }
+
+        if (jtest_host_results[j].done)
+        {
+            passed += jtest_host_results[j].passed;
+            failed += jtest_host_results[j].failed;
+        }
+        else
+        {
+            printf("Job %" PRIu32 " did not complete\n", j);
+            crashed++;
+        }
+    }
+
+    printf("All Jobs:\n"
+           "Tests Run: %" PRIu32 "\n"
+           "----------\n"
+           "   Passed: %" PRIu32 "\n"
+           "   Failed: %" PRIu32 "\n",
+           passed + failed, passed, failed);
+    fflush(stdout);
+
+    exit((crashed > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+#else
+    if (nb > 1)
+    {
+        printf("Jobs: not supported on this host, the tests are run serially\n");
+    }
+#endif
+}
+
+void jtest_host_end_job(uint32_t passed, uint32_t failed)
+{
+#if defined(JTEST_HOST_JOBS_SUPPORTED)
+    if (jtest_host_results == NULL)
+    {
+        return;
+    }
+
+    jtest_host_results[jtest_host_job].passed = passed;
+    jtest_host_results[jtest_host_job].failed = failed;
+    jtest_host_results[jtest_host_job].done   = 1;
+
+    fflush(stdout);
+    _exit(EXIT_SUCCESS);
+#else
+    (void) passed;
+    (void) failed;
+#endif
+}
+
+int jtest_host_test_selected(void)
+{
+    if (jtest_host_nb_jobs <= 1)
+    {
+        return 1;
+    }
+
+    return ((jtest_host_test_index++ % jtest_host_nb_jobs) == jtest_host_job);
+}
+
+#endif /* JTEST_HOST */
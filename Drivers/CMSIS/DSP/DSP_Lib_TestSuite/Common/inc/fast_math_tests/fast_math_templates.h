@@ -99,4 +99,135 @@
             return JTEST_TEST_PASSED;                                   \
         }
 
+/**
+ *  Test of a vector function against the reference function. The inputs are
+ *  fast_math_f32_inputs transformed by input_expr (a function of x).
+ *
+ *  The vector function is benchmarked against a loop of the scalar function
+ *  scalar_func. The block size is odd to also test the tail of the vector
+ *  versions.
+ */
+#define VEC_TEST_TEMPLATE_ELT1(func, scalar_func, input_expr)          \
+                                                                        \
+        JTEST_DEFINE_TEST(arm_v##func##_f32_test, arm_v##func##_f32)    \
+        {                                                               \
+            uint32_t i;                                                 \
+            const uint32_t block_size = FAST_MATH_MAX_LEN - 1;          \
+                                                                        \
+            for(i=0;i<block_size;i++)                                   \
+            {                                                           \
+                float32_t x = fast_math_f32_inputs[i];                  \
+                fast_math_f32_vec_inputs[i] = (input_expr);             \
+            }                                                           \
+                                                                        \
+            JTEST_DUMP_STRF("Block Size: %d\n", (int)block_size);       \
+                                                                        \
+            JTEST_DUMP_STRF("Implementation: %s\n", "vector");          \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_v##func##_f32(fast_math_f32_vec_inputs,             \
+                                  fast_math_output_fut,                 \
+                                  block_size));                         \
+                                                                        \
+            JTEST_DUMP_STRF("Implementation: %s\n", STR(scalar_func));  \
+            JTEST_COUNT_CYCLES(                                         \
+                for(i=0;i<block_size;i++)                               \
+                {                                                       \
+                    fast_math_output_ref[i] =                           \
+                        scalar_func(fast_math_f32_vec_inputs[i]);       \
+                });                                                     \
+                                                                        \
+            for(i=0;i<block_size;i++)                                   \
+            {                                                           \
+                fast_math_output_ref[i] =                               \
+                    ref_##func##_f32(fast_math_f32_vec_inputs[i]);      \
+            }                                                           \
+                                                                        \
+            FAST_MATH_SNR_COMPARE_INTERFACE(                            \
+                block_size,                                             \
+                float32_t);                                             \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+        }
+
+/**
+ *  Test of the absolute error of arm_vsin_f32 and arm_vcos_f32 against the
+ *  double precision function, which is the bound given by their documentation.
+ *
+ *  The inputs are fast_math_f32_inputs, values spread in [-65536 65536],
+ *  values rounded from multiples of pi/2 (close to the zeros of the function)
+ *  and values spread logarithmically up to 2^127 with alternating signs. The
+ *  result of the infinites and of NaN, in the vector body and in the tail, must
+ *  be NaN.
+ */
+#define FAST_MATH_VSINCOS_MAX_DELTA 1.5e-7
+
+#define VEC_SINCOS_ERROR_TEST_TEMPLATE_ELT1(func)                       \
+                                                                        \
+        JTEST_DEFINE_TEST(arm_v##func##_f32_error_test, arm_v##func##_f32) \
+        {                                                               \
+            uint32_t i;                                                 \
+            const uint32_t block_size = FAST_MATH_MAX_LEN - 1;          \
+            float32_t t;                                                \
+                                                                        \
+            for(i=0;i<block_size;i++)                                   \
+            {                                                           \
+                t = (float32_t) i / (float32_t) block_size;             \
+                switch (i & 3U)                                         \
+                {                                                       \
+                case 0:                                                 \
+                    fast_math_f32_vec_inputs[i] = fast_math_f32_inputs[i]; \
+                    break;                                              \
+                case 1:                                                 \
+                    fast_math_f32_vec_inputs[i] = 65536.0f * (2.0f * t - 1.0f); \
+                    break;                                              \
+                case 2:                                                 \
+                    fast_math_f32_vec_inputs[i] = (float32_t)           \
+                        ((double) ((i * 40503U) % 1000003U) * 1.5707963267948966); \
+                    break;                                              \
+                default:                                                \
+                    fast_math_f32_vec_inputs[i] =                       \
+                        powf(2.0f, -10.0f + 137.0f * t) * ((i & 4U) ? -1.0f : 1.0f); \
+                    break;                                              \
+                }                                                       \
+            }                                                           \
+                                                                        \
+            arm_v##func##_f32(fast_math_f32_vec_inputs,                 \
+                              fast_math_output_fut,                     \
+                              block_size);                              \
+                                                                        \
+            for(i=0;i<block_size;i++)                                   \
+            {                                                           \
+                double x = (double) fast_math_f32_vec_inputs[i];        \
+                double y = (double) fast_math_output_fut[i];            \
+                                                                        \
+                if (!(fabs(y - func(x)) <= FAST_MATH_VSINCOS_MAX_DELTA)) \
+                {                                                       \
+                    JTEST_DUMP_STRF("Error: x %g y %.9g expected %.9g\n", \
+                                    x, y, func(x));                     \
+                    return JTEST_TEST_FAILED;                           \
+                }                                                       \
+            }                                                           \
+                                                                        \
+            fast_math_f32_vec_inputs[5] = NAN;                          \
+            fast_math_f32_vec_inputs[6] = INFINITY;                     \
+            fast_math_f32_vec_inputs[7] = -INFINITY;                    \
+            fast_math_f32_vec_inputs[block_size - 1] = NAN;             \
+                                                                        \
+            arm_v##func##_f32(fast_math_f32_vec_inputs,                 \
+                              fast_math_output_fut,                     \
+                              block_size);                              \
+                                                                        \
+            if (!isnan(fast_math_output_fut[5]) ||                      \
+                !isnan(fast_math_output_fut[6]) ||                      \
+                !isnan(fast_math_output_fut[7]) ||                      \
+                !isnan(fast_math_output_fut[block_size - 1]))           \
+            {                                                           \
+                JTEST_DUMP_STRF("Error: %s\n",                          \
+                                "result of Inf or NaN is not NaN");     \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+        }
+
 #endif /* _FAST_MATH_TEMPLATES_H_ */
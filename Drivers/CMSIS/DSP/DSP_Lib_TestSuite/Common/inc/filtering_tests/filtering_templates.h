@@ -47,6 +47,38 @@
             );                                              \
     } while (0)                                              
 
+/**
+ *  Compare reference and fut outputs using SNR with a specific threshold.
+ */
+#define FILTERING_SNR_COMPARE_INTERFACE_THRESHOLD(block_size,  \
+                                                  output_type, \
+                                                  threshold)   \
+    do                                                         \
+    {                                                          \
+        TEST_CONVERT_AND_ASSERT_SNR(                           \
+            filtering_output_f32_ref,                          \
+            (output_type *) filtering_output_ref,              \
+            filtering_output_f32_fut,                          \
+            (output_type *) filtering_output_fut,              \
+            block_size,                                        \
+            output_type,                                       \
+            threshold                                          \
+            );                                                 \
+    } while (0)
+
+/**
+ *  Compare reference and fut outputs bit by bit.
+ *
+ *  @note Used for the fixed-point functions computing the same exact
+ *  accumulations as their reference: the vector versions must be bit exact.
+ */
+#define FILTERING_EXACT_COMPARE_INTERFACE(block_size,                   \
+                                          output_type)                  \
+    TEST_ASSERT_BUFFERS_EQUAL(                                          \
+        filtering_output_ref,                                           \
+        filtering_output_fut,                                           \
+        (block_size) * sizeof(output_type))
+
 /**
  *  Compare reference and fut outputs starting at some offset using SNR.
  *  Special case for float64_t
@@ -20,6 +20,16 @@
 #define FILTERING_MAX_TAP_DELAY	0xFF
 #define FILTERING_MAX_L				3
 #define FILTERING_MAX_M				33
+#define FILTERING_MULTI_NUMCHANNELS	5
+#define FILTERING_BIQUAD_BANK_NUMCHANNELS	13
+#define FILTERING_FIR_FFT_PARTLEN	16
+#define FILTERING_FIR_FFT_BLOCKSIZE	(2 * FILTERING_FIR_FFT_PARTLEN)
+#define FILTERING_FIR_FFT_LONG_NUMTAPS	300
+#define FILTERING_FIR_FFT_LONG_PARTLEN	64
+#define FILTERING_FIR_FFT_LONG_NUMPARTS	((FILTERING_FIR_FFT_LONG_NUMTAPS + FILTERING_FIR_FFT_LONG_PARTLEN - 1) / FILTERING_FIR_FFT_LONG_PARTLEN)
+#define FILTERING_FIR_FFT_LONG_BLOCKSIZE	(4 * FILTERING_FIR_FFT_LONG_PARTLEN)
+#define FILTERING_RESAMPLE_M		3
+#define FILTERING_RESAMPLE_BLOCKSIZE	24
 
 /*--------------------------------------------------------------------------------*/
 /* Declare Variables */
@@ -47,6 +57,7 @@ ARR_DESC_DECLARE(filtering_blocksizes);
 ARR_DESC_DECLARE(lms_blocksizes);
 ARR_DESC_DECLARE(filtering_numtaps);
 ARR_DESC_DECLARE(filtering_numtaps2);
+ARR_DESC_DECLARE(filtering_sparse_density_numtaps);
 ARR_DESC_DECLARE(filtering_postshifts);
 ARR_DESC_DECLARE(filtering_numstages);
 ARR_DESC_DECLARE(filtering_Ls);
@@ -7,6 +7,7 @@
 JTEST_DECLARE_GROUP(mat_add_tests);
 JTEST_DECLARE_GROUP(mat_cmplx_mult_tests);
 JTEST_DECLARE_GROUP(mat_init_tests);
+JTEST_DECLARE_GROUP(mat_decomposition_tests);
 JTEST_DECLARE_GROUP(mat_inverse_tests);
 JTEST_DECLARE_GROUP(mat_mult_tests);
 JTEST_DECLARE_GROUP(mat_mult_fast_tests);
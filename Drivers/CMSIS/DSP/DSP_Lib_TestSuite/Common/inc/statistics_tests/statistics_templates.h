@@ -58,6 +58,57 @@
 
 
 
+/*
+ * Result structures of the arm_stats_xxx functions.
+ */
+#define STATISTICS_STATS_RESULT_float32_t arm_stats_result_f32
+#define STATISTICS_STATS_RESULT_q31_t arm_stats_result_q31
+#define STATISTICS_STATS_RESULT_q15_t arm_stats_result_q15
+
+/**
+ *  Compare the SNR of one of the fields of the stats_ref and stats_fut
+ *  statistics of #STATISTICS_STATS_COMPARE().
+ */
+#define STATISTICS_STATS_FIELD_SNR_COMPARE(field, output_type, threshold) \
+    TEST_CONVERT_AND_ASSERT_SNR(                                    \
+        statistics_output_f32_ref,                                  \
+        &stats_ref->field,                                          \
+        statistics_output_f32_fut,                                  \
+        &stats_fut->field,                                          \
+        1,                                                          \
+        output_type,                                                \
+        threshold)
+
+/**
+ *  Compare the statistics returned by arm_stats_xxx and ref_stats_xxx.
+ *
+ *  The minimum and maximum values and their indexes must be equal.  The mean,
+ *  variance and RMS values are compared using SNR.
+ */
+#define STATISTICS_STATS_COMPARE(output_type, threshold)                \
+    do                                                                  \
+    {                                                                   \
+        STATISTICS_STATS_RESULT_##output_type * stats_ref =             \
+            (STATISTICS_STATS_RESULT_##output_type *)                   \
+            statistics_output_ref.data_ptr;                             \
+        STATISTICS_STATS_RESULT_##output_type * stats_fut =             \
+            (STATISTICS_STATS_RESULT_##output_type *)                   \
+            statistics_output_fut.data_ptr;                             \
+                                                                        \
+        TEST_ASSERT_EQUAL(stats_fut->min, stats_ref->min);              \
+        TEST_ASSERT_EQUAL(stats_fut->minIndex, stats_ref->minIndex);    \
+        TEST_ASSERT_EQUAL(stats_fut->max, stats_ref->max);              \
+        TEST_ASSERT_EQUAL(stats_fut->maxIndex, stats_ref->maxIndex);    \
+        STATISTICS_STATS_FIELD_SNR_COMPARE(mean, output_type, threshold); \
+        STATISTICS_STATS_FIELD_SNR_COMPARE(var, output_type, threshold); \
+        STATISTICS_STATS_FIELD_SNR_COMPARE(rms, output_type, threshold); \
+    } while (0)
+
+#define STATISTICS_STATS_COMPARE_INTERFACE(block_size,                  \
+                                           output_type)                 \
+    STATISTICS_STATS_COMPARE(output_type,                               \
+                             STATISTICS_SNR_THRESHOLD_##output_type)
+
 /*--------------------------------------------------------------------------------*/
 /* Input Interfaces */
 /*--------------------------------------------------------------------------------*/
@@ -110,6 +161,12 @@
 #define REF_rms_INPUT_INTERFACE(input, block_size)              \
     PAREN(input, block_size, statistics_output_ref.data_ptr)
 
+#define ARM_stats_INPUT_INTERFACE(input, block_size)            \
+    PAREN(input, block_size, statistics_output_fut.data_ptr)
+
+#define REF_stats_INPUT_INTERFACE(input, block_size)            \
+    PAREN(input, block_size, statistics_output_ref.data_ptr)
+
 #define ARM_std_INPUT_INTERFACE(input, block_size)              \
     PAREN(input, block_size, statistics_output_fut.data_ptr)
 
@@ -40,5 +40,6 @@ ARR_DESC_DECLARE(statistics_f_2);
 ARR_DESC_DECLARE(statistics_f_15);
 ARR_DESC_DECLARE(statistics_f_32);
 ARR_DESC_DECLARE(statistics_f_all);
+ARR_DESC_DECLARE(statistics_f_offset_all);
 
 #endif /* _STATISTICS_TEST_DATA_H_ */
@@ -38,11 +38,19 @@ ARR_DESC_DECLARE(transform_radix2_fftlens);
 ARR_DESC_DECLARE(transform_radix4_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fast_fftlens);
+ARR_DESC_DECLARE(transform_stft_fftlens);
+ARR_DESC_DECLARE(transform_stft_hopdivs);
+ARR_DESC_DECLARE(transform_mfcc_fftlens);
+ARR_DESC_DECLARE(transform_goertzel_blocksizes);
+ARR_DESC_DECLARE(transform_goertzel_numbins);
+ARR_DESC_DECLARE(transform_sdft_windowlens);
 ARR_DESC_DECLARE(transform_dct_fftlens);
 
 /* CFFT Structs */
 ARR_DESC_DECLARE(transform_cfft_f32_structs);
 ARR_DESC_DECLARE(transform_cfft_q31_structs);
+ARR_DESC_DECLARE(transform_cfft_ram_f32_structs);
+ARR_DESC_DECLARE(transform_cfft_ram_q31_structs);
 ARR_DESC_DECLARE(transform_cfft_q15_structs);
 
 #endif /* _TRANSFORM_TEST_DATA_H_ */
@@ -7,17 +7,19 @@
 #include "complex_math_templates.h"
 #include "type_abbrev.h"
 
-#define JTEST_ARM_CMPLX_MAG_SQUARED_TEST(suffix)    \
+#define JTEST_ARM_CMPLX_MAG_SQUARED_TEST(suffix, comparison_interface) \
     COMPLEX_MATH_DEFINE_TEST_TEMPLATE_BUF1_BLK(     \
         cmplx_mag_squared,                          \
         suffix,                                     \
         TYPE_FROM_ABBREV(suffix),                   \
         TYPE_FROM_ABBREV(suffix),                   \
-        COMPLEX_MATH_COMPARE_RE_INTERFACE)
+        comparison_interface)
 
-JTEST_ARM_CMPLX_MAG_SQUARED_TEST(f32);
-JTEST_ARM_CMPLX_MAG_SQUARED_TEST(q31);
-JTEST_ARM_CMPLX_MAG_SQUARED_TEST(q15);
+/* The vector versions of arm_cmplx_mag_squared_f32 are not rounding like the
+   reference when the compiler fuses its multiply-adds */
+JTEST_ARM_CMPLX_MAG_SQUARED_TEST(f32, COMPLEX_MATH_SNR_COMPARE_RE_INTERFACE);
+JTEST_ARM_CMPLX_MAG_SQUARED_TEST(q31, COMPLEX_MATH_COMPARE_RE_INTERFACE);
+JTEST_ARM_CMPLX_MAG_SQUARED_TEST(q15, COMPLEX_MATH_COMPARE_RE_INTERFACE);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -15,7 +15,9 @@
         TYPE_FROM_ABBREV(suffix),                               \
         comparison_interface)
 
-JTEST_ARM_CMPLX_MAG_TEST(f32, COMPLEX_MATH_COMPARE_RE_INTERFACE);
+/* The vector versions of arm_cmplx_mag_f32 are not rounding like the reference
+   when the compiler fuses its multiply-adds */
+JTEST_ARM_CMPLX_MAG_TEST(f32, COMPLEX_MATH_SNR_COMPARE_RE_INTERFACE);
 JTEST_ARM_CMPLX_MAG_TEST(q31, COMPLEX_MATH_SNR_COMPARE_RE_INTERFACE);
 JTEST_ARM_CMPLX_MAG_TEST(q15, COMPLEX_MATH_SNR_COMPARE_RE_INTERFACE);
 
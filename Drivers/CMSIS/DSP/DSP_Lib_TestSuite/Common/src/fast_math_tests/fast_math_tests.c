@@ -16,6 +16,14 @@ SIN_COS_TEST_TEMPLATE_ELT1(f32, float32_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q31, q31_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q15, q15_t, cos);
 
+VEC_TEST_TEMPLATE_ELT1(sin, arm_sin_f32, x);
+VEC_TEST_TEMPLATE_ELT1(cos, arm_cos_f32, x);
+VEC_TEST_TEMPLATE_ELT1(exp, expf, x);
+VEC_TEST_TEMPLATE_ELT1(log, logf, expf(x));
+
+VEC_SINCOS_ERROR_TEST_TEMPLATE_ELT1(sin);
+VEC_SINCOS_ERROR_TEST_TEMPLATE_ELT1(cos);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -35,4 +43,11 @@ JTEST_DEFINE_GROUP(fast_math_tests)
     JTEST_TEST_CALL(arm_cos_f32_test);
     JTEST_TEST_CALL(arm_cos_q31_test);
     JTEST_TEST_CALL(arm_cos_q15_test);
+
+    JTEST_TEST_CALL(arm_vsin_f32_test);
+    JTEST_TEST_CALL(arm_vcos_f32_test);
+    JTEST_TEST_CALL(arm_vsin_f32_error_test);
+    JTEST_TEST_CALL(arm_vcos_f32_error_test);
+    JTEST_TEST_CALL(arm_vexp_f32_test);
+    JTEST_TEST_CALL(arm_vlog_f32_test);
 }
@@ -7,7 +7,58 @@
 #include "filtering_templates.h"
 #include "type_abbrev.h"
 
-#define BIQUAD_DEFINE_TEST(suffix, instance_name, config_suffix, output_type)    \
+/**
+ *  Initialize the instance of the function under test.
+ *
+ *  The vector versions of arm_biquad_cascade_df2T_f32 are using a bigger
+ *  coefficient array computed by arm_biquad_cascade_df2T_compute_coefs_f32().
+ */
+#define BIQUAD_FUT_INIT(suffix, config_suffix, inst_ptr, numStages)              \
+   BIQUAD_##config_suffix##_##suffix##_FUT_INIT(inst_ptr, numStages)
+
+#define BIQUAD_df1_f32_FUT_INIT(inst_ptr, numStages)                             \
+   arm_biquad_cascade_df1_init_f32(                                              \
+         inst_ptr, numStages,                                                    \
+         (float32_t*)filtering_coeffs_b_f32,                                     \
+         (void *) filtering_pState)
+
+#define BIQUAD_stereo_df2T_f32_FUT_INIT(inst_ptr, numStages)                     \
+   arm_biquad_cascade_stereo_df2T_init_f32(                                      \
+         inst_ptr, numStages,                                                    \
+         (float32_t*)filtering_coeffs_b_f32,                                     \
+         (void *) filtering_pState)
+
+#if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD)
+static float32_t biquad_df2T_coeffs_f32[8 * FILTERING_MAX_NUMSTAGES];
+
+/* 4 stages are computed at once with products of their coefficients : the
+   rounding errors are bigger than with the scalar version */
+#define BIQUAD_DF2T_SNR_COMPARE_INTERFACE(block_size, output_type)               \
+   FILTERING_SNR_COMPARE_INTERFACE_THRESHOLD(block_size, output_type, 95)
+
+#define BIQUAD_df2T_f32_FUT_INIT(inst_ptr, numStages)                            \
+   do                                                                            \
+   {                                                                             \
+      arm_biquad_cascade_df2T_init_f32(                                          \
+            inst_ptr, numStages,                                                 \
+            biquad_df2T_coeffs_f32,                                              \
+            (void *) filtering_pState);                                          \
+      arm_biquad_cascade_df2T_compute_coefs_f32(                                 \
+            inst_ptr, numStages,                                                 \
+            (float32_t*)filtering_coeffs_b_f32);                                 \
+   } while (0)
+#else
+#define BIQUAD_df2T_f32_FUT_INIT(inst_ptr, numStages)                            \
+   arm_biquad_cascade_df2T_init_f32(                                             \
+         inst_ptr, numStages,                                                    \
+         (float32_t*)filtering_coeffs_b_f32,                                     \
+         (void *) filtering_pState)
+
+#define BIQUAD_DF2T_SNR_COMPARE_INTERFACE FILTERING_SNR_COMPARE_INTERFACE
+#endif
+
+#define BIQUAD_DEFINE_TEST(suffix, instance_name, config_suffix, output_type,    \
+                           compare_interface)                                    \
    JTEST_DEFINE_TEST(arm_biquad_cascade_##config_suffix##_##suffix##_test,       \
          arm_biquad_cascade_##config_suffix##_##suffix)                          \
    {                                                                             \
@@ -21,10 +72,8 @@
                numstages_idx, uint16_t, numStages, filtering_numstages           \
                ,                                                                 \
                /* Initialize the BIQUAD Instances */                             \
-               arm_biquad_cascade_##config_suffix##_init_##suffix(               \
-                     &biquad_inst_fut, numStages,                                \
-                     (output_type*)filtering_coeffs_b_##suffix,                  \
-                     (void *) filtering_pState);                                 \
+               BIQUAD_FUT_INIT(suffix, config_suffix,                            \
+                               &biquad_inst_fut, numStages);                     \
                                                                                  \
                /* Display test parameter values */                               \
                JTEST_DUMP_STRF("Block Size: %d\n"                                \
@@ -50,14 +99,15 @@
                      (void *) filtering_output_ref,                              \
                      blockSize);                                                 \
                                                                                  \
-               FILTERING_SNR_COMPARE_INTERFACE(                                  \
+               compare_interface(                                                \
                      blockSize,                                                  \
                      output_type)));                                             \
                                                                                  \
             return JTEST_TEST_PASSED;                                            \
    }
 
-#define BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(suffix, config_suffix, speed, output_type)   \
+#define BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(suffix, config_suffix, speed, output_type,   \
+                                          compare_interface)                           \
    JTEST_DEFINE_TEST(arm_biquad_cascade_##config_suffix##speed##_##suffix##_test,      \
          arm_biquad_cascade_##config_suffix##speed##_##suffix)                         \
    {                                                                                   \
@@ -105,7 +155,7 @@
                         (void *) filtering_output_ref,                                 \
                         blockSize);                                                    \
                                                                                        \
-                  FILTERING_SNR_COMPARE_INTERFACE(                                     \
+                  compare_interface(                                                   \
                         blockSize,                                                     \
                         output_type))));                                               \
                                                                                        \
@@ -215,13 +265,104 @@ JTEST_DEFINE_TEST(arm_biquad_cascade_df2T_f64_test,
 }
 
 
-BIQUAD_DEFINE_TEST(f32,arm_biquad_casd_df1_inst_f32, df1,float32_t);
-BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_df2T_instance_f32,df2T,float32_t);
-BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_stereo_df2T_instance_f32,stereo_df2T,float32_t);
-BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,,q31_t);
-BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,,q15_t);
-BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,_fast,q31_t);
-BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,_fast,q15_t);
+/**
+ *  The channels of the bank are filtered with the coefficients of
+ *  filtering_coeffs_b_f32, the feedforward coefficients being scaled by a
+ *  gain depending on the channel and on the stage.
+ */
+static float32_t biquad_bank_coeffs_f32[5 * FILTERING_MAX_NUMSTAGES * FILTERING_BIQUAD_BANK_NUMCHANNELS];
+static float32_t biquad_bank_tcoeffs_f32[5 * FILTERING_MAX_NUMSTAGES * FILTERING_BIQUAD_BANK_NUMCHANNELS];
+
+static void biquad_bank_make_coeffs_f32(uint16_t numStages)
+{
+   float32_t *pCoeffs = biquad_bank_coeffs_f32;
+   float32_t gain;
+   uint32_t ch, stage, k;
+
+   for (ch = 0; ch < FILTERING_BIQUAD_BANK_NUMCHANNELS; ch++)
+   {
+      for (stage = 0; stage < numStages; stage++)
+      {
+         gain = 1.0f - 0.125f * (float32_t)((ch + stage) % 4);
+
+         for (k = 0; k < 5; k++)
+         {
+            *pCoeffs = filtering_coeffs_b_f32[5 * stage + k];
+            if (k < 3)
+            {
+               *pCoeffs *= gain;
+            }
+            pCoeffs++;
+         }
+      }
+   }
+
+   arm_biquad_bank_df2T_compute_coefs_f32(
+         FILTERING_BIQUAD_BANK_NUMCHANNELS, numStages,
+         biquad_bank_coeffs_f32, biquad_bank_tcoeffs_f32);
+}
+
+JTEST_DEFINE_TEST(arm_biquad_bank_df2T_f32_test,
+     arm_biquad_bank_df2T_f32)
+{
+  arm_biquad_bank_df2T_instance_f32 biquad_inst_fut = { 0 };
+  arm_biquad_bank_df2T_instance_f32 biquad_inst_ref = { 0 };
+
+  TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+     TEMPLATE_DO_ARR_DESC(
+           numstages_idx, uint16_t, numStages, filtering_numstages
+           ,
+           /* Display test parameter values */
+           JTEST_DUMP_STRF("Block Size: %d\n"
+                           "Number of Stages: %d\n"
+                           "Number of Channels: %d\n",
+                           (int)blockSize,
+                           (int)numStages,
+                           (int)FILTERING_BIQUAD_BANK_NUMCHANNELS);
+
+           /* Initialize the BIQUAD Instances */
+           biquad_bank_make_coeffs_f32(numStages);
+
+           arm_biquad_bank_df2T_init_f32(
+                 &biquad_inst_fut, FILTERING_BIQUAD_BANK_NUMCHANNELS, numStages,
+                 biquad_bank_tcoeffs_f32,
+                 (void *) filtering_pState);
+
+           JTEST_COUNT_CYCLES(
+                 arm_biquad_bank_df2T_f32(
+                       &biquad_inst_fut,
+                       (void *) filtering_f32_inputs,
+                       (void *) filtering_output_fut,
+                       blockSize));
+
+           arm_biquad_bank_df2T_init_f32(
+                 &biquad_inst_ref, FILTERING_BIQUAD_BANK_NUMCHANNELS, numStages,
+                 biquad_bank_tcoeffs_f32,
+                 (void *) filtering_pState);
+
+           ref_biquad_bank_df2T_f32(
+                 &biquad_inst_ref,
+                 (void *) filtering_f32_inputs,
+                 (void *) filtering_output_ref,
+                 blockSize);
+
+           FILTERING_SNR_COMPARE_INTERFACE(
+                 blockSize * FILTERING_BIQUAD_BANK_NUMCHANNELS,
+                 float32_t)));
+
+        return JTEST_TEST_PASSED;
+}
+
+
+BIQUAD_DEFINE_TEST(f32,arm_biquad_casd_df1_inst_f32, df1,float32_t,FILTERING_SNR_COMPARE_INTERFACE);
+BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_df2T_instance_f32,df2T,float32_t,BIQUAD_DF2T_SNR_COMPARE_INTERFACE);
+BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_stereo_df2T_instance_f32,stereo_df2T,float32_t,FILTERING_SNR_COMPARE_INTERFACE);
+BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,,q31_t,FILTERING_SNR_COMPARE_INTERFACE);
+BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,,q15_t,FILTERING_EXACT_COMPARE_INTERFACE);
+BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,_fast,q31_t,FILTERING_SNR_COMPARE_INTERFACE);
+BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,_fast,q15_t,FILTERING_SNR_COMPARE_INTERFACE);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -235,6 +376,7 @@ JTEST_DEFINE_GROUP(biquad_tests)
    JTEST_TEST_CALL(arm_biquad_cascade_df1_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_stereo_df2T_f32_test);
+   JTEST_TEST_CALL(arm_biquad_bank_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f64_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q31_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q15_test);
@@ -285,9 +285,10 @@ ARR_DESC_DEFINE(uint32_t,
 /* Convolution Tests */
 /*--------------------------------------------------------------------------------*/
 
-#define CONV_TEST_TEMPLATE(fut, fut_arg_interface,                            \
-                           ref, ref_arg_interface,                            \
-                           suffix, output_type)                               \
+#define CONV_TEST_TEMPLATE_COMPARE(fut, fut_arg_interface,                    \
+                                   ref, ref_arg_interface,                    \
+                                   suffix, output_type,                       \
+                                   compare_interface)                         \
     JTEST_DEFINE_TEST(fut##_tests, fut)                                       \
     {                                                                         \
         TEMPLATE_DO_ARR_DESC(                                                 \
@@ -315,7 +316,7 @@ ARR_DESC_DEFINE(uint32_t,
                     ref, ref_arg_interface(                                   \
                         input_a_ptr, conv_len_a, input_b_ptr, conv_len_b));   \
                                                                               \
-                FILTERING_SNR_COMPARE_INTERFACE(                              \
+                compare_interface(                                            \
                     conv_len_a + conv_len_b - 1,                              \
                     output_type)));                                           \
                                                                               \
@@ -323,6 +324,23 @@ ARR_DESC_DEFINE(uint32_t,
     }                                                                         \
                                                                               \
 
+#define CONV_TEST_TEMPLATE(fut, fut_arg_interface,                            \
+                           ref, ref_arg_interface,                            \
+                           suffix, output_type)                               \
+    CONV_TEST_TEMPLATE_COMPARE(fut, fut_arg_interface,                        \
+                               ref, ref_arg_interface,                        \
+                               suffix, output_type,                           \
+                               FILTERING_SNR_COMPARE_INTERFACE)
+
+/* For the functions which must be bit exact with their reference */
+#define CONV_EXACT_TEST_TEMPLATE(fut, fut_arg_interface,                      \
+                                 ref, ref_arg_interface,                      \
+                                 suffix, output_type)                         \
+    CONV_TEST_TEMPLATE_COMPARE(fut, fut_arg_interface,                        \
+                               ref, ref_arg_interface,                        \
+                               suffix, output_type,                           \
+                               FILTERING_EXACT_COMPARE_INTERFACE)
+
 #define CONV_PARTIAL_TEST_TEMPLATE(fut, fut_arg_interface,                    \
                                    ref, ref_arg_interface,                    \
                                    suffix, output_type)                       \
@@ -417,7 +435,7 @@ ARR_DESC_DEFINE(uint32_t,
 /* Tests on functions without partial outputs */
 CONV_DEFINE_TEST(conv          , f32, float32_t, CONV_TEST_TEMPLATE);
 CONV_DEFINE_TEST(conv          , q31, q31_t    , CONV_TEST_TEMPLATE);
-CONV_DEFINE_TEST(conv          , q15, q15_t    , CONV_TEST_TEMPLATE);
+CONV_DEFINE_TEST(conv          , q15, q15_t    , CONV_EXACT_TEST_TEMPLATE);
 CONV_DEFINE_TEST(conv          , q7 , q7_t     , CONV_TEST_TEMPLATE);
 CONV_DEFINE_TEST(conv_opt      , q15, q15_t    , CONV_TEST_TEMPLATE);
 CONV_DEFINE_TEST(conv_opt      , q7 , q7_t     , CONV_TEST_TEMPLATE);
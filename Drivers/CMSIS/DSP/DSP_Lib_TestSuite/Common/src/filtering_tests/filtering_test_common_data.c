@@ -566,6 +566,13 @@ ARR_DESC_DEFINE(uint16_t,
                 CURLY(
                       6, 12, 18, 24, 30));
 
+/* Number of nonzero taps of the 256 taps sparse filters */
+ARR_DESC_DEFINE(uint16_t,
+                filtering_sparse_density_numtaps,
+                6,
+                CURLY(
+                      8, 32, 64, 128, 192, 256));
+
 ARR_DESC_DEFINE(uint16_t,
                 filtering_numstages,
                 3,
@@ -7,7 +7,8 @@
 #include "filtering_templates.h"
 #include "type_abbrev.h"
 
-#define FIR_DEFINE_TEST(suffix, config_suffix, output_type)             \
+#define FIR_DEFINE_TEST(suffix, config_suffix, output_type,             \
+                        compare_interface)                              \
    JTEST_DEFINE_TEST(arm_fir##config_suffix##_##suffix##_test,          \
          arm_fir##config_suffix##_##suffix)                             \
    {                                                                    \
@@ -50,13 +51,217 @@
                      (void *) filtering_output_ref,                     \
                      blockSize);                                        \
                                                                         \
-               FILTERING_SNR_COMPARE_INTERFACE(                         \
+               compare_interface(                                       \
                      blockSize,                                         \
                      output_type)));                                    \
                                                                         \
             return JTEST_TEST_PASSED;                                   \
    }
 
+/**
+ *  The multi-channel FIR is compared with FILTERING_MULTI_NUMCHANNELS separate
+ *  calls to arm_fir (planar layout). The cycles of both are reported.
+ */
+#define FIR_MULTI_DEFINE_TEST(suffix, output_type, compare_interface)   \
+   JTEST_DEFINE_TEST(arm_fir_multi_##suffix##_test,                     \
+         arm_fir_multi_##suffix)                                        \
+   {                                                                    \
+      arm_fir_multi_instance_##suffix fir_inst_fut = { 0 };             \
+      arm_fir_instance_##suffix fir_inst_ref = { 0 };                   \
+      uint32_t ch;                                                      \
+                                                                        \
+      TEMPLATE_DO_ARR_DESC(                                             \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes    \
+            ,                                                           \
+         TEMPLATE_DO_ARR_DESC(                                          \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps        \
+               ,                                                        \
+               /* Initialize the FIR Instance */                        \
+               arm_fir_multi_init_##suffix(                             \
+                     &fir_inst_fut, FILTERING_MULTI_NUMCHANNELS,        \
+                     numTaps,                                           \
+                     (output_type*)filtering_coeffs_##suffix,           \
+                     (void *) filtering_pState, blockSize, 1);          \
+                                                                        \
+              /* Display test parameter values */                       \
+              JTEST_DUMP_STRF("Block Size: %d\n"                        \
+                              "Number of Taps: %d\n"                    \
+                              "Number of Channels: %d\n",               \
+                         (int)blockSize,                                \
+                         (int)numTaps,                                  \
+                         (int)FILTERING_MULTI_NUMCHANNELS);             \
+                                                                        \
+               JTEST_COUNT_CYCLES(                                      \
+                     arm_fir_multi_##suffix(                            \
+                           &fir_inst_fut,                               \
+                           (void *) filtering_##suffix##_inputs,        \
+                           (void *) filtering_output_fut,               \
+                           blockSize));                                 \
+                                                                        \
+               JTEST_COUNT_CYCLES(                                      \
+                  for (ch = 0; ch < FILTERING_MULTI_NUMCHANNELS; ch++)  \
+                  {                                                     \
+                     arm_fir_init_##suffix(                             \
+                           &fir_inst_ref, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,     \
+                           (void *) filtering_pState, blockSize);       \
+                                                                        \
+                     arm_fir_##suffix(                                  \
+                           &fir_inst_ref,                               \
+                           (output_type *) filtering_##suffix##_inputs  \
+                              + ch * blockSize,                         \
+                           (output_type *) filtering_output_ref         \
+                              + ch * blockSize,                         \
+                           blockSize);                                  \
+                  });                                                   \
+                                                                        \
+               compare_interface(                                       \
+                     blockSize * FILTERING_MULTI_NUMCHANNELS,           \
+                     output_type)));                                    \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+   }
+
+/**
+ *  The FFT based FIR is compared with arm_fir_f32. The block size is fixed
+ *  since it must be a multiple of the partition length.
+ */
+JTEST_DEFINE_TEST(arm_fir_fft_f32_test, arm_fir_fft_f32)
+{
+   arm_fir_fft_instance_f32 fir_inst_fut;
+   arm_fir_instance_f32 fir_inst_ref = { 0 };
+   uint32_t blockSize = FILTERING_FIR_FFT_BLOCKSIZE;
+
+   TEMPLATE_DO_ARR_DESC(
+         numtaps_idx, uint16_t, numTaps, filtering_numtaps
+         ,
+         /* Initialize the FIR Instance */
+         TEST_ASSERT_EQUAL(
+               arm_fir_fft_init_f32(
+                     &fir_inst_fut, numTaps,
+                     (float32_t *) filtering_coeffs_f32,
+                     filtering_scratch,
+                     (void *) filtering_pState,
+                     FILTERING_FIR_FFT_PARTLEN),
+               ARM_MATH_SUCCESS);
+
+         /* Display test parameter values */
+         JTEST_DUMP_STRF("Block Size: %d\n"
+                         "Number of Taps: %d\n"
+                         "Partition Length: %d\n",
+                         (int)blockSize,
+                         (int)numTaps,
+                         (int)FILTERING_FIR_FFT_PARTLEN);
+
+         JTEST_COUNT_CYCLES(
+               arm_fir_fft_f32(
+                     &fir_inst_fut,
+                     (void *) filtering_f32_inputs,
+                     (void *) filtering_output_fut,
+                     blockSize));
+
+         arm_fir_init_f32(
+               &fir_inst_ref, numTaps,
+               (float32_t *) filtering_coeffs_f32,
+               (void *) filtering_pState, blockSize);
+
+         ref_fir_f32(
+               &fir_inst_ref,
+               (void *) filtering_f32_inputs,
+               (void *) filtering_output_ref,
+               blockSize);
+
+         FILTERING_SNR_COMPARE_INTERFACE(
+               blockSize,
+               float32_t));
+
+   /* A partial partition is rejected and the output is not written */
+   filtering_output_fut[0] = 12345.0f;
+   if (arm_fir_fft_f32(&fir_inst_fut,
+                       (void *) filtering_f32_inputs,
+                       (void *) filtering_output_fut,
+                       blockSize + 1U) != ARM_MATH_ARGUMENT_ERROR
+       || filtering_output_fut[0] != 12345.0f)
+   {
+      JTEST_DUMP_STRF("Error: block size %d is not rejected\n",
+                      (int)(blockSize + 1U));
+      return JTEST_TEST_FAILED;
+   }
+
+   return JTEST_TEST_PASSED;
+}
+
+static float32_t filtering_fir_fft_long_coeffs_fft[2 * FILTERING_FIR_FFT_LONG_PARTLEN
+                                                   * FILTERING_FIR_FFT_LONG_NUMPARTS];
+static float32_t filtering_fir_fft_long_state[2 * FILTERING_FIR_FFT_LONG_PARTLEN
+                                              * (FILTERING_FIR_FFT_LONG_NUMPARTS + 3)];
+static float32_t filtering_fir_fft_long_fir_state[FILTERING_FIR_FFT_LONG_NUMTAPS
+                                                  + 2 * FILTERING_FIR_FFT_LONG_BLOCKSIZE - 1];
+
+/**
+ *  Long filter with several partitions, the last one partial. Two calls are
+ *  made so that the frequency delay line wraps around, the output is compared
+ *  with a single call to arm_fir_f32. The coefficients are taken from the
+ *  input array, after the input samples.
+ */
+JTEST_DEFINE_TEST(arm_fir_fft_f32_long_test, arm_fir_fft_f32)
+{
+   arm_fir_fft_instance_f32 fir_inst_fut;
+   arm_fir_instance_f32 fir_inst_ref = { 0 };
+   uint32_t blockSize = FILTERING_FIR_FFT_LONG_BLOCKSIZE;
+   const float32_t *pCoeffs = filtering_f32_inputs + 2 * blockSize;
+   arm_status status;
+
+   JTEST_DUMP_STRF("Block Size: %d\n"
+                   "Number of Taps: %d\n"
+                   "Partition Length: %d\n",
+                   (int)blockSize,
+                   (int)FILTERING_FIR_FFT_LONG_NUMTAPS,
+                   (int)FILTERING_FIR_FFT_LONG_PARTLEN);
+
+   TEST_ASSERT_EQUAL(
+         arm_fir_fft_init_f32(
+               &fir_inst_fut, FILTERING_FIR_FFT_LONG_NUMTAPS,
+               pCoeffs,
+               filtering_fir_fft_long_coeffs_fft,
+               filtering_fir_fft_long_state,
+               FILTERING_FIR_FFT_LONG_PARTLEN),
+         ARM_MATH_SUCCESS);
+
+   JTEST_COUNT_CYCLES(
+         status = arm_fir_fft_f32(
+               &fir_inst_fut,
+               filtering_f32_inputs,
+               filtering_output_fut,
+               blockSize));
+   TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);
+
+   status = arm_fir_fft_f32(
+         &fir_inst_fut,
+         filtering_f32_inputs + blockSize,
+         filtering_output_fut + blockSize,
+         blockSize);
+   TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);
+
+   arm_fir_init_f32(
+         &fir_inst_ref, FILTERING_FIR_FFT_LONG_NUMTAPS,
+         pCoeffs,
+         filtering_fir_fft_long_fir_state, 2 * blockSize);
+
+   JTEST_COUNT_CYCLES(
+         arm_fir_f32(
+               &fir_inst_ref,
+               filtering_f32_inputs,
+               filtering_output_ref,
+               2 * blockSize));
+
+   FILTERING_SNR_COMPARE_INTERFACE(
+         2 * blockSize,
+         float32_t);
+
+   return JTEST_TEST_PASSED;
+}
+
 #define FIR_INTERPOLATE_DEFINE_TEST(suffix, output_type)                      \
    JTEST_DEFINE_TEST(arm_fir_interpolate_##suffix##_test,                     \
          arm_fir_interpolate_##suffix)                                        \
@@ -170,6 +375,188 @@
             return JTEST_TEST_PASSED;                                      \
    }
 
+/**
+ *  The resampler is compared with the reference interpolator followed by the
+ *  selection of one sample every FILTERING_RESAMPLE_M. The cycles of the
+ *  arm_fir_interpolate + arm_fir_decimate chain are reported for comparison.
+ */
+#define RESAMPLE_DEFINE_TEST(suffix, output_type)                          \
+   JTEST_DEFINE_TEST(arm_resample_##suffix##_test,                         \
+         arm_resample_##suffix)                                            \
+   {                                                                       \
+      arm_resample_instance_##suffix fir_inst_fut = { 0 };                 \
+      arm_fir_interpolate_instance_##suffix fir_inst_ref = { 0 };          \
+      arm_fir_interpolate_instance_##suffix fir_inst_interp = { 0 };       \
+      arm_fir_decimate_instance_##suffix fir_inst_dec = { 0 };             \
+      uint32_t blockSize = FILTERING_RESAMPLE_BLOCKSIZE;                   \
+      uint32_t outCnt, i;                                                  \
+                                                                           \
+      TEMPLATE_DO_ARR_DESC(                                                \
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+            ,                                                              \
+         TEMPLATE_DO_ARR_DESC(                                             \
+               L_idx, uint8_t, L, filtering_Ls                             \
+               ,                                                           \
+               /* Display test parameter values */                         \
+               JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                               "Number of Taps: %d\n"                      \
+                               "Upsample Factor: %d\n"                     \
+                               "Downsample Factor: %d\n",                  \
+                               (int)blockSize,                             \
+                               (int)numTaps,                               \
+                               (int)L,                                     \
+                               (int)FILTERING_RESAMPLE_M);                 \
+                                                                           \
+               /* Initialize the resampler */                              \
+               arm_resample_init_##suffix(                                 \
+                     &fir_inst_fut, L, FILTERING_RESAMPLE_M, numTaps,      \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) filtering_pState, blockSize);                \
+                                                                           \
+               JTEST_COUNT_CYCLES(                                         \
+                     outCnt = arm_resample_##suffix(                       \
+                           &fir_inst_fut,                                  \
+                           (void *) filtering_##suffix##_inputs,           \
+                           (void *) filtering_output_fut,                  \
+                           blockSize));                                    \
+                                                                           \
+               if (outCnt != (L * blockSize) / FILTERING_RESAMPLE_M)       \
+               {                                                           \
+                  return JTEST_TEST_FAILED;                                \
+               }                                                           \
+                                                                           \
+               /* Same conversion with the interpolator and decimator */   \
+               arm_fir_interpolate_init_##suffix(                          \
+                     &fir_inst_interp, L, numTaps,                         \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) filtering_scratch, blockSize);               \
+                                                                           \
+               arm_fir_decimate_init_##suffix(                             \
+                     &fir_inst_dec, numTaps, FILTERING_RESAMPLE_M,         \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) filtering_pState, L * blockSize);            \
+                                                                           \
+               JTEST_COUNT_CYCLES(                                         \
+                  arm_fir_interpolate_##suffix(                            \
+                        &fir_inst_interp,                                  \
+                        (void *) filtering_##suffix##_inputs,              \
+                        (void *) filtering_output_f32_fut,                 \
+                        blockSize);                                        \
+                  arm_fir_decimate_##suffix(                               \
+                        &fir_inst_dec,                                     \
+                        (void *) filtering_output_f32_fut,                 \
+                        (void *) filtering_output_f32_ref,                 \
+                        L * blockSize));                                   \
+                                                                           \
+               /* Reference */                                             \
+               arm_fir_interpolate_init_##suffix(                          \
+                     &fir_inst_ref, L, numTaps,                            \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) filtering_scratch2, blockSize);              \
+                                                                           \
+               ref_fir_interpolate_##suffix(                               \
+                     &fir_inst_ref,                                        \
+                     (void *) filtering_##suffix##_inputs,                 \
+                     (void *) filtering_output_f32_ref,                    \
+                     blockSize);                                           \
+                                                                           \
+               for (i = 0; i < outCnt; i++)                                \
+               {                                                           \
+                  ((output_type *) filtering_output_ref)[i] =              \
+                     ((output_type *) filtering_output_f32_ref)            \
+                        [(i + 1) * FILTERING_RESAMPLE_M - 1];              \
+               }                                                           \
+                                                                           \
+               FILTERING_SNR_COMPARE_INTERFACE(                            \
+                     outCnt,                                               \
+                     output_type)));                                       \
+                                                                           \
+            return JTEST_TEST_PASSED;                                      \
+   }
+
+/**
+ *  Sizes of the successive calls of the streaming resampler test. None is a
+ *  multiple of FILTERING_RESAMPLE_M and their sum is
+ *  FILTERING_RESAMPLE_BLOCKSIZE.
+ */
+static const uint32_t filtering_resample_chunks[] = {7, 5, 1, 11};
+
+/**
+ *  The resampler run in several calls must give the same outputs as a single
+ *  call on the whole block, the position of the next output is carried from
+ *  call to call.
+ */
+#define RESAMPLE_MULTI_DEFINE_TEST(suffix, output_type)                    \
+   JTEST_DEFINE_TEST(arm_resample_##suffix##_multi_test,                   \
+         arm_resample_##suffix)                                            \
+   {                                                                       \
+      arm_resample_instance_##suffix fir_inst_fut = { 0 };                 \
+      arm_resample_instance_##suffix fir_inst_ref = { 0 };                 \
+      uint32_t blockSize = FILTERING_RESAMPLE_BLOCKSIZE;                   \
+      uint32_t outCnt, refCnt, inCnt, i;                                   \
+                                                                           \
+      TEMPLATE_DO_ARR_DESC(                                                \
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+            ,                                                              \
+         TEMPLATE_DO_ARR_DESC(                                             \
+               L_idx, uint8_t, L, filtering_Ls                             \
+               ,                                                           \
+               /* Display test parameter values */                         \
+               JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                               "Number of Taps: %d\n"                      \
+                               "Upsample Factor: %d\n"                     \
+                               "Downsample Factor: %d\n",                  \
+                               (int)blockSize,                             \
+                               (int)numTaps,                               \
+                               (int)L,                                     \
+                               (int)FILTERING_RESAMPLE_M);                 \
+                                                                           \
+               /* Single call on the whole block */                        \
+               arm_resample_init_##suffix(                                 \
+                     &fir_inst_ref, L, FILTERING_RESAMPLE_M, numTaps,      \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) filtering_scratch, blockSize);               \
+                                                                           \
+               refCnt = arm_resample_##suffix(                             \
+                     &fir_inst_ref,                                        \
+                     (void *) filtering_##suffix##_inputs,                 \
+                     (void *) filtering_output_ref,                        \
+                     blockSize);                                           \
+                                                                           \
+               /* Same block in several calls */                           \
+               arm_resample_init_##suffix(                                 \
+                     &fir_inst_fut, L, FILTERING_RESAMPLE_M, numTaps,      \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) filtering_pState, blockSize);                \
+                                                                           \
+               outCnt = 0;                                                 \
+               inCnt = 0;                                                  \
+               for (i = 0; i < sizeof(filtering_resample_chunks) /         \
+                       sizeof(filtering_resample_chunks[0]); i++)          \
+               {                                                           \
+                  outCnt += arm_resample_##suffix(                         \
+                        &fir_inst_fut,                                     \
+                        (output_type *) filtering_##suffix##_inputs        \
+                           + inCnt,                                        \
+                        (output_type *) filtering_output_fut + outCnt,     \
+                        filtering_resample_chunks[i]);                     \
+                  inCnt += filtering_resample_chunks[i];                   \
+               }                                                           \
+                                                                           \
+               if (inCnt != blockSize || outCnt != refCnt)                 \
+               {                                                           \
+                  JTEST_DUMP_STRF("Output Count: %d, expected %d\n",       \
+                                  (int)outCnt, (int)refCnt);               \
+                  return JTEST_TEST_FAILED;                                \
+               }                                                           \
+                                                                           \
+               FILTERING_EXACT_COMPARE_INTERFACE(                          \
+                     outCnt,                                               \
+                     output_type)));                                       \
+                                                                           \
+            return JTEST_TEST_PASSED;                                      \
+   }
+
 #define FIR_LATTICE_DEFINE_TEST(suffix, output_type)                       \
    JTEST_DEFINE_TEST(arm_fir_lattice_##suffix##_test,                      \
          arm_fir_lattice_##suffix)                                         \
@@ -339,12 +726,200 @@
             return JTEST_TEST_PASSED;                                   \
    }
 
-FIR_DEFINE_TEST(f32,,float32_t);
-FIR_DEFINE_TEST(q31,,q31_t);
-FIR_DEFINE_TEST(q15,,q15_t);
-FIR_DEFINE_TEST(q31,_fast,q31_t);
-FIR_DEFINE_TEST(q15,_fast,q15_t);
-FIR_DEFINE_TEST(q7,,q7_t);
+/**
+ *  The sparse FIR with runs of taps is fed in chunks of
+ *  FILTERING_SPARSE_RUNS_CHUNK samples with a maximum delay of
+ *  FILTERING_SPARSE_RUNS_MAX_DELAY (the largest delay of filtering_tap_delay),
+ *  so the samples are moved to the start of the state buffer during the test.
+ */
+#define FILTERING_SPARSE_RUNS_CHUNK      4
+#define FILTERING_SPARSE_RUNS_MAX_DELAY  0x21
+
+/**
+ *  The density test compares the cycles of the runs, sparse and dense
+ *  filters of FILTERING_SPARSE_DENSITY_LEN taps, with numTaps nonzero taps in
+ *  runs of FILTERING_SPARSE_DENSITY_RUN taps spread over the filter.
+ */
+#define FILTERING_SPARSE_DENSITY_LEN     256
+#define FILTERING_SPARSE_DENSITY_RUN     4
+#define FILTERING_SPARSE_DENSITY_BLOCK   32
+
+static float32_t fir_sparse_runs_state[2 * FILTERING_SPARSE_DENSITY_LEN + FILTERING_MAX_BLOCKSIZE];
+static float32_t fir_sparse_runs_coeffs[FILTERING_SPARSE_DENSITY_LEN];
+static uint16_t fir_sparse_runs[2 * FILTERING_SPARSE_DENSITY_LEN];
+static float32_t fir_sparse_density_coeffs[FILTERING_SPARSE_DENSITY_LEN];
+static float32_t fir_sparse_density_dense[FILTERING_SPARSE_DENSITY_LEN];
+static int32_t fir_sparse_density_delay[FILTERING_SPARSE_DENSITY_LEN];
+static float32_t fir_sparse_density_state[FILTERING_SPARSE_DENSITY_LEN + FILTERING_MAX_BLOCKSIZE];
+
+#define FIR_SPARSE_RUNS_DEFINE_TEST(suffix, output_type)                \
+   JTEST_DEFINE_TEST(arm_fir_sparse_runs_##suffix##_test,               \
+         arm_fir_sparse_runs_##suffix)                                  \
+   {                                                                    \
+      arm_fir_sparse_runs_instance_##suffix fir_inst_fut = { 0 };       \
+      uint32_t i, n;                                                    \
+                                                                        \
+      TEMPLATE_DO_ARR_DESC(                                             \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes    \
+            ,                                                           \
+         TEMPLATE_DO_ARR_DESC(                                          \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps        \
+               ,                                                        \
+               /* Display test parameter values */                      \
+               JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                               "Number of Taps: %d\n"                   \
+                               "Tap Delay: %d\n",                       \
+                               (int)blockSize,                          \
+                               (int)numTaps,                            \
+                               (int)FILTERING_SPARSE_RUNS_MAX_DELAY);   \
+                                                                        \
+               /* Initialize the FIR Instances */                       \
+               if (arm_fir_sparse_runs_init_##suffix(                   \
+                     &fir_inst_fut, numTaps,                            \
+                     (output_type*)filtering_coeffs_##suffix,           \
+                     filtering_tap_delay,                               \
+                     FILTERING_SPARSE_RUNS_MAX_DELAY,                   \
+                     (output_type*)fir_sparse_runs_coeffs,              \
+                     fir_sparse_runs,                                   \
+                     (output_type*)fir_sparse_runs_state,               \
+                     FILTERING_SPARSE_RUNS_CHUNK)                       \
+                   != ARM_MATH_SUCCESS)                                 \
+               {                                                        \
+                  return JTEST_TEST_FAILED;                             \
+               }                                                        \
+                                                                        \
+               JTEST_COUNT_CYCLES(                                      \
+                     for (i = 0; i < blockSize; i += n)                 \
+                     {                                                  \
+                        n = blockSize - i;                              \
+                        if (n > FILTERING_SPARSE_RUNS_CHUNK)            \
+                        {                                               \
+                           n = FILTERING_SPARSE_RUNS_CHUNK;             \
+                        }                                               \
+                        arm_fir_sparse_runs_##suffix(                   \
+                              &fir_inst_fut,                            \
+                              (output_type *) filtering_##suffix##_inputs + i, \
+                              (output_type *) filtering_output_fut + i, \
+                              n);                                       \
+                     });                                                \
+                                                                        \
+               ref_fir_sparse_runs_##suffix(                            \
+                     numTaps,                                           \
+                     (output_type*)filtering_coeffs_##suffix,           \
+                     filtering_tap_delay,                               \
+                     (output_type *) filtering_##suffix##_inputs,       \
+                     (output_type *) filtering_output_ref,              \
+                     blockSize);                                        \
+                                                                        \
+               FILTERING_SNR_COMPARE_INTERFACE(                         \
+                     blockSize,                                         \
+                     output_type)));                                    \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+   }
+
+/* Runs of FILTERING_SPARSE_DENSITY_RUN taps spread over the filter */
+static void fir_sparse_density_taps(uint16_t numTaps)
+{
+   uint32_t k, step = FILTERING_SPARSE_DENSITY_RUN * FILTERING_SPARSE_DENSITY_LEN / numTaps;
+
+   memset(fir_sparse_density_dense, 0, sizeof(fir_sparse_density_dense));
+
+   for (k = 0; k < numTaps; k++)
+   {
+      fir_sparse_density_delay[k] = (k / FILTERING_SPARSE_DENSITY_RUN) * step
+                                  + (k % FILTERING_SPARSE_DENSITY_RUN);
+      fir_sparse_density_coeffs[k] = (float32_t) sin(0.7 * k) / 16.0f;
+
+      /* arm_fir_f32 coefficients are in time reversed order */
+      fir_sparse_density_dense[FILTERING_SPARSE_DENSITY_LEN - 1 - fir_sparse_density_delay[k]] =
+         fir_sparse_density_coeffs[k];
+   }
+}
+
+JTEST_DEFINE_TEST(arm_fir_sparse_runs_f32_density_test,
+                  arm_fir_sparse_runs_f32)
+{
+   arm_fir_sparse_runs_instance_f32 fir_inst_fut = { 0 };
+   arm_fir_sparse_instance_f32 fir_inst_sparse = { 0 };
+   arm_fir_instance_f32 fir_inst_dense = { 0 };
+
+   TEMPLATE_DO_ARR_DESC(
+      numtaps_idx, uint16_t, numTaps, filtering_sparse_density_numtaps
+      ,
+      fir_sparse_density_taps(numTaps);
+
+      /* Display test parameter values */
+      JTEST_DUMP_STRF("Block Size: %d\n"
+                      "Number of Taps: %d\n"
+                      "Tap Delay: %d\n",
+                      (int)FILTERING_SPARSE_DENSITY_BLOCK,
+                      (int)numTaps,
+                      (int)(FILTERING_SPARSE_DENSITY_LEN - 1));
+
+      arm_fir_sparse_runs_init_f32(
+         &fir_inst_fut, numTaps, fir_sparse_density_coeffs,
+         fir_sparse_density_delay, FILTERING_SPARSE_DENSITY_LEN - 1,
+         fir_sparse_runs_coeffs, fir_sparse_runs, fir_sparse_runs_state,
+         FILTERING_SPARSE_DENSITY_BLOCK);
+
+      JTEST_DUMP_STRF("Filter: %s\n", "runs");
+      JTEST_COUNT_CYCLES(
+         arm_fir_sparse_runs_f32(
+            &fir_inst_fut,
+            (float32_t *) filtering_f32_inputs,
+            (float32_t *) filtering_output_fut,
+            FILTERING_SPARSE_DENSITY_BLOCK));
+
+      arm_fir_sparse_init_f32(
+         &fir_inst_sparse, numTaps, fir_sparse_density_coeffs,
+         fir_sparse_density_state, fir_sparse_density_delay,
+         FILTERING_SPARSE_DENSITY_LEN - 1, FILTERING_SPARSE_DENSITY_BLOCK);
+
+      JTEST_DUMP_STRF("Filter: %s\n", "sparse");
+      JTEST_COUNT_CYCLES(
+         arm_fir_sparse_f32(
+            &fir_inst_sparse,
+            (float32_t *) filtering_f32_inputs,
+            (float32_t *) filtering_output_ref,
+            (float32_t *) filtering_scratch,
+            FILTERING_SPARSE_DENSITY_BLOCK));
+
+      arm_fir_init_f32(
+         &fir_inst_dense, FILTERING_SPARSE_DENSITY_LEN,
+         fir_sparse_density_dense, fir_sparse_density_state,
+         FILTERING_SPARSE_DENSITY_BLOCK);
+
+      JTEST_DUMP_STRF("Filter: %s\n", "dense");
+      JTEST_COUNT_CYCLES(
+         arm_fir_f32(
+            &fir_inst_dense,
+            (float32_t *) filtering_f32_inputs,
+            (float32_t *) filtering_output_ref,
+            FILTERING_SPARSE_DENSITY_BLOCK));
+
+      ref_fir_sparse_runs_f32(
+         numTaps, fir_sparse_density_coeffs, fir_sparse_density_delay,
+         (float32_t *) filtering_f32_inputs,
+         (float32_t *) filtering_output_ref,
+         FILTERING_SPARSE_DENSITY_BLOCK);
+
+      FILTERING_SNR_COMPARE_INTERFACE(
+         FILTERING_SPARSE_DENSITY_BLOCK,
+         float32_t));
+
+   return JTEST_TEST_PASSED;
+}
+
+FIR_DEFINE_TEST(f32,,float32_t,FILTERING_SNR_COMPARE_INTERFACE);
+FIR_DEFINE_TEST(q31,,q31_t,FILTERING_EXACT_COMPARE_INTERFACE);
+FIR_DEFINE_TEST(q15,,q15_t,FILTERING_EXACT_COMPARE_INTERFACE);
+FIR_DEFINE_TEST(q31,_fast,q31_t,FILTERING_SNR_COMPARE_INTERFACE);
+FIR_DEFINE_TEST(q15,_fast,q15_t,FILTERING_SNR_COMPARE_INTERFACE);
+FIR_DEFINE_TEST(q7,,q7_t,FILTERING_SNR_COMPARE_INTERFACE);
+
+FIR_MULTI_DEFINE_TEST(f32,float32_t,FILTERING_SNR_COMPARE_INTERFACE);
+FIR_MULTI_DEFINE_TEST(q15,q15_t,FILTERING_EXACT_COMPARE_INTERFACE);
 
 FIR_LATTICE_DEFINE_TEST(f32,float32_t);
 FIR_LATTICE_DEFINE_TEST(q31,q31_t);
@@ -360,11 +935,21 @@ FIR_DECIMATE_DEFINE_TEST(q15,,q15_t);
 FIR_DECIMATE_DEFINE_TEST(q31,_fast,q31_t);
 FIR_DECIMATE_DEFINE_TEST(q15,_fast,q15_t);
 
+RESAMPLE_DEFINE_TEST(f32,float32_t);
+RESAMPLE_DEFINE_TEST(q15,q15_t);
+RESAMPLE_MULTI_DEFINE_TEST(f32,float32_t);
+RESAMPLE_MULTI_DEFINE_TEST(q15,q15_t);
+
 FIR_SPARSE_DEFINE_TEST(f32,float32_t);
 FIR_SPARSE_DEFINE_TEST(q31,q31_t);
 FIR_SPARSE2_DEFINE_TEST(q15,q15_t);
 FIR_SPARSE2_DEFINE_TEST(q7,q7_t);
 
+FIR_SPARSE_RUNS_DEFINE_TEST(f32,float32_t);
+FIR_SPARSE_RUNS_DEFINE_TEST(q31,q31_t);
+FIR_SPARSE_RUNS_DEFINE_TEST(q15,q15_t);
+FIR_SPARSE_RUNS_DEFINE_TEST(q7,q7_t);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -381,6 +966,12 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_fast_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_multi_f32_test);
+   JTEST_TEST_CALL(arm_fir_multi_q15_test);
+
+   JTEST_TEST_CALL(arm_fir_fft_f32_test);
+   JTEST_TEST_CALL(arm_fir_fft_f32_long_test);
+
    JTEST_TEST_CALL(arm_fir_lattice_f32_test);
    JTEST_TEST_CALL(arm_fir_lattice_q31_test);
    JTEST_TEST_CALL(arm_fir_lattice_q15_test);
@@ -395,8 +986,19 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_decimate_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_decimate_fast_q15_test);
 
+   JTEST_TEST_CALL(arm_resample_f32_test);
+   JTEST_TEST_CALL(arm_resample_q15_test);
+   JTEST_TEST_CALL(arm_resample_f32_multi_test);
+   JTEST_TEST_CALL(arm_resample_q15_multi_test);
+
    JTEST_TEST_CALL(arm_fir_sparse_f32_test);
    JTEST_TEST_CALL(arm_fir_sparse_q31_test);
    JTEST_TEST_CALL(arm_fir_sparse_q15_test);
    JTEST_TEST_CALL(arm_fir_sparse_q7_test);
+
+   JTEST_TEST_CALL(arm_fir_sparse_runs_f32_test);
+   JTEST_TEST_CALL(arm_fir_sparse_runs_q31_test);
+   JTEST_TEST_CALL(arm_fir_sparse_runs_q15_test);
+   JTEST_TEST_CALL(arm_fir_sparse_runs_q7_test);
+   JTEST_TEST_CALL(arm_fir_sparse_runs_f32_density_test);
 }
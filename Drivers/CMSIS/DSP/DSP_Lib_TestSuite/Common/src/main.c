@@ -14,7 +14,11 @@ void debug_init(void)
     *SHCSR_ptr |= 0x70000;             /* Enable  UsageFault, BusFault, and MemManage fault*/
 }
 
+#if defined(JTEST_HOST)
+int main(int argc, char ** argv)
+#else
 int main(void)
+#endif
 {
 #if !defined(FILEIO)
     debug_init();
@@ -22,9 +26,19 @@ int main(void)
 
     JTEST_INIT();               /* Initialize test framework. */
 
+#if defined(JTEST_HOST)
+    jtest_host_init();          /* Select the host cycle counter. */
+    JTEST_DUMP_STRF("Cycle Counter: %s\nRepeat: %d\n",
+                    jtest_host_counter_name(), JTEST_HOST_REPEAT);
+    jtest_host_start_jobs(argc, argv); /* Share the tests between "-j" jobs. */
+#endif
+
     JTEST_GROUP_CALL(all_tests); /* Run all tests. */
 
     JTEST_ACT_EXIT_FW();        /* Exit test framework.  */
+#if defined(JTEST_HOST)
+    jtest_host_end_job(JTEST_FW.passed, JTEST_FW.failed);
+#endif
 #if !defined(FILEIO)
     while (1);                   /* Never return. */
 #endif
@@ -0,0 +1,618 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Input/Output Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* The decompositions need inputs with a given structure (symmetric positive
+ * definite or triangular). They are built from the invertible inputs:
+ * a is the symmetric positive definite matrix M * M' + n * I, b is M and t is
+ * the transpose of the Cholesky factor of a. */
+static float32_t mat_decomposition_a_f32_data[MATRIX_TEST_MAX_ELTS];
+static float32_t mat_decomposition_b_f32_data[MATRIX_TEST_MAX_ELTS];
+static float32_t mat_decomposition_t_f32_data[MATRIX_TEST_MAX_ELTS];
+static float32_t mat_decomposition_u_fut_f32_data[MATRIX_TEST_MAX_ELTS];
+static float32_t mat_decomposition_u_ref_f32_data[MATRIX_TEST_MAX_ELTS];
+static float64_t mat_decomposition_a_f64_data[MATRIX_TEST_MAX_ELTS];
+static float64_t mat_decomposition_b_f64_data[MATRIX_TEST_MAX_ELTS];
+static float64_t mat_decomposition_t_f64_data[MATRIX_TEST_MAX_ELTS];
+static uint16_t mat_decomposition_p_fut[MATRIX_TEST_MAX_ROWS];
+static uint16_t mat_decomposition_p_ref[MATRIX_TEST_MAX_ROWS];
+
+static arm_matrix_instance_f32 mat_decomposition_a_f32 = {0, 0, mat_decomposition_a_f32_data};
+static arm_matrix_instance_f32 mat_decomposition_b_f32 = {0, 0, mat_decomposition_b_f32_data};
+static arm_matrix_instance_f32 mat_decomposition_t_f32 = {0, 0, mat_decomposition_t_f32_data};
+static arm_matrix_instance_f32 mat_decomposition_u_fut = {0, 0, mat_decomposition_u_fut_f32_data};
+static arm_matrix_instance_f32 mat_decomposition_u_ref = {0, 0, mat_decomposition_u_ref_f32_data};
+static arm_matrix_instance_f64 mat_decomposition_a_f64 = {0, 0, mat_decomposition_a_f64_data};
+static arm_matrix_instance_f64 mat_decomposition_b_f64 = {0, 0, mat_decomposition_b_f64_data};
+static arm_matrix_instance_f64 mat_decomposition_t_f64 = {0, 0, mat_decomposition_t_f64_data};
+
+/**
+ *  Build the inputs of the decomposition tests from an invertible matrix and
+ *  size the outputs.
+ */
+static void mat_decomposition_config(const arm_matrix_instance_f32 * mat_ptr)
+{
+    uint16_t n = mat_ptr->numRows;
+    uint32_t i, j, k;
+    float64_t sum;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            sum = (i == j) ? n : 0;
+            for (k = 0; k < n; k++)
+            {
+                sum += (float64_t)mat_ptr->pData[i*n + k] * mat_ptr->pData[j*n + k];
+            }
+            mat_decomposition_a_f32_data[i*n + j] = sum;
+            mat_decomposition_a_f64_data[i*n + j] = mat_decomposition_a_f32_data[i*n + j];
+            mat_decomposition_b_f32_data[i*n + j] = mat_ptr->pData[i*n + j];
+            mat_decomposition_b_f64_data[i*n + j] = mat_ptr->pData[i*n + j];
+        }
+    }
+
+    mat_decomposition_a_f32.numRows = mat_decomposition_a_f32.numCols = n;
+    mat_decomposition_b_f32.numRows = mat_decomposition_b_f32.numCols = n;
+    mat_decomposition_t_f32.numRows = mat_decomposition_t_f32.numCols = n;
+    mat_decomposition_u_fut.numRows = mat_decomposition_u_fut.numCols = n;
+    mat_decomposition_u_ref.numRows = mat_decomposition_u_ref.numCols = n;
+    mat_decomposition_a_f64.numRows = mat_decomposition_a_f64.numCols = n;
+    mat_decomposition_b_f64.numRows = mat_decomposition_b_f64.numCols = n;
+    mat_decomposition_t_f64.numRows = mat_decomposition_t_f64.numCols = n;
+
+    /* t is the upper triangular transpose of the Cholesky factor of a */
+    ref_mat_cholesky_f32(&mat_decomposition_a_f32, &matrix_output_ref);
+    ref_mat_cholesky_f64(&mat_decomposition_a_f64, &mat_decomposition_b_f64);
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            mat_decomposition_t_f32_data[i*n + j] = matrix_output_ref.pData[j*n + i];
+            mat_decomposition_t_f64_data[i*n + j] = mat_decomposition_b_f64_data[j*n + i];
+        }
+    }
+    for (i = 0; i < n * n; i++)
+    {
+        mat_decomposition_b_f64_data[i] = mat_ptr->pData[i];
+    }
+
+    MATRIX_TEST_CONFIG_SAMESIZE_OUTPUT(arm_matrix_instance_f32 *, mat_ptr);
+    matrix_output_fut64.numRows = matrix_output_fut64.numCols = n;
+    matrix_output_ref64.numRows = matrix_output_ref64.numCols = n;
+}
+
+/**
+ *  Negate a float64_t buffer, there is no arm_negate_f64.
+ */
+static void mat_decomposition_negate_f64(float64_t * pData, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        pData[i] = -pData[i];
+    }
+}
+
+/**
+ *  Compare float32_t outputs of the function under test and of the reference
+ *  function using SNR.
+ */
+#define MAT_DECOMPOSITION_SNR_COMPARE(ref_ptr, fut_ptr, block_size)     \
+    TEST_CONVERT_AND_ASSERT_SNR(                                        \
+        (float32_t *)matrix_output_f32_ref,                             \
+        ref_ptr,                                                        \
+        (float32_t *)matrix_output_f32_fut,                             \
+        fut_ptr,                                                        \
+        block_size,                                                     \
+        float32_t,                                                      \
+        MATRIX_SNR_THRESHOLD)
+
+/**
+ *  Run the body once for each square invertible input.
+ */
+#define MAT_DECOMPOSITION_TEST_TEMPLATE(body)                           \
+    TEMPLATE_DO_ARR_DESC(                                               \
+        mat_idx, arm_matrix_instance_f32 *, mat_ptr,                    \
+        matrix_f32_invertible_inputs                                    \
+        ,                                                               \
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",                   \
+                        (int)mat_ptr->numRows,                          \
+                        (int)mat_ptr->numCols);                         \
+                                                                        \
+        if (MATRIX_TEST_VALID_SQUARE_DIMENSIONS(arm_matrix_instance_f32 *, \
+                                                mat_ptr))               \
+        {                                                               \
+            uint32_t n = mat_ptr->numRows;                              \
+            arm_status status;                                          \
+                                                                        \
+            mat_decomposition_config(mat_ptr);                          \
+                                                                        \
+            body;                                                       \
+                                                                        \
+            if (status != ARM_MATH_SUCCESS)                             \
+            {                                                           \
+                JTEST_DUMP_STRF("Status: %d\n", (int)status);           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+        })
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_mat_cholesky_f32_test, arm_mat_cholesky_f32)
+{
+    MAT_DECOMPOSITION_TEST_TEMPLATE(
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_cholesky_f32(&mat_decomposition_a_f32,
+                                          &matrix_output_fut));
+        ref_mat_cholesky_f32(&mat_decomposition_a_f32, &matrix_output_ref);
+
+        MAT_DECOMPOSITION_SNR_COMPARE(matrix_output_ref.pData,
+                                      matrix_output_fut.pData,
+                                      n * n);
+
+        /* A matrix which is not positive definite must be rejected */
+        arm_negate_f32(mat_decomposition_a_f32_data,
+                       mat_decomposition_a_f32_data,
+                       n * n);
+        status = arm_mat_cholesky_f32(&mat_decomposition_a_f32,
+                                      &matrix_output_fut);
+        if (status != ARM_MATH_DECOMPOSITION_FAILURE)
+        {
+            JTEST_DUMP_STRF("Negative definite status: %d\n", (int)status);
+            return JTEST_TEST_FAILED;
+        }
+        status = ARM_MATH_SUCCESS;
+        );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_cholesky_f64_test, arm_mat_cholesky_f64)
+{
+    MAT_DECOMPOSITION_TEST_TEMPLATE(
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_cholesky_f64(&mat_decomposition_a_f64,
+                                          &matrix_output_fut64));
+        ref_mat_cholesky_f64(&mat_decomposition_a_f64, &matrix_output_ref64);
+
+        TEST_ASSERT_DBL_SNR(matrix_output_ref64.pData,
+                            matrix_output_fut64.pData,
+                            n * n,
+                            MATRIX_SNR_THRESHOLD);
+
+        /* A matrix which is not positive definite must be rejected */
+        mat_decomposition_negate_f64(mat_decomposition_a_f64_data, n * n);
+        status = arm_mat_cholesky_f64(&mat_decomposition_a_f64,
+                                      &matrix_output_fut64);
+        if (status != ARM_MATH_DECOMPOSITION_FAILURE)
+        {
+            JTEST_DUMP_STRF("Negative definite status: %d\n", (int)status);
+            return JTEST_TEST_FAILED;
+        }
+        status = ARM_MATH_SUCCESS;
+        );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_lu_f32_test, arm_mat_lu_f32)
+{
+    MAT_DECOMPOSITION_TEST_TEMPLATE(
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_lu_f32(&mat_decomposition_b_f32,
+                                    &matrix_output_fut,
+                                    &mat_decomposition_u_fut,
+                                    mat_decomposition_p_fut));
+        ref_mat_lu_f32(&mat_decomposition_b_f32,
+                       &matrix_output_ref,
+                       &mat_decomposition_u_ref,
+                       mat_decomposition_p_ref);
+
+        TEST_ASSERT_BUFFERS_EQUAL(mat_decomposition_p_ref,
+                                  mat_decomposition_p_fut,
+                                  n * sizeof(uint16_t));
+        MAT_DECOMPOSITION_SNR_COMPARE(matrix_output_ref.pData,
+                                      matrix_output_fut.pData,
+                                      n * n);
+        MAT_DECOMPOSITION_SNR_COMPARE(mat_decomposition_u_ref.pData,
+                                      mat_decomposition_u_fut.pData,
+                                      n * n);
+        );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_solve_lower_triangular_f32_test,
+                  arm_mat_solve_lower_triangular_f32)
+{
+    MAT_DECOMPOSITION_TEST_TEMPLATE(
+        ref_mat_trans_f32(&mat_decomposition_t_f32, &mat_decomposition_a_f32);
+
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_solve_lower_triangular_f32(&mat_decomposition_a_f32,
+                                                        &mat_decomposition_b_f32,
+                                                        &matrix_output_fut));
+        ref_mat_solve_lower_triangular_f32(&mat_decomposition_a_f32,
+                                           &mat_decomposition_b_f32,
+                                           &matrix_output_ref);
+
+        MAT_DECOMPOSITION_SNR_COMPARE(matrix_output_ref.pData,
+                                      matrix_output_fut.pData,
+                                      n * n);
+        );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_solve_lower_triangular_f64_test,
+                  arm_mat_solve_lower_triangular_f64)
+{
+    MAT_DECOMPOSITION_TEST_TEMPLATE(
+        ref_mat_cholesky_f64(&mat_decomposition_a_f64, &mat_decomposition_a_f64);
+
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_solve_lower_triangular_f64(&mat_decomposition_a_f64,
+                                                        &mat_decomposition_b_f64,
+                                                        &matrix_output_fut64));
+        ref_mat_solve_lower_triangular_f64(&mat_decomposition_a_f64,
+                                           &mat_decomposition_b_f64,
+                                           &matrix_output_ref64);
+
+        TEST_ASSERT_DBL_SNR(matrix_output_ref64.pData,
+                            matrix_output_fut64.pData,
+                            n * n,
+                            MATRIX_SNR_THRESHOLD);
+        );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_solve_upper_triangular_f32_test,
+                  arm_mat_solve_upper_triangular_f32)
+{
+    MAT_DECOMPOSITION_TEST_TEMPLATE(
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_solve_upper_triangular_f32(&mat_decomposition_t_f32,
+                                                        &mat_decomposition_b_f32,
+                                                        &matrix_output_fut));
+        ref_mat_solve_upper_triangular_f32(&mat_decomposition_t_f32,
+                                           &mat_decomposition_b_f32,
+                                           &matrix_output_ref);
+
+        MAT_DECOMPOSITION_SNR_COMPARE(matrix_output_ref.pData,
+                                      matrix_output_fut.pData,
+                                      n * n);
+        );
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mat_solve_upper_triangular_f64_test,
+                  arm_mat_solve_upper_triangular_f64)
+{
+    MAT_DECOMPOSITION_TEST_TEMPLATE(
+        JTEST_COUNT_CYCLES(
+            status = arm_mat_solve_upper_triangular_f64(&mat_decomposition_t_f64,
+                                                        &mat_decomposition_b_f64,
+                                                        &matrix_output_fut64));
+        ref_mat_solve_upper_triangular_f64(&mat_decomposition_t_f64,
+                                           &mat_decomposition_b_f64,
+                                           &matrix_output_ref64);
+
+        TEST_ASSERT_DBL_SNR(matrix_output_ref64.pData,
+                            matrix_output_fut64.pData,
+                            n * n,
+                            MATRIX_SNR_THRESHOLD);
+        );
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Larger Sizes */
+/*--------------------------------------------------------------------------------*/
+
+/* The inputs above are at most 4x4. Those sizes run the unrolled loops with
+ * all the remainders. The outputs are checked with their residuals. */
+static const uint16_t mat_decomposition_large_dims[] = {5, 9, 13, 23};
+
+#define MAT_DECOMPOSITION_LARGE_MAX_DIM 23
+#define MAT_DECOMPOSITION_LARGE_MAX_ELTS                                \
+    (MAT_DECOMPOSITION_LARGE_MAX_DIM * MAT_DECOMPOSITION_LARGE_MAX_DIM)
+
+/* Number of right hand sides of the triangular solves */
+#define MAT_DECOMPOSITION_LARGE_RHS 7
+
+/* SNR of the residuals, the products are accumulated in float64_t */
+#define MAT_DECOMPOSITION_RESIDUAL_SNR_THRESHOLD_f32 100
+#define MAT_DECOMPOSITION_RESIDUAL_SNR_THRESHOLD_f64 200
+
+#define MAT_DECOMPOSITION_ASSERT_SNR_f32 TEST_ASSERT_SNR
+#define MAT_DECOMPOSITION_ASSERT_SNR_f64 TEST_ASSERT_DBL_SNR
+
+/* m is a random matrix, a is m * m' + n * I, b holds the right hand sides, l
+ * and u are the outputs of the functions under test, ref the outputs of the
+ * reference functions and r the products of the residuals. */
+#define MAT_DECOMPOSITION_LARGE_BUFFERS(suffix)                                          \
+    static TYPE_FROM_ABBREV(suffix) mat_decomposition_large_m_##suffix[MAT_DECOMPOSITION_LARGE_MAX_ELTS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_decomposition_large_a_##suffix[MAT_DECOMPOSITION_LARGE_MAX_ELTS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_decomposition_large_b_##suffix[MAT_DECOMPOSITION_LARGE_MAX_ELTS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_decomposition_large_l_##suffix[MAT_DECOMPOSITION_LARGE_MAX_ELTS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_decomposition_large_u_##suffix[MAT_DECOMPOSITION_LARGE_MAX_ELTS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_decomposition_large_ref_##suffix[MAT_DECOMPOSITION_LARGE_MAX_ELTS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_decomposition_large_r_##suffix[MAT_DECOMPOSITION_LARGE_MAX_ELTS]
+
+MAT_DECOMPOSITION_LARGE_BUFFERS(f32);
+MAT_DECOMPOSITION_LARGE_BUFFERS(f64);
+
+static uint16_t mat_decomposition_large_p[MAT_DECOMPOSITION_LARGE_MAX_DIM];
+
+/**
+ *  Pseudo-random value in [-1 1).
+ */
+static float32_t mat_decomposition_rand(uint32_t * seed)
+{
+    *seed = (*seed * 1664525U) + 1013904223U;
+    return ((float32_t) (int32_t) *seed) / 2147483648.0f;
+}
+
+/**
+ *  Build the random inputs of size n. The float64_t inputs have the same
+ *  values as the float32_t inputs, except for a which is rounded in float32_t.
+ */
+static void mat_decomposition_large_config(uint16_t n, uint32_t * seed)
+{
+    uint32_t i, j, k;
+    float64_t sum;
+
+    for (i = 0; i < (uint32_t) n * n; i++)
+    {
+        mat_decomposition_large_m_f32[i] = mat_decomposition_rand(seed);
+        mat_decomposition_large_m_f64[i] = mat_decomposition_large_m_f32[i];
+    }
+    for (i = 0; i < (uint32_t) n * MAT_DECOMPOSITION_LARGE_RHS; i++)
+    {
+        mat_decomposition_large_b_f32[i] = mat_decomposition_rand(seed);
+        mat_decomposition_large_b_f64[i] = mat_decomposition_large_b_f32[i];
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            sum = (i == j) ? n : 0;
+            for (k = 0; k < n; k++)
+            {
+                sum += mat_decomposition_large_m_f64[i*n + k] * mat_decomposition_large_m_f64[j*n + k];
+            }
+            mat_decomposition_large_a_f32[i*n + j] = sum;
+            mat_decomposition_large_a_f64[i*n + j] = mat_decomposition_large_a_f32[i*n + j];
+        }
+    }
+}
+
+/**
+ *  Product of the (rows x inner) matrix a and of the (inner x cols) matrix b,
+ *  or of the transpose of the (cols x inner) matrix b, accumulated in
+ *  float64_t.
+ */
+#define MAT_DECOMPOSITION_DEFINE_MULT(suffix)                                  \
+    static void mat_decomposition_mult_##suffix(                               \
+        const TYPE_FROM_ABBREV(suffix) * pA,                                   \
+        const TYPE_FROM_ABBREV(suffix) * pB,                                   \
+        TYPE_FROM_ABBREV(suffix) * pDst,                                       \
+        uint32_t rows, uint32_t inner, uint32_t cols, uint8_t transposedB)     \
+    {                                                                          \
+        uint32_t i, j, k;                                                      \
+        float64_t sum;                                                         \
+                                                                               \
+        for (i = 0; i < rows; i++)                                             \
+        {                                                                      \
+            for (j = 0; j < cols; j++)                                         \
+            {                                                                  \
+                sum = 0;                                                       \
+                for (k = 0; k < inner; k++)                                    \
+                {                                                              \
+                    sum += (float64_t) pA[i*inner + k] *                       \
+                        (transposedB ? pB[j*inner + k] : pB[k*cols + j]);      \
+                }                                                              \
+                pDst[i*cols + j] = sum;                                        \
+            }                                                                  \
+        }                                                                      \
+    }
+
+MAT_DECOMPOSITION_DEFINE_MULT(f32)
+MAT_DECOMPOSITION_DEFINE_MULT(f64)
+
+/**
+ *  Run the body once for each size of mat_decomposition_large_dims. The
+ *  instances a, m, l, u, ref, b and x are n x n, except b and x which are
+ *  n x MAT_DECOMPOSITION_LARGE_RHS.
+ */
+#define MAT_DECOMPOSITION_LARGE_TEST_TEMPLATE(suffix, body)                    \
+    do                                                                         \
+    {                                                                          \
+        uint32_t seed = 1U;                                                    \
+        uint32_t d;                                                            \
+                                                                               \
+        for (d = 0; d < sizeof(mat_decomposition_large_dims) /                 \
+                 sizeof(mat_decomposition_large_dims[0]); d++)                 \
+        {                                                                      \
+            uint16_t n = mat_decomposition_large_dims[d];                      \
+            arm_matrix_instance_##suffix a = {n, n, mat_decomposition_large_a_##suffix}; \
+            arm_matrix_instance_##suffix m = {n, n, mat_decomposition_large_m_##suffix}; \
+            arm_matrix_instance_##suffix l = {n, n, mat_decomposition_large_l_##suffix}; \
+            arm_matrix_instance_##suffix u = {n, n, mat_decomposition_large_u_##suffix}; \
+            arm_matrix_instance_##suffix ref = {n, n, mat_decomposition_large_ref_##suffix}; \
+            arm_matrix_instance_##suffix b =                                   \
+                {n, MAT_DECOMPOSITION_LARGE_RHS, mat_decomposition_large_b_##suffix}; \
+            arm_matrix_instance_##suffix x =                                   \
+                {n, MAT_DECOMPOSITION_LARGE_RHS, mat_decomposition_large_r_##suffix}; \
+            arm_status status;                                                 \
+                                                                               \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);    \
+            mat_decomposition_large_config(n, &seed);                          \
+                                                                               \
+            body;                                                              \
+        }                                                                      \
+    } while (0)
+
+/**
+ *  Fail the test when the status is not the expected one.
+ */
+#define MAT_DECOMPOSITION_ASSERT_STATUS(status, expected)               \
+    do                                                                  \
+    {                                                                   \
+        if ((status) != (expected))                                     \
+        {                                                               \
+            JTEST_DUMP_STRF("Status: %d\n", (int)(status));             \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+/**
+ *  Cholesky factorization: L * L' must be a. The last pivot of a matrix with
+ *  a negative last diagonal element is negative, it must be rejected.
+ */
+#define JTEST_ARM_MAT_CHOLESKY_LARGE_TEST(suffix)                              \
+    JTEST_DEFINE_TEST(arm_mat_cholesky_##suffix##_large_test,                  \
+                      arm_mat_cholesky_##suffix)                               \
+    {                                                                          \
+        MAT_DECOMPOSITION_LARGE_TEST_TEMPLATE(                                 \
+            suffix,                                                            \
+            status = arm_mat_cholesky_##suffix(&a, &l);                        \
+            MAT_DECOMPOSITION_ASSERT_STATUS(status, ARM_MATH_SUCCESS);         \
+                                                                               \
+            mat_decomposition_mult_##suffix(l.pData, l.pData, u.pData,         \
+                                            n, n, n, 1);                       \
+            MAT_DECOMPOSITION_ASSERT_SNR_##suffix(                             \
+                a.pData, u.pData, n * n,                                       \
+                MAT_DECOMPOSITION_RESIDUAL_SNR_THRESHOLD_##suffix);            \
+                                                                               \
+            ref_mat_cholesky_##suffix(&a, &ref);                               \
+            MAT_DECOMPOSITION_ASSERT_SNR_##suffix(                             \
+                ref.pData, l.pData, n * n, MATRIX_SNR_THRESHOLD);              \
+                                                                               \
+            a.pData[(n - 1) * n + n - 1] = -a.pData[(n - 1) * n + n - 1];      \
+            status = arm_mat_cholesky_##suffix(&a, &l);                        \
+            MAT_DECOMPOSITION_ASSERT_STATUS(status,                            \
+                                            ARM_MATH_DECOMPOSITION_FAILURE));  \
+                                                                               \
+        return JTEST_TEST_PASSED;                                              \
+    }
+
+JTEST_ARM_MAT_CHOLESKY_LARGE_TEST(f32);
+JTEST_ARM_MAT_CHOLESKY_LARGE_TEST(f64);
+
+/**
+ *  LU factorization of the random matrix: L * U must be P * m. A matrix with a
+ *  zero column must be found singular.
+ */
+JTEST_DEFINE_TEST(arm_mat_lu_f32_large_test, arm_mat_lu_f32)
+{
+    MAT_DECOMPOSITION_LARGE_TEST_TEMPLATE(
+        f32,
+        uint32_t i;
+        uint32_t j;
+
+        status = arm_mat_lu_f32(&m, &l, &u, mat_decomposition_large_p);
+        MAT_DECOMPOSITION_ASSERT_STATUS(status, ARM_MATH_SUCCESS);
+
+        /* Permuted rows of m, the residual fails if p is not a permutation */
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                ref.pData[i*n + j] = m.pData[mat_decomposition_large_p[i]*n + j];
+            }
+        }
+        mat_decomposition_mult_f32(l.pData, u.pData, a.pData, n, n, n, 0);
+        TEST_ASSERT_SNR(ref.pData, a.pData, n * n,
+                        MAT_DECOMPOSITION_RESIDUAL_SNR_THRESHOLD_f32);
+
+        for (i = 0; i < n; i++)
+        {
+            m.pData[i*n + n / 2] = 0.0f;
+        }
+        status = arm_mat_lu_f32(&m, &l, &u, mat_decomposition_large_p);
+        MAT_DECOMPOSITION_ASSERT_STATUS(status, ARM_MATH_SINGULAR));
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Triangular solves with the Cholesky factor of a or with its transpose:
+ *  T * X must be b.
+ */
+#define JTEST_ARM_MAT_SOLVE_TRIANGULAR_LARGE_TEST(suffix, lower_upper, transposeT) \
+    JTEST_DEFINE_TEST(arm_mat_solve_##lower_upper##_triangular_##suffix##_large_test, \
+                      arm_mat_solve_##lower_upper##_triangular_##suffix)       \
+    {                                                                          \
+        MAT_DECOMPOSITION_LARGE_TEST_TEMPLATE(                                 \
+            suffix,                                                            \
+            arm_matrix_instance_##suffix * t = transposeT ? &u : &l;           \
+                                                                               \
+            ref_mat_cholesky_##suffix(&a, &l);                                 \
+            ref_mat_trans_##suffix(&l, &u);                                    \
+                                                                               \
+            status = arm_mat_solve_##lower_upper##_triangular_##suffix(        \
+                t, &b, &x);                                                    \
+            MAT_DECOMPOSITION_ASSERT_STATUS(status, ARM_MATH_SUCCESS);         \
+                                                                               \
+            mat_decomposition_mult_##suffix(t->pData, x.pData, a.pData, n, n,  \
+                                            MAT_DECOMPOSITION_LARGE_RHS, 0);   \
+            MAT_DECOMPOSITION_ASSERT_SNR_##suffix(                             \
+                b.pData, a.pData, n * MAT_DECOMPOSITION_LARGE_RHS,             \
+                MAT_DECOMPOSITION_RESIDUAL_SNR_THRESHOLD_##suffix);            \
+                                                                               \
+            ref.numCols = MAT_DECOMPOSITION_LARGE_RHS;                         \
+            ref_mat_solve_##lower_upper##_triangular_##suffix(t, &b, &ref);    \
+            MAT_DECOMPOSITION_ASSERT_SNR_##suffix(                             \
+                ref.pData, x.pData, n * MAT_DECOMPOSITION_LARGE_RHS,           \
+                MATRIX_SNR_THRESHOLD));                                        \
+                                                                               \
+        return JTEST_TEST_PASSED;                                              \
+    }
+
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_LARGE_TEST(f32, lower, 0);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_LARGE_TEST(f64, lower, 0);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_LARGE_TEST(f32, upper, 1);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_LARGE_TEST(f64, upper, 1);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_decomposition_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f64_test);
+    JTEST_TEST_CALL(arm_mat_lu_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_large_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f64_large_test);
+    JTEST_TEST_CALL(arm_mat_lu_f32_large_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f32_large_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f64_large_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f32_large_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f64_large_test);
+}
@@ -44,6 +44,159 @@ JTEST_DEFINE_TEST(arm_mat_mult_q15_test, arm_mat_mult_q15)
         MATRIX_COMPARE_INTERFACE);
 }
 
+/*--------------------------------------------------------------------------------*/
+/* Blocked versions use a scratch buffer for the packed panel of B. */
+/*--------------------------------------------------------------------------------*/
+
+#define ARM_mat_mult_blocked_f32_INPUT_INTERFACE(input_a_ptr, input_b_ptr) \
+    PAREN(input_a_ptr, input_b_ptr,                                     \
+          (void *) &matrix_output_fut,                                  \
+          (float32_t *) matrix_output_scratch,                          \
+          0)
+
+#define ARM_mat_mult_blocked_q15_INPUT_INTERFACE(input_a_ptr, input_b_ptr) \
+    PAREN(input_a_ptr, input_b_ptr,                                     \
+          (void *) &matrix_output_fut,                                  \
+          (q15_t *) matrix_output_scratch,                              \
+          0)
+
+#define JTEST_ARM_MAT_MULT_BLOCKED_TEST(suffix)                         \
+    JTEST_DEFINE_TEST(arm_mat_mult_blocked_##suffix##_test,             \
+                      arm_mat_mult_blocked_##suffix)                    \
+    {                                                                   \
+        MATRIX_TEST_TEMPLATE_ELT2(                                      \
+            matrix_##suffix##_a_inputs,                                 \
+            matrix_##suffix##_b_inputs,                                 \
+            arm_matrix_instance_##suffix * ,                            \
+            arm_matrix_instance_##suffix,                               \
+            TYPE_FROM_ABBREV(suffix),                                   \
+            arm_mat_mult_blocked_##suffix,                              \
+            ARM_mat_mult_blocked_##suffix##_INPUT_INTERFACE,            \
+            ref_mat_mult_##suffix,                                      \
+            REF_mat_mult_INPUT_INTERFACE,                               \
+            MATRIX_TEST_CONFIG_MULTIPLICATIVE_OUTPUT,                   \
+            MATRIX_TEST_VALID_MULTIPLICATIVE_DIMENSIONS,                \
+            MATRIX_COMPARE_INTERFACE);                                  \
+    }
+
+JTEST_ARM_MAT_MULT_BLOCKED_TEST(f32);
+JTEST_ARM_MAT_MULT_BLOCKED_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Blocked versions above ARM_MAT_MULT_BLOCKED_MIN_DIM, compared to arm_mat_mult_xxx. */
+/*--------------------------------------------------------------------------------*/
+
+/* Largest dimension of the matrices of the large tests */
+#define MAT_MULT_BLOCKED_MAX_DIM 48
+
+/* M x N times N x P. The sizes are not multiple of the panel or of the tiles. */
+static const uint16_t mat_mult_blocked_dims[][3] =
+{
+    {37, 41, 35},
+    {33, 48, 47},
+    {45, 33, 39},
+    {48, 35, 32}
+};
+
+static float32_t mat_mult_blocked_a[MAT_MULT_BLOCKED_MAX_DIM * MAT_MULT_BLOCKED_MAX_DIM];
+static float32_t mat_mult_blocked_b[MAT_MULT_BLOCKED_MAX_DIM * MAT_MULT_BLOCKED_MAX_DIM];
+static float32_t mat_mult_blocked_bt[MAT_MULT_BLOCKED_MAX_DIM * MAT_MULT_BLOCKED_MAX_DIM];
+static float32_t mat_mult_blocked_ref[MAT_MULT_BLOCKED_MAX_DIM * MAT_MULT_BLOCKED_MAX_DIM];
+static float32_t mat_mult_blocked_fut[MAT_MULT_BLOCKED_MAX_DIM * MAT_MULT_BLOCKED_MAX_DIM];
+static float32_t mat_mult_blocked_state[MAT_MULT_BLOCKED_MAX_DIM * MAT_MULT_BLOCKED_MAX_DIM];
+
+/* Pseudo-random value in [-1 1) */
+static float32_t mat_mult_blocked_rand(uint32_t * seed)
+{
+    *seed = (*seed * 1664525U) + 1013904223U;
+    return ((float32_t) (int32_t) *seed) / 2147483648.0f;
+}
+
+/**
+ *  Test of arm_mat_mult_blocked_xxx against arm_mat_mult_xxx for the sizes of
+ *  mat_mult_blocked_dims, with B and with the transpose of B. The q15 outputs
+ *  must be bit exact, the f32 outputs are compared with their SNR since the
+ *  order of the accumulations is not the same.
+ *
+ *  The xxx data are stored in the float32_t arrays above.
+ */
+#define JTEST_ARM_MAT_MULT_BLOCKED_LARGE_TEST(suffix, from_float, compare)  \
+    JTEST_DEFINE_TEST(arm_mat_mult_blocked_##suffix##_large_test,           \
+                      arm_mat_mult_blocked_##suffix)                        \
+    {                                                                       \
+        TYPE_FROM_ABBREV(suffix) *pA = (TYPE_FROM_ABBREV(suffix) *) mat_mult_blocked_a;  \
+        TYPE_FROM_ABBREV(suffix) *pB = (TYPE_FROM_ABBREV(suffix) *) mat_mult_blocked_b;  \
+        TYPE_FROM_ABBREV(suffix) *pBt = (TYPE_FROM_ABBREV(suffix) *) mat_mult_blocked_bt; \
+        TYPE_FROM_ABBREV(suffix) *pRef = (TYPE_FROM_ABBREV(suffix) *) mat_mult_blocked_ref; \
+        TYPE_FROM_ABBREV(suffix) *pFut = (TYPE_FROM_ABBREV(suffix) *) mat_mult_blocked_fut; \
+        arm_matrix_instance_##suffix matA, matB, matBt, matRef, matFut;    \
+        uint32_t seed = 1U;                                                 \
+        uint32_t d, i, j, transposed;                                       \
+                                                                            \
+        for (d = 0; d < sizeof(mat_mult_blocked_dims) /                     \
+                 sizeof(mat_mult_blocked_dims[0]); d++)                     \
+        {                                                                   \
+            uint16_t M = mat_mult_blocked_dims[d][0];                       \
+            uint16_t N = mat_mult_blocked_dims[d][1];                       \
+            uint16_t P = mat_mult_blocked_dims[d][2];                       \
+                                                                            \
+            for (i = 0; i < (uint32_t) M * N; i++)                          \
+            {                                                               \
+                pA[i] = from_float(mat_mult_blocked_rand(&seed));           \
+            }                                                               \
+            for (i = 0; i < N; i++)                                         \
+            {                                                               \
+                for (j = 0; j < P; j++)                                     \
+                {                                                           \
+                    pB[i * P + j] = from_float(mat_mult_blocked_rand(&seed)); \
+                    pBt[j * N + i] = pB[i * P + j];                         \
+                }                                                           \
+            }                                                               \
+                                                                            \
+            arm_mat_init_##suffix(&matA, M, N, pA);                         \
+            arm_mat_init_##suffix(&matB, N, P, pB);                         \
+            arm_mat_init_##suffix(&matBt, P, N, pBt);                       \
+            arm_mat_init_##suffix(&matRef, M, P, pRef);                     \
+            arm_mat_init_##suffix(&matFut, M, P, pFut);                     \
+                                                                            \
+            JTEST_DUMP_STRF("Size: %d x %d x %d\n", (int) M, (int) N, (int) P); \
+            TEST_ASSERT_EQUAL(ARM_MAT_MULT_REF_##suffix(&matA, &matB, &matRef), \
+                              ARM_MATH_SUCCESS);                            \
+                                                                            \
+            for (transposed = 0; transposed < 2; transposed++)              \
+            {                                                               \
+                memset(pFut, 0, (uint32_t) M * P * sizeof(*pFut));          \
+                TEST_ASSERT_EQUAL(arm_mat_mult_blocked_##suffix(            \
+                                      &matA, transposed ? &matBt : &matB,   \
+                                      &matFut,                              \
+                                      (TYPE_FROM_ABBREV(suffix) *)          \
+                                      mat_mult_blocked_state,               \
+                                      (uint8_t) transposed),                \
+                                  ARM_MATH_SUCCESS);                        \
+                compare(pRef, pFut, (uint32_t) M * P);                      \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+#define MAT_MULT_BLOCKED_F32(x) (x)
+#define MAT_MULT_BLOCKED_Q15(x) ((q15_t) ((x) * 16384.0f))
+
+#define MAT_MULT_BLOCKED_SNR_COMPARE(ref, fut, size)                        \
+    TEST_ASSERT_SNR(ref, fut, size, MATRIX_SNR_THRESHOLD)
+
+#define MAT_MULT_BLOCKED_EXACT_COMPARE(ref, fut, size)                      \
+    TEST_ASSERT_BUFFERS_EQUAL(ref, fut, (size) * sizeof(*(ref)))
+
+/* arm_mat_mult_q15 needs a scratch buffer for the transpose of B */
+#define ARM_MAT_MULT_REF_f32(a, b, dst) arm_mat_mult_f32(a, b, dst)
+#define ARM_MAT_MULT_REF_q15(a, b, dst)                                     \
+    arm_mat_mult_q15(a, b, dst, (q15_t *) mat_mult_blocked_state)
+
+JTEST_ARM_MAT_MULT_BLOCKED_LARGE_TEST(f32, MAT_MULT_BLOCKED_F32, MAT_MULT_BLOCKED_SNR_COMPARE);
+JTEST_ARM_MAT_MULT_BLOCKED_LARGE_TEST(q15, MAT_MULT_BLOCKED_Q15, MAT_MULT_BLOCKED_EXACT_COMPARE);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -56,4 +209,8 @@ JTEST_DEFINE_GROUP(mat_mult_tests)
     JTEST_TEST_CALL(arm_mat_mult_f32_test);
     JTEST_TEST_CALL(arm_mat_mult_q31_test);
     JTEST_TEST_CALL(arm_mat_mult_q15_test);
+    JTEST_TEST_CALL(arm_mat_mult_blocked_f32_test);
+    JTEST_TEST_CALL(arm_mat_mult_blocked_q15_test);
+    JTEST_TEST_CALL(arm_mat_mult_blocked_f32_large_test);
+    JTEST_TEST_CALL(arm_mat_mult_blocked_q15_large_test);
 }
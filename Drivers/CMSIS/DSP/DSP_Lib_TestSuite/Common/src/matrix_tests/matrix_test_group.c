@@ -9,6 +9,7 @@ JTEST_DEFINE_GROUP(matrix_tests)
     JTEST_GROUP_CALL(mat_add_tests);
     JTEST_GROUP_CALL(mat_cmplx_mult_tests);
     JTEST_GROUP_CALL(mat_init_tests);
+    JTEST_GROUP_CALL(mat_decomposition_tests);
     JTEST_GROUP_CALL(mat_inverse_tests);
     JTEST_GROUP_CALL(mat_mult_tests);
     JTEST_GROUP_CALL(mat_mult_fast_tests);
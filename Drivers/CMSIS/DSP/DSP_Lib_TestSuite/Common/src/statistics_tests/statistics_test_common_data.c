@@ -92,3 +92,38 @@ ARR_DESC_DEFINE(ARR_DESC_t *,
                     &statistics_f_15,
                     &statistics_f_32
                     ));
+
+/* Same data with a large mean */
+ARR_DESC_DEFINE(float32_t,
+                statistics_f_offset_32,
+                32,
+                CURLY(
+                    99.9134870377       , 99.6668831244,
+                    100.0250664613      , 100.0575352841,
+                    99.7707057299       , 100.2381830931,
+                    100.2378328403      , 99.9924733447,
+                    100.0654584723      , 100.0349278286,
+                    99.9626582845       , 100.1451581097,
+                    99.8823366914       , 100.4366371636,
+                    99.9727208234       , 100.0227862627,
+                    100.2133536423      , 100.0118562921,
+                    99.9808703189       , 99.8335301073,
+                    100.0588821633      , 99.7327636284,
+                    100.1428649104      , 100.3247124129,
+                    99.8616448597       , 100.1715993346,
+                    100.2508002843      , 99.6812540847,
+                    99.7118071136       , 100.1142295247,
+                    99.9200228845       , 100.1379994751
+                    ));
+
+ARR_DESC_DEFINE_SUBSET(statistics_f_offset_15,
+                       statistics_f_offset_32,
+                       15);
+
+ARR_DESC_DEFINE(ARR_DESC_t *,
+                statistics_f_offset_all,
+                2,
+                CURLY(
+                    &statistics_f_offset_15,
+                    &statistics_f_offset_32
+                    ));
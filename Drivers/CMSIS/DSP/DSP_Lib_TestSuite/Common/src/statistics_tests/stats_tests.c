@@ -0,0 +1,66 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+#define JTEST_ARM_STATS_TEST(suffix)            \
+    STATISTICS_DEFINE_TEST_TEMPLATE_BUF1_BLK(   \
+        stats,                                  \
+        suffix,                                 \
+        TYPE_FROM_ABBREV(suffix),               \
+        TYPE_FROM_ABBREV(suffix),               \
+        STATISTICS_STATS_COMPARE_INTERFACE)
+
+JTEST_ARM_STATS_TEST(f32);
+JTEST_ARM_STATS_TEST(q31);
+JTEST_ARM_STATS_TEST(q15);
+
+/*
+ * The samples around 100 are rounded to 100 * 2^-24 and so is their mean. This
+ * is limiting the SNR of the variance to about 90 dB whatever the algorithm.
+ * The sum of squares method (ref_var_f32) gives about 30 dB on this data.
+ */
+#define STATISTICS_STATS_OFFSET_SNR_THRESHOLD 80
+
+#define STATISTICS_STATS_OFFSET_COMPARE_INTERFACE(block_size,   \
+                                                  output_type)  \
+    STATISTICS_STATS_COMPARE(output_type,                       \
+                             STATISTICS_STATS_OFFSET_SNR_THRESHOLD)
+
+/**
+ *  The floating-point variance must not lose its precision when the mean is
+ *  large compared to the standard deviation.
+ */
+JTEST_DEFINE_TEST(arm_stats_f32_offset_test,
+                  arm_stats_f32)
+{
+    TEST_TEMPLATE_BUF1_BLK(
+        statistics_f_offset_all,
+        statistics_block_sizes,
+        float32_t,
+        float32_t,
+        arm_stats_f32,
+        ARM_stats_INPUT_INTERFACE,
+        ref_stats_f32,
+        REF_stats_INPUT_INTERFACE,
+        STATISTICS_STATS_OFFSET_COMPARE_INTERFACE);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stats_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stats_f32_test);
+    JTEST_TEST_CALL(arm_stats_f32_offset_test);
+    JTEST_TEST_CALL(arm_stats_q31_test);
+    JTEST_TEST_CALL(arm_stats_q15_test);
+}
@@ -0,0 +1,109 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include <math.h>
+
+/**
+ *  Maximum differences between the twiddle factors computed in RAM and the
+ *  constant tables : 2 ulp of 1.0 in single precision, 1 LSB in Q31.
+ */
+#define CFFT_INIT_RAM_TWIDDLE_THRESHOLD_f32 2.4e-7
+#define CFFT_INIT_RAM_TWIDDLE_THRESHOLD_q31 1.0
+
+/* Number of values of the twiddle factor tables */
+#define CFFT_INIT_RAM_TWIDDLE_LEN_f32(fftLen) (2 * (fftLen))
+#define CFFT_INIT_RAM_TWIDDLE_LEN_q31(fftLen) (3 * (fftLen) / 2)
+
+static float32_t cfft_ram_twiddle_f32[2 * TRANSFORM_MAX_FFT_LEN];
+static q31_t cfft_ram_twiddle_q31[3 * TRANSFORM_MAX_FFT_LEN / 2];
+static uint16_t cfft_ram_bitrev[2 * TRANSFORM_MAX_FFT_LEN];
+
+/*
+  CFFT with tables in RAM test template. Arguments are: function suffix
+  (q31/f32) and the output type (q31_t, float32_t).
+  The cycles of the initialization are displayed (startup time). The tables
+  are compared with the constant tables of the same length, then the CFFT of
+  the RAM instance is compared with the reference CFFT.
+*/
+#define CFFT_INIT_RAM_DEFINE_TEST(suffix, output_type)                        \
+    JTEST_DEFINE_TEST(arm_cfft_init_ram_##suffix##_test,                      \
+                      arm_cfft_init_ram_##suffix)                             \
+    {                                                                         \
+        arm_cfft_instance_##suffix cfft_inst_ram;                             \
+        arm_status status;                                                    \
+        float64_t maxDiff;                                                    \
+        uint32_t i;                                                           \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr, \
+            transform_cfft_ram_##suffix##_structs                             \
+            ,                                                                 \
+            /* Display parameter values */                                    \
+            JTEST_DUMP_STRF("Block Size: %d\n",                               \
+                            (int)cfft_inst_ptr->fftLen);                      \
+                                                                              \
+            /* Display cycle count and run test */                            \
+            JTEST_COUNT_CYCLES(                                               \
+                status = arm_cfft_init_ram_##suffix(                          \
+                    &cfft_inst_ram, cfft_inst_ptr->fftLen,                    \
+                    cfft_ram_twiddle_##suffix, cfft_ram_bitrev));             \
+                                                                              \
+            if ((status != ARM_MATH_SUCCESS) ||                               \
+                (cfft_inst_ram.bitRevLength != cfft_inst_ptr->bitRevLength))  \
+            {                                                                 \
+                return JTEST_TEST_FAILED;                                     \
+            }                                                                 \
+                                                                              \
+            maxDiff = 0;                                                      \
+            for (i = 0;                                                       \
+                 i < CFFT_INIT_RAM_TWIDDLE_LEN_##suffix(cfft_inst_ptr->fftLen); \
+                 i++)                                                         \
+            {                                                                 \
+                maxDiff = fmax(maxDiff,                                       \
+                               fabs((float64_t) cfft_inst_ram.pTwiddle[i] -   \
+                                    (float64_t) cfft_inst_ptr->pTwiddle[i])); \
+            }                                                                 \
+                                                                              \
+            if (maxDiff > CFFT_INIT_RAM_TWIDDLE_THRESHOLD_##suffix)           \
+            {                                                                 \
+                JTEST_DUMP_STRF("Twiddle factor error: %g\n", maxDiff);       \
+                return JTEST_TEST_FAILED;                                     \
+            }                                                                 \
+                                                                              \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                 \
+                transform_fft_##suffix##_inputs,                              \
+                cfft_inst_ptr->fftLen *                                       \
+                sizeof(output_type) *                                         \
+                2 /*complex_inputs*/);                                        \
+                                                                              \
+            arm_cfft_##suffix(&cfft_inst_ram,                                 \
+                              (void *) transform_fft_inplace_input_fut,       \
+                              0,              /* IFFT Flag */                 \
+                              1);             /* Bitreverse flag */           \
+            ref_cfft_##suffix(cfft_inst_ptr,                                  \
+                              (void *) transform_fft_inplace_input_ref,       \
+                              0,              /* IFFT Flag */                 \
+                              1);             /* Bitreverse flag */           \
+                                                                              \
+            /* Test correctness */                                            \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                            \
+                cfft_inst_ptr->fftLen,                                        \
+                output_type));                                                \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+CFFT_INIT_RAM_DEFINE_TEST(f32, float32_t);
+CFFT_INIT_RAM_DEFINE_TEST(q31, q31_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cfft_init_ram_tests)
+{
+    JTEST_TEST_CALL(arm_cfft_init_ram_f32_test);
+    JTEST_TEST_CALL(arm_cfft_init_ram_q31_test);
+}
@@ -96,6 +96,52 @@
     } while (0)
 
 
+#if defined(ARM_MATH_X86_SIMD)
+/*
+  arm_cfft_stockham_f32 test template. transform_fft_input_fut is the work buffer.
+*/
+#define CFFT_STOCKHAM_TEST_BODY(ifft_flag)                                              \
+    do                                                                                  \
+    {                                                                                   \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_f32 *, cfft_inst_ptr,                \
+            transform_cfft_f32_structs                                                  \
+            ,                                                                           \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_f32_inputs,                                               \
+                cfft_inst_ptr->fftLen *                                                 \
+                sizeof(float32_t) *                                                     \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)cfft_inst_ptr->fftLen,                                 \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_stockham_f32(cfft_inst_ptr,                                    \
+                             (void *) transform_fft_inplace_input_fut,                  \
+                             transform_fft_input_fut,                                   \
+                             ifft_flag));            /* IFFT Flag */                    \
+            ref_cfft_f32(cfft_inst_ptr,                                                 \
+                         (void *) transform_fft_inplace_input_ref,                      \
+                         ifft_flag,         /* IFFT Flag */                             \
+                         1);        /* Bitreverse flag */                               \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                                      \
+                cfft_inst_ptr->fftLen,                                                  \
+                float32_t));                                                            \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
+
 /* Test declarations */
 JTEST_DEFINE_TEST(cfft_f32_test, cfft_f32)
 {
@@ -107,6 +153,18 @@ JTEST_DEFINE_TEST(cfft_f32_ifft_test, cfft_f32)
     CFFT_TEST_BODY((uint8_t) 1, f32, float32_t);
 }
 
+#if defined(ARM_MATH_X86_SIMD)
+JTEST_DEFINE_TEST(cfft_stockham_f32_test, cfft_stockham_f32)
+{
+    CFFT_STOCKHAM_TEST_BODY((uint8_t) 0);
+}
+
+JTEST_DEFINE_TEST(cfft_stockham_f32_ifft_test, cfft_stockham_f32)
+{
+    CFFT_STOCKHAM_TEST_BODY((uint8_t) 1);
+}
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
 JTEST_DEFINE_TEST(cfft_q31_test, cfft_q31)
 {
     CFFT_TEST_BODY((uint8_t) 0, q31, q31_t);
@@ -135,6 +193,10 @@ JTEST_DEFINE_GROUP(cfft_tests)
 {
     JTEST_TEST_CALL(cfft_f32_test);
     JTEST_TEST_CALL(cfft_f32_ifft_test);
+#if defined(ARM_MATH_X86_SIMD)
+    JTEST_TEST_CALL(cfft_stockham_f32_test);
+    JTEST_TEST_CALL(cfft_stockham_f32_ifft_test);
+#endif /* defined(ARM_MATH_X86_SIMD) */
 
     JTEST_TEST_CALL(cfft_q31_test);
     JTEST_TEST_CALL(cfft_q31_ifft_test);
@@ -0,0 +1,188 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/**
+ *  The cycles of the Goertzel filters for 1 to 16 frequencies can be compared
+ *  with the cycles of the rfft_fast tests of the same length to find the
+ *  number of frequencies above which an FFT is cheaper.
+ */
+#define TRANSFORM_GOERTZEL_MAX_BINS 16
+
+/**
+ *  The input of the sliding DFT is given in chunks of TRANSFORM_SDFT_CHUNK
+ *  samples, which are not related to the window length.
+ */
+#define TRANSFORM_SDFT_BLOCKSIZE  1000
+#define TRANSFORM_SDFT_CHUNK      100
+#define TRANSFORM_SDFT_MAX_LEN    256
+
+static float32_t goertzel_coeffs_f32[2 * TRANSFORM_GOERTZEL_MAX_BINS];
+static q31_t goertzel_coeffs_q31[2 * TRANSFORM_GOERTZEL_MAX_BINS];
+static float32_t sdft_state_f32[TRANSFORM_SDFT_MAX_LEN];
+static float32_t sdft_bins_f32[2 * TRANSFORM_GOERTZEL_MAX_BINS];
+
+/* Frequencies which are not bins of the DFT of the block */
+static void goertzel_make_coeffs(uint16_t numBins)
+{
+    uint32_t k;
+    float64_t w;
+
+    for (k = 0; k < numBins; k++)
+    {
+        w = 6.283185307179586 * (0.013 + 0.029 * k);
+        goertzel_coeffs_f32[k] = (float32_t) cos(w);
+        goertzel_coeffs_f32[numBins + k] = (float32_t) sin(w);
+        goertzel_coeffs_q31[k] = (q31_t) (cos(w) * 2147483647.0);
+        goertzel_coeffs_q31[numBins + k] = (q31_t) (sin(w) * 2147483647.0);
+    }
+}
+
+/* Odd bins of the DFT of the window, below windowLen/2 */
+static void sdft_make_coeffs(uint16_t windowLen, uint16_t numBins)
+{
+    uint32_t k;
+    float64_t w;
+
+    for (k = 0; k < numBins; k++)
+    {
+        w = 6.283185307179586 * (2 * k + 1) / windowLen;
+        goertzel_coeffs_f32[k] = (float32_t) cos(w);
+        goertzel_coeffs_f32[numBins + k] = (float32_t) sin(w);
+    }
+}
+
+/*
+Goertzel test template. Arguments are: data type suffix (f32/q31) and output
+type
+*/
+#define GOERTZEL_DEFINE_TEST(suffix, output_type)                             \
+    JTEST_DEFINE_TEST(arm_goertzel_##suffix##_test,                           \
+                      arm_goertzel_##suffix)                                  \
+    {                                                                         \
+        arm_goertzel_instance_##suffix goertzel_inst;                         \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            blocksize_idx, uint16_t, blockSize,                               \
+            transform_goertzel_blocksizes                                     \
+            ,                                                                 \
+          TEMPLATE_DO_ARR_DESC(                                               \
+              numbins_idx, uint16_t, numBins, transform_goertzel_numbins      \
+              ,                                                               \
+              goertzel_make_coeffs(numBins);                                  \
+              arm_goertzel_init_##suffix(&goertzel_inst, numBins,             \
+                                         goertzel_coeffs_##suffix);           \
+                                                                              \
+              /* Display parameter values */                                  \
+              JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                              "Number of bins: %d\n",                         \
+                              (int)blockSize,                                 \
+                              (int)numBins);                                  \
+                                                                              \
+              /* Display cycle count and run test */                          \
+              JTEST_COUNT_CYCLES(                                             \
+                  arm_goertzel_##suffix(                                      \
+                      &goertzel_inst,                                         \
+                      transform_fft_##suffix##_inputs,                        \
+                      (output_type *) transform_fft_output_fut,               \
+                      blockSize));                                            \
+                                                                              \
+              ref_goertzel_##suffix(                                          \
+                  &goertzel_inst,                                             \
+                  transform_fft_##suffix##_inputs,                            \
+                  (output_type *) transform_fft_output_ref,                   \
+                  blockSize);                                                 \
+                                                                              \
+              /* Test correctness */                                          \
+              TRANSFORM_SNR_COMPARE_INTERFACE(                                \
+                  numBins,                                                    \
+                  output_type)));                                             \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+GOERTZEL_DEFINE_TEST(f32, float32_t);
+GOERTZEL_DEFINE_TEST(q31, q31_t);
+
+/*
+Sliding DFT test template. Arguments are: name of the test and damping factor
+*/
+#define SDFT_DEFINE_TEST(config_suffix, damping)                              \
+    JTEST_DEFINE_TEST(arm_sdft_f32_##config_suffix##_test,                    \
+                      arm_sdft_f32)                                           \
+    {                                                                         \
+        arm_sdft_instance_f32 sdft_inst;                                      \
+        uint32_t i, n;                                                        \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            windowlen_idx, uint16_t, windowLen, transform_sdft_windowlens     \
+            ,                                                                 \
+          TEMPLATE_DO_ARR_DESC(                                               \
+              numbins_idx, uint16_t, numBins, transform_goertzel_numbins      \
+              ,                                                               \
+              sdft_make_coeffs(windowLen, numBins);                           \
+              if (arm_sdft_init_f32(&sdft_inst, windowLen, numBins,           \
+                                    goertzel_coeffs_f32, damping,             \
+                                    sdft_state_f32, sdft_bins_f32)            \
+                  != ARM_MATH_SUCCESS)                                        \
+              {                                                               \
+                  return JTEST_TEST_FAILED;                                   \
+              }                                                               \
+                                                                              \
+              /* Display parameter values */                                  \
+              JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                              "Window Length: %d\n"                           \
+                              "Number of bins: %d\n"                          \
+                              "Damping: %f\n",                                \
+                              (int)TRANSFORM_SDFT_BLOCKSIZE,                  \
+                              (int)windowLen,                                 \
+                              (int)numBins,                                   \
+                              (double)damping);                               \
+                                                                              \
+              /* Display cycle count and run test */                          \
+              JTEST_COUNT_CYCLES(                                             \
+                  for (i = 0; i < TRANSFORM_SDFT_BLOCKSIZE; i += n)           \
+                  {                                                           \
+                      n = TRANSFORM_SDFT_BLOCKSIZE - i;                       \
+                      if (n > TRANSFORM_SDFT_CHUNK)                           \
+                      {                                                       \
+                          n = TRANSFORM_SDFT_CHUNK;                           \
+                      }                                                       \
+                      arm_sdft_f32(                                           \
+                          &sdft_inst,                                         \
+                          transform_fft_f32_inputs + i,                       \
+                          (float32_t *) transform_fft_output_fut, n);         \
+                  });                                                         \
+                                                                              \
+              ref_sdft_f32(                                                   \
+                  &sdft_inst,                                                 \
+                  transform_fft_f32_inputs,                                   \
+                  (float32_t *) transform_fft_output_ref,                     \
+                  TRANSFORM_SDFT_BLOCKSIZE);                                  \
+                                                                              \
+              /* Test correctness */                                          \
+              TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                          \
+                  numBins,                                                    \
+                  float32_t)));                                               \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+SDFT_DEFINE_TEST(undamped, 1.0f);
+SDFT_DEFINE_TEST(damped, 0.999f);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(goertzel_tests)
+{
+    JTEST_TEST_CALL(arm_goertzel_f32_test);
+    JTEST_TEST_CALL(arm_goertzel_q31_test);
+    JTEST_TEST_CALL(arm_sdft_f32_undamped_test);
+    JTEST_TEST_CALL(arm_sdft_f32_damped_test);
+}
@@ -0,0 +1,173 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/**
+ *  Keyword spotting configuration : 16 kHz sampling rate, 40 Mel filters
+ *  between 0 and 8 kHz and 13 MFCC. Several frames overlapping by half a
+ *  frame are taken from the input signal.
+ */
+#define TRANSFORM_MFCC_SAMPLING_FREQ  16000.0
+#define TRANSFORM_MFCC_NBMEL          40
+#define TRANSFORM_MFCC_NBDCT          13
+#define TRANSFORM_MFCC_NUMFRAMES      4
+#define TRANSFORM_MFCC_MAX_LEN        1024
+#define TRANSFORM_MFCC_MAX_BINS       (TRANSFORM_MFCC_MAX_LEN / 2 + 1)
+
+static float32_t mfcc_mel_f32[TRANSFORM_MFCC_NBMEL * TRANSFORM_MFCC_MAX_BINS];
+static float32_t mfcc_filter_coefs_f32[TRANSFORM_MFCC_MAX_BINS * 2];
+static q15_t mfcc_filter_coefs_q15[TRANSFORM_MFCC_MAX_BINS * 2];
+static uint32_t mfcc_filter_pos[TRANSFORM_MFCC_NBMEL];
+static uint32_t mfcc_filter_lengths[TRANSFORM_MFCC_NBMEL];
+static float32_t mfcc_dct_f32[TRANSFORM_MFCC_NBDCT * TRANSFORM_MFCC_NBMEL];
+static q15_t mfcc_dct_q15[TRANSFORM_MFCC_NBDCT * TRANSFORM_MFCC_NBMEL];
+static float32_t mfcc_window_f32[TRANSFORM_MFCC_MAX_LEN];
+static q15_t mfcc_window_q15[TRANSFORM_MFCC_MAX_LEN];
+static float32_t mfcc_tmp_f32[TRANSFORM_MFCC_MAX_LEN + 2];
+static q31_t mfcc_tmp_q15[TRANSFORM_MFCC_MAX_LEN];
+
+static float64_t mfcc_mel(float64_t freq)
+{
+    return 1127.0 * log(1.0 + freq / 700.0);
+}
+
+/* Q15 conversion saturating the coefficients equal to 1 */
+static q15_t mfcc_to_q15(float64_t x)
+{
+    x = floor(x * 32768.0 + 0.5);
+    return (q15_t) ((x > 32767.0) ? 32767.0 : x);
+}
+
+/* Triangular Mel filters, periodic Hann window and orthonormal DCT-II */
+static void mfcc_make_tables(uint32_t fftLen)
+{
+    uint32_t numBins = (fftLen / 2) + 1;
+    uint32_t i, k, nbCoefs;
+    float64_t melStep, left, center, right, mel, w;
+
+    melStep = mfcc_mel(TRANSFORM_MFCC_SAMPLING_FREQ / 2) / (TRANSFORM_MFCC_NBMEL + 1);
+
+    for (i = 0; i < TRANSFORM_MFCC_NBMEL; i++)
+    {
+        left = melStep * i;
+        center = melStep * (i + 1);
+        right = melStep * (i + 2);
+
+        for (k = 0; k < numBins; k++)
+        {
+            mel = mfcc_mel(k * TRANSFORM_MFCC_SAMPLING_FREQ / fftLen);
+            w = (mel < center) ? (mel - left) / (center - left) : (right - mel) / (right - center);
+            mfcc_mel_f32[i * numBins + k] = (float32_t) ((w > 0) ? w : 0);
+        }
+    }
+
+    nbCoefs = arm_mfcc_sparse_filters_f32(mfcc_mel_f32, TRANSFORM_MFCC_NBMEL, numBins,
+                                          mfcc_filter_pos, mfcc_filter_lengths,
+                                          mfcc_filter_coefs_f32);
+
+    for (k = 0; k < nbCoefs; k++)
+    {
+        mfcc_filter_coefs_q15[k] = mfcc_to_q15(mfcc_filter_coefs_f32[k]);
+    }
+
+    for (k = 0; k < fftLen; k++)
+    {
+        w = 0.5 - 0.5 * cos(6.283185307179586 * k / fftLen);
+        mfcc_window_f32[k] = (float32_t) w;
+        mfcc_window_q15[k] = mfcc_to_q15(w);
+    }
+
+    for (i = 0; i < TRANSFORM_MFCC_NBDCT; i++)
+    {
+        for (k = 0; k < TRANSFORM_MFCC_NBMEL; k++)
+        {
+            w = sqrt(2.0 / TRANSFORM_MFCC_NBMEL) *
+                cos(3.141592653589793 / TRANSFORM_MFCC_NBMEL * (k + 0.5) * i);
+            w = (i == 0) ? w * sqrt(0.5) : w;
+            mfcc_dct_f32[i * TRANSFORM_MFCC_NBMEL + k] = (float32_t) w;
+            mfcc_dct_q15[i * TRANSFORM_MFCC_NBMEL + k] = mfcc_to_q15(w);
+        }
+    }
+}
+
+/*
+MFCC test template. Arguments are: data type suffix (f32/q15) and type.
+The input of a frame is modified, so it is copied before each call.
+*/
+#define MFCC_DEFINE_TEST(suffix, type)                                        \
+    JTEST_DEFINE_TEST(arm_mfcc_##suffix##_test,                               \
+                      arm_mfcc_##suffix)                                      \
+    {                                                                         \
+        arm_mfcc_instance_##suffix mfcc_inst;                                 \
+        type * frame = (type *) transform_fft_input_fut;                      \
+        type * pSrc;                                                          \
+        uint32_t f;                                                           \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            fftlen_idx, uint16_t, fftlen, transform_mfcc_fftlens              \
+            ,                                                                 \
+            mfcc_make_tables(fftlen);                                         \
+                                                                              \
+            if (arm_mfcc_init_##suffix(                                       \
+                    &mfcc_inst, fftlen, TRANSFORM_MFCC_NBMEL,                 \
+                    TRANSFORM_MFCC_NBDCT, mfcc_dct_##suffix,                  \
+                    mfcc_filter_pos, mfcc_filter_lengths,                     \
+                    mfcc_filter_coefs_##suffix, mfcc_window_##suffix)         \
+                != ARM_MATH_SUCCESS)                                          \
+            {                                                                 \
+                return JTEST_TEST_FAILED;                                     \
+            }                                                                 \
+                                                                              \
+            /* Display parameter values */                                    \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                \
+                            "Sampling Frequency: %d\n"                        \
+                            "Mel Filters: %d\n"                               \
+                            "DCT Outputs: %d\n",                              \
+                            (int)fftlen,                                      \
+                            (int)TRANSFORM_MFCC_SAMPLING_FREQ,                \
+                            (int)TRANSFORM_MFCC_NBMEL,                        \
+                            (int)TRANSFORM_MFCC_NBDCT);                       \
+                                                                              \
+            for (f = 0; f < TRANSFORM_MFCC_NUMFRAMES; f++)                    \
+            {                                                                 \
+                pSrc = transform_fft_##suffix##_inputs + f * (fftlen / 2);    \
+                memcpy(frame, pSrc, fftlen * sizeof(type));                   \
+                                                                              \
+                /* Display cycle count and run test */                        \
+                JTEST_COUNT_CYCLES(                                           \
+                    arm_mfcc_##suffix(                                        \
+                        &mfcc_inst, frame,                                    \
+                        (type *) transform_fft_output_fut +                   \
+                        f * TRANSFORM_MFCC_NBDCT,                             \
+                        mfcc_tmp_##suffix));                                  \
+                                                                              \
+                ref_mfcc_##suffix(                                            \
+                    &mfcc_inst, pSrc,                                         \
+                    (type *) transform_fft_output_ref +                       \
+                    f * TRANSFORM_MFCC_NBDCT);                                \
+            }                                                                 \
+                                                                              \
+            /* Test correctness */                                            \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                                  \
+                TRANSFORM_MFCC_NUMFRAMES * TRANSFORM_MFCC_NBDCT,              \
+                type));                                                       \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+MFCC_DEFINE_TEST(f32, float32_t);
+MFCC_DEFINE_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mfcc_tests)
+{
+    JTEST_TEST_CALL(arm_mfcc_f32_test);
+    JTEST_TEST_CALL(arm_mfcc_q15_test);
+}
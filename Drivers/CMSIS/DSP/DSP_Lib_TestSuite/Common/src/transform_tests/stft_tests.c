@@ -0,0 +1,133 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/**
+ *  The input is given to the STFT in chunks of TRANSFORM_STFT_CHUNK samples,
+ *  which are not related to the hop size. The frame ring is smaller than the
+ *  number of frames so it wraps around.
+ */
+#define TRANSFORM_STFT_BLOCKSIZE  1024
+#define TRANSFORM_STFT_CHUNK      100
+#define TRANSFORM_STFT_NUMFRAMES  7
+#define TRANSFORM_STFT_MAX_LEN    256
+
+static float32_t stft_window_f32[TRANSFORM_STFT_MAX_LEN];
+static q15_t stft_window_q15[TRANSFORM_STFT_MAX_LEN];
+static float32_t stft_state_f32[3 * TRANSFORM_STFT_MAX_LEN];
+static q15_t stft_state_q15[4 * TRANSFORM_STFT_MAX_LEN];
+
+/* Periodic Hann window */
+static void stft_make_window(uint16_t fftLen)
+{
+    uint32_t n;
+    float64_t w;
+
+    for (n = 0; n < fftLen; n++)
+    {
+        w = 0.5 - 0.5 * cos(6.283185307179586 * n / fftLen);
+        stft_window_f32[n] = (float32_t) w;
+        stft_window_q15[n] = (q15_t) (w * 32767.0);
+    }
+}
+
+/*
+STFT test template. Arguments are: data type suffix (f32/q15), output type,
+name of the test and power flag
+*/
+#define STFT_DEFINE_TEST(suffix, output_type, config_suffix, power_flag)      \
+    JTEST_DEFINE_TEST(arm_stft_##suffix##_##config_suffix##_test,             \
+                      arm_stft_##suffix)                                      \
+    {                                                                         \
+        arm_stft_instance_##suffix stft_inst_fut;                             \
+        arm_stft_instance_##suffix stft_inst_ref;                             \
+        uint32_t numBins, nbFrames, i, n;                                     \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            fftlen_idx, uint16_t, fftlen, transform_stft_fftlens              \
+            ,                                                                 \
+          TEMPLATE_DO_ARR_DESC(                                               \
+              hopdiv_idx, uint16_t, hopdiv, transform_stft_hopdivs            \
+              ,                                                               \
+              numBins = (fftlen / 2) + 1;                                     \
+              stft_make_window(fftlen);                                       \
+                                                                              \
+              memset(transform_fft_output_fut, 0,                             \
+                     sizeof(transform_fft_output_fut));                       \
+              memset(transform_fft_output_ref, 0,                             \
+                     sizeof(transform_fft_output_ref));                       \
+                                                                              \
+              /* Initialize the STFT Instances */                             \
+              arm_stft_init_##suffix(                                         \
+                  &stft_inst_fut, fftlen, fftlen / hopdiv,                    \
+                  stft_window_##suffix, stft_state_##suffix,                  \
+                  (output_type *) transform_fft_output_fut,                   \
+                  TRANSFORM_STFT_NUMFRAMES, power_flag);                      \
+                                                                              \
+              arm_stft_init_##suffix(                                         \
+                  &stft_inst_ref, fftlen, fftlen / hopdiv,                    \
+                  stft_window_##suffix, stft_state_##suffix,                  \
+                  (output_type *) transform_fft_output_ref,                   \
+                  TRANSFORM_STFT_NUMFRAMES, power_flag);                      \
+                                                                              \
+              /* Display parameter values */                                  \
+              JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                              "FFT Length: %d\n"                              \
+                              "Hop Size: %d\n"                                \
+                              "Power flag: %d\n",                             \
+                              (int)TRANSFORM_STFT_BLOCKSIZE,                  \
+                              (int)fftlen,                                    \
+                              (int)(fftlen / hopdiv),                         \
+                              (int)power_flag);                               \
+                                                                              \
+              /* Display cycle count and run test */                          \
+              nbFrames = 0;                                                   \
+              JTEST_COUNT_CYCLES(                                             \
+                  for (i = 0; i < TRANSFORM_STFT_BLOCKSIZE; i += n)           \
+                  {                                                           \
+                      n = TRANSFORM_STFT_BLOCKSIZE - i;                       \
+                      if (n > TRANSFORM_STFT_CHUNK)                           \
+                      {                                                       \
+                          n = TRANSFORM_STFT_CHUNK;                           \
+                      }                                                       \
+                      nbFrames += arm_stft_##suffix(                          \
+                          &stft_inst_fut,                                     \
+                          transform_fft_##suffix##_inputs + i, n);            \
+                  });                                                         \
+                                                                              \
+              if (nbFrames != ref_stft_##suffix(                              \
+                      &stft_inst_ref,                                         \
+                      (output_type *) transform_fft_##suffix##_inputs,        \
+                      TRANSFORM_STFT_BLOCKSIZE))                              \
+              {                                                               \
+                  return JTEST_TEST_FAILED;                                   \
+              }                                                               \
+                                                                              \
+              /* Test correctness */                                          \
+              TRANSFORM_SNR_COMPARE_INTERFACE(                                \
+                  TRANSFORM_STFT_NUMFRAMES * numBins,                         \
+                  output_type)));                                             \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+STFT_DEFINE_TEST(f32, float32_t, magnitude, 0U);
+STFT_DEFINE_TEST(f32, float32_t, power, 1U);
+STFT_DEFINE_TEST(q15, q15_t, magnitude, 0U);
+STFT_DEFINE_TEST(q15, q15_t, power, 1U);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stft_tests)
+{
+    JTEST_TEST_CALL(arm_stft_f32_magnitude_test);
+    JTEST_TEST_CALL(arm_stft_f32_power_test);
+    JTEST_TEST_CALL(arm_stft_q15_magnitude_test);
+    JTEST_TEST_CALL(arm_stft_q15_power_test);
+}
@@ -3250,6 +3250,43 @@ ARR_DESC_DEFINE(uint16_t,
                       32, 64, 128, 256,
                       512, 1024, 2048));
 
+ARR_DESC_DEFINE(uint16_t,
+                transform_stft_fftlens,
+                2,
+                CURLY(
+                      64, 256));
+
+/* The hop sizes are fftLen / hopdiv */
+ARR_DESC_DEFINE(uint16_t,
+                transform_stft_hopdivs,
+                3,
+                CURLY(
+                      4, 2, 1));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_mfcc_fftlens,
+                2,
+                CURLY(
+                      512, 1024));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_goertzel_blocksizes,
+                3,
+                CURLY(
+                      64, 256, 1024));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_goertzel_numbins,
+                5,
+                CURLY(
+                      1, 2, 4, 8, 16));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_sdft_windowlens,
+                2,
+                CURLY(
+                      64, 256));
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_F32 Structs */
 /*--------------------------------------------------------------------------------*/
@@ -3290,6 +3327,44 @@ ARR_DESC_DEFINE(const arm_cfft_instance_q31 *,
                     /* &arm_cfft_sR_q31_len4096 */
                     ));
 
+/*--------------------------------------------------------------------------------*/
+/* CFFT_F32 Structs compared with the tables computed in RAM */
+/*--------------------------------------------------------------------------------*/
+
+ARR_DESC_DEFINE(const arm_cfft_instance_f32 *,
+                transform_cfft_ram_f32_structs,
+                9,
+                CURLY(
+                    &arm_cfft_sR_f32_len16,
+                    &arm_cfft_sR_f32_len32,
+                    &arm_cfft_sR_f32_len64,
+                    &arm_cfft_sR_f32_len128,
+                    &arm_cfft_sR_f32_len256,
+                    &arm_cfft_sR_f32_len512,
+                    &arm_cfft_sR_f32_len1024,
+                    &arm_cfft_sR_f32_len2048,
+                    &arm_cfft_sR_f32_len4096
+                    ));
+
+/*--------------------------------------------------------------------------------*/
+/* CFFT_Q31 Structs compared with the tables computed in RAM */
+/*--------------------------------------------------------------------------------*/
+
+ARR_DESC_DEFINE(const arm_cfft_instance_q31 *,
+                transform_cfft_ram_q31_structs,
+                9,
+                CURLY(
+                    &arm_cfft_sR_q31_len16,
+                    &arm_cfft_sR_q31_len32,
+                    &arm_cfft_sR_q31_len64,
+                    &arm_cfft_sR_q31_len128,
+                    &arm_cfft_sR_q31_len256,
+                    &arm_cfft_sR_q31_len512,
+                    &arm_cfft_sR_q31_len1024,
+                    &arm_cfft_sR_q31_len2048,
+                    &arm_cfft_sR_q31_len4096
+                    ));
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_q15 Structs */
 /*--------------------------------------------------------------------------------*/
@@ -481,6 +481,10 @@ q31_t ref_cos_q31(q31_t x);
 
 q15_t ref_cos_q15(q15_t x);
 
+#define ref_exp_f32(a) expf(a)
+
+#define ref_log_f32(a) logf(a)
+
 arm_status ref_sqrt_q31(q31_t in, q31_t * pOut);
 
 arm_status ref_sqrt_q15(q15_t in, q15_t * pOut);
@@ -500,6 +504,12 @@ void ref_biquad_cascade_stereo_df2T_f32(
 	float32_t * pDst,
 	uint32_t blockSize);
 	
+void ref_biquad_bank_df2T_f32(
+	const arm_biquad_bank_df2T_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+	
 void ref_biquad_cascade_df2T_f64(
 	const arm_biquad_cascade_df2T_instance_f64 * S,
 	float64_t * pSrc,
@@ -850,6 +860,38 @@ void ref_fir_sparse_q7(
   q31_t * pScratchOut,
   uint32_t blockSize);
 
+void ref_fir_sparse_runs_f32(
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  const int32_t * pTapDelay,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_sparse_runs_q31(
+  uint16_t numTaps,
+  const q31_t * pCoeffs,
+  const int32_t * pTapDelay,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_sparse_runs_q15(
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  const int32_t * pTapDelay,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_sparse_runs_q7(
+  uint16_t numTaps,
+  const q7_t * pCoeffs,
+  const int32_t * pTapDelay,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
 void ref_iir_lattice_f32(
   const arm_iir_lattice_instance_f32 * S,
   float32_t * pSrc,
@@ -952,6 +994,14 @@ arm_status ref_mat_cmplx_mult_q15(
   const arm_matrix_instance_q15 * pSrcB,
   arm_matrix_instance_q15 * pDst);
 
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
 arm_status ref_mat_inverse_f32(
   const arm_matrix_instance_f32 * pSrc,
   arm_matrix_instance_f32 * pDst);
@@ -960,6 +1010,12 @@ arm_status ref_mat_inverse_f64(
   const arm_matrix_instance_f64 * pSrc,
   arm_matrix_instance_f64 * pDst);
 
+arm_status ref_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pu,
+  uint16_t * pp);
+
 arm_status ref_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -998,6 +1054,26 @@ arm_status ref_mat_scale_q15(
   int32_t shift,
   arm_matrix_instance_q15 * pDst);
 
+arm_status ref_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * lt,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+arm_status ref_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * ut,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+arm_status ref_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * lt,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst);
+
+arm_status ref_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * ut,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst);
+
 arm_status ref_mat_sub_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -1150,6 +1226,21 @@ void ref_rms_q15(
   uint32_t blockSize,
   q15_t * pResult);
 
+void ref_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult);
+
+void ref_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult);
+
+void ref_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult);
+
 void ref_std_f32(
   float32_t * pSrc,
   uint32_t blockSize,
@@ -1353,6 +1444,44 @@ void ref_rfft_q15(
   q15_t * pSrc,
   q15_t * pDst);
 
+uint32_t ref_stft_f32(
+	arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	uint32_t blockSize);
+
+uint32_t ref_stft_q15(
+	arm_stft_instance_q15 * S,
+	q15_t * pSrc,
+	uint32_t blockSize);
+
+void ref_mfcc_f32(
+	const arm_mfcc_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst);
+
+void ref_mfcc_q15(
+	const arm_mfcc_instance_q15 * S,
+	q15_t * pSrc,
+	q15_t * pDst);
+
+void ref_goertzel_f32(
+	const arm_goertzel_instance_f32 * S,
+	const float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+
+void ref_goertzel_q31(
+	const arm_goertzel_instance_q31 * S,
+	const q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize);
+
+void ref_sdft_f32(
+	const arm_sdft_instance_f32 * S,
+	const float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+
 void ref_dct4_f32(
   const arm_dct4_instance_f32 * S,
   float32_t * pState,
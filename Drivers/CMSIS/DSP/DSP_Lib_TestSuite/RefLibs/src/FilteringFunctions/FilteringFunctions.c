@@ -7,6 +7,7 @@
 #include "fir_interpolate.c"
 #include "fir_lattice.c"
 #include "fir_sparse.c"
+#include "fir_sparse_runs.c"
 #include "iir_lattice.c"
 #include "lms.c"
 
@@ -149,6 +149,50 @@ void ref_biquad_cascade_stereo_df2T_f32(
 	
 }
 
+void ref_biquad_bank_df2T_f32(
+	const arm_biquad_bank_df2T_instance_f32 * S,
+	      float32_t * pSrc,
+	      float32_t * pDst,
+	      uint32_t blockSize)
+{
+	uint32_t numChannels = S->numChannels;
+	uint32_t ch, stage, n;
+	float32_t b0, b1, b2, a1, a2, d1, d2, x, acc;
+	float32_t *pIn;
+
+	/* Each channel is filtered separately by its whole cascade */
+	for (ch = 0; ch < numChannels; ch++)
+	{
+		pIn = pSrc;
+
+		for (stage = 0; stage < S->numStages; stage++)
+		{
+			b0 = S->pCoeffs[(5 * stage + 0) * numChannels + ch];
+			b1 = S->pCoeffs[(5 * stage + 1) * numChannels + ch];
+			b2 = S->pCoeffs[(5 * stage + 2) * numChannels + ch];
+			a1 = S->pCoeffs[(5 * stage + 3) * numChannels + ch];
+			a2 = S->pCoeffs[(5 * stage + 4) * numChannels + ch];
+
+			d1 = S->pState[(2 * stage) * numChannels + ch];
+			d2 = S->pState[(2 * stage + 1) * numChannels + ch];
+
+			for (n = 0; n < blockSize; n++)
+			{
+				x = pIn[n * numChannels + ch];
+				acc = (b0 * x) + d1;
+				pDst[n * numChannels + ch] = acc;
+				d1 = ((b1 * x) + (a1 * acc)) + d2;
+				d2 = (b2 * x) + (a2 * acc);
+			}
+
+			S->pState[(2 * stage) * numChannels + ch] = d1;
+			S->pState[(2 * stage + 1) * numChannels + ch] = d2;
+
+			pIn = pDst;
+		}
+	}
+}
+
 void ref_biquad_cascade_df2T_f64(
 	const arm_biquad_cascade_df2T_instance_f64 * S,
 	float64_t * pSrc,
@@ -0,0 +1,107 @@
+#include "ref.h"
+
+/*
+ * The sparse filter is computed in direct form from the taps before they are
+ * grouped in runs: y[n] = sum(pCoeffs[k] * x[n - pTapDelay[k]]), the samples
+ * before the start of the block being zero. The fixed-point sums are exact and
+ * only saturated at the output, like arm_fir_sparse_runs_q31/q15/q7.
+ */
+void ref_fir_sparse_runs_f32(
+	uint16_t numTaps,
+	const float32_t * pCoeffs,
+	const int32_t * pTapDelay,
+	const float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t n, k;
+	float64_t sum;
+
+	for(n=0;n<blockSize;n++)
+	{
+		sum = 0;
+		for(k=0;k<numTaps;k++)
+		{
+			if ((int32_t)n >= pTapDelay[k])
+			{
+				sum += (float64_t)pCoeffs[k] * pSrc[n - pTapDelay[k]];
+			}
+		}
+		pDst[n] = (float32_t)sum;
+	}
+}
+
+void ref_fir_sparse_runs_q31(
+	uint16_t numTaps,
+	const q31_t * pCoeffs,
+	const int32_t * pTapDelay,
+	const q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t n, k;
+	q63_t sum;
+
+	for(n=0;n<blockSize;n++)
+	{
+		sum = 0;
+		for(k=0;k<numTaps;k++)
+		{
+			if ((int32_t)n >= pTapDelay[k])
+			{
+				sum += (q63_t)pCoeffs[k] * pSrc[n - pTapDelay[k]];
+			}
+		}
+		pDst[n] = ref_sat_q31(sum >> 31);
+	}
+}
+
+void ref_fir_sparse_runs_q15(
+	uint16_t numTaps,
+	const q15_t * pCoeffs,
+	const int32_t * pTapDelay,
+	const q15_t * pSrc,
+	q15_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t n, k;
+	q63_t sum;
+
+	for(n=0;n<blockSize;n++)
+	{
+		sum = 0;
+		for(k=0;k<numTaps;k++)
+		{
+			if ((int32_t)n >= pTapDelay[k])
+			{
+				sum += (q31_t)pCoeffs[k] * pSrc[n - pTapDelay[k]];
+			}
+		}
+		pDst[n] = ref_sat_q15((q31_t)(sum >> 15));
+	}
+}
+
+void ref_fir_sparse_runs_q7(
+	uint16_t numTaps,
+	const q7_t * pCoeffs,
+	const int32_t * pTapDelay,
+	const q7_t * pSrc,
+	q7_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t n, k;
+	q31_t sum;
+
+	for(n=0;n<blockSize;n++)
+	{
+		sum = 0;
+		for(k=0;k<numTaps;k++)
+		{
+			if ((int32_t)n >= pTapDelay[k])
+			{
+				sum += (q15_t)pCoeffs[k] * pSrc[n - pTapDelay[k]];
+			}
+		}
+		pDst[n] = (q7_t)ref_sat_n(sum >> 7, 8);
+	}
+}
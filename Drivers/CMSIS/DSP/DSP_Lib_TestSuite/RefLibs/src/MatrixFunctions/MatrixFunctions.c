@@ -1,9 +1,12 @@
 
 #include "mat_add.c"
+#include "mat_cholesky.c"
 #include "mat_cmplx_mult.c"
 #include "mat_inverse.c"
+#include "mat_lu.c"
 #include "mat_mult.c"
 #include "mat_scale.c"
+#include "mat_solve_triangular.c"
 #include "mat_sub.c"
 #include "mat_trans.c"
 
@@ -0,0 +1,91 @@
+#include "ref.h"
+
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+	uint32_t i,j,k,n;
+	float64_t sum;
+	
+	n = pSrc->numRows;
+	
+	for(j=0;j<n;j++)
+	{
+		sum = pSrc->pData[j*n + j];
+		for(k=0;k<j;k++)
+		{
+			sum -= (float64_t)pDst->pData[j*n + k] * pDst->pData[j*n + k];
+		}
+		
+		if (sum <= 0)
+		{
+			return ARM_MATH_DECOMPOSITION_FAILURE;
+		}
+		pDst->pData[j*n + j] = sqrt(sum);
+		
+		for(i=j+1;i<n;i++)
+		{
+			sum = pSrc->pData[i*n + j];
+			for(k=0;k<j;k++)
+			{
+				sum -= (float64_t)pDst->pData[i*n + k] * pDst->pData[j*n + k];
+			}
+			pDst->pData[i*n + j] = sum / pDst->pData[j*n + j];
+		}
+	}
+	
+	for(i=0;i<n;i++)
+	{
+		for(j=i+1;j<n;j++)
+		{
+			pDst->pData[i*n + j] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+	uint32_t i,j,k,n;
+	float64_t sum;
+	
+	n = pSrc->numRows;
+	
+	for(j=0;j<n;j++)
+	{
+		sum = pSrc->pData[j*n + j];
+		for(k=0;k<j;k++)
+		{
+			sum -= pDst->pData[j*n + k] * pDst->pData[j*n + k];
+		}
+		
+		if (sum <= 0)
+		{
+			return ARM_MATH_DECOMPOSITION_FAILURE;
+		}
+		pDst->pData[j*n + j] = sqrt(sum);
+		
+		for(i=j+1;i<n;i++)
+		{
+			sum = pSrc->pData[i*n + j];
+			for(k=0;k<j;k++)
+			{
+				sum -= pDst->pData[i*n + k] * pDst->pData[j*n + k];
+			}
+			pDst->pData[i*n + j] = sum / pDst->pData[j*n + j];
+		}
+	}
+	
+	for(i=0;i<n;i++)
+	{
+		for(j=i+1;j<n;j++)
+		{
+			pDst->pData[i*n + j] = 0;
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
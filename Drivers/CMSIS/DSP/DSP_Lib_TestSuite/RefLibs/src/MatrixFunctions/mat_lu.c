@@ -0,0 +1,82 @@
+#include "ref.h"
+
+arm_status ref_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pu,
+  uint16_t * pp)
+{
+	uint32_t i,j,k,p,n;
+	float64_t *a = (float64_t*)scratchArray;
+	float64_t tmp, factor;
+	uint16_t idx;
+	
+	n = pSrc->numRows;
+	
+	for(i=0;i<n*n;i++)
+	{
+		a[i] = pSrc->pData[i];
+		pl->pData[i] = 0;
+	}
+	for(i=0;i<n;i++)
+	{
+		pp[i] = i;
+	}
+	
+	for(k=0;k<n;k++)
+	{
+		p = k;
+		for(i=k+1;i<n;i++)
+		{
+			if (fabs(a[i*n + k]) > fabs(a[p*n + k]))
+			{
+				p = i;
+			}
+		}
+		
+		if (a[p*n + k] == 0)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+		
+		for(j=0;j<n;j++)
+		{
+			tmp = a[k*n + j];
+			a[k*n + j] = a[p*n + j];
+			a[p*n + j] = tmp;
+		}
+		idx = pp[k];
+		pp[k] = pp[p];
+		pp[p] = idx;
+		
+		/* a keeps the factors of L below the diagonal */
+		for(i=k+1;i<n;i++)
+		{
+			factor = a[i*n + k] / a[k*n + k];
+			a[i*n + k] = factor;
+			for(j=k+1;j<n;j++)
+			{
+				a[i*n + j] -= factor * a[k*n + j];
+			}
+		}
+	}
+	
+	for(i=0;i<n;i++)
+	{
+		for(j=0;j<n;j++)
+		{
+			if (j < i)
+			{
+				pl->pData[i*n + j] = a[i*n + j];
+				pu->pData[i*n + j] = 0;
+			}
+			else
+			{
+				pl->pData[i*n + j] = (i == j) ? 1 : 0;
+				pu->pData[i*n + j] = a[i*n + j];
+			}
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,109 @@
+#include "ref.h"
+
+arm_status ref_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * lt,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst)
+{
+	uint32_t i,j,k,n,cols;
+	float64_t sum;
+	
+	n = lt->numRows;
+	cols = a->numCols;
+	
+	for(j=0;j<cols;j++)
+	{
+		for(i=0;i<n;i++)
+		{
+			sum = a->pData[i*cols + j];
+			for(k=0;k<i;k++)
+			{
+				sum -= (float64_t)lt->pData[i*n + k] * dst->pData[k*cols + j];
+			}
+			dst->pData[i*cols + j] = sum / lt->pData[i*n + i];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * ut,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst)
+{
+	uint32_t i,j,k,n,cols;
+	float64_t sum;
+	
+	n = ut->numRows;
+	cols = a->numCols;
+	
+	for(j=0;j<cols;j++)
+	{
+		for(i=n;i>0;i--)
+		{
+			sum = a->pData[(i-1)*cols + j];
+			for(k=i;k<n;k++)
+			{
+				sum -= (float64_t)ut->pData[(i-1)*n + k] * dst->pData[k*cols + j];
+			}
+			dst->pData[(i-1)*cols + j] = sum / ut->pData[(i-1)*n + (i-1)];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * lt,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst)
+{
+	uint32_t i,j,k,n,cols;
+	float64_t sum;
+	
+	n = lt->numRows;
+	cols = a->numCols;
+	
+	for(j=0;j<cols;j++)
+	{
+		for(i=0;i<n;i++)
+		{
+			sum = a->pData[i*cols + j];
+			for(k=0;k<i;k++)
+			{
+				sum -= lt->pData[i*n + k] * dst->pData[k*cols + j];
+			}
+			dst->pData[i*cols + j] = sum / lt->pData[i*n + i];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * ut,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst)
+{
+	uint32_t i,j,k,n,cols;
+	float64_t sum;
+	
+	n = ut->numRows;
+	cols = a->numCols;
+	
+	for(j=0;j<cols;j++)
+	{
+		for(i=n;i>0;i--)
+		{
+			sum = a->pData[(i-1)*cols + j];
+			for(k=i;k<n;k++)
+			{
+				sum -= ut->pData[(i-1)*n + k] * dst->pData[k*cols + j];
+			}
+			dst->pData[(i-1)*cols + j] = sum / ut->pData[(i-1)*n + (i-1)];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -4,5 +4,6 @@
 #include "min.c"
 #include "power.c"
 #include "rms.c"
+#include "stats.c"
 #include "std.c"
 #include "var.c"
@@ -0,0 +1,53 @@
+#include "ref.h"
+
+void ref_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+	uint32_t i;
+	float64_t sum=0, sumsq=0, mean, dev=0;
+	
+	/* Two-pass algorithm in double precision */
+	for(i=0;i<blockSize;i++)
+	{
+			sum += pSrc[i];
+			sumsq += (float64_t)pSrc[i] * pSrc[i];
+	}
+	mean = sum / blockSize;
+	
+	for(i=0;i<blockSize;i++)
+	{
+			dev += (pSrc[i] - mean) * (pSrc[i] - mean);
+	}
+	
+	pResult->mean = (float32_t)mean;
+	pResult->var = (blockSize > 1) ? (float32_t)(dev / (blockSize - 1)) : 0;
+	pResult->rms = (float32_t)sqrt(sumsq / blockSize);
+	ref_min_f32(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_f32(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
+
+void ref_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+	ref_mean_q31(pSrc, blockSize, &pResult->mean);
+	ref_var_q31(pSrc, blockSize, &pResult->var);
+	ref_rms_q31(pSrc, blockSize, &pResult->rms);
+	ref_min_q31(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_q31(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
+
+void ref_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+	ref_mean_q15(pSrc, blockSize, &pResult->mean);
+	ref_var_q15(pSrc, blockSize, &pResult->var);
+	ref_rms_q15(pSrc, blockSize, &pResult->rms);
+	ref_min_q15(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_q15(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
@@ -1,4 +1,8 @@
 
 #include "cfft.c"
 #include "dct4.c"
+#include "goertzel.c"
+#include "mfcc.c"
 #include "rfft.c"
+#include "sdft.c"
+#include "stft.c"
@@ -0,0 +1,77 @@
+#include "ref.h"
+
+/*
+ * The DFT at the angular frequency of each coefficient is computed directly,
+ * in double precision. The frequency of the resonator is given by the cosine
+ * alone: w = acos(cos(w)) and not the angle of the rounded (cos, sin) pair,
+ * which is not accurate enough for low frequencies.
+ */
+static void ref_goertzel_bin(
+	const float64_t * pSrc,
+	uint32_t blockSize,
+	float64_t w,
+	float64_t * pRe,
+	float64_t * pIm)
+{
+	uint32_t n;
+	float64_t re = 0, im = 0;
+
+	for(n=0;n<blockSize;n++)
+	{
+		re += pSrc[n] * cos(w * n);
+		im -= pSrc[n] * sin(w * n);
+	}
+
+	*pRe = re;
+	*pIm = im;
+}
+
+void ref_goertzel_f32(
+	const arm_goertzel_instance_f32 * S,
+	const float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t n, k;
+	float64_t buf[4096], re, im, w;
+
+	for(n=0;n<blockSize;n++)
+	{
+		buf[n] = pSrc[n];
+	}
+
+	for(k=0;k<S->numBins;k++)
+	{
+		w = acos(S->pCoeffs[k]);
+		ref_goertzel_bin(buf, blockSize, w, &re, &im);
+		pDst[k] = (float32_t)(re * re + im * im);
+	}
+}
+
+void ref_goertzel_q31(
+	const arm_goertzel_instance_q31 * S,
+	const q31_t * pSrc,
+	q31_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t n, k, shift = 0;
+	float64_t buf[4096], re, im, w;
+
+	/* The DFT is divided by 2^b, b being the number of bits of blockSize-1 */
+	while((shift < 32) && ((1U << shift) < blockSize))
+	{
+		shift++;
+	}
+
+	for(n=0;n<blockSize;n++)
+	{
+		buf[n] = (float64_t)pSrc[n] / 2147483648.0 / (float64_t)(1U << shift);
+	}
+
+	for(k=0;k<S->numBins;k++)
+	{
+		w = acos((float64_t)S->pCoeffs[k] / 2147483648.0);
+		ref_goertzel_bin(buf, blockSize, w, &re, &im);
+		pDst[k] = ref_sat_q31((q63_t)((re * re + im * im) * 2147483648.0));
+	}
+}
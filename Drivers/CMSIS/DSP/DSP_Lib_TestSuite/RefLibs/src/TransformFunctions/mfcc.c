@@ -0,0 +1,109 @@
+#include "ref.h"
+
+/*
+ * The magnitudes are computed with a direct DFT in double precision.
+ * The Mel filters, the window and the DCT are the tables of the instance.
+ */
+static void ref_mfcc_energies(
+	const float64_t * pFrame,
+	uint32_t fftLen,
+	uint32_t nbMelFilters,
+	const uint32_t * filterPos,
+	const uint32_t * filterLengths,
+	const float64_t * pCoefs,
+	float64_t * pEnergies)
+{
+	uint32_t i, j, k, n;
+	float64_t re, im, phi, mag[4096 / 2 + 1];
+
+	for(k=0;k<=fftLen/2;k++)
+	{
+		re = 0;
+		im = 0;
+		for(n=0;n<fftLen;n++)
+		{
+			phi = 6.283185307179586 * (float64_t)((k * n) % fftLen) / fftLen;
+			re += pFrame[n] * cos(phi);
+			im -= pFrame[n] * sin(phi);
+		}
+		mag[k] = sqrt(re * re + im * im);
+	}
+
+	for(i=0;i<nbMelFilters;i++)
+	{
+		pEnergies[i] = 0;
+		for(j=0;j<filterLengths[i];j++)
+		{
+			pEnergies[i] += mag[filterPos[i] + j] * *pCoefs++;
+		}
+	}
+}
+
+void ref_mfcc_f32(
+	const arm_mfcc_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst)
+{
+	uint32_t i, j, nbCoefs = 0;
+	float64_t frame[4096], coefs[4096], energies[4096 / 2 + 1], sum;
+
+	for(i=0;i<S->fftLen;i++)
+	{
+		frame[i] = (float64_t)pSrc[i] * S->windowCoefs[i];
+	}
+
+	for(i=0;i<S->nbMelFilters;i++)
+	{
+		for(j=0;j<S->filterLengths[i];j++, nbCoefs++)
+		{
+			coefs[nbCoefs] = S->filterCoefs[nbCoefs];
+		}
+	}
+
+	ref_mfcc_energies(frame, S->fftLen, S->nbMelFilters, S->filterPos, S->filterLengths, coefs, energies);
+
+	for(i=0;i<S->nbDctOutputs;i++)
+	{
+		sum = 0;
+		for(j=0;j<S->nbMelFilters;j++)
+		{
+			sum += S->dctCoefs[i * S->nbMelFilters + j] * log(energies[j] + 1.0e-6);
+		}
+		pDst[i] = (float32_t)sum;
+	}
+}
+
+void ref_mfcc_q15(
+	const arm_mfcc_instance_q15 * S,
+	q15_t * pSrc,
+	q15_t * pDst)
+{
+	uint32_t i, j, nbCoefs = 0;
+	float64_t frame[4096], coefs[4096], energies[4096 / 2 + 1], sum;
+
+	for(i=0;i<S->fftLen;i++)
+	{
+		frame[i] = (float64_t)pSrc[i] * S->windowCoefs[i] / (32768.0 * 32768.0);
+	}
+
+	for(i=0;i<S->nbMelFilters;i++)
+	{
+		for(j=0;j<S->filterLengths[i];j++, nbCoefs++)
+		{
+			coefs[nbCoefs] = S->filterCoefs[nbCoefs] / 32768.0;
+		}
+	}
+
+	ref_mfcc_energies(frame, S->fftLen, S->nbMelFilters, S->filterPos, S->filterLengths, coefs, energies);
+
+	/* MFCC in 8.7 format */
+	for(i=0;i<S->nbDctOutputs;i++)
+	{
+		sum = 0;
+		for(j=0;j<S->nbMelFilters;j++)
+		{
+			sum += S->dctCoefs[i * S->nbMelFilters + j] / 32768.0 * log(energies[j]);
+		}
+		pDst[i] = ref_sat_q15((q31_t)floor(sum * 128.0 + 0.5));
+	}
+}
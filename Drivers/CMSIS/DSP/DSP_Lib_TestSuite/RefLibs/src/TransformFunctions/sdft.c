@@ -0,0 +1,35 @@
+#include "ref.h"
+
+/*
+ * The bins are computed from the whole input signal given since the
+ * initialization of the instance: the windowLen last samples, weighted by
+ * damping^m (m being the age of the sample), are multiplied by
+ * exp(i*w*(m+1)) in double precision.
+ */
+void ref_sdft_f32(
+	const arm_sdft_instance_f32 * S,
+	const float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+	uint32_t m, k;
+	float64_t re, im, w, r;
+
+	for(k=0;k<S->numBins;k++)
+	{
+		w = atan2(S->pCoeffs[S->numBins + k], S->pCoeffs[k]);
+		re = 0;
+		im = 0;
+		r = 1;
+
+		for(m=0;(m<S->windowLen) && (m<blockSize);m++)
+		{
+			re += r * pSrc[blockSize - 1 - m] * cos(w * (m + 1));
+			im += r * pSrc[blockSize - 1 - m] * sin(w * (m + 1));
+			r *= S->damping;
+		}
+
+		pDst[2 * k] = (float32_t)re;
+		pDst[2 * k + 1] = (float32_t)im;
+	}
+}
@@ -0,0 +1,97 @@
+#include "ref.h"
+
+/*
+ * The frames are computed from the whole input signal, preceded by
+ * fftLen-hopSize zeros, with a direct DFT in double precision.
+ */
+static void ref_stft_bin(
+	const float64_t * pFrame,
+	uint32_t fftLen,
+	uint32_t k,
+	float64_t * pRe,
+	float64_t * pIm)
+{
+	uint32_t n;
+	float64_t re = 0, im = 0, phi;
+
+	for(n=0;n<fftLen;n++)
+	{
+		phi = 6.283185307179586 * (float64_t)((k * n) % fftLen) / fftLen;
+		re += pFrame[n] * cos(phi);
+		im -= pFrame[n] * sin(phi);
+	}
+
+	*pRe = re;
+	*pIm = im;
+}
+
+uint32_t ref_stft_f32(
+	arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	uint32_t blockSize)
+{
+	uint32_t fftLen = S->fftLen, numBins = fftLen / 2 + 1;
+	uint32_t frame, n, k, nbFrames = blockSize / S->hopSize;
+	int32_t idx;
+	float64_t buf[4096], re, im;
+	float32_t *pFrame;
+
+	for(frame=0;frame<nbFrames;frame++)
+	{
+		/* The last sample of the frame is pSrc[(frame+1)*hopSize-1] */
+		for(n=0;n<fftLen;n++)
+		{
+			idx = (int32_t)((frame + 1) * S->hopSize) - (int32_t)fftLen + (int32_t)n;
+			buf[n] = (idx < 0) ? 0 : (float64_t)pSrc[idx] * S->pWindow[n];
+		}
+
+		pFrame = S->pFrames + ((frame % S->numFrames) * numBins);
+
+		for(k=0;k<numBins;k++)
+		{
+			ref_stft_bin(buf, fftLen, k, &re, &im);
+			pFrame[k] = (float32_t)(S->powerFlag ? (re * re + im * im) : sqrt(re * re + im * im));
+		}
+	}
+
+	return nbFrames;
+}
+
+uint32_t ref_stft_q15(
+	arm_stft_instance_q15 * S,
+	q15_t * pSrc,
+	uint32_t blockSize)
+{
+	uint32_t fftLen = S->fftLen, numBins = fftLen / 2 + 1;
+	uint32_t frame, n, k, nbFrames = blockSize / S->hopSize;
+	int32_t idx;
+	float64_t buf[4096], re, im, v;
+	q15_t *pFrame;
+
+	for(frame=0;frame<nbFrames;frame++)
+	{
+		/* Q15 product of the sample and of the window */
+		for(n=0;n<fftLen;n++)
+		{
+			idx = (int32_t)((frame + 1) * S->hopSize) - (int32_t)fftLen + (int32_t)n;
+			buf[n] = (idx < 0) ? 0 : (float64_t)(((q31_t)pSrc[idx] * S->pWindow[n]) >> 15);
+		}
+
+		pFrame = S->pFrames + ((frame % S->numFrames) * numBins);
+
+		for(k=0;k<numBins;k++)
+		{
+			/* arm_rfft_q15 is scaling down by fftLen */
+			ref_stft_bin(buf, fftLen, k, &re, &im);
+			re /= fftLen;
+			im /= fftLen;
+
+			/* 2.14 magnitude, 3.13 power as computed by arm_cmplx_mag_q15 and arm_cmplx_mag_squared_q15,
+			   which are truncating their results */
+			v = S->powerFlag ? (re * re + im * im) / 131072.0 : sqrt(re * re + im * im) / 2.0;
+			pFrame[k] = (q15_t)floor(v);
+		}
+	}
+
+	return nbFrames;
+}
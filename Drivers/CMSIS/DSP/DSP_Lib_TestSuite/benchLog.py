@@ -0,0 +1,187 @@
+#!/usr/bin/python3
+
+# Convert the trace of a native host build of the DSP_Lib_TestSuite
+# (HOST, X86SIMD or X86AVX2 cmake options) to a JSON benchmark file.
+#
+# Each "Cycles:" line of the trace is a measurement of the function under
+# test. The parameters dumped before it (Block Size, Number of Taps ...)
+# identify the measurement. The same measurement done several times
+# (for each input buffer of a test, or in several runs of the test suite)
+# is reduced to its minimum.
+#
+# e.g.: benchLog.py --run ./DSP_Lib_TestSuite --runs 10 -o benchmark.json
+#       benchLog.py trace.log -o new.json --compare benchmark.json
+
+import argparse
+import json
+import subprocess
+import sys
+
+# Lines of the trace which are not parameters of a measurement
+not_params = ["Cycles", "Time", "SNR", "Error", "Cycle Counter", "Repeat", "Jobs"]
+
+
+def nbSamples(params):
+    if "Block Size" in params:
+        return int(params["Block Size"])
+    if "Input A Length" in params:
+        return int(params["Input A Length"])
+    if "Matrix Dimensions" in params:
+        dims = params["Matrix Dimensions"].split()
+        # "RxC" or "A RxC  B RxC" : the number of elements of A is used
+        rows, cols = [d for d in dims if "x" in d][0].split("x")
+        return int(rows) * int(cols)
+    return 1
+
+
+def parseLog(lines):
+    bench = {"counter": "", "repeat": 1, "results": []}
+    results = {}
+    group = test = fut = ""
+    params = {}
+    nextName = None
+    cycles = None
+    testKeys = []
+
+    for line in lines:
+        line = line.rstrip("\n")
+
+        if nextName is not None:
+            if nextName == "group":
+                group = line
+            elif nextName == "test":
+                test = line
+                params = {}
+                testKeys = []
+            else:
+                fut = line
+            nextName = None
+            continue
+
+        if line == "Group Name:":
+            nextName = "group"
+            continue
+        if line == "Test Name:":
+            nextName = "test"
+            continue
+        if line == "Function Under Test:":
+            nextName = "fut"
+            continue
+        if line == "Test Failed":
+            for key in testKeys:
+                results[key]["passed"] = False
+            continue
+
+        if ":" not in line:
+            continue
+        name, value = [s.strip() for s in line.split(":", 1)]
+
+        if name == "Cycle Counter":
+            bench["counter"] = value
+        elif name == "Repeat":
+            bench["repeat"] = int(value)
+        elif name == "Cycles":
+            cycles = int(value)
+        elif name == "Time" and cycles is not None:
+            ns = int(value.split()[0])
+            key = (fut, test, tuple(sorted(params.items())))
+            if key not in results:
+                results[key] = {"function": fut,
+                                "test": test,
+                                "group": group,
+                                "params": dict(params),
+                                "samples": nbSamples(params),
+                                "cycles": cycles,
+                                "ns": ns,
+                                "runs": 0,
+                                "passed": True}
+            if key not in testKeys:
+                testKeys.append(key)
+            r = results[key]
+            r["cycles"] = min(r["cycles"], cycles)
+            r["ns"] = min(r["ns"], ns)
+            r["runs"] += 1
+            cycles = None
+        elif name not in not_params:
+            params[name] = value
+
+    for r in results.values():
+        r["cycles_per_sample"] = r["cycles"] / r["samples"]
+        r["samples_per_s"] = (r["samples"] * 1e9 / r["ns"]) if r["ns"] > 0 else 0.0
+        bench["results"].append(r)
+
+    return bench
+
+
+def benchKey(r):
+    return (r["function"], r["test"], tuple(sorted(r["params"].items())))
+
+
+def compare(base, new, threshold, minCycles):
+    baseResults = {benchKey(r): r for r in base["results"]}
+    regressions = 0
+
+    if base["counter"] != new["counter"]:
+        print("Warning: cycle counters are different ({0} and {1})".format(
+            base["counter"], new["counter"]))
+
+    for r in new["results"]:
+        b = baseResults.get(benchKey(r))
+        # Short measurements are dominated by the noise of the host
+        if b is None or b["cycles"] < minCycles:
+            continue
+        ratio = 100.0 * (r["cycles"] - b["cycles"]) / b["cycles"]
+        if ratio > threshold:
+            regressions += 1
+            print("{0} {1} : {2} -> {3} cycles ({4:+.1f}%)".format(
+                r["function"],
+                " ".join("{0}={1}".format(k, v) for k, v in sorted(r["params"].items())),
+                b["cycles"], r["cycles"], ratio))
+
+    print("{0} regressions above {1}%".format(regressions, threshold))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="DSP_Lib_TestSuite host benchmark")
+    parser.add_argument("log", nargs="?", help="trace of the test suite (default stdin)")
+    parser.add_argument("--run", help="run this executable and parse its trace")
+    parser.add_argument("--runs", type=int, default=1,
+                        help="number of runs of the executable (default 1)")
+    parser.add_argument("-o", "--output", help="JSON file (default stdout)")
+    parser.add_argument("--label", default="", help="name of the library revision")
+    parser.add_argument("--compare", help="reference JSON file")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="cycle increase in %% reported as a regression")
+    parser.add_argument("--min-cycles", type=int, default=1000,
+                        help="measurements below are not compared (default 1000)")
+    args = parser.parse_args()
+
+    if args.run:
+        lines = []
+        for i in range(args.runs):
+            lines += subprocess.run([args.run], stdout=subprocess.PIPE,
+                                    universal_newlines=True).stdout.split("\n")
+    elif args.log:
+        lines = open(args.log).read().split("\n")
+    else:
+        lines = sys.stdin.read().split("\n")
+
+    bench = parseLog(lines)
+    bench["label"] = args.label
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(bench, f, indent=1)
+    elif not args.compare:
+        json.dump(bench, sys.stdout, indent=1)
+
+    if args.compare:
+        with open(args.compare) as f:
+            base = json.load(f)
+        if compare(base, bench, args.threshold, args.min_cycles) > 0:
+            exit(1)
+
+
+if __name__ == "__main__":
+    main()
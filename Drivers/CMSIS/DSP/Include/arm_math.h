@@ -128,6 +128,22 @@
    * of some DSP functions. Experimental Neon versions currently do not have better
    * performances than the scalar versions.
    *
+   * - ARM_MATH_X86_SIMD:
+   *
+   * Define macro ARM_MATH_X86_SIMD to enable SSE2 versions of the floating-point
+   * DSP functions which have a Neon version, when the library is built for an x86
+   * host (simulation or golden model). When the compiler is also targeting AVX2 and
+   * FMA (<code>-mavx2 -mfma</code>), the same code paths are using 8-lane vectors.
+   * Results of the floating-point functions are not bit exact with the scalar versions
+   * because the order of the accumulations is different. The fixed-point FIR, biquad DF1
+   * and convolution functions having an x86 version are bit exact with the scalar versions.
+   *
+   * - ARM_MATH_DSP_EMULATION:
+   *
+   * Define macros ARM_MATH_DSP and ARM_MATH_DSP_EMULATION to build the Cortex-M4/M7 versions
+   * of the functions for a host without the DSP extension. The SIMD intrinsics are then
+   * replaced by their C versions, so the results are bit exact with the Cortex-M4/M7 library.
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -331,6 +347,10 @@
 #include <arm_neon.h>
 #endif
 
+#if defined(ARM_MATH_X86_SIMD)
+#include <immintrin.h>
+#endif
+
 
 #ifdef   __cplusplus
 extern "C"
@@ -380,7 +400,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH  = -3,        /**< Size of matrices is not compatible with the operation */
     ARM_MATH_NANINF         = -4,        /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR       = -5,        /**< Input matrix is singular and cannot be inverted */
-    ARM_MATH_TEST_FAILURE   = -6         /**< Test Failed */
+    ARM_MATH_TEST_FAILURE   = -6,        /**< Test Failed */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Decomposition Failed */
   } arm_status;
 
   /**
@@ -638,7 +659,7 @@ compiler file in Core or Core_A would not make sense.
   }
 #endif
 
-#ifndef ARM_MATH_DSP
+#if !defined (ARM_MATH_DSP) || defined (ARM_MATH_DSP_EMULATION)
   /**
    * @brief definition to pack two 16 bit values.
    */
@@ -856,10 +877,731 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
 
 #endif
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/*
+ * @brief Vector helpers for the x86 versions of the floating-point functions.
+ * A vector is 8 floats wide when AVX2 and FMA are enabled and 4 floats wide (SSE2) otherwise.
+ * ARM_X86_LANES_F32 must be used to compute the loop counts.
+ */
+#if defined(__AVX2__) && defined(__FMA__)
+
+#define ARM_X86_LANES_F32 8U
+
+typedef __m256 arm_x86_f32v_t;
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_load_f32_x86(const float32_t * p)
+{
+  return _mm256_loadu_ps(p);
+}
+
+__STATIC_FORCEINLINE void __arm_vec_store_f32_x86(float32_t * p, arm_x86_f32v_t v)
+{
+  _mm256_storeu_ps(p, v);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_dup_f32_x86(float32_t x)
+{
+  return _mm256_set1_ps(x);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_add_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_add_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_sub_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_sub_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_mul_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_mul_ps(a, b);
+}
+
+/* acc + a * b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_mla_f32_x86(arm_x86_f32v_t acc, arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_fmadd_ps(a, b, acc);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_max_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_max_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_min_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_min_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_abs_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_neg_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_xor_ps(_mm256_set1_ps(-0.0f), a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_sqrt_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_sqrt_ps(a);
+}
+
+/* Sum of the lanes */
+__STATIC_FORCEINLINE float32_t __arm_vec_hsum_f32_x86(arm_x86_f32v_t v)
+{
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+
+  return _mm_cvtss_f32(sum);
+}
+
+/* Sums of adjacent lanes : a0+a1, a2+a3, ..., b0+b1, b2+b3, ... */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_pairadd_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  __m256d sum = _mm256_castps_pd(_mm256_hadd_ps(a, b));
+
+  return _mm256_castpd_ps(_mm256_permute4x64_pd(sum, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+/* Load ARM_X86_LANES_F32/2 values and duplicate each of them : p0, p0, p1, p1, ... */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_load_dup2_f32_x86(const float32_t * p)
+{
+  __m128 v = _mm_loadu_ps(p);
+
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(v, v)), _mm_unpackhi_ps(v, v), 1);
+}
+
+/* Swap the real and imaginary parts of interleaved complex numbers */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_swap_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+/* Conjugate of interleaved complex numbers */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_conj_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_xor_ps(a, _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f));
+}
+
+/* Product of interleaved complex numbers (re, im, re, im, ...) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_mult_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  arm_x86_f32v_t bRe = _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 0, 0));
+  arm_x86_f32v_t bIm = _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 1, 1));
+  arm_x86_f32v_t aSwap = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+
+  return _mm256_addsub_ps(_mm256_mul_ps(a, bRe), _mm256_mul_ps(aSwap, bIm));
+}
+
+/* Load one complex number and duplicate it in all the lanes : re, im, re, im, ... */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_dup_f32_x86(const float32_t * p)
+{
+  return _mm256_castpd_ps(_mm256_broadcast_sd((const double *) p));
+}
+
+/* Interleave the complex numbers of a and b : a0, b0, a1, b1 (low half) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_zip_lo_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  __m256d lo = _mm256_unpacklo_pd(_mm256_castps_pd(a), _mm256_castps_pd(b));
+  __m256d hi = _mm256_unpackhi_pd(_mm256_castps_pd(a), _mm256_castps_pd(b));
+
+  return _mm256_castpd_ps(_mm256_permute2f128_pd(lo, hi, 0x20));
+}
+
+/* Interleave the complex numbers of a and b : a2, b2, a3, b3 (high half) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_zip_hi_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  __m256d lo = _mm256_unpacklo_pd(_mm256_castps_pd(a), _mm256_castps_pd(b));
+  __m256d hi = _mm256_unpackhi_pd(_mm256_castps_pd(a), _mm256_castps_pd(b));
+
+  return _mm256_castpd_ps(_mm256_permute2f128_pd(lo, hi, 0x31));
+}
+
+/* 32 bits integer lanes (indexes and fixed-point conversions) */
+typedef __m256i arm_x86_u32v_t;
+
+/* Lanes set to all ones where a > b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmpgt_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+}
+
+/* Lanes set to all ones where a < b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplt_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+}
+
+/* Lanes set to all ones where a <= b is false (a > b or one of them is NaN) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmpnle_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_cmp_ps(a, b, _CMP_NLE_UQ);
+}
+
+/* Bit i of the result is the sign bit of lane i */
+__STATIC_FORCEINLINE int32_t __arm_vec_movemask_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_movemask_ps(a);
+}
+
+/* mask ? a : b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_select_f32_x86(arm_x86_f32v_t mask, arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_blendv_ps(b, a, mask);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_load_u32_x86(const uint32_t * p)
+{
+  return _mm256_loadu_si256((const __m256i *) p);
+}
+
+__STATIC_FORCEINLINE void __arm_vec_store_u32_x86(uint32_t * p, arm_x86_u32v_t v)
+{
+  _mm256_storeu_si256((__m256i *) p, v);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_dup_u32_x86(uint32_t x)
+{
+  return _mm256_set1_epi32((int) x);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_add_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm256_add_epi32(a, b);
+}
+
+/* mask ? a : b */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_select_u32_x86(arm_x86_f32v_t mask, arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b), _mm256_castsi256_ps(a), mask));
+}
+
+/* Conversion with truncation. Out of range values are converted to 0x80000000 */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_cvtt_s32_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_cvttps_epi32(a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cvt_f32_s32_x86(arm_x86_u32v_t a)
+{
+  return _mm256_cvtepi32_ps(a);
+}
+
+/* Lanes set to all ones where a == b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmpeq_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+}
+
+/* Reinterpretation of the bits of the lanes */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_as_u32_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm256_castps_si256(a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_as_f32_u32_x86(arm_x86_u32v_t a)
+{
+  return _mm256_castsi256_ps(a);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_sub_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm256_sub_epi32(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_and_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm256_and_si256(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_or_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm256_or_si256(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_xor_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm256_xor_si256(a, b);
+}
+
+/* Shifts by a constant number of bits */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_sll_u32_x86(arm_x86_u32v_t a, int n)
+{
+  return _mm256_slli_epi32(a, n);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_srl_u32_x86(arm_x86_u32v_t a, int n)
+{
+  return _mm256_srli_epi32(a, n);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_sra_s32_x86(arm_x86_u32v_t a, int n)
+{
+  return _mm256_srai_epi32(a, n);
+}
+
+/* Load ARM_X86_LANES_F32 q15 values sign extended to 32 bits */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_load_s16_x86(const q15_t * p)
+{
+  return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) p));
+}
+
+/* Load ARM_X86_LANES_F32 q7 values sign extended to 32 bits */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_load_s8_x86(const q7_t * p)
+{
+  return _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *) p));
+}
+
+/* Store ARM_X86_LANES_F32 32 bits values saturated to q15 */
+__STATIC_FORCEINLINE void __arm_vec_store_s16_x86(q15_t * p, arm_x86_u32v_t v)
+{
+  __m128i r = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+  _mm_storeu_si128((__m128i *) p, r);
+}
+
+/* Store ARM_X86_LANES_F32 32 bits values saturated to q7 */
+__STATIC_FORCEINLINE void __arm_vec_store_s8_x86(q7_t * p, arm_x86_u32v_t v)
+{
+  __m128i r = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+  _mm_storel_epi64((__m128i *) p, _mm_packs_epi16(r, r));
+}
+
+/*
+ * 64 bits integer lanes used as accumulators by the fixed-point functions.
+ * The sums are exact (modulo 2^64) so the results are bit exact with the scalar versions.
+ */
+#define ARM_X86_LANES_Q15 16U
+
+typedef __m256i arm_x86_q63v_t;
+
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_zero_q63_x86(void)
+{
+  return _mm256_setzero_si256();
+}
+
+/* Add the 32 bits sums of pairs of q15 products to acc.
+   2 * (-32768 * -32768) is the only pair sum not fitting in 32 bits. It is wrapped to 0x80000000 and widened as a positive value. */
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_acc_madd_q15_x86(arm_x86_q63v_t acc, __m256i p)
+{
+  __m256i sign = _mm256_andnot_si256(_mm256_cmpeq_epi32(p, _mm256_set1_epi32(INT32_MIN)), _mm256_srai_epi32(p, 31));
+
+  acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(p, sign));
+
+  return _mm256_add_epi64(acc, _mm256_unpackhi_epi32(p, sign));
+}
+
+/* acc + pA[0] * pB[0] + ... + pA[ARM_X86_LANES_Q15 - 1] * pB[ARM_X86_LANES_Q15 - 1] */
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_mlald_q15_x86(arm_x86_q63v_t acc, const q15_t * pA, const q15_t * pB)
+{
+  __m256i a = _mm256_loadu_si256((const __m256i *) pA);
+  __m256i b = _mm256_loadu_si256((const __m256i *) pB);
+
+  return __arm_vec_acc_madd_q15_x86(acc, _mm256_madd_epi16(a, b));
+}
+
+/* acc + pA[0] * pB[ARM_X86_LANES_Q15 - 1] + ... + pA[ARM_X86_LANES_Q15 - 1] * pB[0] */
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_mlald_rev_q15_x86(arm_x86_q63v_t acc, const q15_t * pA, const q15_t * pB)
+{
+  __m256i a = _mm256_loadu_si256((const __m256i *) pA);
+  __m256i b = _mm256_loadu_si256((const __m256i *) pB);
+
+  b = _mm256_shuffle_epi8(b, _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                              14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1));
+  b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(1, 0, 3, 2));
+
+  return __arm_vec_acc_madd_q15_x86(acc, _mm256_madd_epi16(a, b));
+}
+
+/* SSE2 has no signed 32 x 32 -> 64 bits multiplication and emulating it is slower than the scalar code.
+   The q31 functions only have an x86 version when AVX2 is enabled. */
+#define ARM_X86_SIMD_Q31
+
+/* acc + pA[0] * pB[0] + ... + pA[ARM_X86_LANES_F32 - 1] * pB[ARM_X86_LANES_F32 - 1] */
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_mlal_q31_x86(arm_x86_q63v_t acc, const q31_t * pA, const q31_t * pB)
+{
+  __m256i a = _mm256_loadu_si256((const __m256i *) pA);
+  __m256i b = _mm256_loadu_si256((const __m256i *) pB);
+
+  acc = _mm256_add_epi64(acc, _mm256_mul_epi32(a, b));
+
+  return _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)));
+}
+
+/* Sum of the lanes */
+__STATIC_FORCEINLINE q63_t __arm_vec_hsum_q63_x86(arm_x86_q63v_t v)
+{
+  __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+  sum = _mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum));
+
+  return (q63_t) _mm_cvtsi128_si64(sum);
+}
+
+#else
+
+#define ARM_X86_LANES_F32 4U
+
+typedef __m128 arm_x86_f32v_t;
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_load_f32_x86(const float32_t * p)
+{
+  return _mm_loadu_ps(p);
+}
+
+__STATIC_FORCEINLINE void __arm_vec_store_f32_x86(float32_t * p, arm_x86_f32v_t v)
+{
+  _mm_storeu_ps(p, v);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_dup_f32_x86(float32_t x)
+{
+  return _mm_set1_ps(x);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_add_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_add_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_sub_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_sub_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_mul_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_mul_ps(a, b);
+}
+
+/* acc + a * b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_mla_f32_x86(arm_x86_f32v_t acc, arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_add_ps(acc, _mm_mul_ps(a, b));
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_max_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_max_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_min_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_min_ps(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_abs_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_neg_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_xor_ps(_mm_set1_ps(-0.0f), a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_sqrt_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_sqrt_ps(a);
+}
+
+/* Sum of the lanes */
+__STATIC_FORCEINLINE float32_t __arm_vec_hsum_f32_x86(arm_x86_f32v_t v)
+{
+  __m128 sum = _mm_add_ps(v, _mm_movehl_ps(v, v));
+
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+
+  return _mm_cvtss_f32(sum);
+}
+
+/* Sums of adjacent lanes : a0+a1, a2+a3, b0+b1, b2+b3 */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_pairadd_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+/* Load ARM_X86_LANES_F32/2 values and duplicate each of them : p0, p0, p1, p1 */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_load_dup2_f32_x86(const float32_t * p)
+{
+  __m128 v = _mm_castpd_ps(_mm_load_sd((const double *) p));
+
+  return _mm_unpacklo_ps(v, v);
+}
+
+/* Swap the real and imaginary parts of interleaved complex numbers */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_swap_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+/* Conjugate of interleaved complex numbers */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_conj_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_xor_ps(a, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+}
+
+/* Product of interleaved complex numbers (re, im, re, im, ...) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_mult_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  arm_x86_f32v_t bRe = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0));
+  arm_x86_f32v_t bIm = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1));
+  arm_x86_f32v_t aSwap = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+  arm_x86_f32v_t sign = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+
+  /* SSE2 has no addsub : the sign of the even lanes is flipped instead */
+  return _mm_add_ps(_mm_mul_ps(a, bRe), _mm_xor_ps(_mm_mul_ps(aSwap, bIm), sign));
+}
+
+/* Load one complex number and duplicate it in all the lanes : re, im, re, im */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_dup_f32_x86(const float32_t * p)
+{
+  return _mm_castpd_ps(_mm_load1_pd((const double *) p));
+}
+
+/* Interleave the complex numbers of a and b : a0, b0 (low half) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_zip_lo_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_castpd_ps(_mm_unpacklo_pd(_mm_castps_pd(a), _mm_castps_pd(b)));
+}
+
+/* Interleave the complex numbers of a and b : a1, b1 (high half) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplx_zip_hi_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_castpd_ps(_mm_unpackhi_pd(_mm_castps_pd(a), _mm_castps_pd(b)));
+}
+
+/* 32 bits integer lanes (indexes and fixed-point conversions) */
+typedef __m128i arm_x86_u32v_t;
+
+/* Lanes set to all ones where a > b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmpgt_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_cmpgt_ps(a, b);
+}
+
+/* Lanes set to all ones where a < b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmplt_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_cmplt_ps(a, b);
+}
+
+/* Lanes set to all ones where a <= b is false (a > b or one of them is NaN) */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmpnle_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_cmpnle_ps(a, b);
+}
+
+/* Bit i of the result is the sign bit of lane i */
+__STATIC_FORCEINLINE int32_t __arm_vec_movemask_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_movemask_ps(a);
+}
+
+/* mask ? a : b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_select_f32_x86(arm_x86_f32v_t mask, arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_load_u32_x86(const uint32_t * p)
+{
+  return _mm_loadu_si128((const __m128i *) p);
+}
+
+__STATIC_FORCEINLINE void __arm_vec_store_u32_x86(uint32_t * p, arm_x86_u32v_t v)
+{
+  _mm_storeu_si128((__m128i *) p, v);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_dup_u32_x86(uint32_t x)
+{
+  return _mm_set1_epi32((int) x);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_add_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm_add_epi32(a, b);
+}
+
+/* mask ? a : b */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_select_u32_x86(arm_x86_f32v_t mask, arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  __m128i m = _mm_castps_si128(mask);
+
+  return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+}
+
+/* Conversion with truncation. Out of range values are converted to 0x80000000 */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_cvtt_s32_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_cvttps_epi32(a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cvt_f32_s32_x86(arm_x86_u32v_t a)
+{
+  return _mm_cvtepi32_ps(a);
+}
+
+/* Lanes set to all ones where a == b */
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_cmpeq_f32_x86(arm_x86_f32v_t a, arm_x86_f32v_t b)
+{
+  return _mm_cmpeq_ps(a, b);
+}
+
+/* Reinterpretation of the bits of the lanes */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_as_u32_f32_x86(arm_x86_f32v_t a)
+{
+  return _mm_castps_si128(a);
+}
+
+__STATIC_FORCEINLINE arm_x86_f32v_t __arm_vec_as_f32_u32_x86(arm_x86_u32v_t a)
+{
+  return _mm_castsi128_ps(a);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_sub_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm_sub_epi32(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_and_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm_and_si128(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_or_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm_or_si128(a, b);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_xor_u32_x86(arm_x86_u32v_t a, arm_x86_u32v_t b)
+{
+  return _mm_xor_si128(a, b);
+}
+
+/* Shifts by a constant number of bits */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_sll_u32_x86(arm_x86_u32v_t a, int n)
+{
+  return _mm_slli_epi32(a, n);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_srl_u32_x86(arm_x86_u32v_t a, int n)
+{
+  return _mm_srli_epi32(a, n);
+}
+
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_sra_s32_x86(arm_x86_u32v_t a, int n)
+{
+  return _mm_srai_epi32(a, n);
+}
+
+/* Load ARM_X86_LANES_F32 q15 values sign extended to 32 bits */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_load_s16_x86(const q15_t * p)
+{
+  __m128i v = _mm_loadl_epi64((const __m128i *) p);
+
+  return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+}
+
+/* Load ARM_X86_LANES_F32 q7 values sign extended to 32 bits */
+__STATIC_FORCEINLINE arm_x86_u32v_t __arm_vec_load_s8_x86(const q7_t * p)
+{
+  int32_t packed;
+  __m128i v;
+
+  memcpy(&packed, p, sizeof(packed));
+  v = _mm_cvtsi32_si128(packed);
+  v = _mm_unpacklo_epi8(v, v);
+
+  return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 24);
+}
+
+/* Store ARM_X86_LANES_F32 32 bits values saturated to q15 */
+__STATIC_FORCEINLINE void __arm_vec_store_s16_x86(q15_t * p, arm_x86_u32v_t v)
+{
+  _mm_storel_epi64((__m128i *) p, _mm_packs_epi32(v, v));
+}
+
+/* Store ARM_X86_LANES_F32 32 bits values saturated to q7 */
+__STATIC_FORCEINLINE void __arm_vec_store_s8_x86(q7_t * p, arm_x86_u32v_t v)
+{
+  __m128i r = _mm_packs_epi32(v, v);
+  int32_t packed = _mm_cvtsi128_si32(_mm_packs_epi16(r, r));
+
+  memcpy(p, &packed, sizeof(packed));
+}
+
+/*
+ * 64 bits integer lanes used as accumulators by the fixed-point functions.
+ * The sums are exact (modulo 2^64) so the results are bit exact with the scalar versions.
+ */
+#define ARM_X86_LANES_Q15 8U
+
+typedef __m128i arm_x86_q63v_t;
+
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_zero_q63_x86(void)
+{
+  return _mm_setzero_si128();
+}
+
+/* Add the 32 bits sums of pairs of q15 products to acc.
+   2 * (-32768 * -32768) is the only pair sum not fitting in 32 bits. It is wrapped to 0x80000000 and widened as a positive value. */
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_acc_madd_q15_x86(arm_x86_q63v_t acc, __m128i p)
+{
+  __m128i sign = _mm_andnot_si128(_mm_cmpeq_epi32(p, _mm_set1_epi32(INT32_MIN)), _mm_srai_epi32(p, 31));
+
+  acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(p, sign));
+
+  return _mm_add_epi64(acc, _mm_unpackhi_epi32(p, sign));
+}
+
+/* acc + pA[0] * pB[0] + ... + pA[ARM_X86_LANES_Q15 - 1] * pB[ARM_X86_LANES_Q15 - 1] */
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_mlald_q15_x86(arm_x86_q63v_t acc, const q15_t * pA, const q15_t * pB)
+{
+  __m128i a = _mm_loadu_si128((const __m128i *) pA);
+  __m128i b = _mm_loadu_si128((const __m128i *) pB);
+
+  return __arm_vec_acc_madd_q15_x86(acc, _mm_madd_epi16(a, b));
+}
+
+/* acc + pA[0] * pB[ARM_X86_LANES_Q15 - 1] + ... + pA[ARM_X86_LANES_Q15 - 1] * pB[0] */
+__STATIC_FORCEINLINE arm_x86_q63v_t __arm_vec_mlald_rev_q15_x86(arm_x86_q63v_t acc, const q15_t * pA, const q15_t * pB)
+{
+  __m128i a = _mm_loadu_si128((const __m128i *) pA);
+  __m128i b = _mm_loadu_si128((const __m128i *) pB);
+
+  b = _mm_shufflelo_epi16(b, _MM_SHUFFLE(0, 1, 2, 3));
+  b = _mm_shufflehi_epi16(b, _MM_SHUFFLE(0, 1, 2, 3));
+  b = _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2));
+
+  return __arm_vec_acc_madd_q15_x86(acc, _mm_madd_epi16(a, b));
+}
+
+/* Sum of the lanes */
+__STATIC_FORCEINLINE q63_t __arm_vec_hsum_q63_x86(arm_x86_q63v_t v)
+{
+  v = _mm_add_epi64(v, _mm_unpackhi_epi64(v, v));
+
+  return (q63_t) _mm_cvtsi128_si64(v);
+}
+
+#endif /* defined(__AVX2__) && defined(__FMA__) */
+
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
 /*
  * @brief C custom defined intrinsic functions
  */
-#if !defined (ARM_MATH_DSP)
+#if !defined (ARM_MATH_DSP) || defined (ARM_MATH_DSP_EMULATION)
 
   /*
    * @brief C custom defined QADD8
@@ -1122,9 +1864,9 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
   uint64_t sum)
   {
 /*  return (sum + ((q15_t) (x >> 16) * (q15_t) (y >> 16)) + ((q15_t) x * (q15_t) y)); */
-    return ((uint64_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16)) +
-                       ( ((q63_t)sum    )                                  )   ));
+    return ((uint64_t)(( ((q63_t)sum    )                                  ) +
+                       ((((q31_t)x << 16) >> 16) * (((q31_t)y << 16) >> 16)) +
+                       ((((q31_t)x      ) >> 16) * (((q31_t)y      ) >> 16))   ));
   }
 
 
@@ -1137,9 +1879,9 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
   uint64_t sum)
   {
 /*  return (sum + ((q15_t) (x >> 16) * (q15_t) y)) + ((q15_t) x * (q15_t) (y >> 16)); */
-    return ((uint64_t)(((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
-                       ((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16)) +
-                       ( ((q63_t)sum    )                                  )   ));
+    return ((uint64_t)(( ((q63_t)sum    )                                  ) +
+                       ((((q31_t)x << 16) >> 16) * (((q31_t)y      ) >> 16)) +
+                       ((((q31_t)x      ) >> 16) * (((q31_t)y << 16) >> 16))   ));
   }
 
 
@@ -1188,7 +1930,37 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
     return (sum + (int32_t) (((int64_t) x * y) >> 32));
   }
 
-#endif /* !defined (ARM_MATH_DSP) */
+  /*
+   * @brief C custom defined SADD16
+   */
+  __STATIC_FORCEINLINE uint32_t __SADD16(
+  uint32_t x,
+  uint32_t y)
+  {
+    q31_t r, s;
+
+    r = ((((q31_t)x << 16) >> 16) + (((q31_t)y << 16) >> 16)) & (int32_t)0x0000FFFF;
+    s = ((((q31_t)x      ) >> 16) + (((q31_t)y      ) >> 16)) & (int32_t)0x0000FFFF;
+
+    return ((uint32_t)((s << 16) | (r      )));
+  }
+
+  /*
+   * @brief C custom defined SXTAB16
+   */
+  __STATIC_FORCEINLINE uint32_t __SXTAB16(
+  uint32_t x,
+  uint32_t y)
+  {
+    q31_t r, s;
+
+    r = ((((q31_t)x << 16) >> 16) + (((q31_t)y << 24) >> 24)) & (int32_t)0x0000FFFF;
+    s = ((((q31_t)x      ) >> 16) + (((q31_t)y <<  8) >> 24)) & (int32_t)0x0000FFFF;
+
+    return ((uint32_t)((s << 16) | (r      )));
+  }
+
+#endif /* !defined (ARM_MATH_DSP) || defined (ARM_MATH_DSP_EMULATION) */
 
 
   /**
@@ -1372,6 +2144,94 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numChannels; /**< number of channels filtered with the same coefficients. */
+          uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+          uint8_t planar;       /**< 0 : channels are interleaved in the input and output buffers. 1 : channels are stored one after the other. */
+          q15_t *pState;        /**< points to the state variable array. The array is of length numChannels*(numTaps+blockSize-1). */
+    const q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multi_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numChannels; /**< number of channels filtered with the same coefficients. */
+          uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+          uint8_t planar;       /**< 0 : channels are interleaved in the input and output buffers. 1 : channels are stored one after the other. */
+          float32_t *pState;    /**< points to the state variable array. The array is of length numChannels*(numTaps+blockSize-1). */
+    const float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multi_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]  pSrc       points to the block of input data (numChannels*blockSize samples).
+   * @param[out] pDst       points to the block of output data (numChannels*blockSize samples).
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   * @param[in]     planar       layout of the input and output buffers (0 : interleaved, 1 : planar).
+   */
+  void arm_fir_multi_init_q15(
+        arm_fir_multi_instance_q15 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize,
+        uint8_t planar);
+
+  /**
+   * @brief Processing function for the floating-point multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in]  pSrc       points to the block of input data (numChannels*blockSize samples).
+   * @param[out] pDst       points to the block of output data (numChannels*blockSize samples).
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   * @param[in]     planar       layout of the input and output buffers (0 : interleaved, 1 : planar).
+   */
+  void arm_fir_multi_init_f32(
+        arm_fir_multi_instance_f32 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize,
+        uint8_t planar);
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1734,6 +2594,59 @@ arm_status arm_mat_mult_fast_q31(
   const arm_matrix_instance_q31 * pSrcB,
         arm_matrix_instance_q31 * pDst);
 
+  /**
+   * @brief Number of columns of B packed by the blocked matrix multiplications.
+   * The pState array of ::arm_mat_mult_blocked_f32 and ::arm_mat_mult_blocked_q15
+   * must contain ARM_MAT_MULT_BLOCKED_PANEL_COLS * numColsA samples.
+   */
+#define ARM_MAT_MULT_BLOCKED_PANEL_COLS 8U
+
+  /**
+   * @brief Below this dimension, ::arm_mat_mult_blocked_f32 is using ::arm_mat_mult_f32.
+   * The vectorized x86 version of ::arm_mat_mult_f32 remains faster up to 32x32 matrices.
+   */
+#ifndef ARM_MAT_MULT_BLOCKED_MIN_DIM
+#if defined(ARM_MATH_X86_SIMD)
+#define ARM_MAT_MULT_BLOCKED_MIN_DIM 32U
+#else
+#define ARM_MAT_MULT_BLOCKED_MIN_DIM 16U
+#endif
+#endif
+
+  /**
+   * @brief Floating-point matrix multiplication with packed panels of B
+   * @param[in]  pSrcA       points to the first input matrix structure
+   * @param[in]  pSrcB       points to the second input matrix structure
+   * @param[out] pDst        points to output matrix structure
+   * @param[in]  pState      points to the array for storing the packed panel of B
+   * @param[in]  transposedB when 1, pSrcB contains the transpose of the second matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst,
+        float32_t * pState,
+        uint8_t transposedB);
+
+  /**
+   * @brief Q15 matrix multiplication with packed panels of B
+   * @param[in]  pSrcA       points to the first input matrix structure
+   * @param[in]  pSrcB       points to the second input matrix structure
+   * @param[out] pDst        points to output matrix structure
+   * @param[in]  pState      points to the array for storing the packed panel of B
+   * @param[in]  transposedB when 1, pSrcB contains the transpose of the second matrix
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst,
+        q15_t * pState,
+        uint8_t transposedB);
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -2260,6 +3173,21 @@ void arm_cfft_q31(
           uint8_t ifftFlag,
           uint8_t bitReverseFlag);
 
+  /**
+   * @brief  Initialization function for the Q31 CFFT with tables computed in RAM.
+   * @param[out]    S             points to an instance of the Q31 CFFT structure.
+   * @param[in]     fftLen        length of the FFT (16 to 4096, power of 2).
+   * @param[out]    pTwiddle      points to the twiddle factor buffer of 3*fftLen/2 values.
+   * @param[out]    pBitRevTable  points to the bit reversal buffer of fftLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * fftLen is not a supported length.
+   */
+  arm_status arm_cfft_init_ram_q31(
+        arm_cfft_instance_q31 * S,
+        uint16_t fftLen,
+        q31_t * pTwiddle,
+        uint16_t * pBitRevTable);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -2277,6 +3205,29 @@ void arm_cfft_q31(
         uint8_t ifftFlag,
         uint8_t bitReverseFlag);
 
+#if defined(ARM_MATH_X86_SIMD)
+  void arm_cfft_stockham_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        float32_t * pBuffer,
+        uint8_t ifftFlag);
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
+  /**
+   * @brief  Initialization function for the floating-point CFFT with tables computed in RAM.
+   * @param[out]    S             points to an instance of the floating-point CFFT structure.
+   * @param[in]     fftLen        length of the FFT (16 to 4096, power of 2).
+   * @param[out]    pTwiddle      points to the twiddle factor buffer of 2*fftLen values.
+   * @param[out]    pBitRevTable  points to the bit reversal buffer of 2*fftLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * fftLen is not a supported length.
+   */
+  arm_status arm_cfft_init_ram_f32(
+        arm_cfft_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        uint16_t * pBitRevTable);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2390,6 +3341,401 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+  /**
+   * @brief Instance structure for the floating-point FFT based FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+          uint16_t partLen;                   /**< length of a partition of the filter. The FFT length is 2*partLen. */
+          uint16_t numParts;                  /**< number of partitions of the filter. */
+          uint16_t partIdx;                   /**< position of the most recent input spectrum in the frequency delay line. */
+          float32_t *pState;                  /**< points to the state variable array. The array is of length 2*partLen*(numParts+3). */
+    const float32_t *pCoeffs;                 /**< points to the spectra of the partitions. The array is of length 2*partLen*numParts. */
+          arm_rfft_fast_instance_f32 rfft;    /**< real FFT instance of length 2*partLen. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point FFT based FIR filter.
+   * @param[in]  S          points to an instance of the floating-point FFT based FIR structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process. Must be a multiple of partLen.
+   * @return     The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>partLen</code>.
+   */
+  arm_status arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FFT based FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point FFT based FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[out]    pCoeffsFft points to the buffer for the spectra of the partitions of the filter.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     partLen    length of a partition (16 to 2048, power of 2).
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>partLen</code> is not a supported length.
+   */
+  arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffsFft,
+        float32_t * pState,
+        uint16_t partLen);
+
+  /**
+   * @brief Instance structure for the floating-point short-time Fourier transform.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                    /**< length of a frame. */
+          uint16_t hopSize;                   /**< number of samples between two frames. */
+          uint16_t numFrames;                 /**< number of frames of the frame ring. */
+          uint16_t frameIdx;                  /**< position of the next frame in the frame ring. */
+          uint16_t writeIdx;                  /**< position of the next sample in the circular buffer. */
+          uint16_t hopCnt;                    /**< number of samples received since the last frame. */
+          uint8_t powerFlag;                  /**< 0 for magnitude frames, 1 for power frames. */
+    const float32_t *pWindow;                 /**< points to the window. The array is of length fftLen. */
+          float32_t *pState;                  /**< points to the state variable array. The array is of length 3*fftLen. */
+          float32_t *pFrames;                 /**< points to the frame ring. The array is of length numFrames*(fftLen/2+1). */
+          arm_rfft_fast_instance_f32 rfft;    /**< real FFT instance of length fftLen. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 short-time Fourier transform.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                    /**< length of a frame. */
+          uint16_t hopSize;                   /**< number of samples between two frames. */
+          uint16_t numFrames;                 /**< number of frames of the frame ring. */
+          uint16_t frameIdx;                  /**< position of the next frame in the frame ring. */
+          uint16_t writeIdx;                  /**< position of the next sample in the circular buffer. */
+          uint16_t hopCnt;                    /**< number of samples received since the last frame. */
+          uint8_t powerFlag;                  /**< 0 for magnitude frames, 1 for power frames. */
+    const q15_t *pWindow;                     /**< points to the window. The array is of length fftLen. */
+          q15_t *pState;                      /**< points to the state variable array. The array is of length 4*fftLen. */
+          q15_t *pFrames;                     /**< points to the frame ring. The array is of length numFrames*(fftLen/2+1). */
+          arm_rfft_instance_q15 rfft;         /**< real FFT instance of length fftLen. */
+  } arm_stft_instance_q15;
+
+  /**
+   * @brief Processing function for the floating-point short-time Fourier transform.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        number of frames written into the frame ring.
+   */
+  uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point short-time Fourier transform.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen     length of a frame (32 to 4096, power of 2).
+   * @param[in]     hopSize    number of samples between two frames (1 to fftLen).
+   * @param[in]     pWindow    points to the window of fftLen values.
+   * @param[in]     pState     points to the state buffer of 3*fftLen values.
+   * @param[out]    pFrames    points to the frame ring of numFrames*(fftLen/2+1) values.
+   * @param[in]     numFrames  number of frames of the ring.
+   * @param[in]     powerFlag  0 for magnitude frames, 1 for power frames.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * a parameter is not supported.
+   */
+  arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState,
+        float32_t * pFrames,
+        uint16_t numFrames,
+        uint8_t powerFlag);
+
+  /**
+   * @brief Processing function for the Q15 short-time Fourier transform.
+   * @param[in,out] S          points to an instance of the Q15 STFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        number of frames written into the frame ring.
+   */
+  uint32_t arm_stft_q15(
+        arm_stft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 short-time Fourier transform.
+   * @param[in,out] S          points to an instance of the Q15 STFT structure.
+   * @param[in]     fftLen     length of a frame (32 to 8192, power of 2).
+   * @param[in]     hopSize    number of samples between two frames (1 to fftLen).
+   * @param[in]     pWindow    points to the window of fftLen values.
+   * @param[in]     pState     points to the state buffer of 4*fftLen values.
+   * @param[out]    pFrames    points to the frame ring of numFrames*(fftLen/2+1) values.
+   * @param[in]     numFrames  number of frames of the ring.
+   * @param[in]     powerFlag  0 for magnitude frames, 1 for power frames.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * a parameter is not supported.
+   */
+  arm_status arm_stft_init_q15(
+        arm_stft_instance_q15 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const q15_t * pWindow,
+        q15_t * pState,
+        q15_t * pFrames,
+        uint16_t numFrames,
+        uint8_t powerFlag);
+
+  /**
+   * @brief Instance structure for the floating-point MFCC.
+   */
+  typedef struct
+  {
+    const float32_t *dctCoefs;                /**< points to the DCT matrix of nbDctOutputs*nbMelFilters values. */
+    const float32_t *filterCoefs;             /**< points to the non zero coefficients of the Mel filters. */
+    const float32_t *windowCoefs;             /**< points to the window of fftLen values. */
+    const uint32_t *filterPos;                /**< points to the first bin of each Mel filter. */
+    const uint32_t *filterLengths;            /**< points to the number of bins of each Mel filter. */
+          uint32_t fftLen;                    /**< length of a frame. */
+          uint32_t nbMelFilters;              /**< number of Mel filters. */
+          uint32_t nbDctOutputs;              /**< number of MFCC. */
+          arm_rfft_fast_instance_f32 rfft;    /**< real FFT instance of length fftLen. */
+  } arm_mfcc_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 MFCC.
+   */
+  typedef struct
+  {
+    const q15_t *dctCoefs;                    /**< points to the DCT matrix of nbDctOutputs*nbMelFilters values. */
+    const q15_t *filterCoefs;                 /**< points to the non zero coefficients of the Mel filters. */
+    const q15_t *windowCoefs;                 /**< points to the window of fftLen values. */
+    const uint32_t *filterPos;                /**< points to the first bin of each Mel filter. */
+    const uint32_t *filterLengths;            /**< points to the number of bins of each Mel filter. */
+          uint32_t fftLen;                    /**< length of a frame. */
+          uint32_t nbMelFilters;              /**< number of Mel filters. */
+          uint32_t nbDctOutputs;              /**< number of MFCC. */
+          arm_rfft_instance_q15 rfft;         /**< real FFT instance of length fftLen. */
+  } arm_mfcc_instance_q15;
+
+  /**
+   * @brief MFCC of a frame of floating-point samples.
+   * @param[in]     S     points to an instance of the floating-point MFCC structure.
+   * @param[in,out] pSrc  points to the frame of fftLen samples. It is modified by the function.
+   * @param[out]    pDst  points to the nbDctOutputs MFCC.
+   * @param[in,out] pTmp  points to a temporary buffer of fftLen+2 values.
+   */
+  void arm_mfcc_f32(
+  const arm_mfcc_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief  Initialization function for the floating-point MFCC.
+   * @param[out]    S              points to an instance of the floating-point MFCC structure.
+   * @param[in]     fftLen         length of a frame (32 to 4096, power of 2).
+   * @param[in]     nbMelFilters   number of Mel filters.
+   * @param[in]     nbDctOutputs   number of MFCC.
+   * @param[in]     dctCoefs       points to the DCT matrix of nbDctOutputs*nbMelFilters values.
+   * @param[in]     filterPos      points to the first bin of each Mel filter.
+   * @param[in]     filterLengths  points to the number of bins of each Mel filter.
+   * @param[in]     filterCoefs    points to the coefficients of the Mel filters.
+   * @param[in]     windowCoefs    points to the window of fftLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * a parameter is not supported.
+   */
+  arm_status arm_mfcc_init_f32(
+        arm_mfcc_instance_f32 * S,
+        uint32_t fftLen,
+        uint32_t nbMelFilters,
+        uint32_t nbDctOutputs,
+  const float32_t * dctCoefs,
+  const uint32_t * filterPos,
+  const uint32_t * filterLengths,
+  const float32_t * filterCoefs,
+  const float32_t * windowCoefs);
+
+  /**
+   * @brief  Sparse storage of a dense Mel matrix.
+   * @param[in]     pMel           points to the Mel matrix of nbMelFilters rows and nbBins columns.
+   * @param[in]     nbMelFilters   number of Mel filters.
+   * @param[in]     nbBins         number of bins of a filter.
+   * @param[out]    filterPos      points to the first bin of each Mel filter.
+   * @param[out]    filterLengths  points to the number of bins of each Mel filter.
+   * @param[out]    filterCoefs    points to the coefficients of the Mel filters.
+   * @return        number of coefficients written in filterCoefs.
+   */
+  uint32_t arm_mfcc_sparse_filters_f32(
+  const float32_t * pMel,
+        uint32_t nbMelFilters,
+        uint32_t nbBins,
+        uint32_t * filterPos,
+        uint32_t * filterLengths,
+        float32_t * filterCoefs);
+
+  /**
+   * @brief MFCC of a frame of Q15 samples.
+   * @param[in]     S     points to an instance of the Q15 MFCC structure.
+   * @param[in,out] pSrc  points to the frame of fftLen samples. It is modified by the function.
+   * @param[out]    pDst  points to the nbDctOutputs MFCC in 8.7 format.
+   * @param[in,out] pTmp  points to a temporary buffer of fftLen Q31 values.
+   */
+  void arm_mfcc_q15(
+  const arm_mfcc_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst,
+        q31_t * pTmp);
+
+  /**
+   * @brief  Initialization function for the Q15 MFCC.
+   * @param[out]    S              points to an instance of the Q15 MFCC structure.
+   * @param[in]     fftLen         length of a frame (32 to 8192, power of 2).
+   * @param[in]     nbMelFilters   number of Mel filters (1 to fftLen/2-1).
+   * @param[in]     nbDctOutputs   number of MFCC.
+   * @param[in]     dctCoefs       points to the DCT matrix of nbDctOutputs*nbMelFilters values.
+   * @param[in]     filterPos      points to the first bin of each Mel filter.
+   * @param[in]     filterLengths  points to the number of bins of each Mel filter.
+   * @param[in]     filterCoefs    points to the coefficients of the Mel filters.
+   * @param[in]     windowCoefs    points to the window of fftLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * a parameter is not supported.
+   */
+  arm_status arm_mfcc_init_q15(
+        arm_mfcc_instance_q15 * S,
+        uint32_t fftLen,
+        uint32_t nbMelFilters,
+        uint32_t nbDctOutputs,
+  const q15_t * dctCoefs,
+  const uint32_t * filterPos,
+  const uint32_t * filterLengths,
+  const q15_t * filterCoefs,
+  const q15_t * windowCoefs);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filters.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                   /**< number of frequencies. */
+    const float32_t *pCoeffs;                 /**< points to the cosines then the sines of the numBins angular frequencies. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filters.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                   /**< number of frequencies. */
+    const q31_t *pCoeffs;                     /**< points to the cosines then the sines of the numBins angular frequencies. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Power of a block of floating-point samples at a few frequencies (Goertzel algorithm).
+   * @param[in]  S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the numBins powers.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filters.
+   * @param[out]    S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins   number of frequencies.
+   * @param[in]     pCoeffs   points to the cosines then the sines of the numBins angular frequencies.
+   */
+  void arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+  const float32_t * pCoeffs);
+
+  /**
+   * @brief Power of a block of Q31 samples at a few frequencies (Goertzel algorithm).
+   * @param[in]  S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the numBins powers, divided by the square of the next power of 2 of blockSize.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filters.
+   * @param[out]    S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins   number of frequencies.
+   * @param[in]     pCoeffs   points to the cosines then the sines of the numBins angular frequencies.
+   */
+  void arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const q31_t * pCoeffs);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t windowLen;                 /**< length of the sliding window. */
+          uint16_t numBins;                   /**< number of bins. */
+          uint16_t stateIndex;                /**< index of the oldest sample in the window buffer. */
+          float32_t damping;                  /**< damping factor of the recurrence. */
+          float32_t dampingN;                 /**< damping factor to the power windowLen. */
+    const float32_t *pCoeffs;                 /**< points to the cosines then the sines of the numBins angular frequencies. */
+          float32_t *pState;                  /**< points to the last windowLen input samples. */
+          float32_t *pBins;                   /**< points to the real parts then the imaginary parts of the bins. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Sliding DFT of a block of floating-point samples.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the numBins complex bins of the last windowLen samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[out]    S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     windowLen  length of the sliding window.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     pCoeffs    points to the cosines then the sines of the numBins angular frequencies 2*pi*k/windowLen.
+   * @param[in]     damping    damping factor of the recurrence (0 to 1, 1 for no damping).
+   * @param[in]     pState     points to the window buffer of windowLen values.
+   * @param[in]     pBins      points to the bins buffer of 2*numBins values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * a parameter is not supported.
+   */
+  arm_status arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t windowLen,
+        uint16_t numBins,
+  const float32_t * pCoeffs,
+        float32_t damping,
+        float32_t * pState,
+        float32_t * pBins);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3652,53 +4998,150 @@ arm_status arm_fir_decimate_init_f32(
 
 
   /**
-   * @brief  Initialization function for the Q31 FIR interpolator.
-   * @param[in,out] S          points to an instance of the Q31 FIR interpolator structure.
+   * @brief  Initialization function for the Q31 FIR interpolator.
+   * @param[in,out] S          points to an instance of the Q31 FIR interpolator structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_interpolate_init_q31(
+        arm_fir_interpolate_instance_q31 * S,
+        uint8_t L,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR interpolator.
+   * @param[in]  S          points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   */
+  void arm_fir_interpolate_f32(
+  const arm_fir_interpolate_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR interpolator.
+   * @param[in,out] S          points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_interpolate_init_f32(
+        arm_fir_interpolate_instance_f32 * S,
+        uint8_t L,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor. */
+        uint16_t M;                     /**< downsample factor. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint32_t pos;                   /**< position of the next output in the upsampled input block. */
+  const q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+        q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point rational resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor. */
+        uint16_t M;                     /**< downsample factor. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint32_t pos;                   /**< position of the next output in the upsampled input block. */
+  const float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+        float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 rational resampler.
+   * @param[in]  S          points to an instance of the Q15 resampler structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of input samples to process per call.
+   * @return     number of output samples written in pDst.
+   */
+  uint32_t arm_resample_q15(
+        arm_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
    * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
    * @param[in]     numTaps    number of filter coefficients in the filter.
    * @param[in]     pCoeffs    points to the filter coefficient buffer.
    * @param[in]     pState     points to the state buffer.
    * @param[in]     blockSize  number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is 0 or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is not a multiple of <code>L</code>.
    */
-  arm_status arm_fir_interpolate_init_q31(
-        arm_fir_interpolate_instance_q31 * S,
-        uint8_t L,
+  arm_status arm_resample_init_q15(
+        arm_resample_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
         uint16_t numTaps,
-  const q31_t * pCoeffs,
-        q31_t * pState,
+  const q15_t * pCoeffs,
+        q15_t * pState,
         uint32_t blockSize);
 
-
   /**
-   * @brief Processing function for the floating-point FIR interpolator.
-   * @param[in]  S          points to an instance of the floating-point FIR interpolator structure.
+   * @brief Processing function for the floating-point rational resampler.
+   * @param[in]  S          points to an instance of the floating-point resampler structure.
    * @param[in]  pSrc       points to the block of input data.
    * @param[out] pDst       points to the block of output data.
    * @param[in]  blockSize  number of input samples to process per call.
+   * @return     number of output samples written in pDst.
    */
-  void arm_fir_interpolate_f32(
-  const arm_fir_interpolate_instance_f32 * S,
+  uint32_t arm_resample_f32(
+        arm_resample_instance_f32 * S,
   const float32_t * pSrc,
         float32_t * pDst,
         uint32_t blockSize);
 
-
   /**
-   * @brief  Initialization function for the floating-point FIR interpolator.
-   * @param[in,out] S          points to an instance of the floating-point FIR interpolator structure.
+   * @brief  Initialization function for the floating-point rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
    * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
    * @param[in]     numTaps    number of filter coefficients in the filter.
    * @param[in]     pCoeffs    points to the filter coefficient buffer.
    * @param[in]     pState     points to the state buffer.
    * @param[in]     blockSize  number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is 0 or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is not a multiple of <code>L</code>.
    */
-  arm_status arm_fir_interpolate_init_f32(
-        arm_fir_interpolate_instance_f32 * S,
-        uint8_t L,
+  arm_status arm_resample_init_f32(
+        arm_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
         uint16_t numTaps,
   const float32_t * pCoeffs,
         float32_t * pState,
@@ -3765,6 +5208,17 @@ arm_status arm_fir_decimate_init_f32(
     const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numChannels;      /**< number of independent channels of the bank. */
+          uint8_t numStages;         /**< number of 2nd order stages of each channel. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of transposed coefficients.  The array is of length 5*numStages*numChannels. */
+  } arm_biquad_bank_df2T_instance_f32;
+
   /**
    * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
@@ -3804,6 +5258,20 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad filter bank.
+   * @param[in]  S          points to an instance of the filter bank data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_bank_df2T_f32(
+  const arm_biquad_bank_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in]  S          points to an instance of the filter data structure.
@@ -3818,7 +5286,7 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD)
 void arm_biquad_cascade_df2T_compute_coefs_f32(
   arm_biquad_cascade_df2T_instance_f32 * S,
   uint8_t numStages,
@@ -3852,6 +5320,36 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pState);
 
 
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad filter bank.
+   * @param[in,out] S            points to an instance of the filter bank data structure.
+   * @param[in]     numChannels  number of channels of the bank.
+   * @param[in]     numStages    number of 2nd order stages of each channel.
+   * @param[in]     pCoeffs      points to the transposed filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_bank_df2T_init_f32(
+        arm_biquad_bank_df2T_instance_f32 * S,
+        uint16_t numChannels,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
+  /**
+   * @brief  Transposes the coefficients of several Biquad cascades for a filter bank.
+   * @param[in]  numChannels  number of channels of the bank.
+   * @param[in]  numStages    number of 2nd order stages of each channel.
+   * @param[in]  pSrc         points to the coefficients of the channels, one cascade after the other.
+   * @param[out] pDst         points to the transposed coefficients.
+   */
+  void arm_biquad_bank_df2T_compute_coefs_f32(
+        uint16_t numChannels,
+        uint8_t numStages,
+  const float32_t * pSrc,
+        float32_t * pDst);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -4773,6 +6271,219 @@ void arm_correlate_fast_q31(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter with runs of taps.
+   */
+  typedef struct
+  {
+          uint16_t numRuns;             /**< number of runs of taps with consecutive delays. */
+          uint16_t maxDelay;            /**< maximum offset specified by the tap delays. */
+          uint32_t stateIndex;          /**< index of the next input sample in the state buffer. */
+          uint32_t stateLen;            /**< length of the state buffer (2*maxDelay + blockSize). */
+          float32_t *pState;            /**< points to the state buffer array. */
+    const float32_t *pCoeffs;           /**< points to the coefficients of the runs, sorted by delay. */
+    const uint16_t *pRuns;              /**< points to the first delay and the number of taps of each run. */
+  } arm_fir_sparse_runs_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse FIR filter with runs of taps.
+   */
+  typedef struct
+  {
+          uint16_t numRuns;             /**< number of runs of taps with consecutive delays. */
+          uint16_t maxDelay;            /**< maximum offset specified by the tap delays. */
+          uint32_t stateIndex;          /**< index of the next input sample in the state buffer. */
+          uint32_t stateLen;            /**< length of the state buffer (2*maxDelay + blockSize). */
+          q31_t *pState;                /**< points to the state buffer array. */
+    const q31_t *pCoeffs;               /**< points to the coefficients of the runs, sorted by delay. */
+    const uint16_t *pRuns;              /**< points to the first delay and the number of taps of each run. */
+  } arm_fir_sparse_runs_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse FIR filter with runs of taps.
+   */
+  typedef struct
+  {
+          uint16_t numRuns;             /**< number of runs of taps with consecutive delays. */
+          uint16_t maxDelay;            /**< maximum offset specified by the tap delays. */
+          uint32_t stateIndex;          /**< index of the next input sample in the state buffer. */
+          uint32_t stateLen;            /**< length of the state buffer (2*maxDelay + blockSize). */
+          q15_t *pState;                /**< points to the state buffer array. */
+    const q15_t *pCoeffs;               /**< points to the coefficients of the runs, sorted by delay. */
+    const uint16_t *pRuns;              /**< points to the first delay and the number of taps of each run. */
+  } arm_fir_sparse_runs_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sparse FIR filter with runs of taps.
+   */
+  typedef struct
+  {
+          uint16_t numRuns;             /**< number of runs of taps with consecutive delays. */
+          uint16_t maxDelay;            /**< maximum offset specified by the tap delays. */
+          uint32_t stateIndex;          /**< index of the next input sample in the state buffer. */
+          uint32_t stateLen;            /**< length of the state buffer (2*maxDelay + blockSize). */
+          q7_t *pState;                 /**< points to the state buffer array. */
+    const q7_t *pCoeffs;                /**< points to the coefficients of the runs, sorted by delay. */
+    const uint16_t *pRuns;              /**< points to the first delay and the number of taps of each run. */
+  } arm_fir_sparse_runs_instance_q7;
+
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter with runs of taps.
+   * @param[in,out] S          points to an instance of the floating-point sparse FIR runs structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of input samples to process per call.
+   */
+  void arm_fir_sparse_runs_f32(
+        arm_fir_sparse_runs_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point sparse FIR filter with runs of taps.
+   * @param[in,out] S           points to an instance of the floating-point sparse FIR runs structure.
+   * @param[in]     numTaps     number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs     points to the array of filter coefficients.
+   * @param[in]     pTapDelay   points to the array of offset times.
+   * @param[in]     maxDelay    maximum offset time supported.
+   * @param[out]    pRunCoeffs  points to the coefficients of the runs (numTaps values).
+   * @param[out]    pRuns       points to the runs (2*numTaps values).
+   * @param[in]     pState      points to the state buffer (2*maxDelay + blockSize values).
+   * @param[in]     blockSize   maximum number of samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_fir_sparse_runs_init_f32(
+        arm_fir_sparse_runs_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+  const int32_t * pTapDelay,
+        uint16_t maxDelay,
+        float32_t * pRunCoeffs,
+        uint16_t * pRuns,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 sparse FIR filter with runs of taps.
+   * @param[in,out] S          points to an instance of the Q31 sparse FIR runs structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of input samples to process per call.
+   */
+  void arm_fir_sparse_runs_q31(
+        arm_fir_sparse_runs_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 sparse FIR filter with runs of taps.
+   * @param[in,out] S           points to an instance of the Q31 sparse FIR runs structure.
+   * @param[in]     numTaps     number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs     points to the array of filter coefficients.
+   * @param[in]     pTapDelay   points to the array of offset times.
+   * @param[in]     maxDelay    maximum offset time supported.
+   * @param[out]    pRunCoeffs  points to the coefficients of the runs (numTaps values).
+   * @param[out]    pRuns       points to the runs (2*numTaps values).
+   * @param[in]     pState      points to the state buffer (2*maxDelay + blockSize values).
+   * @param[in]     blockSize   maximum number of samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_fir_sparse_runs_init_q31(
+        arm_fir_sparse_runs_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+  const int32_t * pTapDelay,
+        uint16_t maxDelay,
+        q31_t * pRunCoeffs,
+        uint16_t * pRuns,
+        q31_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 sparse FIR filter with runs of taps.
+   * @param[in,out] S          points to an instance of the Q15 sparse FIR runs structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of input samples to process per call.
+   */
+  void arm_fir_sparse_runs_q15(
+        arm_fir_sparse_runs_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 sparse FIR filter with runs of taps.
+   * @param[in,out] S           points to an instance of the Q15 sparse FIR runs structure.
+   * @param[in]     numTaps     number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs     points to the array of filter coefficients.
+   * @param[in]     pTapDelay   points to the array of offset times.
+   * @param[in]     maxDelay    maximum offset time supported.
+   * @param[out]    pRunCoeffs  points to the coefficients of the runs (numTaps values).
+   * @param[out]    pRuns       points to the runs (2*numTaps values).
+   * @param[in]     pState      points to the state buffer (2*maxDelay + blockSize values).
+   * @param[in]     blockSize   maximum number of samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_fir_sparse_runs_init_q15(
+        arm_fir_sparse_runs_instance_q15 * S,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+  const int32_t * pTapDelay,
+        uint16_t maxDelay,
+        q15_t * pRunCoeffs,
+        uint16_t * pRuns,
+        q15_t * pState,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q7 sparse FIR filter with runs of taps.
+   * @param[in,out] S          points to an instance of the Q7 sparse FIR runs structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of input samples to process per call.
+   */
+  void arm_fir_sparse_runs_q7(
+        arm_fir_sparse_runs_instance_q7 * S,
+  const q7_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q7 sparse FIR filter with runs of taps.
+   * @param[in,out] S           points to an instance of the Q7 sparse FIR runs structure.
+   * @param[in]     numTaps     number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs     points to the array of filter coefficients.
+   * @param[in]     pTapDelay   points to the array of offset times.
+   * @param[in]     maxDelay    maximum offset time supported.
+   * @param[out]    pRunCoeffs  points to the coefficients of the runs (numTaps values).
+   * @param[out]    pRuns       points to the runs (2*numTaps values).
+   * @param[in]     pState      points to the state buffer (2*maxDelay + blockSize values).
+   * @param[in]     blockSize   maximum number of samples processed per call.
+   * @return        execution status
+   */
+  arm_status arm_fir_sparse_runs_init_q7(
+        arm_fir_sparse_runs_instance_q7 * S,
+        uint16_t numTaps,
+  const q7_t * pCoeffs,
+  const int32_t * pTapDelay,
+        uint16_t maxDelay,
+        q7_t * pRunCoeffs,
+        uint16_t * pRuns,
+        q7_t * pState,
+        uint32_t blockSize);
+
+
   /**
    * @brief  Floating-point sin_cos function.
    * @param[in]  theta   input value in degrees
@@ -5088,6 +6799,102 @@ __STATIC_FORCEINLINE q15_t arm_pid_q15(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky factorization.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point (64 bit) Cholesky factorization.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Floating-point LU factorization with partial pivoting : P . src = L . U
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] pl    points to the instance of the output lower triangular matrix structure (unit diagonal).
+   * @param[out] pu    points to the instance of the output upper triangular matrix structure.
+   * @param[out] pp    points to the output permutation : row i of P . src is row pp[i] of src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pu,
+  uint16_t * pp);
+
+
+  /**
+   * @brief Solve LT . X = A where LT is a lower triangular matrix.
+   * @param[in]  lt    points to the instance of the lower triangular matrix structure.
+   * @param[in]  a     points to the instance of the right hand side matrix structure.
+   * @param[out] dst   points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of LT is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * lt,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Solve UT . X = A where UT is an upper triangular matrix.
+   * @param[in]  ut    points to the instance of the upper triangular matrix structure.
+   * @param[in]  a     points to the instance of the right hand side matrix structure.
+   * @param[out] dst   points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of UT is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * ut,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Solve LT . X = A where LT is a lower triangular matrix (64 bit).
+   * @param[in]  lt    points to the instance of the lower triangular matrix structure.
+   * @param[in]  a     points to the instance of the right hand side matrix structure.
+   * @param[out] dst   points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of LT is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * lt,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Solve UT . X = A where UT is an upper triangular matrix (64 bit).
+   * @param[in]  ut    points to the instance of the upper triangular matrix structure.
+   * @param[in]  a     points to the instance of the right hand side matrix structure.
+   * @param[out] dst   points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of UT is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * ut,
+  const arm_matrix_instance_f64 * a,
+  arm_matrix_instance_f64 * dst);
+
+
 
   /**
    * @ingroup groupController
@@ -5807,6 +7614,54 @@ __STATIC_FORCEINLINE void arm_inv_park_q31(
   q15_t x);
 
 
+  /**
+   * @brief  Vector sine for floating-point data.
+   * @param[in]  pSrc       points to the input vector (radians).
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vsin_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector cosine for floating-point data.
+   * @param[in]  pSrc       points to the input vector (radians).
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector exponential for floating-point data.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vexp_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector natural logarithm for floating-point data.
+   * @param[in]  pSrc       points to the input vector.
+   * @param[out] pDst       points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @ingroup groupFastMath
    */
@@ -6439,6 +8294,85 @@ arm_status arm_sqrt_q15(
         uint32_t blockSize,
         q15_t * pResult);
 
+  /**
+   * @brief Statistics of a floating-point vector computed by arm_stats_f32().
+   */
+  typedef struct
+  {
+          float32_t mean;      /**< mean value. */
+          float32_t var;       /**< variance. */
+          float32_t rms;       /**< root mean square value. */
+          float32_t min;       /**< minimum value. */
+          float32_t max;       /**< maximum value. */
+          uint32_t minIndex;   /**< index of the first occurrence of the minimum value. */
+          uint32_t maxIndex;   /**< index of the first occurrence of the maximum value. */
+  } arm_stats_result_f32;
+
+  /**
+   * @brief Statistics of a Q31 vector computed by arm_stats_q31().
+   */
+  typedef struct
+  {
+          q31_t mean;          /**< mean value. */
+          q31_t var;           /**< variance. */
+          q31_t rms;           /**< root mean square value. */
+          q31_t min;           /**< minimum value. */
+          q31_t max;           /**< maximum value. */
+          uint32_t minIndex;   /**< index of the first occurrence of the minimum value. */
+          uint32_t maxIndex;   /**< index of the first occurrence of the maximum value. */
+  } arm_stats_result_q31;
+
+  /**
+   * @brief Statistics of a Q15 vector computed by arm_stats_q15().
+   */
+  typedef struct
+  {
+          q15_t mean;          /**< mean value. */
+          q15_t var;           /**< variance. */
+          q15_t rms;           /**< root mean square value. */
+          q15_t min;           /**< minimum value. */
+          q15_t max;           /**< maximum value. */
+          uint32_t minIndex;   /**< index of the first occurrence of the minimum value. */
+          uint32_t maxIndex;   /**< index of the first occurrence of the maximum value. */
+  } arm_stats_result_q15;
+
+
+  /**
+   * @brief  Mean, variance, RMS, minimum and maximum of a floating-point vector in one pass.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    points to the statistics returned
+   */
+  void arm_stats_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_f32 * pResult);
+
+
+  /**
+   * @brief  Mean, variance, RMS, minimum and maximum of a Q31 vector in one pass.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    points to the statistics returned
+   */
+  void arm_stats_q31(
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_q31 * pResult);
+
+
+  /**
+   * @brief  Mean, variance, RMS, minimum and maximum of a Q15 vector in one pass.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    points to the statistics returned
+   */
+  void arm_stats_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_q15 * pResult);
+
+
 
   /**
    * @brief  Floating-point complex magnitude
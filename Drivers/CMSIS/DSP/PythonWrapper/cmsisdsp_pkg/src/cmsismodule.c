@@ -162,6 +162,33 @@ Method_##NAME##_##FIELD(ml_##NAME##Object *self, PyObject *ignored)\
 #define FREEARGUMENT(FIELD) \
     PyMem_Free(FIELD)
 
+/*
+
+Argument of a batch function : a 1D array (one frame) or a 2D array
+(frames x samples).
+The numpy buffer is used directly when the array is already C contiguous,
+aligned and of type FORMAT. Otherwise numpy is doing one conversion for
+all the frames.
+
+*/
+#define GETBATCHARGUMENT(FIELD,FORMAT)                                         \
+    npy_intp nbFrames##FIELD=0;                                                \
+    npy_intp frameLength##FIELD=0;                                             \
+    PyArrayObject *FIELD##c = (PyArrayObject *)PyArray_FromAny(FIELD,          \
+        PyArray_DescrFromType(FORMAT),                                         \
+        1,2,NPY_ARRAY_C_CONTIGUOUS | NPY_ARRAY_ALIGNED | NPY_ARRAY_FORCECAST,  \
+        NULL);                                                                 \
+    if (FIELD##c)                                                              \
+    {                                                                          \
+       nbFrames##FIELD = PyArray_NDIM(FIELD##c) == 2 ? PyArray_DIM(FIELD##c,0) : 1;\
+       frameLength##FIELD = PyArray_DIM(FIELD##c,PyArray_NDIM(FIELD##c)-1);   \
+    }
+
+/* Result of a batch function with the same shape as the argument ARG */
+#define BATCHARRAY(OBJ,ARG,FORMAT)                                             \
+    PyArrayObject *OBJ=(PyArrayObject *)PyArray_SimpleNew(PyArray_NDIM(ARG),   \
+        PyArray_DIMS(ARG), FORMAT);
+
 #ifdef IS_PY3K
 #define ADDTYPE(name)                                               \
     if (PyType_Ready(&ml_##name##Type) < 0)                         \
@@ -333,10 +333,13 @@ arm_fir_instance_f32_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
     if (self != NULL) {
 
-        self->instance = PyMem_Malloc(sizeof(arm_fir_instance_f32));
-
-        self->instance->pState = NULL;
-        self->instance->pCoeffs = NULL;
+        /* Zero-initialized, so that the functions can check that the instance is initialized */
+        self->instance = PyMem_Calloc(1,sizeof(arm_fir_instance_f32));
+        if (self->instance == NULL)
+        {
+            Py_DECREF(self);
+            return(PyErr_NoMemory());
+        }
 
     }
  
@@ -2752,9 +2755,13 @@ arm_rfft_fast_instance_f32_new(PyTypeObject *type, PyObject *args, PyObject *kwd
 
     if (self != NULL) {
 
-        self->instance = PyMem_Malloc(sizeof(arm_rfft_fast_instance_f32));
-
-        self->instance->pTwiddleRFFT = NULL;
+        /* Zero-initialized, so that the functions can check that the instance is initialized */
+        self->instance = PyMem_Calloc(1,sizeof(arm_rfft_fast_instance_f32));
+        if (self->instance == NULL)
+        {
+            Py_DECREF(self);
+            return(PyErr_NoMemory());
+        }
 
     }
  
@@ -5942,6 +5949,87 @@ cmsis_arm_fir_f32(PyObject *obj, PyObject *args)
   return(NULL);
 }
 
+/*
+
+The frames are consecutive blocks of the same signal : the state of the
+instance is updated like with successive calls to arm_fir_f32.
+The GIL is released during the filtering. An instance must not be used
+by several threads at the same time.
+
+*/
+static PyObject *
+cmsis_arm_fir_batch_f32(PyObject *obj, PyObject *args)
+{
+
+  PyObject *S=NULL; // input
+  PyObject *pSrc=NULL; // input
+  arm_fir_instance_f32 batchS;
+  float32_t *batchState=NULL;
+  npy_intp frame;
+
+  if (PyArg_ParseTuple(args,"OO",&S,&pSrc))
+  {
+
+    if (!PyObject_TypeCheck(S,&ml_arm_fir_instance_f32Type))
+    {
+      PyErr_SetString(PyExc_TypeError,"S is not an arm_fir_instance_f32");
+      return(NULL);
+    }
+
+    ml_arm_fir_instance_f32Object *selfS = (ml_arm_fir_instance_f32Object *)S;
+    if (selfS->instance->pCoeffs == NULL)
+    {
+      PyErr_SetString(PyExc_ValueError,"FIR instance is not initialized");
+      return(NULL);
+    }
+
+    GETBATCHARGUMENT(pSrc,NPY_FLOAT);
+    if (pSrcc == NULL)
+    {
+      return(NULL);
+    }
+
+    uint16_t numTaps = selfS->instance->numTaps;
+    BATCHARRAY(pDstOBJ,pSrcc,NPY_FLOAT);
+    if (pDstOBJ == NULL)
+    {
+      Py_DECREF(pSrcc);
+      return(NULL);
+    }
+
+    /* The state of the instance was sized for its own blockSize.
+       A state sized for the frame length is used for the batch and
+       the numTaps-1 samples of history are copied in and out. */
+    batchState=PyMem_Malloc(sizeof(float32_t)*(numTaps + frameLengthpSrc - 1));
+    if (batchState == NULL)
+    {
+      Py_DECREF(pDstOBJ);
+      Py_DECREF(pSrcc);
+      return(PyErr_NoMemory());
+    }
+    arm_fir_init_f32(&batchS,numTaps,selfS->instance->pCoeffs,batchState,frameLengthpSrc);
+    memcpy(batchState,selfS->instance->pState,sizeof(float32_t)*(numTaps - 1));
+
+    float32_t *pIn = (float32_t*)PyArray_DATA(pSrcc);
+    float32_t *pOut = (float32_t*)PyArray_DATA(pDstOBJ);
+
+    Py_BEGIN_ALLOW_THREADS
+    for(frame = 0; frame < nbFramespSrc; frame++)
+    {
+      arm_fir_f32(&batchS,pIn + frame*frameLengthpSrc,pOut + frame*frameLengthpSrc,frameLengthpSrc);
+    }
+    Py_END_ALLOW_THREADS
+
+    memcpy(selfS->instance->pState,batchState,sizeof(float32_t)*(numTaps - 1));
+
+    PyMem_Free(batchState);
+    Py_DECREF(pSrcc);
+    return((PyObject*)pDstOBJ);
+
+  }
+  return(NULL);
+}
+
 
 static PyObject *
 cmsis_arm_fir_init_f32(PyObject *obj, PyObject *args)
@@ -7993,6 +8081,90 @@ cmsis_arm_rfft_fast_f32(PyObject *obj, PyObject *args)
   return(NULL);
 }
 
+/*
+
+Each frame has fftLenRFFT samples and is transformed independently.
+arm_rfft_fast_f32 is modifying its input so each frame is copied to a
+scratch buffer and the numpy argument is not changed.
+The GIL is released during the transforms. The instance is not modified
+and can be shared by several threads.
+
+*/
+static PyObject *
+cmsis_arm_rfft_fast_batch_f32(PyObject *obj, PyObject *args)
+{
+
+  PyObject *S=NULL; // input
+  PyObject *p=NULL; // input
+  uint32_t ifftFlag; // input
+  float32_t *scratch=NULL;
+  npy_intp frame;
+
+  if (PyArg_ParseTuple(args,"OOi",&S,&p,&ifftFlag))
+  {
+
+    if (!PyObject_TypeCheck(S,&ml_arm_rfft_fast_instance_f32Type))
+    {
+      PyErr_SetString(PyExc_TypeError,"S is not an arm_rfft_fast_instance_f32");
+      return(NULL);
+    }
+
+    ml_arm_rfft_fast_instance_f32Object *selfS = (ml_arm_rfft_fast_instance_f32Object *)S;
+    if ((selfS->instance->pTwiddleRFFT == NULL) || (selfS->instance->Sint.pTwiddle == NULL))
+    {
+      PyErr_SetString(PyExc_ValueError,"RFFT instance is not initialized");
+      return(NULL);
+    }
+
+    GETBATCHARGUMENT(p,NPY_FLOAT);
+    if (pc == NULL)
+    {
+      return(NULL);
+    }
+
+    uint16_t fftLen = selfS->instance->fftLenRFFT;
+    if (frameLengthp != fftLen)
+    {
+      PyErr_Format(PyExc_ValueError,"frame length %ld is not the FFT length %d",
+        (long)frameLengthp,(int)fftLen);
+      Py_DECREF(pc);
+      return(NULL);
+    }
+
+    BATCHARRAY(pOutOBJ,pc,NPY_FLOAT);
+    if (pOutOBJ == NULL)
+    {
+      Py_DECREF(pc);
+      return(NULL);
+    }
+
+    scratch=PyMem_Malloc(sizeof(float32_t)*fftLen);
+    if (scratch == NULL)
+    {
+      Py_DECREF(pOutOBJ);
+      Py_DECREF(pc);
+      return(PyErr_NoMemory());
+    }
+
+    float32_t *pIn = (float32_t*)PyArray_DATA(pc);
+    float32_t *pOut = (float32_t*)PyArray_DATA(pOutOBJ);
+
+    Py_BEGIN_ALLOW_THREADS
+    for(frame = 0; frame < nbFramesp; frame++)
+    {
+      memcpy(scratch,pIn + frame*fftLen,sizeof(float32_t)*fftLen);
+      arm_rfft_fast_f32(selfS->instance,scratch,pOut + frame*fftLen,(uint8_t)ifftFlag);
+    }
+    Py_END_ALLOW_THREADS
+
+    PyMem_Free(scratch);
+    Py_DECREF(pc);
+    return((PyObject*)pOutOBJ);
+
+  }
+  return(NULL);
+}
+
 
 static PyObject *
 cmsis_arm_dct4_init_f32(PyObject *obj, PyObject *args)
@@ -15071,6 +15243,7 @@ static PyMethodDef CMSISMLMethods[] = {
 {"arm_fir_fast_q31",  cmsis_arm_fir_fast_q31, METH_VARARGS,""},
 {"arm_fir_init_q31",  cmsis_arm_fir_init_q31, METH_VARARGS,""},
 {"arm_fir_f32",  cmsis_arm_fir_f32, METH_VARARGS,""},
+{"arm_fir_batch_f32",  cmsis_arm_fir_batch_f32, METH_VARARGS,""},
 {"arm_fir_init_f32",  cmsis_arm_fir_init_f32, METH_VARARGS,""},
 {"arm_biquad_cascade_df1_q15",  cmsis_arm_biquad_cascade_df1_q15, METH_VARARGS,""},
 {"arm_biquad_cascade_df1_init_q15",  cmsis_arm_biquad_cascade_df1_init_q15, METH_VARARGS,""},
@@ -15141,6 +15314,7 @@ static PyMethodDef CMSISMLMethods[] = {
 {"arm_rfft_2048_fast_init_f32",  cmsis_arm_rfft_2048_fast_init_f32, METH_VARARGS,""},
 {"arm_rfft_4096_fast_init_f32",  cmsis_arm_rfft_4096_fast_init_f32, METH_VARARGS,""},
 {"arm_rfft_fast_f32",  cmsis_arm_rfft_fast_f32, METH_VARARGS,""},
+{"arm_rfft_fast_batch_f32",  cmsis_arm_rfft_fast_batch_f32, METH_VARARGS,""},
 {"arm_dct4_init_f32",  cmsis_arm_dct4_init_f32, METH_VARARGS,""},
 {"arm_dct4_f32",  cmsis_arm_dct4_f32, METH_VARARGS,""},
 {"arm_dct4_init_q31",  cmsis_arm_dct4_init_q31, METH_VARARGS,""},
@@ -6,7 +6,7 @@ import sys
 import os
 from config import ROOT
 
-includes = [os.path.join(ROOT,"Include"),os.path.join("cmsisdsp_pkg","src")]
+includes = [os.path.join(ROOT,"Include"),os.path.join(ROOT,"..","Core","Include"),os.path.join("cmsisdsp_pkg","src")]
 
 if sys.platform == 'win32':
   cflags = ["-DWIN",config.cflags,"-DUNALIGNED_SUPPORT_DISABLE"] 
@@ -80,6 +80,47 @@ print(filtered_x)
 print(dsp.arm_fir_f32(firf32,[1,2,3,4,5]))
 print(dsp.arm_fir_f32(firf32,[1,2,3,4,5]))
 
+# Same signal filtered as a batch of 2 frames
+firf32 = dsp.arm_fir_instance_f32()
+dsp.arm_fir_init_f32(firf32,3,[1.,2,3],[0,0,0,0,0,0,0])
+print(dsp.arm_fir_batch_f32(firf32,np.array([[1,2,3,4,5],[1,2,3,4,5]],dtype=np.float32)))
+
+# The batch functions must give the same output as one call per frame
+frames = np.random.randn(4,256).astype(np.float32)
+
+# The state of arm_fir_f32 is sized for the frame length
+firf32 = dsp.arm_fir_instance_f32()
+dsp.arm_fir_init_f32(firf32,3,[1.,2,3],np.zeros(3+256-1))
+ref = np.array([dsp.arm_fir_f32(firf32,f) for f in frames])
+firf32 = dsp.arm_fir_instance_f32()
+dsp.arm_fir_init_f32(firf32,3,[1.,2,3],[0,0,0,0,0,0,0])
+assert np.array_equal(dsp.arm_fir_batch_f32(firf32,frames),ref)
+
+rfftf32 = dsp.arm_rfft_fast_instance_f32()
+dsp.arm_rfft_fast_init_f32(rfftf32,256)
+for ifftFlag in [0,1]:
+    ref = np.array([dsp.arm_rfft_fast_f32(rfftf32,f,ifftFlag)[:256] for f in frames])
+    assert np.array_equal(dsp.arm_rfft_fast_batch_f32(rfftf32,frames,ifftFlag),ref)
+
+# Instances of the wrong type or not initialized are rejected
+def raises(error,f,*args):
+    try:
+        f(*args)
+    except error:
+        return(True)
+    return(False)
+
+assert raises(TypeError,dsp.arm_fir_batch_f32,rfftf32,frames)
+assert raises(TypeError,dsp.arm_rfft_fast_batch_f32,firf32,frames,0)
+assert raises(ValueError,dsp.arm_fir_batch_f32,dsp.arm_fir_instance_f32(),frames)
+assert raises(ValueError,dsp.arm_rfft_fast_batch_f32,dsp.arm_rfft_fast_instance_f32(),frames,0)
+rfftf32 = dsp.arm_rfft_fast_instance_f32()
+dsp.arm_rfft_fast_init_f32(rfftf32,16)
+assert raises(ValueError,dsp.arm_rfft_fast_batch_f32,rfftf32,frames[:,:16],0)
+rfftf32 = dsp.arm_rfft_fast_instance_f32()
+dsp.arm_rfft_fast_init_f32(rfftf32,128)
+assert raises(ValueError,dsp.arm_rfft_fast_batch_f32,rfftf32,frames,0)
+
 def q31sat(x):
      if x > 0x7FFFFFFF:
           return(np.int32(0x7FFFFFFF))
@@ -96,6 +96,36 @@ void arm_add_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+    arm_x86_f32v_t vec1;
+    arm_x86_f32v_t vec2;
+    arm_x86_f32v_t res;
+
+    /* Compute ARM_X86_LANES_F32 outputs at a time */
+    blkCnt = blockSize / ARM_X86_LANES_F32;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A + B */
+
+        /* Add and then store the results in the destination buffer. */
+        vec1 = __arm_vec_load_f32_x86(pSrcA);
+        vec2 = __arm_vec_load_f32_x86(pSrcB);
+        res = __arm_vec_add_f32_x86(vec1, vec2);
+        __arm_vec_store_f32_x86(pDst, res);
+
+        /* Increment pointers */
+        pSrcA += ARM_X86_LANES_F32;
+        pSrcB += ARM_X86_LANES_F32;
+        pDst += ARM_X86_LANES_F32;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize % ARM_X86_LANES_F32;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -107,6 +107,35 @@ void arm_dot_prod_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+    arm_x86_f32v_t vec1;
+    arm_x86_f32v_t vec2;
+    arm_x86_f32v_t accum = __arm_vec_dup_f32_x86(0.0f);
+
+    /* Compute ARM_X86_LANES_F32 outputs at a time */
+    blkCnt = blockSize / ARM_X86_LANES_F32;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A[0]*B[0] + A[1]*B[1] + A[2]*B[2] + ... + A[blockSize-1]*B[blockSize-1] */
+        /* Calculate dot product and then store the result in a temporary buffer. */
+        vec1 = __arm_vec_load_f32_x86(pSrcA);
+        vec2 = __arm_vec_load_f32_x86(pSrcB);
+        accum = __arm_vec_mla_f32_x86(accum, vec1, vec2);
+
+        /* Increment pointers */
+        pSrcA += ARM_X86_LANES_F32;
+        pSrcB += ARM_X86_LANES_F32;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    sum = __arm_vec_hsum_f32_x86(accum);
+
+    /* Tail */
+    blkCnt = blockSize % ARM_X86_LANES_F32;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -104,6 +104,30 @@ void arm_cmplx_conj_f32(
    /* Tail */
    blkCnt = numSamples & 0x3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+   arm_x86_f32v_t vec;
+
+   /* Compute ARM_X86_LANES_F32/2 outputs at a time */
+   blkCnt = numSamples / (ARM_X86_LANES_F32 / 2U);
+
+   while (blkCnt > 0U)
+   {
+     /* C[0]+jC[1] = A[0]+(-1)*jA[1] */
+     /* Calculate Complex Conjugate and then store the results in the destination buffer. */
+     vec = __arm_vec_load_f32_x86(pSrc);
+     __arm_vec_store_f32_x86(pDst, __arm_vec_cmplx_conj_f32_x86(vec));
+
+     /* Increment pointers */
+     pSrc += ARM_X86_LANES_F32;
+     pDst += ARM_X86_LANES_F32;
+
+     /* Decrement the loop counter */
+     blkCnt--;
+   }
+
+   /* Tail */
+   blkCnt = numSamples % (ARM_X86_LANES_F32 / 2U);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
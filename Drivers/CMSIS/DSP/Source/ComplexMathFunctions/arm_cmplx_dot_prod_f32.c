@@ -144,6 +144,55 @@ void arm_cmplx_dot_prod_f32(
     /* Tail */
     blkCnt = numSamples & 0x7;
 
+#elif defined(ARM_MATH_X86_SIMD)
+    arm_x86_f32v_t vecA, vecB;
+    arm_x86_f32v_t accRe, accIm;
+    float32_t accum[ARM_X86_LANES_F32];
+    uint32_t k;
+
+    accRe = __arm_vec_dup_f32_x86(0.0f);
+    accIm = __arm_vec_dup_f32_x86(0.0f);
+
+    /* Compute ARM_X86_LANES_F32/2 outputs at a time */
+    blkCnt = numSamples / (ARM_X86_LANES_F32 / 2U);
+
+    while (blkCnt > 0U)
+    {
+        /* C = (A[0]+jA[1])*(B[0]+jB[1]) + ...  */
+        vecA = __arm_vec_load_f32_x86(pSrcA);
+        vecB = __arm_vec_load_f32_x86(pSrcB);
+
+        /* Increment pointers */
+        pSrcA += ARM_X86_LANES_F32;
+        pSrcB += ARM_X86_LANES_F32;
+
+        /* Even lanes : Re{A}*Re{B}, odd lanes : Im{A}*Im{B} */
+        accRe = __arm_vec_mla_f32_x86(accRe, vecA, vecB);
+
+        /* Even lanes : Im{A}*Re{B}, odd lanes : Re{A}*Im{B} */
+        accIm = __arm_vec_mla_f32_x86(accIm, __arm_vec_cmplx_swap_f32_x86(vecA), vecB);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Re{C} = Re{A}*Re{B} - Im{A}*Im{B} */
+    __arm_vec_store_f32_x86(accum, accRe);
+    for (k = 0U; k < ARM_X86_LANES_F32; k += 2U)
+    {
+      real_sum += accum[k] - accum[k + 1U];
+    }
+
+    /* Im{C} = Re{A}*Im{B} + Im{A}*Re{B} */
+    __arm_vec_store_f32_x86(accum, accIm);
+    for (k = 0U; k < ARM_X86_LANES_F32; k += 2U)
+    {
+      imag_sum += accum[k] + accum[k + 1U];
+    }
+
+    /* Tail */
+    blkCnt = numSamples % (ARM_X86_LANES_F32 / 2U);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
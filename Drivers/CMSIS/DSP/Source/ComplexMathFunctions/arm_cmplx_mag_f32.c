@@ -123,6 +123,38 @@ void arm_cmplx_mag_f32(
 
   blkCnt = numSamples & 7;
 
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32v_t vecA;
+  arm_x86_f32v_t vecB;
+  arm_x86_f32v_t vMagSq;
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = numSamples / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* out = sqrt((real * real) + (imag * imag)) */
+
+    vecA = __arm_vec_load_f32_x86(pSrc);
+    pSrc += ARM_X86_LANES_F32;
+
+    vecB = __arm_vec_load_f32_x86(pSrc);
+    pSrc += ARM_X86_LANES_F32;
+
+    vMagSq = __arm_vec_pairadd_f32_x86(__arm_vec_mul_f32_x86(vecA, vecA),
+                                       __arm_vec_mul_f32_x86(vecB, vecB));
+
+    /* Store the result in the destination buffer. */
+    __arm_vec_store_f32_x86(pDst, __arm_vec_sqrt_f32_x86(vMagSq));
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = numSamples % ARM_X86_LANES_F32;
+
 #else
 
 #if defined (ARM_MATH_LOOPUNROLL)
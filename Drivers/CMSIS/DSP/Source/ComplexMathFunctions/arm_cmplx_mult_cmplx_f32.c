@@ -114,6 +114,35 @@ void arm_cmplx_mult_cmplx_f32(
     /* Tail */
     blkCnt = numSamples & 3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+    arm_x86_f32v_t va, vb;
+
+    /* Compute ARM_X86_LANES_F32/2 outputs at a time */
+    blkCnt = numSamples / (ARM_X86_LANES_F32 / 2U);
+
+    while (blkCnt > 0U)
+    {
+        va = __arm_vec_load_f32_x86(pSrcA);
+        vb = __arm_vec_load_f32_x86(pSrcB);
+
+        /* Increment pointers */
+        pSrcA += ARM_X86_LANES_F32;
+        pSrcB += ARM_X86_LANES_F32;
+
+        /* Re{C} = Re{A}*Re{B} - Im{A}*Im{B} */
+        /* Im{C} = Re{A}*Im{B} + Im{A}*Re{B} */
+        __arm_vec_store_f32_x86(pDst, __arm_vec_cmplx_mult_f32_x86(va, vb));
+
+        /* Increment pointer */
+        pDst += ARM_X86_LANES_F32;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples % (ARM_X86_LANES_F32 / 2U);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -105,6 +105,30 @@ void arm_cmplx_mult_real_f32(
 
     /* Tail */
     blkCnt = numSamples & 3;
+#elif defined(ARM_MATH_X86_SIMD)
+    arm_x86_f32v_t ab, r;
+
+    /* Compute ARM_X86_LANES_F32/2 outputs at a time */
+    blkCnt = numSamples / (ARM_X86_LANES_F32 / 2U);
+
+    while (blkCnt > 0U)
+    {
+        ab = __arm_vec_load_f32_x86(pSrcCmplx);
+        r = __arm_vec_load_dup2_f32_x86(pSrcReal);
+
+        /* Increment pointers */
+        pSrcCmplx += ARM_X86_LANES_F32;
+        pSrcReal += ARM_X86_LANES_F32 / 2U;
+
+        __arm_vec_store_f32_x86(pCmplxDst, __arm_vec_mul_f32_x86(ab, r));
+        pCmplxDst += ARM_X86_LANES_F32;
+
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples % (ARM_X86_LANES_F32 / 2U);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -34,4 +34,9 @@
 #include "arm_sin_q31.c"
 #include "arm_sqrt_q15.c"
 #include "arm_sqrt_q31.c"
+#include "arm_vcos_f32.c"
+#include "arm_vexp_f32.c"
+#include "arm_vlog_f32.c"
+#include "arm_vsincos_f32.c"
+#include "arm_vsin_f32.c"
 
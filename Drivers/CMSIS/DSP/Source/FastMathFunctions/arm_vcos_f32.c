@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vcos_f32.c
+ * Description:  Vector cosine calculation for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vcos Vector Cosine
+
+  Computes the trigonometric cosine of each element of a floating-point vector.
+  The input is in radians.
+
+  Contrary to \ref cos, no table is used : the input is reduced to [-pi/4 pi/4]
+  and the sine and cosine of the reduced value are approximated by polynomials.
+  The functions are vectorized with Neon and with the x86 SIMD extensions.
+  The steps used are:
+   -# Calculation of the nearest quadrant q = round(x * 2/pi)
+   -# Reduction r = x - q * pi/2 with pi/2 split in 3 parts (Cody-Waite reduction)
+   -# Evaluation of the sine (degree 7) and cosine (degree 8) polynomials of r
+   -# Selection of the polynomial and of the sign from the 2 low bits of q
+  The quadrant is incremented by one since cos(x) = sin(x + pi/2).
+
+  The Cody-Waite reduction is exact while |x| <= 65536. Beyond, the input is
+  reduced by the scalar code with the bits of 4/pi (Payne-Hanek reduction), so
+  a vector containing such an input is slower. The result of +/-Inf and of NaN is NaN.
+
+  The absolute error is below 1.5e-7 for all the finite inputs. It is not a
+  relative error bound : close to the zeros of the function, where the result
+  is small, the error in ULP is large.
+ */
+
+/**
+  @addtogroup vcos
+  @{
+ */
+
+extern void arm_vsincos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t quadrant);
+
+/**
+  @brief         Vector cosine for floating-point data.
+  @param[in]     pSrc       points to the input vector (radians)
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           In-place
+                   pDst can be the same vector as pSrc.
+ */
+
+void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  arm_vsincos_f32(pSrc, pDst, blockSize, 1U);
+}
+
+/**
+  @} end of vcos group
+ */
@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32.c
+ * Description:  Vector exponential calculation for floating-point values
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vexp Vector Exponential
+
+  Computes the natural exponential of each element of a floating-point vector.
+
+  The steps used are:
+   -# Calculation of n = round(x / ln(2))
+   -# Reduction r = x - n * ln(2) with ln(2) split in 2 parts (Cody-Waite reduction)
+   -# Evaluation of a degree 7 polynomial approximation of exp(r) on [-ln(2)/2 ln(2)/2]
+   -# Multiplication by 2^n, built in the exponent field of the floats
+
+  2^n is applied in 2 steps so that the denormal results are correctly computed.
+  There is no branch on the data, so the function is vectorized with Neon and with
+  the x86 SIMD extensions.
+
+  The maximum error is 1.1 ULP (measured on all the floats of [-104 89]).
+  The result is +Inf for x > 88.7228391 and 0 for x < -103.972084.
+  A NaN input gives a NaN output.
+ */
+
+/**
+  @addtogroup vexp
+  @{
+ */
+
+/* ln(2) = ARM_VEXP_LN2_HI + ARM_VEXP_LN2_LO. The products by n of the first part are exact. */
+#define ARM_VEXP_LN2_HI  0.693359375f
+#define ARM_VEXP_LN2_LO -2.12194440e-4f
+
+/* exp(r) = 1 + r + r^2 * (P5 + r * (P4 + r * (P3 + r * (P2 + r * (P1 + r * P0))))) */
+#define ARM_VEXP_P0 1.9875691500e-4f
+#define ARM_VEXP_P1 1.3981999507e-3f
+#define ARM_VEXP_P2 8.3334519073e-3f
+#define ARM_VEXP_P3 4.1665795894e-2f
+#define ARM_VEXP_P4 1.6666665459e-1f
+#define ARM_VEXP_P5 5.0000001201e-1f
+
+/* Overflow and underflow thresholds */
+#define ARM_VEXP_MAX  88.7228391f
+#define ARM_VEXP_MIN -103.972084f
+
+__STATIC_FORCEINLINE float32_t arm_vexp_scalar_f32(
+  float32_t x)
+{
+  union { float32_t f; int32_t i; } s1, s2;
+  float32_t xc, y, fn, r, p;
+  int32_t n, n1;
+
+  /* Keep n in the range of the exponents */
+  xc = (x > 89.0f) ? 89.0f : x;
+  xc = (xc < -104.0f) ? -104.0f : xc;
+
+  /* Nearest integer of x / ln(2) */
+  y = xc * 1.44269504088896341f;
+  n = (int32_t) (y + ((y < 0.0f) ? -0.5f : 0.5f));
+  fn = (float32_t) n;
+
+  /* Reduced input in [-ln(2)/2 ln(2)/2] */
+  r = xc - fn * ARM_VEXP_LN2_HI;
+  r = r - fn * ARM_VEXP_LN2_LO;
+
+  p = ARM_VEXP_P0;
+  p = p * r + ARM_VEXP_P1;
+  p = p * r + ARM_VEXP_P2;
+  p = p * r + ARM_VEXP_P3;
+  p = p * r + ARM_VEXP_P4;
+  p = p * r + ARM_VEXP_P5;
+  p = p * r * r + r + 1.0f;
+
+  /* p * 2^n with n in [-150 129] : 2^n is split in 2 normal floats */
+  n1 = n >> 1;
+  s1.i = (n1 + 127) << 23;
+  s2.i = (n - n1 + 127) << 23;
+  p = p * s1.f * s2.f;
+
+  p = (x > ARM_VEXP_MAX) ? INFINITY : p;
+  p = (x < ARM_VEXP_MIN) ? 0.0f : p;
+  p = (x != x) ? x : p;
+
+  return (p);
+}
+
+/**
+  @brief         Vector exponential for floating-point data.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           In-place
+                   pDst can be the same vector as pSrc.
+ */
+
+void arm_vexp_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+  float32x4_t x, xc, y, fn, r, p;
+  int32x4_t n, n1;
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    x = vld1q_f32(pSrc);
+
+    /* Keep n in the range of the exponents */
+    xc = vminq_f32(vmaxq_f32(x, vdupq_n_f32(-104.0f)), vdupq_n_f32(89.0f));
+
+    /* Nearest integer : the conversion truncates, so 0.5 with the sign of y is added */
+    y = vmulq_f32(xc, vdupq_n_f32(1.44269504088896341f));
+    n = vcvtq_s32_f32(vaddq_f32(y, vreinterpretq_f32_u32(vorrq_u32(
+          vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x80000000U)),
+          vreinterpretq_u32_f32(vdupq_n_f32(0.5f))))));
+    fn = vcvtq_f32_s32(n);
+
+    r = vmlsq_f32(xc, fn, vdupq_n_f32(ARM_VEXP_LN2_HI));
+    r = vmlsq_f32(r, fn, vdupq_n_f32(ARM_VEXP_LN2_LO));
+
+    p = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P1), r, vdupq_n_f32(ARM_VEXP_P0));
+    p = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P2), r, p);
+    p = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P3), r, p);
+    p = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P4), r, p);
+    p = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P5), r, p);
+    p = vaddq_f32(vmlaq_f32(r, vmulq_f32(p, r), r), vdupq_n_f32(1.0f));
+
+    /* p * 2^n with 2^n split in 2 normal floats */
+    n1 = vshrq_n_s32(n, 1);
+    p = vmulq_f32(p, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n1, vdupq_n_s32(127)), 23)));
+    p = vmulq_f32(p, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vsubq_s32(n, n1), vdupq_n_s32(127)), 23)));
+
+    p = vbslq_f32(vcgtq_f32(x, vdupq_n_f32(ARM_VEXP_MAX)), vdupq_n_f32(INFINITY), p);
+    p = vbslq_f32(vcltq_f32(x, vdupq_n_f32(ARM_VEXP_MIN)), vdupq_n_f32(0.0f), p);
+    p = vbslq_f32(vceqq_f32(x, x), p, x);
+
+    vst1q_f32(pDst, p);
+
+    /* Increment pointers */
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize & 0x3;
+
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32v_t x, xc, y, fn, r, p;
+  arm_x86_u32v_t n, n1;
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    x = __arm_vec_load_f32_x86(pSrc);
+
+    /* Keep n in the range of the exponents */
+    xc = __arm_vec_min_f32_x86(__arm_vec_max_f32_x86(x, __arm_vec_dup_f32_x86(-104.0f)), __arm_vec_dup_f32_x86(89.0f));
+
+    /* Nearest integer : the conversion truncates, so 0.5 with the sign of y is added */
+    y = __arm_vec_mul_f32_x86(xc, __arm_vec_dup_f32_x86(1.44269504088896341f));
+    n = __arm_vec_cvtt_s32_f32_x86(__arm_vec_add_f32_x86(y, __arm_vec_as_f32_u32_x86(__arm_vec_or_u32_x86(
+          __arm_vec_and_u32_x86(__arm_vec_as_u32_f32_x86(y), __arm_vec_dup_u32_x86(0x80000000U)),
+          __arm_vec_as_u32_f32_x86(__arm_vec_dup_f32_x86(0.5f))))));
+    fn = __arm_vec_cvt_f32_s32_x86(n);
+
+    r = __arm_vec_mla_f32_x86(xc, fn, __arm_vec_dup_f32_x86(-ARM_VEXP_LN2_HI));
+    r = __arm_vec_mla_f32_x86(r, fn, __arm_vec_dup_f32_x86(-ARM_VEXP_LN2_LO));
+
+    p = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VEXP_P1), r, __arm_vec_dup_f32_x86(ARM_VEXP_P0));
+    p = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VEXP_P2), r, p);
+    p = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VEXP_P3), r, p);
+    p = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VEXP_P4), r, p);
+    p = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VEXP_P5), r, p);
+    p = __arm_vec_add_f32_x86(__arm_vec_mla_f32_x86(r, __arm_vec_mul_f32_x86(p, r), r), __arm_vec_dup_f32_x86(1.0f));
+
+    /* p * 2^n with 2^n split in 2 normal floats */
+    n1 = __arm_vec_sra_s32_x86(n, 1);
+    p = __arm_vec_mul_f32_x86(p, __arm_vec_as_f32_u32_x86(
+          __arm_vec_sll_u32_x86(__arm_vec_add_u32_x86(n1, __arm_vec_dup_u32_x86(127U)), 23)));
+    p = __arm_vec_mul_f32_x86(p, __arm_vec_as_f32_u32_x86(
+          __arm_vec_sll_u32_x86(__arm_vec_add_u32_x86(__arm_vec_sub_u32_x86(n, n1), __arm_vec_dup_u32_x86(127U)), 23)));
+
+    p = __arm_vec_select_f32_x86(__arm_vec_cmpgt_f32_x86(x, __arm_vec_dup_f32_x86(ARM_VEXP_MAX)), __arm_vec_dup_f32_x86(INFINITY), p);
+    p = __arm_vec_select_f32_x86(__arm_vec_cmplt_f32_x86(x, __arm_vec_dup_f32_x86(ARM_VEXP_MIN)), __arm_vec_dup_f32_x86(0.0f), p);
+    p = __arm_vec_select_f32_x86(__arm_vec_cmpeq_f32_x86(x, x), p, x);
+
+    __arm_vec_store_f32_x86(pDst, p);
+
+    /* Increment pointers */
+    pSrc += ARM_X86_LANES_F32;
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_vexp_scalar_f32(*pSrc++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of vexp group
+ */
@@ -0,0 +1,279 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_f32.c
+ * Description:  Vector natural logarithm calculation for floating-point values
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vlog Vector Natural Logarithm
+
+  Computes the natural logarithm of each element of a floating-point vector.
+
+  The steps used are:
+   -# Decomposition x = m * 2^e with m in [sqrt(2)/2 sqrt(2)] from the bits of the float
+      (the denormal inputs are first multiplied by 2^23)
+   -# Evaluation of a degree 10 polynomial approximation of log(m) in m - 1
+   -# Addition of e * ln(2) with ln(2) split in 2 parts
+
+  There is no branch on the data, so the function is vectorized with Neon and with
+  the x86 SIMD extensions.
+
+  The maximum error is 0.9 ULP (measured on all the positive floats).
+  The result is -Inf for 0, +Inf for +Inf and NaN for negative or NaN inputs.
+ */
+
+/**
+  @addtogroup vlog
+  @{
+ */
+
+/* ln(2) = ARM_VLOG_LN2_HI + ARM_VLOG_LN2_LO */
+#define ARM_VLOG_LN2_HI  0.693359375f
+#define ARM_VLOG_LN2_LO -2.12194440e-4f
+
+/* log(1 + m) = m - m^2 / 2 + m^3 * (P8 + m * (P7 + ... + m * P0)) */
+#define ARM_VLOG_P0  7.0376836292e-2f
+#define ARM_VLOG_P1 -1.1514610310e-1f
+#define ARM_VLOG_P2  1.1676998740e-1f
+#define ARM_VLOG_P3 -1.2420140846e-1f
+#define ARM_VLOG_P4  1.4249322787e-1f
+#define ARM_VLOG_P5 -1.6668057665e-1f
+#define ARM_VLOG_P6  2.0000714765e-1f
+#define ARM_VLOG_P7 -2.4999993993e-1f
+#define ARM_VLOG_P8  3.3333331174e-1f
+
+#define ARM_VLOG_SQRTHF 0.707106781186547524f
+
+__STATIC_FORCEINLINE float32_t arm_vlog_scalar_f32(
+  float32_t x)
+{
+  union { float32_t f; int32_t i; } m;
+  float32_t fe, z, y, res;
+  int32_t e;
+
+  /* Denormals are normalized */
+  m.f = (x < FLT_MIN) ? x * 8388608.0f : x;
+  e = (x < FLT_MIN) ? (-126 - 23) : -126;
+
+  /* x = m * 2^e with m in [0.5 1) */
+  e += (m.i >> 23) & 0xFF;
+  m.i = (m.i & 0x007FFFFF) | 0x3F000000;
+
+  /* m in [sqrt(2)/2 sqrt(2)) and m = m - 1 */
+  e = (m.f < ARM_VLOG_SQRTHF) ? e - 1 : e;
+  m.f = ((m.f < ARM_VLOG_SQRTHF) ? m.f + m.f : m.f) - 1.0f;
+  fe = (float32_t) e;
+
+  z = m.f * m.f;
+  y = ARM_VLOG_P0;
+  y = y * m.f + ARM_VLOG_P1;
+  y = y * m.f + ARM_VLOG_P2;
+  y = y * m.f + ARM_VLOG_P3;
+  y = y * m.f + ARM_VLOG_P4;
+  y = y * m.f + ARM_VLOG_P5;
+  y = y * m.f + ARM_VLOG_P6;
+  y = y * m.f + ARM_VLOG_P7;
+  y = y * m.f + ARM_VLOG_P8;
+  y = y * m.f * z;
+
+  y = y + fe * ARM_VLOG_LN2_LO;
+  y = y - 0.5f * z;
+  res = m.f + y;
+  res = res + fe * ARM_VLOG_LN2_HI;
+
+  res = (x > 0.0f) ? res : NAN;
+  res = (x == 0.0f) ? -INFINITY : res;
+  res = (x == INFINITY) ? INFINITY : res;
+
+  return (res);
+}
+
+/**
+  @brief         Vector natural logarithm for floating-point data.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           In-place
+                   pDst can be the same vector as pSrc.
+ */
+
+void arm_vlog_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+  float32x4_t x, m, fe, z, y, res;
+  int32x4_t e;
+  uint32x4_t mask;
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    x = vld1q_f32(pSrc);
+
+    /* Denormals are normalized */
+    mask = vcltq_f32(x, vdupq_n_f32(FLT_MIN));
+    m = vbslq_f32(mask, vmulq_f32(x, vdupq_n_f32(8388608.0f)), x);
+    e = vbslq_s32(mask, vdupq_n_s32(126 + 23), vdupq_n_s32(126));
+
+    /* x = m * 2^e with m in [0.5 1) */
+    e = vsubq_s32(vreinterpretq_s32_u32(vandq_u32(vshrq_n_u32(vreinterpretq_u32_f32(m), 23), vdupq_n_u32(0xFFU))), e);
+    m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(m), vdupq_n_u32(0x007FFFFFU)),
+                                        vdupq_n_u32(0x3F000000U)));
+
+    /* m in [sqrt(2)/2 sqrt(2)) and m = m - 1. The mask is -1 in the lanes to update. */
+    mask = vcltq_f32(m, vdupq_n_f32(ARM_VLOG_SQRTHF));
+    e = vaddq_s32(e, vreinterpretq_s32_u32(mask));
+    m = vsubq_f32(vaddq_f32(m, vbslq_f32(mask, m, vdupq_n_f32(0.0f))), vdupq_n_f32(1.0f));
+    fe = vcvtq_f32_s32(e);
+
+    z = vmulq_f32(m, m);
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P1), m, vdupq_n_f32(ARM_VLOG_P0));
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P2), m, y);
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P3), m, y);
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P4), m, y);
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P5), m, y);
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P6), m, y);
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P7), m, y);
+    y = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P8), m, y);
+    y = vmulq_f32(vmulq_f32(y, m), z);
+
+    y = vmlaq_f32(y, fe, vdupq_n_f32(ARM_VLOG_LN2_LO));
+    y = vmlsq_f32(y, z, vdupq_n_f32(0.5f));
+    res = vaddq_f32(m, y);
+    res = vmlaq_f32(res, fe, vdupq_n_f32(ARM_VLOG_LN2_HI));
+
+    res = vbslq_f32(vcgtq_f32(x, vdupq_n_f32(0.0f)), res, vdupq_n_f32(NAN));
+    res = vbslq_f32(vceqq_f32(x, vdupq_n_f32(0.0f)), vdupq_n_f32(-INFINITY), res);
+    res = vbslq_f32(vceqq_f32(x, vdupq_n_f32(INFINITY)), vdupq_n_f32(INFINITY), res);
+
+    vst1q_f32(pDst, res);
+
+    /* Increment pointers */
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize & 0x3;
+
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32v_t x, m, fe, z, y, res, mask;
+  arm_x86_u32v_t e;
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    x = __arm_vec_load_f32_x86(pSrc);
+
+    /* Denormals are normalized */
+    mask = __arm_vec_cmplt_f32_x86(x, __arm_vec_dup_f32_x86(FLT_MIN));
+    m = __arm_vec_select_f32_x86(mask, __arm_vec_mul_f32_x86(x, __arm_vec_dup_f32_x86(8388608.0f)), x);
+    e = __arm_vec_select_u32_x86(mask, __arm_vec_dup_u32_x86(126U + 23U), __arm_vec_dup_u32_x86(126U));
+
+    /* x = m * 2^e with m in [0.5 1) */
+    e = __arm_vec_sub_u32_x86(__arm_vec_and_u32_x86(__arm_vec_srl_u32_x86(__arm_vec_as_u32_f32_x86(m), 23),
+                                                    __arm_vec_dup_u32_x86(0xFFU)), e);
+    m = __arm_vec_as_f32_u32_x86(__arm_vec_or_u32_x86(
+          __arm_vec_and_u32_x86(__arm_vec_as_u32_f32_x86(m), __arm_vec_dup_u32_x86(0x007FFFFFU)),
+          __arm_vec_dup_u32_x86(0x3F000000U)));
+
+    /* m in [sqrt(2)/2 sqrt(2)) and m = m - 1. The mask is -1 in the lanes to update. */
+    mask = __arm_vec_cmplt_f32_x86(m, __arm_vec_dup_f32_x86(ARM_VLOG_SQRTHF));
+    e = __arm_vec_add_u32_x86(e, __arm_vec_as_u32_f32_x86(mask));
+    m = __arm_vec_sub_f32_x86(__arm_vec_add_f32_x86(m, __arm_vec_select_f32_x86(mask, m, __arm_vec_dup_f32_x86(0.0f))),
+                              __arm_vec_dup_f32_x86(1.0f));
+    fe = __arm_vec_cvt_f32_s32_x86(e);
+
+    z = __arm_vec_mul_f32_x86(m, m);
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P1), m, __arm_vec_dup_f32_x86(ARM_VLOG_P0));
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P2), m, y);
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P3), m, y);
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P4), m, y);
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P5), m, y);
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P6), m, y);
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P7), m, y);
+    y = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VLOG_P8), m, y);
+    y = __arm_vec_mul_f32_x86(__arm_vec_mul_f32_x86(y, m), z);
+
+    y = __arm_vec_mla_f32_x86(y, fe, __arm_vec_dup_f32_x86(ARM_VLOG_LN2_LO));
+    y = __arm_vec_mla_f32_x86(y, z, __arm_vec_dup_f32_x86(-0.5f));
+    res = __arm_vec_add_f32_x86(m, y);
+    res = __arm_vec_mla_f32_x86(res, fe, __arm_vec_dup_f32_x86(ARM_VLOG_LN2_HI));
+
+    res = __arm_vec_select_f32_x86(__arm_vec_cmpgt_f32_x86(x, __arm_vec_dup_f32_x86(0.0f)), res, __arm_vec_dup_f32_x86(NAN));
+    res = __arm_vec_select_f32_x86(__arm_vec_cmpeq_f32_x86(x, __arm_vec_dup_f32_x86(0.0f)), __arm_vec_dup_f32_x86(-INFINITY), res);
+    res = __arm_vec_select_f32_x86(__arm_vec_cmpeq_f32_x86(x, __arm_vec_dup_f32_x86(INFINITY)), __arm_vec_dup_f32_x86(INFINITY), res);
+
+    __arm_vec_store_f32_x86(pDst, res);
+
+    /* Increment pointers */
+    pSrc += ARM_X86_LANES_F32;
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_vlog_scalar_f32(*pSrc++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of vlog group
+ */
@@ -0,0 +1,345 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsincos_f32.c
+ * Description:  Common kernel of the vector sine and cosine for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vsin
+  @{
+ */
+
+/* pi/2 = ARM_VSINCOS_DP1 + ARM_VSINCOS_DP2 + ARM_VSINCOS_DP3. The first 2 parts have 8 significant bits,
+   so their products by q are exact for |q| < 2^16. */
+#define ARM_VSINCOS_DP1 1.5703125f
+#define ARM_VSINCOS_DP2 4.825592041015625e-4f
+#define ARM_VSINCOS_DP3 1.26759079505673141701e-6f
+
+/* Largest input magnitude of the Cody-Waite reduction, |q| <= 41722 */
+#define ARM_VSINCOS_MAX 65536.0f
+#define ARM_VSINCOS_MAX_BITS 0x47800000U
+
+/* sin(r) = r + r^3 * (S1 + r^2 * (S2 + r^2 * S3)) */
+#define ARM_VSINCOS_S1 -1.6666654611e-1f
+#define ARM_VSINCOS_S2  8.3321608736e-3f
+#define ARM_VSINCOS_S3 -1.9515295891e-4f
+
+/* cos(r) = 1 - r^2 / 2 + r^4 * (C1 + r^2 * (C2 + r^2 * C3)) */
+#define ARM_VSINCOS_C1  4.166664568298827e-2f
+#define ARM_VSINCOS_C2 -1.388731625493765e-3f
+#define ARM_VSINCOS_C3  2.443315711809948e-5f
+
+/* pi/2 * 2^-62 */
+#define ARM_VSINCOS_PIO2_2M62 3.40612158e-19f
+
+/* Bits of 4/pi : entry k, for k >= 3, is floor(4/pi * 2^(8*k + 7)) modulo 2^32.
+   The first entries hold the leading bits only. */
+static const uint32_t arm_vsincos_inv_pio4[24] = {
+  0x000000a2U, 0x0000a2f9U, 0x00a2f983U, 0xa2f9836eU,
+  0xf9836e4eU, 0x836e4e44U, 0x6e4e4415U, 0x4e441529U,
+  0x441529fcU, 0x1529fc27U, 0x29fc2757U, 0xfc2757d1U,
+  0x2757d1f5U, 0x57d1f534U, 0xd1f534ddU, 0xf534ddc0U,
+  0x34ddc0dbU, 0xddc0db62U, 0xc0db6295U, 0xdb629599U,
+  0x6295993cU, 0x95993c43U, 0x993c4390U, 0x3c439041U
+};
+
+/*
+ * Payne-Hanek reduction of a finite magnitude larger than ARM_VSINCOS_MAX,
+ * given by its bits ax : ax = q * pi/2 + r with r in [-pi/4 pi/4].
+ * The mantissa is multiplied by the 96 bits of 4/pi which are aligned with
+ * its exponent. The lower bits of 4/pi only change the result by less than
+ * 2^-62 and the higher bits only add multiples of 8.
+ * The 64 bits product holds 2 integer bits (the quadrant modulo 4) and 62
+ * fractional bits.
+ */
+static float32_t arm_vsincos_reduce_f32(
+  uint32_t ax,
+  uint32_t * q)
+{
+  const uint32_t *pTable = &arm_vsincos_inv_pio4[(ax >> 26) & 15U];
+  uint32_t shift = (ax >> 23) & 7U;
+  uint32_t m;
+  uint64_t res0, res1, res2, n;
+
+  m = ((ax & 0x007fffffU) | 0x00800000U) << shift;
+
+  res0 = (uint32_t) (m * pTable[0]);
+  res1 = (uint64_t) m * pTable[4];
+  res2 = (uint64_t) m * pTable[8];
+  res0 = (res2 >> 32) | (res0 << 32);
+  res0 += res1;
+
+  /* Nearest quadrant and signed fraction */
+  n = (res0 + (1ULL << 61)) >> 62;
+  res0 -= n << 62;
+
+  *q = (uint32_t) n;
+
+  return ((float32_t) (int64_t) res0 * ARM_VSINCOS_PIO2_2M62);
+}
+
+/* sin(x + quadrant * pi/2) */
+static float32_t arm_vsincos_scalar_f32(
+  float32_t x,
+  uint32_t quadrant)
+{
+  float32_t y, fq, r, r2, s, c;
+  uint32_t xi, ax, q, si, ci, mask;
+
+  memcpy(&xi, &x, sizeof(xi));
+  ax = xi & 0x7fffffffU;
+
+  if (ax <= ARM_VSINCOS_MAX_BITS)
+  {
+    /* Nearest quadrant */
+    y = x * 0.636619772367581343f;
+    q = (uint32_t) (int32_t) (y + ((y < 0.0f) ? -0.5f : 0.5f));
+    fq = (float32_t) (int32_t) q;
+
+    /* Reduced input in [-pi/4 pi/4] */
+    r = x - fq * ARM_VSINCOS_DP1;
+    r = r - fq * ARM_VSINCOS_DP2;
+    r = r - fq * ARM_VSINCOS_DP3;
+  }
+  else if (ax < 0x7f800000U)
+  {
+    /* |x| is reduced. sin(-x) = sin(x + pi) and cos(-x) = cos(x) */
+    r = arm_vsincos_reduce_f32(ax, &q);
+    if ((xi != ax) && (quadrant == 0U))
+    {
+      q += 2U;
+    }
+  }
+  else
+  {
+    /* NaN for the infinites and the NaNs */
+    return (x - x);
+  }
+
+  q += quadrant;
+  r2 = r * r;
+
+  s = r + r * r2 * (ARM_VSINCOS_S1 + r2 * (ARM_VSINCOS_S2 + r2 * ARM_VSINCOS_S3));
+  c = 1.0f - 0.5f * r2 + r2 * r2 * (ARM_VSINCOS_C1 + r2 * (ARM_VSINCOS_C2 + r2 * ARM_VSINCOS_C3));
+
+  /* Odd quadrants use the cosine polynomial, quadrants 2 and 3 are negated */
+  memcpy(&si, &s, sizeof(si));
+  memcpy(&ci, &c, sizeof(ci));
+  mask = 0U - (q & 1U);
+  si = ((ci & mask) | (si & ~mask)) ^ ((q & 2U) << 30);
+  memcpy(&s, &si, sizeof(s));
+
+  return (s);
+}
+
+/**
+  @brief         Common kernel of \ref arm_vsin_f32 and \ref arm_vcos_f32.
+  @param[in]     pSrc       points to the input vector (radians)
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     quadrant   0 for the sine, 1 for the cosine
+  @return        none
+
+  @par           In-place
+                   pDst can be the same vector as pSrc.
+  @par
+                   A vector with an input beyond +/-ARM_VSINCOS_MAX or a non-finite
+                   input is computed again by the scalar version.
+ */
+
+void arm_vsincos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t quadrant)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+  float32x4_t x, y, fq, r, r2, s, c, res;
+  float32_t xv[4];
+  int32x4_t q;
+  uint32x4_t mask;
+  uint32x2_t any;
+  uint32_t i;
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    x = vld1q_f32(pSrc);
+
+    /* Nearest quadrant : the conversion truncates, so 0.5 with the sign of y is added */
+    y = vmulq_f32(x, vdupq_n_f32(0.636619772367581343f));
+    q = vcvtq_s32_f32(vaddq_f32(y, vreinterpretq_f32_u32(vorrq_u32(
+          vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x80000000U)),
+          vreinterpretq_u32_f32(vdupq_n_f32(0.5f))))));
+    fq = vcvtq_f32_s32(q);
+
+    r = vmlsq_f32(x, fq, vdupq_n_f32(ARM_VSINCOS_DP1));
+    r = vmlsq_f32(r, fq, vdupq_n_f32(ARM_VSINCOS_DP2));
+    r = vmlsq_f32(r, fq, vdupq_n_f32(ARM_VSINCOS_DP3));
+    r2 = vmulq_f32(r, r);
+
+    q = vaddq_s32(q, vdupq_n_s32((int32_t) quadrant));
+
+    s = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_S2), r2, vdupq_n_f32(ARM_VSINCOS_S3));
+    s = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_S1), r2, s);
+    s = vmlaq_f32(r, vmulq_f32(r, r2), s);
+
+    c = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_C2), r2, vdupq_n_f32(ARM_VSINCOS_C3));
+    c = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_C1), r2, c);
+    c = vmlaq_f32(vmlsq_f32(vdupq_n_f32(1.0f), r2, vdupq_n_f32(0.5f)), vmulq_f32(r2, r2), c);
+
+    /* Odd quadrants use the cosine polynomial, quadrants 2 and 3 are negated */
+    mask = vreinterpretq_u32_s32(vshrq_n_s32(vshlq_n_s32(q, 31), 31));
+    res = vbslq_f32(mask, c, s);
+    res = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(res),
+            vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(2U)), 30)));
+
+    /* Lanes beyond ARM_VSINCOS_MAX or not finite */
+    mask = vmvnq_u32(vcleq_f32(vabsq_f32(x), vdupq_n_f32(ARM_VSINCOS_MAX)));
+    any = vpmax_u32(vget_low_u32(mask), vget_high_u32(mask));
+    any = vpmax_u32(any, any);
+
+    if (vget_lane_u32(any, 0) != 0U)
+    {
+      vst1q_f32(xv, x);
+      for (i = 0U; i < 4U; i++)
+      {
+        pDst[i] = arm_vsincos_scalar_f32(xv[i], quadrant);
+      }
+    }
+    else
+    {
+      vst1q_f32(pDst, res);
+    }
+
+    /* Increment pointers */
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize & 0x3;
+
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32v_t x, y, fq, r, r2, s, c, res, mask;
+  arm_x86_u32v_t q;
+  float32_t xv[ARM_X86_LANES_F32];
+  uint32_t i;
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    x = __arm_vec_load_f32_x86(pSrc);
+
+    /* Nearest quadrant : the conversion truncates, so 0.5 with the sign of y is added */
+    y = __arm_vec_mul_f32_x86(x, __arm_vec_dup_f32_x86(0.636619772367581343f));
+    q = __arm_vec_cvtt_s32_f32_x86(__arm_vec_add_f32_x86(y, __arm_vec_as_f32_u32_x86(__arm_vec_or_u32_x86(
+          __arm_vec_and_u32_x86(__arm_vec_as_u32_f32_x86(y), __arm_vec_dup_u32_x86(0x80000000U)),
+          __arm_vec_as_u32_f32_x86(__arm_vec_dup_f32_x86(0.5f))))));
+    fq = __arm_vec_cvt_f32_s32_x86(q);
+
+    r = __arm_vec_mla_f32_x86(x, fq, __arm_vec_dup_f32_x86(-ARM_VSINCOS_DP1));
+    r = __arm_vec_mla_f32_x86(r, fq, __arm_vec_dup_f32_x86(-ARM_VSINCOS_DP2));
+    r = __arm_vec_mla_f32_x86(r, fq, __arm_vec_dup_f32_x86(-ARM_VSINCOS_DP3));
+    r2 = __arm_vec_mul_f32_x86(r, r);
+
+    q = __arm_vec_add_u32_x86(q, __arm_vec_dup_u32_x86(quadrant));
+
+    s = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VSINCOS_S2), r2, __arm_vec_dup_f32_x86(ARM_VSINCOS_S3));
+    s = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VSINCOS_S1), r2, s);
+    s = __arm_vec_mla_f32_x86(r, __arm_vec_mul_f32_x86(r, r2), s);
+
+    c = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VSINCOS_C2), r2, __arm_vec_dup_f32_x86(ARM_VSINCOS_C3));
+    c = __arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(ARM_VSINCOS_C1), r2, c);
+    c = __arm_vec_mla_f32_x86(__arm_vec_mla_f32_x86(__arm_vec_dup_f32_x86(1.0f), r2, __arm_vec_dup_f32_x86(-0.5f)),
+                              __arm_vec_mul_f32_x86(r2, r2), c);
+
+    /* Odd quadrants use the cosine polynomial, quadrants 2 and 3 are negated */
+    mask = __arm_vec_as_f32_u32_x86(__arm_vec_sra_s32_x86(__arm_vec_sll_u32_x86(q, 31), 31));
+    res = __arm_vec_select_f32_x86(mask, c, s);
+    res = __arm_vec_as_f32_u32_x86(__arm_vec_xor_u32_x86(__arm_vec_as_u32_f32_x86(res),
+            __arm_vec_sll_u32_x86(__arm_vec_and_u32_x86(q, __arm_vec_dup_u32_x86(2U)), 30)));
+
+    /* Lanes beyond ARM_VSINCOS_MAX or not finite */
+    mask = __arm_vec_cmpnle_f32_x86(__arm_vec_abs_f32_x86(x), __arm_vec_dup_f32_x86(ARM_VSINCOS_MAX));
+
+    if (__arm_vec_movemask_f32_x86(mask) != 0)
+    {
+      __arm_vec_store_f32_x86(xv, x);
+      for (i = 0U; i < ARM_X86_LANES_F32; i++)
+      {
+        pDst[i] = arm_vsincos_scalar_f32(xv[i], quadrant);
+      }
+    }
+    else
+    {
+      __arm_vec_store_f32_x86(pDst, res);
+    }
+
+    /* Increment pointers */
+    pSrc += ARM_X86_LANES_F32;
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_vsincos_scalar_f32(*pSrc++, quadrant);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of vsin group
+ */
@@ -42,6 +42,8 @@
 #include "arm_biquad_cascade_df2T_init_f64.c"
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
+#include "arm_biquad_bank_df2T_f32.c"
+#include "arm_biquad_bank_df2T_init_f32.c"
 #include "arm_conv_f32.c"
 #include "arm_conv_fast_opt_q15.c"
 #include "arm_conv_fast_q15.c"
@@ -80,6 +82,8 @@
 #include "arm_fir_f32.c"
 #include "arm_fir_fast_q15.c"
 #include "arm_fir_fast_q31.c"
+#include "arm_fir_fft_f32.c"
+#include "arm_fir_fft_init_f32.c"
 #include "arm_fir_init_f32.c"
 #include "arm_fir_init_q15.c"
 #include "arm_fir_init_q31.c"
@@ -96,6 +100,10 @@
 #include "arm_fir_lattice_init_q31.c"
 #include "arm_fir_lattice_q15.c"
 #include "arm_fir_lattice_q31.c"
+#include "arm_fir_multi_f32.c"
+#include "arm_fir_multi_init_f32.c"
+#include "arm_fir_multi_init_q15.c"
+#include "arm_fir_multi_q15.c"
 #include "arm_fir_q15.c"
 #include "arm_fir_q31.c"
 #include "arm_fir_q7.c"
@@ -107,6 +115,14 @@
 #include "arm_fir_sparse_q15.c"
 #include "arm_fir_sparse_q31.c"
 #include "arm_fir_sparse_q7.c"
+#include "arm_fir_sparse_runs_f32.c"
+#include "arm_fir_sparse_runs_init_f32.c"
+#include "arm_fir_sparse_runs_init_q15.c"
+#include "arm_fir_sparse_runs_init_q31.c"
+#include "arm_fir_sparse_runs_init_q7.c"
+#include "arm_fir_sparse_runs_q15.c"
+#include "arm_fir_sparse_runs_q31.c"
+#include "arm_fir_sparse_runs_q7.c"
 #include "arm_iir_lattice_f32.c"
 #include "arm_iir_lattice_init_f32.c"
 #include "arm_iir_lattice_init_q15.c"
@@ -125,3 +141,7 @@
 #include "arm_lms_norm_q31.c"
 #include "arm_lms_q15.c"
 #include "arm_lms_q31.c"
+#include "arm_resample_f32.c"
+#include "arm_resample_init_f32.c"
+#include "arm_resample_init_q15.c"
+#include "arm_resample_q15.c"
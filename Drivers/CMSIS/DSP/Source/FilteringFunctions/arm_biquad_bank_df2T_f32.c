@@ -0,0 +1,351 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_bank_df2T_f32.c
+ * Description:  Processing function for the floating-point transposed direct form II Biquad filter bank
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup BiquadBankDF2T Biquad Filter Banks Using a Direct Form II Transposed Structure
+
+  This set of functions implements a bank of independent Biquad cascade filters
+  (the bands of a graphic equalizer, the outputs of a crossover or the channels of
+  a multi-channel stream). Each channel has its own coefficients and state and is
+  filtered exactly like with ::arm_biquad_cascade_df2T_f32.
+  @par
+                   The samples of a Biquad cascade are serially dependent, so a single cascade
+                   cannot use the SIMD lanes of the processor. The bank filters several channels
+                   in lockstep instead : each lane is processing a different channel and the
+                   coefficients are stored transposed, so the coefficients of a group of
+                   consecutive channels are loaded with one vector load.
+                   The channels are processed by groups of 4 with Neon and of ARM_X86_LANES_F32
+                   with the x86 SIMD extensions.
+
+  @par           Channel Layout
+                   The input and output buffers contain <code>numChannels*blockSize</code> samples
+                   with the channels interleaved :
+  <pre>
+      {x0[0], x1[0], ..., xN-1[0], x0[1], x1[1], ...}
+  </pre>
+                   The processing can be done in place.
+
+  @par           Coefficient and State Ordering
+                   The coefficient <code>k</code> (b0, b1, b2, a1, a2) of stage <code>s</code> of channel
+                   <code>c</code> is stored at <code>pCoeffs[(5*s + k)*numChannels + c]</code>.
+                   The array contains <code>5*numStages*numChannels</code> values.
+                   ::arm_biquad_bank_df2T_compute_coefs_f32 is building it from the coefficients
+                   of each channel in the ::arm_biquad_cascade_df2T_init_f32 order.
+  @par
+                   The state variables <code>d1</code> of stage <code>s</code> of all the channels are
+                   followed by the state variables <code>d2</code> of the same stage.
+                   The state array has a total length of <code>2*numStages*numChannels</code> values.
+                   The state variables are updated after each block of data is processed; the coefficients are untouched.
+
+  @par           Instance Structure
+                   The coefficients and state variables for a bank are stored together in an instance data structure.
+                   A separate instance structure must be defined for each bank.
+                   Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+
+  @par           Init Functions
+                   There is also an associated initialization function.
+                   The initialization function clears the state buffer.
+                   All the channels must have the same number of stages. A channel with a lower order
+                   can use pass-through stages (<code>b0=1</code>, other coefficients 0).
+ */
+
+/**
+  @addtogroup BiquadBankDF2T
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point transposed direct form II Biquad filter bank.
+  @param[in]     S          points to an instance of the filter bank data structure
+  @param[in]     pSrc       points to the block of interleaved input data
+  @param[out]    pDst       points to the block of interleaved output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+ */
+void arm_biquad_bank_df2T_f32(
+  const arm_biquad_bank_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const float32_t *px;                                 /* Input pointer of a channel */
+        float32_t *py;                                 /* Output pointer of a channel */
+        float32_t acc0;                                /* Accumulator */
+        float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+        float32_t Xn0;                                 /* Temporary input */
+        float32_t d10, d20;                            /* State variables */
+        uint32_t numChannels = S->numChannels;         /* Number of channels */
+        uint32_t sample, ch, stage = S->numStages;     /* Loop counters */
+
+#if defined(ARM_MATH_NEON)
+        float32x4_t b0V, b1V, b2V, a1V, a2V;           /* Coefficients of 4 channels */
+        float32x4_t d1V, d2V;                          /* State variables of 4 channels */
+        float32x4_t xV, accV;                          /* Input and output of 4 channels */
+#elif defined(ARM_MATH_X86_SIMD)
+        arm_x86_f32v_t b0V, b1V, b2V, a1V, a2V;        /* Coefficients of ARM_X86_LANES_F32 channels */
+        arm_x86_f32v_t d1V, d2V;                       /* State variables of ARM_X86_LANES_F32 channels */
+        arm_x86_f32v_t xV, accV;                       /* Input and output of ARM_X86_LANES_F32 channels */
+#endif
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t acc1;                                /* Accumulator */
+        float32_t b01, b11, b21, a11, a21;             /* Filter coefficients of the second channel */
+        float32_t Xn1;                                 /* Temporary input */
+        float32_t d11, d21;                            /* State variables */
+#endif
+
+  do
+  {
+    /* y[n] = b0 * x[n] + d1 */
+    /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+    /* d2 = b2 * x[n] + a2 * y[n] */
+
+    ch = 0U;
+
+#if defined(ARM_MATH_NEON)
+
+    /* 4 channels at a time */
+    while ((ch + 4U) <= numChannels)
+    {
+      /* Reading the coefficients and the state values of the 4 channels */
+      b0V = vld1q_f32(pCoeffs + ch);
+      b1V = vld1q_f32(pCoeffs + numChannels + ch);
+      b2V = vld1q_f32(pCoeffs + (2U * numChannels) + ch);
+      a1V = vld1q_f32(pCoeffs + (3U * numChannels) + ch);
+      a2V = vld1q_f32(pCoeffs + (4U * numChannels) + ch);
+
+      d1V = vld1q_f32(pState + ch);
+      d2V = vld1q_f32(pState + numChannels + ch);
+
+      px = pIn + ch;
+      py = pDst + ch;
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        xV = vld1q_f32(px);
+
+        accV = vmlaq_f32(d1V, b0V, xV);
+        vst1q_f32(py, accV);
+
+        d1V = vaddq_f32(vmlaq_f32(vmulq_f32(b1V, xV), a1V, accV), d2V);
+        d2V = vmlaq_f32(vmulq_f32(b2V, xV), a2V, accV);
+
+        px += numChannels;
+        py += numChannels;
+
+        /* Decrement loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      vst1q_f32(pState + ch, d1V);
+      vst1q_f32(pState + numChannels + ch, d2V);
+
+      ch += 4U;
+    }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+    /* ARM_X86_LANES_F32 channels at a time */
+    while ((ch + ARM_X86_LANES_F32) <= numChannels)
+    {
+      /* Reading the coefficients and the state values of the ARM_X86_LANES_F32 channels */
+      b0V = __arm_vec_load_f32_x86(pCoeffs + ch);
+      b1V = __arm_vec_load_f32_x86(pCoeffs + numChannels + ch);
+      b2V = __arm_vec_load_f32_x86(pCoeffs + (2U * numChannels) + ch);
+      a1V = __arm_vec_load_f32_x86(pCoeffs + (3U * numChannels) + ch);
+      a2V = __arm_vec_load_f32_x86(pCoeffs + (4U * numChannels) + ch);
+
+      d1V = __arm_vec_load_f32_x86(pState + ch);
+      d2V = __arm_vec_load_f32_x86(pState + numChannels + ch);
+
+      px = pIn + ch;
+      py = pDst + ch;
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        xV = __arm_vec_load_f32_x86(px);
+
+        accV = __arm_vec_mla_f32_x86(d1V, b0V, xV);
+        __arm_vec_store_f32_x86(py, accV);
+
+        d1V = __arm_vec_add_f32_x86(__arm_vec_mla_f32_x86(__arm_vec_mul_f32_x86(b1V, xV), a1V, accV), d2V);
+        d2V = __arm_vec_mla_f32_x86(__arm_vec_mul_f32_x86(b2V, xV), a2V, accV);
+
+        px += numChannels;
+        py += numChannels;
+
+        /* Decrement loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      __arm_vec_store_f32_x86(pState + ch, d1V);
+      __arm_vec_store_f32_x86(pState + numChannels + ch, d2V);
+
+      ch += ARM_X86_LANES_F32;
+    }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* 2 channels at a time */
+    while ((ch + 2U) <= numChannels)
+    {
+      /* Reading the coefficients */
+      b0  = pCoeffs[ch];
+      b01 = pCoeffs[ch + 1U];
+      b1  = pCoeffs[numChannels + ch];
+      b11 = pCoeffs[numChannels + ch + 1U];
+      b2  = pCoeffs[(2U * numChannels) + ch];
+      b21 = pCoeffs[(2U * numChannels) + ch + 1U];
+      a1  = pCoeffs[(3U * numChannels) + ch];
+      a11 = pCoeffs[(3U * numChannels) + ch + 1U];
+      a2  = pCoeffs[(4U * numChannels) + ch];
+      a21 = pCoeffs[(4U * numChannels) + ch + 1U];
+
+      /* Reading the state values */
+      d10 = pState[ch];
+      d11 = pState[ch + 1U];
+      d20 = pState[numChannels + ch];
+      d21 = pState[numChannels + ch + 1U];
+
+      px = pIn + ch;
+      py = pDst + ch;
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        Xn0 = px[0];
+        Xn1 = px[1];
+
+        acc0 = (b0  * Xn0) + d10;
+        acc1 = (b01 * Xn1) + d11;
+
+        py[0] = acc0;
+        py[1] = acc1;
+
+        d10 = ((b1  * Xn0) + (a1  * acc0)) + d20;
+        d11 = ((b11 * Xn1) + (a11 * acc1)) + d21;
+
+        d20 = (b2  * Xn0) + (a2  * acc0);
+        d21 = (b21 * Xn1) + (a21 * acc1);
+
+        px += numChannels;
+        py += numChannels;
+
+        /* Decrement loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[ch]                    = d10;
+      pState[ch + 1U]               = d11;
+      pState[numChannels + ch]      = d20;
+      pState[numChannels + ch + 1U] = d21;
+
+      ch += 2U;
+    }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    /* Remaining channels */
+    while (ch < numChannels)
+    {
+      /* Reading the coefficients */
+      b0 = pCoeffs[ch];
+      b1 = pCoeffs[numChannels + ch];
+      b2 = pCoeffs[(2U * numChannels) + ch];
+      a1 = pCoeffs[(3U * numChannels) + ch];
+      a2 = pCoeffs[(4U * numChannels) + ch];
+
+      /* Reading the state values */
+      d10 = pState[ch];
+      d20 = pState[numChannels + ch];
+
+      px = pIn + ch;
+      py = pDst + ch;
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        Xn0 = *px;
+
+        acc0 = (b0 * Xn0) + d10;
+
+        *py = acc0;
+
+        d10 = ((b1 * Xn0) + (a1 * acc0)) + d20;
+        d20 = (b2 * Xn0) + (a2 * acc0);
+
+        px += numChannels;
+        py += numChannels;
+
+        /* Decrement loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[ch]               = d10;
+      pState[numChannels + ch] = d20;
+
+      ch++;
+    }
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* Next stage */
+    pCoeffs += 5U * numChannels;
+    pState += 2U * numChannels;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadBankDF2T group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_bank_df2T_init_f32.c
+ * Description:  Initialization function for the floating-point transposed direct form II Biquad filter bank
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadBankDF2T
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point transposed direct form II Biquad filter bank.
+  @param[in,out] S            points to an instance of the filter bank data structure.
+  @param[in]     numChannels  number of channels of the bank.
+  @param[in]     numStages    number of 2nd order stages of each channel.
+  @param[in]     pCoeffs      points to the transposed filter coefficients.
+  @param[in]     pState       points to the state buffer.
+  @return        none
+
+  @par           Coefficient and State Ordering
+                   The coefficient <code>k</code> (b0, b1, b2, a1, a2) of stage <code>s</code> of channel
+                   <code>c</code> is stored at <code>pCoeffs[(5*s + k)*numChannels + c]</code>.
+                   The <code>pCoeffs</code> array contains a total of <code>5*numStages*numChannels</code> values.
+                   It can be built with ::arm_biquad_bank_df2T_compute_coefs_f32.
+  @par
+                   The state variables <code>d1</code> of stage 1 of all the channels are first, then the state
+                   variables <code>d2</code> of stage 1, then the state variables of stage 2, and so on.
+                   The state array has a total length of <code>2*numStages*numChannels</code> values.
+ */
+
+void arm_biquad_bank_df2T_init_f32(
+        arm_biquad_bank_df2T_instance_f32 * S,
+        uint16_t numChannels,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pState)
+{
+  /* Assign number of channels and filter stages */
+  S->numChannels = numChannels;
+  S->numStages = numStages;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2U * (uint32_t) numStages * (uint32_t) numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @brief         Transposes the coefficients of several Biquad cascades for a filter bank.
+  @param[in]     numChannels  number of channels of the bank.
+  @param[in]     numStages    number of 2nd order stages of each channel.
+  @param[in]     pSrc         points to the coefficients of the channels.
+  @param[out]    pDst         points to the transposed coefficients.
+  @return        none
+
+  @par           Description
+                   <code>pSrc</code> contains the coefficients of channel 0, followed by the coefficients
+                   of channel 1 and so on. The coefficients of a channel are in the
+                   ::arm_biquad_cascade_df2T_init_f32 order :
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+                   <code>pDst</code> is the <code>pCoeffs</code> array of ::arm_biquad_bank_df2T_init_f32.
+                   Both arrays contain <code>5*numStages*numChannels</code> values.
+ */
+
+void arm_biquad_bank_df2T_compute_coefs_f32(
+        uint16_t numChannels,
+        uint8_t numStages,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+  uint32_t ch, k;                                /* Loop counters */
+  uint32_t nbCoefs = 5U * (uint32_t) numStages;  /* Number of coefficients of a channel */
+
+  for (ch = 0U; ch < numChannels; ch++)
+  {
+    for (k = 0U; k < nbCoefs; k++)
+    {
+      pDst[(k * numChannels) + ch] = *pSrc++;
+    }
+  }
+}
+
+/**
+  @} end of BiquadBankDF2T group
+ */
@@ -37,6 +37,76 @@
   @{
  */
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/* Number of stages computed in parallel, one per 32-bit lane of a 128-bit vector (SSE2 and AVX2 builds) */
+#define ARM_BIQUAD_DF1_Q15_X86_STAGES 4U
+
+/* Below this number of stages, the scalar recursion is faster than the vector one */
+#define ARM_BIQUAD_DF1_Q15_X86_MIN_STAGES 3U
+
+/*
+ * One step of a group of stages : lane s computes the output of stage s for the sample t - s.
+ * in holds the input of the first stage in lane 0 (and 0 in the other lanes).
+ * The state variables (sign extended to 32 bits) of the lanes not set in mask are not updated.
+ * The 5 products are accumulated exactly as acc = hi * 2^16 + lo with 0 <= lo < 2^16, which gives
+ * (acc >> shift) = hi * 2^(16 - shift) + (lo >> shift). hi is saturated to 16 bits before the shift :
+ * the final result is saturated anyway when hi is out of this range.
+ */
+__STATIC_FORCEINLINE __m128i arm_biquad_df1_step_q15(
+  __m128i * x1,
+  __m128i * x2,
+  __m128i * y1,
+  __m128i * y2,
+  __m128i b0b1,
+  __m128i b2a1,
+  __m128i a2,
+  __m128i in,
+  __m128i mask,
+  __m128i lShift,
+  __m128i rShift)
+{
+  const __m128i low = _mm_set1_epi32(0xFFFF);
+  const __m128i minV = _mm_set1_epi32(INT32_MIN);
+  __m128i x, s0, s1, s2, hi, lo, y;
+
+  /* x[n] is the input sample for the first stage and the previous output of the previous stage otherwise */
+  x = _mm_or_si128(_mm_slli_si128(*y1, 4), in);
+
+  /* s0 = b0 * x[n] + b1 * x[n-1], s1 = b2 * x[n-2] + a1 * y[n-1], s2 = a2 * y[n-2] */
+  s0 = _mm_madd_epi16(_mm_or_si128(_mm_and_si128(x, low), _mm_slli_epi32(*x1, 16)), b0b1);
+  s1 = _mm_madd_epi16(_mm_or_si128(_mm_and_si128(*x2, low), _mm_slli_epi32(*y1, 16)), b2a1);
+  s2 = _mm_madd_epi16(_mm_and_si128(*y2, low), a2);
+
+  hi = _mm_add_epi32(_mm_add_epi32(_mm_srai_epi32(s0, 16), _mm_srai_epi32(s1, 16)), _mm_srai_epi32(s2, 16));
+  lo = _mm_add_epi32(_mm_add_epi32(_mm_and_si128(s0, low), _mm_and_si128(s1, low)), _mm_and_si128(s2, low));
+
+  /* A pair sum wrapped to 0x80000000 is 2^31 : its high part is 2^15 and not -2^15 */
+  hi = _mm_sub_epi32(hi, _mm_slli_epi32(_mm_add_epi32(_mm_cmpeq_epi32(s0, minV), _mm_cmpeq_epi32(s1, minV)), 16));
+
+  /* Propagate the carry of the low parts */
+  hi = _mm_add_epi32(hi, _mm_srli_epi32(lo, 16));
+  lo = _mm_and_si128(lo, low);
+
+  hi = _mm_packs_epi32(hi, hi);
+  hi = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16);
+
+  /* The result is converted to 1.15 with saturation */
+  y = _mm_add_epi32(_mm_sll_epi32(hi, lShift), _mm_srl_epi32(lo, rShift));
+  y = _mm_packs_epi32(y, y);
+  y = _mm_srai_epi32(_mm_unpacklo_epi16(y, y), 16);
+
+  /* Update the state of the active stages */
+  *x2 = _mm_or_si128(_mm_and_si128(mask, *x1), _mm_andnot_si128(mask, *x2));
+  *x1 = _mm_or_si128(_mm_and_si128(mask, x), _mm_andnot_si128(mask, *x1));
+  *y2 = _mm_or_si128(_mm_and_si128(mask, *y1), _mm_andnot_si128(mask, *y2));
+  *y1 = _mm_or_si128(_mm_and_si128(mask, y), _mm_andnot_si128(mask, *y1));
+
+  return (y);
+}
+
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
 /**
   @brief         Processing function for the Q15 Biquad cascade filter.
   @param[in]     S         points to an instance of the Q15 Biquad cascade structure
@@ -56,6 +126,185 @@
                    Refer to \ref arm_biquad_cascade_df1_fast_q15() for a faster but less precise implementation of this filter.
  */
 
+#if defined(ARM_MATH_X86_SIMD)
+void arm_biquad_cascade_df1_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pIn = pSrc;                             /* Source pointer */
+        q15_t *pOut = pDst;                            /* Destination pointer */
+        q15_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+        q15_t Xn1, Xn2, Yn1, Yn2;                      /* Filter state variables */
+        q15_t Xn;                                      /* temporary input */
+        q63_t acc;                                     /* Accumulator */
+        int32_t shift = (15 - (int32_t) S->postShift); /* Post shift */
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        uint32_t sample, stage = (uint32_t) S->numStages;     /* Stage loop counter */
+        uint32_t numLanes, i, t;                       /* Number of stages of the group and loop counters */
+        q31_t coeffs[3][ARM_BIQUAD_DF1_Q15_X86_STAGES];   /* Coefficients of the group of stages */
+        q31_t state[4][ARM_BIQUAD_DF1_Q15_X86_STAGES];    /* State variables of the group of stages */
+        q31_t out[ARM_BIQUAD_DF1_Q15_X86_STAGES];         /* Outputs of the stages */
+        __m128i x1, x2, y1, y2, b0b1, b2a1, va2, in, y, mask, lShift, rShift, lane, numSamples;
+
+  lShift = _mm_cvtsi32_si128(16 - shift);
+  rShift = _mm_cvtsi32_si128(shift);
+  lane = _mm_setr_epi32(0, 1, 2, 3);
+  numSamples = _mm_set1_epi32((int32_t) blockSize);
+
+  /* The recursion of a stage cannot be vectorized, so the stages are pipelined instead:
+     at step t, the lane s of a group computes the sample t - s of its stage */
+  while (stage >= ARM_BIQUAD_DF1_Q15_X86_MIN_STAGES)
+  {
+    numLanes = (stage < ARM_BIQUAD_DF1_Q15_X86_STAGES) ? stage : ARM_BIQUAD_DF1_Q15_X86_STAGES;
+
+    /* Read the coefficients and the state variables of the stages. The unused lanes are cleared. */
+    memset(coeffs, 0, sizeof(coeffs));
+    memset(state, 0, sizeof(state));
+
+    for (i = 0U; i < numLanes; i++)
+    {
+      /* b0 and b1, b2 and a1, a2 and 0 are packed in 32 bits */
+      coeffs[0][i] = (q31_t) (((uint32_t) (uint16_t) pCoeffs[0]) | ((uint32_t) pCoeffs[2] << 16));
+      coeffs[1][i] = (q31_t) (((uint32_t) (uint16_t) pCoeffs[3]) | ((uint32_t) pCoeffs[4] << 16));
+      coeffs[2][i] = (q31_t) ((uint32_t) (uint16_t) pCoeffs[5]);
+      pCoeffs += 6U;
+
+      state[0][i] = pState[4U * i];
+      state[1][i] = pState[4U * i + 1U];
+      state[2][i] = pState[4U * i + 2U];
+      state[3][i] = pState[4U * i + 3U];
+    }
+
+    b0b1 = _mm_loadu_si128((const __m128i *) coeffs[0]);
+    b2a1 = _mm_loadu_si128((const __m128i *) coeffs[1]);
+    va2 = _mm_loadu_si128((const __m128i *) coeffs[2]);
+    x1 = _mm_loadu_si128((const __m128i *) state[0]);
+    x2 = _mm_loadu_si128((const __m128i *) state[1]);
+    y1 = _mm_loadu_si128((const __m128i *) state[2]);
+    y2 = _mm_loadu_si128((const __m128i *) state[3]);
+
+    /* Start of the pipeline : the lane s is active when t >= s */
+    for (t = 0U; t < (numLanes - 1U); t++)
+    {
+      in = _mm_cvtsi32_si128((t < blockSize) ? pIn[t] : 0);
+
+      mask = _mm_set1_epi32((int32_t) t);
+      mask = _mm_andnot_si128(_mm_cmpgt_epi32(lane, mask), _mm_cmpgt_epi32(numSamples, _mm_sub_epi32(mask, lane)));
+
+      (void) arm_biquad_df1_step_q15(&x1, &x2, &y1, &y2, b0b1, b2a1, va2, in, mask, lShift, rShift);
+    }
+
+    /* All the stages are active. The last stage of the group computes the sample t - (numLanes - 1) */
+    for (; t < blockSize; t++)
+    {
+      in = _mm_cvtsi32_si128(pIn[t]);
+
+      y = arm_biquad_df1_step_q15(&x1, &x2, &y1, &y2, b0b1, b2a1, va2, in, _mm_set1_epi32(-1), lShift, rShift);
+
+      _mm_storeu_si128((__m128i *) out, y);
+      pOut[t - (numLanes - 1U)] = (q15_t) out[numLanes - 1U];
+    }
+
+    /* End of the pipeline : the lane s is active when t - s < blockSize */
+    for (; t < (blockSize + numLanes - 1U); t++)
+    {
+      in = _mm_setzero_si128();
+
+      mask = _mm_set1_epi32((int32_t) t);
+      mask = _mm_andnot_si128(_mm_cmpgt_epi32(lane, mask), _mm_cmpgt_epi32(numSamples, _mm_sub_epi32(mask, lane)));
+
+      y = arm_biquad_df1_step_q15(&x1, &x2, &y1, &y2, b0b1, b2a1, va2, in, mask, lShift, rShift);
+
+      _mm_storeu_si128((__m128i *) out, y);
+      pOut[t - (numLanes - 1U)] = (q15_t) out[numLanes - 1U];
+    }
+
+    /* Store the updated state variables back into the pState array */
+    _mm_storeu_si128((__m128i *) state[0], x1);
+    _mm_storeu_si128((__m128i *) state[1], x2);
+    _mm_storeu_si128((__m128i *) state[2], y1);
+    _mm_storeu_si128((__m128i *) state[3], y2);
+
+    for (i = 0U; i < numLanes; i++)
+    {
+      *pState++ = (q15_t) state[0][i];
+      *pState++ = (q15_t) state[1][i];
+      *pState++ = (q15_t) state[2][i];
+      *pState++ = (q15_t) state[3][i];
+    }
+
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    stage -= numLanes;
+  }
+
+  /* Remaining stages */
+  while (stage > 0U)
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    pCoeffs++;  // skip the 0 coefficient
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q31_t) b0 * Xn;
+      acc += (q31_t) b1 * Xn1;
+      acc += (q31_t) b2 * Xn2;
+      acc += (q31_t) a1 * Yn1;
+      acc += (q31_t) a2 * Yn2;
+
+      /* The result is converted to 1.15 with saturation */
+      acc = __SSAT((acc >> shift), 16);
+
+      /* Update the state variables */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = (q15_t) acc;
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = (q15_t) acc;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+    pOut = pDst;
+
+    /* Store the updated state variables back into the pState array */
+    *pState++ = Xn1;
+    *pState++ = Xn2;
+    *pState++ = Yn1;
+    *pState++ = Yn2;
+
+    stage--;
+  }
+
+}
+
+#else
 void arm_biquad_cascade_df1_q15(
   const arm_biquad_casd_df1_inst_q15 * S,
   const q15_t * pSrc,
@@ -357,6 +606,7 @@ void arm_biquad_cascade_df1_q15(
 #endif /* #if defined (ARM_MATH_DSP) */
 
 }
+#endif /* defined(ARM_MATH_X86_SIMD) */
 
 /**
   @} end of BiquadCascadeDF1 group
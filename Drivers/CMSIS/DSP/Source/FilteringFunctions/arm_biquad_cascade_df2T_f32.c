@@ -214,6 +214,172 @@ void arm_biquad_cascade_df2T_f32(
       stageCnt--;
    }
 }
+#elif defined(ARM_MATH_X86_SIMD)
+
+void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+   const float32_t *pIn = pSrc;                   /*  source pointer            */
+   float32_t *pOut = pDst;                        /*  destination pointer       */
+   float32_t *pState = S->pState;                 /*  State pointer             */
+   const float32_t *pCoeffs = S->pCoeffs;         /*  coefficient pointer       */
+   float32_t acc1;                                /*  accumulator               */
+   float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+   float32_t Xn1;                                 /*  temporary input           */
+   float32_t d1, d2;                              /*  state variables           */
+   uint32_t sample, stageCnt,stage = S->numStages;         /*   loop counters   */
+
+   __m128 XnV, YnV, d1V, d2V, s;
+   __m128 t1, t2, t3, t4, b1V, b2V, a1V, a2V;
+   __m128 st0, st1;
+
+   /* The coefficients are using the layout generated by arm_biquad_cascade_df2T_compute_coefs_f32 :
+      4 stages are computed in the 4 lanes of a SSE vector (also when AVX2 is enabled). */
+   stageCnt = stage >> 2;
+
+   while (stageCnt > 0U)
+   {
+      /* Reading the coefficients */
+      t1 = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      t2 = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      t3 = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      t4 = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      b1V = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      b2V = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      a1V = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      a2V = _mm_loadu_ps(pCoeffs);
+      pCoeffs += 4;
+
+      /* Reading the state values : d1 of the 4 stages in d1V and d2 of the 4 stages in d2V */
+      st0 = _mm_loadu_ps(pState);
+      st1 = _mm_loadu_ps(pState + 4);
+      d1V = _mm_shuffle_ps(st0, st1, _MM_SHUFFLE(2, 0, 2, 0));
+      d2V = _mm_shuffle_ps(st0, st1, _MM_SHUFFLE(3, 1, 3, 1));
+
+      sample = blockSize;
+
+      while (sample > 0U) {
+         /* y[n] = b0 * x[n] + d1 */
+         /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+         /* d2 = b2 * x[n] + a2 * y[n] */
+
+         XnV = _mm_set1_ps(*pIn++);
+
+         YnV = d1V;
+
+         /* Lane k of s is d1 of the stage (k - 1), (k - 2), (k - 3) and 0 for the first lanes */
+         s = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(d1V), 4));
+         YnV = _mm_add_ps(YnV, _mm_mul_ps(t1, s));
+
+         s = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(d1V), 8));
+         YnV = _mm_add_ps(YnV, _mm_mul_ps(t2, s));
+
+         s = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(d1V), 12));
+         YnV = _mm_add_ps(YnV, _mm_mul_ps(t3, s));
+
+         YnV = _mm_add_ps(YnV, _mm_mul_ps(t4, XnV));
+
+         /* Input of each stage : x[n] for the first one and the output of the previous stage for the others */
+         s = _mm_move_ss(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(YnV), 4)), XnV);
+
+         d1V = _mm_add_ps(d2V, _mm_mul_ps(s, b1V));
+         d1V = _mm_add_ps(d1V, _mm_mul_ps(YnV, a1V));
+
+         d2V = _mm_mul_ps(s, b2V);
+         d2V = _mm_add_ps(d2V, _mm_mul_ps(YnV, a2V));
+
+         *pOut++ = _mm_cvtss_f32(_mm_shuffle_ps(YnV, YnV, _MM_SHUFFLE(3, 3, 3, 3)));
+
+         sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      _mm_storeu_ps(pState, _mm_unpacklo_ps(d1V, d2V));
+      _mm_storeu_ps(pState + 4, _mm_unpackhi_ps(d1V, d2V));
+      pState += 8;
+
+      /* The current stage input is given as the output to the next stage */
+      pIn = pDst;
+
+      /*Reset the output working pointer */
+      pOut = pDst;
+
+      /* decrement the loop counter */
+      stageCnt--;
+
+   }
+
+   /* Tail */
+   stageCnt = stage & 3;
+
+   while (stageCnt > 0U)
+   {
+      /* Reading the coefficients */
+      b0 = *pCoeffs++;
+      b1 = *pCoeffs++;
+      b2 = *pCoeffs++;
+      a1 = *pCoeffs++;
+      a2 = *pCoeffs++;
+
+      /*Reading the state values */
+      d1 = pState[0];
+      d2 = pState[1];
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+         /* Read the input */
+         Xn1 = *pIn++;
+
+         /* y[n] = b0 * x[n] + d1 */
+         acc1 = (b0 * Xn1) + d1;
+
+         /* Store the result in the accumulator in the destination buffer. */
+         *pOut++ = acc1;
+
+         /* Every time after the output is computed state should be updated. */
+         /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+         d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+         /* d2 = b2 * x[n] + a2 * y[n] */
+         d2 = (b2 * Xn1) + (a2 * acc1);
+
+         /* decrement the loop counter */
+         sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      *pState++ = d1;
+      *pState++ = d2;
+
+      /* The current stage input is given as the output to the next stage */
+      pIn = pDst;
+
+      /*Reset the output working pointer */
+      pOut = pDst;
+
+      /* decrement the loop counter */
+      stageCnt--;
+   }
+}
 #else
 LOW_OPTIMIZATION_ENTER
 void arm_biquad_cascade_df2T_f32(
@@ -57,7 +57,7 @@
                    <code>b2x</code> and <code>a2x</code> are the coefficients for the second stage,
                    and so on.  The <code>pCoeffs</code> array contains a total of <code>5*numStages</code> values.
 
-                   For Neon version, this array is bigger. If numstages = 4x + y, then the array has size:
+                   For Neon version (and for the ARM_MATH_X86_SIMD version), this array is bigger. If numstages = 4x + y, then the array has size:
                    32*x + 5*y
                    and it must be initialized using the function
                    arm_biquad_cascade_df2T_compute_coefs_f32 which is taking the
@@ -87,7 +87,7 @@
                    The state variables are updated after each block of data is processed; the coefficients are untouched.
  */
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD)
 /*
 
 Must be called after initializing the biquad instance.
@@ -107,7 +107,8 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
    float32_t *pDstCoeffs;
    float32_t b0[4],b1[4],b2[4],a1[4],a2[4];
 
-   pDstCoeffs = S->pCoeffs;
+   /* The instance only reads its coefficients, but this array was given to the init as writable storage */
+   pDstCoeffs = (float32_t *) S->pCoeffs;
 
    cnt = numStages >> 2; 
    while(cnt > 0)
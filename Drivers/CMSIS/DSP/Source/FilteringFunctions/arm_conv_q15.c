@@ -37,6 +37,41 @@
   @{
  */
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/* y[jStart] * x[n - jStart] + ... + y[jStart + count - 1] * x[n - jStart - count + 1]
+   where pX points to x[n - jStart] and pY to y[jStart] */
+__STATIC_FORCEINLINE q63_t arm_conv_mac_q15(
+  const q15_t * pX,
+  const q15_t * pY,
+        uint32_t count)
+{
+  arm_x86_q63v_t accV = __arm_vec_zero_q63_x86();
+  q63_t sum;
+
+  while (count >= ARM_X86_LANES_Q15)
+  {
+    accV = __arm_vec_mlald_rev_q15_x86(accV, pX - (ARM_X86_LANES_Q15 - 1U), pY);
+
+    pX -= ARM_X86_LANES_Q15;
+    pY += ARM_X86_LANES_Q15;
+    count -= ARM_X86_LANES_Q15;
+  }
+
+  sum = __arm_vec_hsum_q63_x86(accV);
+
+  while (count > 0U)
+  {
+    sum += (q31_t) *pX-- * *pY++;
+
+    count--;
+  }
+
+  return (sum);
+}
+
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
 /**
   @brief         Convolution of Q15 sequences.
   @param[in]     pSrcA      points to the first input sequence
@@ -59,6 +94,129 @@
                    Refer to \ref arm_conv_opt_q15() for a faster implementation of this function using scratch buffers.
  */
 
+#if defined(ARM_MATH_X86_SIMD)
+void arm_conv_q15(
+  const q15_t * pSrcA,
+        uint32_t srcALen,
+  const q15_t * pSrcB,
+        uint32_t srcBLen,
+        q15_t * pDst)
+{
+  const q15_t *pIn1;                                   /* InputA pointer */
+  const q15_t *pIn2;                                   /* InputB pointer */
+  const q15_t *px;                                     /* Intermediate inputA pointer */
+  const q15_t *py;                                     /* Intermediate inputB pointer */
+        q15_t *pOut = pDst;                            /* Output pointer */
+        q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+        arm_x86_q63v_t accV0, accV1, accV2, accV3;     /* Vector accumulators */
+        uint32_t i, j, k, blkCnt;                      /* Loop counters */
+
+  /* srcB is always made to slide across srcA. */
+  /* So srcBLen is always considered as shorter or equal to srcALen */
+  if (srcALen >= srcBLen)
+  {
+    pIn1 = pSrcA;
+    pIn2 = pSrcB;
+  }
+  else
+  {
+    pIn1 = pSrcB;
+    pIn2 = pSrcA;
+
+    j = srcBLen;
+    srcBLen = srcALen;
+    srcALen = j;
+  }
+
+  /* conv(x,y) at n = x[n] * y[0] + x[n-1] * y[1] + x[n-2] * y[2] + ...+ x[n-N+1] * y[N -1]
+   * The products are accumulated in 64-bit lanes, ARM_X86_LANES_Q15 at a time, with y read backward.
+   * The additions are exact, so the results are bit exact with the scalar version.
+   */
+
+  /* Stage 1 : the number of MACs is increasing from 1 to srcBLen - 1 */
+  for (i = 0U; i < (srcBLen - 1U); i++)
+  {
+    acc0 = arm_conv_mac_q15(pIn1 + i, pIn2, i + 1U);
+
+    *pOut++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+  }
+
+  /* Stage 2 : srcBLen MACs for each output. 4 outputs are computed at a time. */
+  blkCnt = (srcALen - srcBLen + 1U) >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    accV0 = __arm_vec_zero_q63_x86();
+    accV1 = __arm_vec_zero_q63_x86();
+    accV2 = __arm_vec_zero_q63_x86();
+    accV3 = __arm_vec_zero_q63_x86();
+
+    /* px points to x[i - ARM_X86_LANES_Q15 + 1] */
+    px = pIn1 + i - (ARM_X86_LANES_Q15 - 1U);
+    py = pIn2;
+
+    k = srcBLen / ARM_X86_LANES_Q15;
+
+    while (k > 0U)
+    {
+      accV0 = __arm_vec_mlald_rev_q15_x86(accV0, px, py);
+      accV1 = __arm_vec_mlald_rev_q15_x86(accV1, px + 1, py);
+      accV2 = __arm_vec_mlald_rev_q15_x86(accV2, px + 2, py);
+      accV3 = __arm_vec_mlald_rev_q15_x86(accV3, px + 3, py);
+
+      px -= ARM_X86_LANES_Q15;
+      py += ARM_X86_LANES_Q15;
+
+      k--;
+    }
+
+    acc0 = __arm_vec_hsum_q63_x86(accV0);
+    acc1 = __arm_vec_hsum_q63_x86(accV1);
+    acc2 = __arm_vec_hsum_q63_x86(accV2);
+    acc3 = __arm_vec_hsum_q63_x86(accV3);
+
+    /* px points to the x value used with the first remaining y value */
+    px += (ARM_X86_LANES_Q15 - 1U);
+
+    k = srcBLen % ARM_X86_LANES_Q15;
+
+    while (k > 0U)
+    {
+      acc0 += (q31_t) px[0] * *py;
+      acc1 += (q31_t) px[1] * *py;
+      acc2 += (q31_t) px[2] * *py;
+      acc3 += (q31_t) px[3] * *py;
+
+      px--;
+      py++;
+
+      k--;
+    }
+
+    *pOut++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    *pOut++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+    *pOut++ = (q15_t) (__SSAT((acc2 >> 15), 16));
+    *pOut++ = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+    i += 4U;
+
+    blkCnt--;
+  }
+
+  /* Stage 2 remaining outputs and stage 3 : the number of MACs is decreasing from srcBLen to 1 */
+  for (; i < (srcALen + srcBLen - 1U); i++)
+  {
+    /* First y index overlapping x */
+    j = (i < srcALen) ? 0U : (i - srcALen + 1U);
+
+    acc0 = arm_conv_mac_q15(pIn1 + i - j, pIn2 + j, srcBLen - j);
+
+    *pOut++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+  }
+
+}
+
+#else
 void arm_conv_q15(
   const q15_t * pSrcA,
         uint32_t srcALen,
@@ -690,6 +848,7 @@ void arm_conv_q15(
 #endif /* #if defined (ARM_MATH_DSP) */
 
 }
+#endif /* defined(ARM_MATH_X86_SIMD) */
 
 /**
   @} end of Conv group
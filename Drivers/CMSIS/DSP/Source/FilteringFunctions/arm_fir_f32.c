@@ -337,6 +337,129 @@ uint32_t blockSize)
    }
 
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                           /* Temporary pointer for coefficient buffer */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+  arm_x86_f32v_t accV;                           /* Vector accumulator */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy ARM_X86_LANES_F32 new input samples into the state buffer */
+    __arm_vec_store_f32_x86(pStateCurnt, __arm_vec_load_f32_x86(pSrc));
+    pStateCurnt += ARM_X86_LANES_F32;
+    pSrc += ARM_X86_LANES_F32;
+
+    /* Set the accumulators to zero */
+    accV = __arm_vec_dup_f32_x86(0.0f);
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize coefficient pointer */
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    /* Each coefficient is multiplied with ARM_X86_LANES_F32 consecutive state samples,
+       so lane k of the accumulator computes the output k of the block. */
+    while (i > 0U)
+    {
+      /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
+      accV = __arm_vec_mla_f32_x86(accV, __arm_vec_dup_f32_x86(*pb++), __arm_vec_load_f32_x86(px++));
+
+      /* Decrement loop counter */
+      i--;
+    }
+
+    /* Store the results in the destination buffer. */
+    __arm_vec_store_f32_x86(pDst, accV);
+    pDst += ARM_X86_LANES_F32;
+
+    /* Advance the state pointer by ARM_X86_LANES_F32 to process the next group of samples */
+    pState = pState + ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0.0f;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    /* Perform the multiply-accumulates */
+    while (i > 0U)
+    {
+      /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
+      acc0 += *px++ * *pb++;
+
+      /* Decrement loop counter */
+      i--;
+    }
+
+    /* Store result in destination buffer. */
+    *pDst++ = acc0;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Copy remaining data */
+  tapCnt = numTaps - 1U;
+
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
+}
+
 #else
 void arm_fir_f32(
   const arm_fir_instance_f32 * S,
@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  FFT based FIR filter for long floating-point filters
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_FFT FFT based Finite Impulse Response (FIR) Filter
+
+  This function implements a long floating-point FIR filter with a uniformly partitioned
+  overlap-save algorithm. The cost of ::arm_fir_f32 is proportional to <code>numTaps</code>
+  per sample whereas the cost of this filter is proportional to <code>log2(partLen)</code> plus the number of partitions.
+  It is interesting for filters with several hundred taps (room correction, matched filters).
+
+  @par           Algorithm
+                   The impulse response is split into <code>numParts = ceil(numTaps / partLen)</code> partitions
+                   of <code>partLen</code> samples. The spectrum of each partition, zero padded to <code>2*partLen</code>,
+                   is computed once by the initialization function.
+  @par
+                   For each block of <code>partLen</code> input samples:
+                   - the last <code>2*partLen</code> input samples are transformed with ::arm_rfft_fast_f32 and the
+                     spectrum is stored in a frequency delay line containing the last <code>numParts</code> input spectra ;
+                   - the spectra of the delay line are multiplied with the spectra of the partitions
+                     (::arm_cmplx_mult_cmplx_f32) and accumulated ;
+                   - the inverse transform of the sum gives <code>partLen</code> valid output samples (the second half).
+  @par
+                   The output is the same as the output of ::arm_fir_f32 (up to rounding errors) : there is no
+                   additional latency but <code>blockSize</code> must be a multiple of <code>partLen</code>.
+                   Other block sizes are rejected with ARM_MATH_ARGUMENT_ERROR, without any output.
+                   The choice of <code>partLen</code> is a trade off between the block size and the computation cost.
+                   A value around <code>numTaps / 4</code> is a good starting point.
+
+  @par           Instance Structure
+                   The state, the spectra of the partitions and the real FFT instance are stored in an instance data structure.
+                   A separate instance structure must be defined for each filter.
+                   The spectra of the partitions may be shared among several instances with the same coefficients and partition length.
+
+  @par           Initialization Functions
+                   The initialization function ::arm_fir_fft_init_f32 is computing the spectra of the partitions,
+                   initializes the real FFT and zeros out the values in the state buffer.
+                   The tables of the real FFT of length <code>2*partLen</code> must be included in the build.
+  @par
+                   <code>pCoeffs</code> is stored in time reversed order as for ::arm_fir_f32.
+                   <code>pCoeffsFft</code> is of length <code>2*partLen*numParts</code> and <code>pState</code>
+                   is of length <code>2*partLen*(numParts+3)</code>.
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point FFT based FIR filter.
+  @param[in]     S          points to an instance of the floating-point FFT based FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process. Must be a multiple of <code>partLen</code>.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>blockSize</code> is not a multiple of <code>partLen</code>.
+                                                    Neither <code>pDst</code> nor the state are modified.
+ */
+arm_status arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t partLen = S->partLen;                 /* Length of a partition */
+        uint32_t fftLen = 2U * partLen;                /* Length of the real FFT */
+        uint32_t numParts = S->numParts;               /* Number of partitions */
+        uint32_t partIdx = S->partIdx;                 /* Position of the most recent spectrum */
+        float32_t *pTime = S->pState;                  /* Last fftLen input samples */
+        float32_t *pFdl = pTime + fftLen;              /* Frequency delay line */
+        float32_t *pAcc = pFdl + (numParts * fftLen);  /* Accumulated spectrum */
+        float32_t *pWork = pAcc + fftLen;              /* Working buffer */
+  const float32_t *pX;                                 /* Spectrum of the delay line */
+  const float32_t *pH;                                 /* Spectrum of a partition */
+        uint32_t blkCnt, part, idx;                    /* Loop counters */
+
+  /* The overlap-save only computes whole partitions */
+  if ((blockSize % partLen) != 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  blkCnt = blockSize / partLen;
+
+  while (blkCnt > 0U)
+  {
+    /* Append the new input samples after the partLen previous ones */
+    arm_copy_f32(pSrc, pTime + partLen, partLen);
+
+    /* Spectrum of the last fftLen samples.
+       The real FFT is using its input as a working buffer so pTime is copied first. */
+    arm_copy_f32(pTime, pWork, fftLen);
+    arm_rfft_fast_f32(&S->rfft, pWork, pFdl + (partIdx * fftLen), 0);
+
+    /* Multiply each spectrum of the delay line with the spectrum of the matching partition and accumulate */
+    idx = partIdx;
+    pH = S->pCoeffs;
+
+    for (part = 0U; part < numParts; part++)
+    {
+      pX = pFdl + (idx * fftLen);
+
+      /* The first complex value of the packed real spectrum contains the real DC and Nyquist bins */
+      pWork[0] = pX[0] * pH[0];
+      pWork[1] = pX[1] * pH[1];
+      arm_cmplx_mult_cmplx_f32(pX + 2, pH + 2, pWork + 2, partLen - 1U);
+
+      if (part == 0U)
+      {
+        arm_copy_f32(pWork, pAcc, fftLen);
+      }
+      else
+      {
+        arm_add_f32(pAcc, pWork, pAcc, fftLen);
+      }
+
+      /* The older spectrum is at the previous position of the circular delay line */
+      idx = (idx == 0U) ? (numParts - 1U) : (idx - 1U);
+      pH += fftLen;
+    }
+
+    /* Back to the time domain. The first half is aliased and discarded. */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pWork, 1);
+    arm_copy_f32(pWork + partLen, pDst, partLen);
+
+    /* Keep the last partLen input samples for the next block */
+    arm_copy_f32(pTime + partLen, pTime, partLen);
+
+    /* Advance the circular delay line */
+    partIdx++;
+    if (partIdx == numParts)
+    {
+      partIdx = 0U;
+    }
+
+    pSrc += partLen;
+    pDst += partLen;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  S->partIdx = (uint16_t) partIdx;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of FIR_FFT group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Initialization function for the FFT based floating-point FIR filter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point FFT based FIR filter.
+  @param[in,out] S          points to an instance of the floating-point FFT based FIR structure
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficients buffer
+  @param[out]    pCoeffsFft points to the buffer for the spectra of the partitions
+  @param[in]     pState     points to the state buffer
+  @param[in]     partLen    length of a partition. The real FFT of length <code>2*partLen</code> must be supported by ::arm_rfft_fast_init_f32.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>partLen</code> is not a supported length
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pCoeffsFft</code> is of length <code>2*partLen*numParts</code> and
+                   <code>pState</code> is of length <code>2*partLen*(numParts+3)</code>
+                   where <code>numParts = ceil(numTaps / partLen)</code>.
+ */
+arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffsFft,
+        float32_t * pState,
+        uint16_t partLen)
+{
+        uint32_t fftLen = 2U * (uint32_t) partLen;     /* Length of the real FFT */
+        uint32_t numParts;                             /* Number of partitions */
+        uint32_t part, i, k;                           /* Loop counters */
+        float32_t *pWork;                              /* Working buffer */
+        arm_status status;
+
+  if ((partLen == 0U) || (fftLen > 4096U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  numParts = ((uint32_t) numTaps + partLen - 1U) / partLen;
+
+  S->numTaps = numTaps;
+  S->partLen = partLen;
+  S->numParts = (uint16_t) numParts;
+  S->partIdx = 0U;
+
+  /* The end of the state buffer is used as a working buffer */
+  pWork = pState + ((numParts + 2U) * fftLen);
+
+  for (part = 0U; part < numParts; part++)
+  {
+    /* Impulse response of the partition, b[part*partLen] to b[part*partLen + partLen - 1], zero padded to fftLen */
+    for (i = 0U; i < partLen; i++)
+    {
+      k = (part * partLen) + i;
+      pWork[i] = (k < numTaps) ? pCoeffs[numTaps - 1U - k] : 0.0f;
+    }
+
+    arm_fill_f32(0.0f, pWork + partLen, partLen);
+
+    arm_rfft_fast_f32(&S->rfft, pWork, pCoeffsFft + (part * fftLen), 0);
+  }
+
+  S->pCoeffs = pCoeffsFft;
+
+  /* Clear state buffer */
+  memset(pState, 0, (numParts + 3U) * fftLen * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of FIR_FFT group
+ */
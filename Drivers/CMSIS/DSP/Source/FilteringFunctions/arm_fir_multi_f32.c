@@ -0,0 +1,432 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_f32.c
+ * Description:  Floating-point multi-channel FIR filter processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Multi Multi-channel Finite Impulse Response (FIR) Filters
+
+  This set of functions implements Finite Impulse Response (FIR) filters applied
+  with the same coefficients to several channels (microphone arrays, multi-channel audio).
+  The channels are processed in one pass : each coefficient is loaded once and is applied
+  to a group of channels, instead of being streamed once per channel with separate
+  ::arm_fir_f32 calls.
+
+  @par           Channel Layout
+                   The input and output buffers contain <code>numChannels*blockSize</code> samples.
+                   When <code>planar</code> is 0, the channels are interleaved :
+  <pre>
+      {x0[0], x1[0], ..., xN-1[0], x0[1], x1[1], ...}
+  </pre>
+                   When <code>planar</code> is 1, the <code>blockSize</code> samples of channel 0 are followed by the
+                   samples of channel 1 and so on.
+
+  @par           State Layout
+                   Whatever the layout of the buffers, the state array is storing the samples of all the channels
+                   for a same time index contiguously. The state array has a size of
+                   <code>numChannels*(numTaps+blockSize-1)</code> samples.
+
+  @par           Instance Structure
+                   The coefficients and state variables for a filter are stored together in an instance data structure.
+                   A separate instance structure must be defined for each filter.
+                   Coefficient arrays may be shared among several instances.
+                   There are separate instance structure declarations for each of the supported data types.
+
+  @par           Initialization Functions
+                   There is also an associated initialization function for each data type.
+                   The coefficients are stored in time reversed order as for ::arm_fir_init_f32.
+                   The initialization function clears the state buffer.
+ */
+
+#if defined(ARM_MATH_X86_SIMD)
+/* Store the outputs of ARM_X86_LANES_F32 consecutive channels */
+__STATIC_FORCEINLINE void arm_fir_multi_store_f32(
+  float32_t * pOut,
+  arm_x86_f32v_t accV,
+  uint32_t channelStride)
+{
+  float32_t accLanes[ARM_X86_LANES_F32];
+  uint32_t lane;
+
+  if (channelStride == 1U)
+  {
+    __arm_vec_store_f32_x86(pOut, accV);
+  }
+  else
+  {
+    __arm_vec_store_f32_x86(accLanes, accV);
+
+    for (lane = 0U; lane < ARM_X86_LANES_F32; lane++)
+    {
+      *pOut = accLanes[lane];
+      pOut += channelStride;
+    }
+  }
+}
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
+/**
+  @addtogroup FIR_Multi
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point multi-channel FIR filter.
+  @param[in]     S          points to an instance of the floating-point multi-channel FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+ */
+void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t *pOut;                               /* Temporary pointer for output buffer */
+        float32_t acc0;                                /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t numChannels = S->numChannels;         /* Number of channels */
+        uint32_t sampleStride, channelStride;          /* Distance between two samples and two channels in pDst */
+        uint32_t i, ch, tapCnt, blkCnt;                /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t acc1, acc2, acc3;                    /* Accumulators */
+        float32_t acc4, acc5, acc6, acc7;              /* Accumulators */
+        float32_t c0;                                  /* Coefficient */
+#endif
+
+#if defined(ARM_MATH_X86_SIMD)
+        arm_x86_f32v_t acc0V, acc1V, acc2V, acc3V;     /* Vector accumulators */
+        arm_x86_f32v_t c0V;                            /* Broadcast coefficient */
+#endif
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples of each channel */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U) * numChannels]);
+
+  /* Copy the new input samples into the state buffer, one time index after the other */
+  if (S->planar == 0U)
+  {
+    blkCnt = blockSize * numChannels;
+
+    while (blkCnt > 0U)
+    {
+      *pStateCurnt++ = *pSrc++;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    sampleStride = numChannels;
+    channelStride = 1U;
+  }
+  else
+  {
+    for (i = 0U; i < blockSize; i++)
+    {
+      for (ch = 0U; ch < numChannels; ch++)
+      {
+        *pStateCurnt++ = pSrc[(ch * blockSize) + i];
+      }
+    }
+
+    sampleStride = 1U;
+    channelStride = blockSize;
+  }
+
+  /* The channels are processed by groups. Each coefficient is read once for the
+     channels of a group and for several consecutive outputs. */
+  ch = 0U;
+
+#if defined(ARM_MATH_X86_SIMD)
+
+  /* ARM_X86_LANES_F32 channels at a time */
+  while ((ch + ARM_X86_LANES_F32) <= numChannels)
+  {
+    /* Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+    i = 0U;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulators to zero */
+      acc0V = __arm_vec_dup_f32_x86(0.0f);
+      acc1V = __arm_vec_dup_f32_x86(0.0f);
+      acc2V = __arm_vec_dup_f32_x86(0.0f);
+      acc3V = __arm_vec_dup_f32_x86(0.0f);
+
+      /* Initialize state and coefficient pointers */
+      px = pState + (i * numChannels) + ch;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
+        c0V = __arm_vec_dup_f32_x86(*pb++);
+
+        acc0V = __arm_vec_mla_f32_x86(acc0V, c0V, __arm_vec_load_f32_x86(px));
+        acc1V = __arm_vec_mla_f32_x86(acc1V, c0V, __arm_vec_load_f32_x86(px + numChannels));
+        acc2V = __arm_vec_mla_f32_x86(acc2V, c0V, __arm_vec_load_f32_x86(px + (2U * numChannels)));
+        acc3V = __arm_vec_mla_f32_x86(acc3V, c0V, __arm_vec_load_f32_x86(px + (3U * numChannels)));
+
+        /* Next time index */
+        px += numChannels;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      /* Store the results in the destination buffer */
+      pOut = pDst + (i * sampleStride) + (ch * channelStride);
+
+      arm_fir_multi_store_f32(pOut, acc0V, channelStride);
+      arm_fir_multi_store_f32(pOut + sampleStride, acc1V, channelStride);
+      arm_fir_multi_store_f32(pOut + (2U * sampleStride), acc2V, channelStride);
+      arm_fir_multi_store_f32(pOut + (3U * sampleStride), acc3V, channelStride);
+
+      i += 4U;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Remaining outputs */
+    while (i < blockSize)
+    {
+      acc0V = __arm_vec_dup_f32_x86(0.0f);
+
+      px = pState + (i * numChannels) + ch;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        acc0V = __arm_vec_mla_f32_x86(acc0V, __arm_vec_dup_f32_x86(*pb++), __arm_vec_load_f32_x86(px));
+
+        /* Next time index */
+        px += numChannels;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      arm_fir_multi_store_f32(pDst + (i * sampleStride) + (ch * channelStride), acc0V, channelStride);
+
+      i++;
+    }
+
+    ch += ARM_X86_LANES_F32;
+  }
+
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* 4 channels at a time */
+  while ((ch + 4U) <= numChannels)
+  {
+    /* Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+    i = 0U;
+
+    while (blkCnt > 0U)
+    {
+      /* Set the accumulators to zero */
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+      acc4 = 0.0f;
+      acc5 = 0.0f;
+      acc6 = 0.0f;
+      acc7 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pState + (i * numChannels) + ch;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        /* Read the coefficient once for the 4 channels and the 2 outputs */
+        c0 = *pb++;
+
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+
+        acc4 += px[numChannels]      * c0;
+        acc5 += px[numChannels + 1U] * c0;
+        acc6 += px[numChannels + 2U] * c0;
+        acc7 += px[numChannels + 3U] * c0;
+
+        /* Next time index */
+        px += numChannels;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      /* Store the results in the destination buffer */
+      pOut = pDst + (i * sampleStride) + (ch * channelStride);
+
+      pOut[0]                 = acc0;
+      pOut[channelStride]     = acc1;
+      pOut[2U * channelStride] = acc2;
+      pOut[3U * channelStride] = acc3;
+
+      pOut += sampleStride;
+
+      pOut[0]                 = acc4;
+      pOut[channelStride]     = acc5;
+      pOut[2U * channelStride] = acc6;
+      pOut[3U * channelStride] = acc7;
+
+      i += 2U;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Remaining output */
+    if (i < blockSize)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      px = pState + (i * numChannels) + ch;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+
+        /* Next time index */
+        px += numChannels;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      pOut = pDst + (i * sampleStride) + (ch * channelStride);
+
+      pOut[0]                 = acc0;
+      pOut[channelStride]     = acc1;
+      pOut[2U * channelStride] = acc2;
+      pOut[3U * channelStride] = acc3;
+    }
+
+    ch += 4U;
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Remaining channels, one at a time */
+  while (ch < numChannels)
+  {
+    for (i = 0U; i < blockSize; i++)
+    {
+      /* Set the accumulator to zero */
+      acc0 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pState + (i * numChannels) + ch;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        acc0 += *px * *pb++;
+
+        /* Next time index */
+        px += numChannels;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      /* Store the result in the destination buffer */
+      pOut = pDst + (i * sampleStride) + (ch * channelStride);
+      *pOut = acc0;
+    }
+
+    ch++;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples of each channel to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the state of the first time index of the next call */
+  pState = pState + (blockSize * numChannels);
+
+  tapCnt = (numTaps - 1U) * numChannels;
+
+  /* Copy data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
+}
+
+/**
+  @} end of FIR_Multi group
+ */
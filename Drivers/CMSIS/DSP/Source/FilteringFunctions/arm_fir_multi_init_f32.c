@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_init_f32.c
+ * Description:  Floating-point multi-channel FIR filter initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Multi
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point multi-channel FIR filter.
+  @param[in,out] S            points to an instance of the floating-point multi-channel FIR structure
+  @param[in]     numChannels  number of channels
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pCoeffs      points to the filter coefficients buffer
+  @param[in]     pState       points to the state buffer
+  @param[in]     blockSize    number of samples per channel processed per call
+  @param[in]     planar       layout of the input and output buffers
+                   - value = 0: channels are interleaved
+                   - value = 1: channels are stored one after the other
+  @return        none
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to the array of state variables.
+                   <code>pState</code> is of length <code>numChannels*(numTaps+blockSize-1)</code> samples, where <code>blockSize</code> is the number of input samples per channel processed by each call to <code>arm_fir_multi_f32()</code>.
+ */
+
+void arm_fir_multi_init_f32(
+        arm_fir_multi_instance_f32 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize,
+        uint8_t planar)
+{
+  /* Assign number of channels */
+  S->numChannels = numChannels;
+
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign buffer layout */
+  S->planar = planar;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer. The size is always numChannels * (blockSize + numTaps - 1) */
+  memset(pState, 0, (uint32_t) numChannels * (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of FIR_Multi group
+ */
@@ -0,0 +1,226 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_q15.c
+ * Description:  Q15 multi-channel FIR filter processing function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Multi
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 multi-channel FIR filter.
+  @param[in]     S          points to an instance of the Q15 multi-channel FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+                   The results are bit exact with ::arm_fir_q15 applied to each channel.
+ */
+void arm_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  const q15_t *px;                                     /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q15_t *pOut;                                   /* Temporary pointer for output buffer */
+        q63_t acc0;                                    /* Accumulator */
+        q31_t c0;                                      /* Coefficient */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t numChannels = S->numChannels;         /* Number of channels */
+        uint32_t sampleStride, channelStride;          /* Distance between two samples and two channels in pDst */
+        uint32_t i, ch, tapCnt, blkCnt;                /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q63_t acc1, acc2, acc3;                        /* Accumulators */
+#endif
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples of each channel */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U) * numChannels]);
+
+  /* Copy the new input samples into the state buffer, one time index after the other */
+  if (S->planar == 0U)
+  {
+    blkCnt = blockSize * numChannels;
+
+    while (blkCnt > 0U)
+    {
+      *pStateCurnt++ = *pSrc++;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    sampleStride = numChannels;
+    channelStride = 1U;
+  }
+  else
+  {
+    for (i = 0U; i < blockSize; i++)
+    {
+      for (ch = 0U; ch < numChannels; ch++)
+      {
+        *pStateCurnt++ = pSrc[(ch * blockSize) + i];
+      }
+    }
+
+    sampleStride = 1U;
+    channelStride = blockSize;
+  }
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    ch = 0U;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Compute 4 channels at a time */
+    while ((ch + 4U) <= numChannels)
+    {
+      /* Set the accumulators to zero */
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      /* Initialize state and coefficient pointers */
+      px = pState + ch;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        /* Read the coefficient once for the 4 channels */
+        c0 = *pb++;
+
+        acc0 += (q31_t) px[0] * c0;
+        acc1 += (q31_t) px[1] * c0;
+        acc2 += (q31_t) px[2] * c0;
+        acc3 += (q31_t) px[3] * c0;
+
+        /* Next time index */
+        px += numChannels;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      /* The results are in 34.30 format. Convert to 1.15 with saturation */
+      pOut = pDst + (i * sampleStride) + (ch * channelStride);
+
+      *pOut = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pOut += channelStride;
+      *pOut = (q15_t) (__SSAT((acc1 >> 15), 16));
+      pOut += channelStride;
+      *pOut = (q15_t) (__SSAT((acc2 >> 15), 16));
+      pOut += channelStride;
+      *pOut = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+      ch += 4U;
+    }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    /* Remaining channels */
+    while (ch < numChannels)
+    {
+      /* Set the accumulator to zero */
+      acc0 = 0;
+
+      /* Initialize state and coefficient pointers */
+      px = pState + ch;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+
+        acc0 += (q31_t) *px * c0;
+
+        /* Next time index */
+        px += numChannels;
+
+        /* Decrement loop counter */
+        tapCnt--;
+      }
+
+      /* The result is in 34.30 format. Convert to 1.15 with saturation */
+      pOut = pDst + (i * sampleStride) + (ch * channelStride);
+      *pOut = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+      ch++;
+    }
+
+    /* Advance state pointer to the next time index */
+    pState = pState + numChannels;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples of each channel to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = (numTaps - 1U) * numChannels;
+
+  /* Copy data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
+}
+
+/**
+  @} end of FIR_Multi group
+ */
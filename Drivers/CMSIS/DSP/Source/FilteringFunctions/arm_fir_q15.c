@@ -57,6 +57,179 @@
                    Refer to \ref arm_fir_fast_q15() for a faster but less precise implementation of this function.
  */
 
+#if defined(ARM_MATH_X86_SIMD)
+void arm_fir_q15(
+  const arm_fir_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+        q15_t *px;                                     /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q15_t c0;                                      /* Temporary variable to hold coefficient value */
+        q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt, blkCnt;                       /* Loop counters */
+        arm_x86_q63v_t accV0, accV1, accV2, accV3;     /* Vector accumulators */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  /* Compute 4 output values at a time.
+   * The taps are computed ARM_X86_LANES_Q15 at a time and each output has its own vector of 64-bit accumulators.
+   * The additions are exact, so the results are bit exact with the scalar version.
+   */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy 4 new input samples into the state buffer. */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set all accumulators to zero */
+    accV0 = __arm_vec_zero_q63_x86();
+    accV1 = __arm_vec_zero_q63_x86();
+    accV2 = __arm_vec_zero_q63_x86();
+    accV3 = __arm_vec_zero_q63_x86();
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize coefficient pointer */
+    pb = pCoeffs;
+
+    tapCnt = numTaps / ARM_X86_LANES_Q15;
+
+    while (tapCnt > 0U)
+    {
+      /* acc0 +=  b[N] * x[n-N] + b[N-1] * x[n-N-1] + ... */
+      accV0 = __arm_vec_mlald_q15_x86(accV0, px, pb);
+      accV1 = __arm_vec_mlald_q15_x86(accV1, px + 1, pb);
+      accV2 = __arm_vec_mlald_q15_x86(accV2, px + 2, pb);
+      accV3 = __arm_vec_mlald_q15_x86(accV3, px + 3, pb);
+
+      px += ARM_X86_LANES_Q15;
+      pb += ARM_X86_LANES_Q15;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    acc0 = __arm_vec_hsum_q63_x86(accV0);
+    acc1 = __arm_vec_hsum_q63_x86(accV1);
+    acc2 = __arm_vec_hsum_q63_x86(accV2);
+    acc3 = __arm_vec_hsum_q63_x86(accV3);
+
+    /* Compute the remaining filter taps */
+    tapCnt = numTaps % ARM_X86_LANES_Q15;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+
+      acc0 += (q31_t) px[0] * c0;
+      acc1 += (q31_t) px[1] * c0;
+      acc2 += (q31_t) px[2] * c0;
+      acc3 += (q31_t) px[3] * c0;
+
+      px++;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* The results in the 4 accumulators are in 2.30 format. Convert to 1.15 with saturation.
+       Then store the 4 outputs in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc2 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+    /* Advance the state pointer by 4 to process the next group of 4 samples */
+    pState = pState + 4U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining output samples */
+  blkCnt = blockSize % 0x4U;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    accV0 = __arm_vec_zero_q63_x86();
+
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps / ARM_X86_LANES_Q15;
+
+    while (tapCnt > 0U)
+    {
+      accV0 = __arm_vec_mlald_q15_x86(accV0, px, pb);
+
+      px += ARM_X86_LANES_Q15;
+      pb += ARM_X86_LANES_Q15;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    acc0 = __arm_vec_hsum_q63_x86(accV0);
+
+    tapCnt = numTaps % ARM_X86_LANES_Q15;
+
+    while (tapCnt > 0U)
+    {
+      acc0 += (q31_t) *px++ * *pb++;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in 2.30 format. Convert to 1.15 with saturation.
+       Then store the output in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Copy remaining data */
+  tapCnt = numTaps - 1U;
+
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
+}
+
+#else
 void arm_fir_q15(
   const arm_fir_instance_q15 * S,
   const q15_t * pSrc,
@@ -326,6 +499,7 @@ void arm_fir_q15(
   }
 
 }
+#endif /* defined(ARM_MATH_X86_SIMD) */
 
 /**
   @} end of FIR group
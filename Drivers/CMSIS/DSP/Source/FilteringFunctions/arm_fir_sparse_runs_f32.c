@@ -0,0 +1,273 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_sparse_runs_f32.c
+ * Description:  Floating-point sparse FIR filter with runs of taps
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Sparse
+  @{
+ */
+
+/**
+  @par           Sparse FIR Filters with Runs of Taps
+                   The arm_fir_sparse_runs functions are computing the same filter with a compressed
+                   layout of the taps, for filters with hundreds of taps (beamforming, echo paths).
+                   The initialization function sorts the taps by delay and groups the taps with
+                   consecutive delays into runs: <code>pRuns</code> contains the first delay and the
+                   number of taps of each run, <code>pCoeffs</code> the coefficients of the runs
+                   in the order of the delays. Each run is a short dense FIR filter and the outputs
+                   are accumulated over all the runs in registers (8 outputs at a time, or a vector
+                   of outputs with Neon or the x86 extensions), so the output is written once and
+                   no temporary buffer is needed.
+  @par
+                   The state buffer is linear: the new samples are appended after the previous ones
+                   and the last <code>maxDelay</code> samples are moved to the start of the buffer only
+                   when it is full. <code>pState</code> points to a buffer of
+                   <code>2*maxDelay + blockSize</code> values, so the samples are moved at most once
+                   every <code>maxDelay/blockSize</code> calls.
+  @par
+                   The cost is proportional to the number of taps, plus a small cost per run. The
+                   runs version is faster than ::arm_fir_sparse_f32 for any density, and faster than
+                   ::arm_fir_f32 (of <code>maxDelay+1</code> taps) when less than about half of the
+                   taps are nonzero. The cycles of the fir_sparse_runs density tests can be used to
+                   find the crossover point of a target.
+ */
+
+/**
+  @brief         Processing function for the floating-point sparse FIR filter with runs of taps.
+  @param[in,out] S          points to an instance of the floating-point sparse FIR runs structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process (at most the blockSize of the initialization)
+  @return        none
+ */
+
+void arm_fir_sparse_runs_f32(
+        arm_fir_sparse_runs_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pIn;                                /* New samples in the state buffer */
+  const float32_t *px;                                 /* Samples of the current tap */
+  const float32_t *pb;                                 /* Coefficient pointer */
+  const uint16_t *pr;                                  /* Runs pointer */
+        uint32_t numRuns = S->numRuns;                 /* Number of runs */
+        uint32_t i = 0U, runCnt, tapCnt;               /* Loop counters */
+        float32_t acc0, x0, c0;                        /* Accumulator, sample and coefficient */
+
+#if defined(ARM_MATH_NEON)
+        float32x4_t accV;                              /* 4 outputs */
+#elif defined(ARM_MATH_X86_SIMD)
+        arm_x86_f32v_t accV;                           /* ARM_X86_LANES_F32 outputs */
+#endif
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t acc1, acc2, acc3, acc4, acc5, acc6, acc7; /* Accumulators of the outputs 1 to 7 */
+        float32_t x1, x2, x3, x4, x5, x6, x7;          /* Samples of the outputs 1 to 7 */
+#endif
+
+  /* The last maxDelay samples are moved to the start of the buffer when the block does not fit */
+  if ((S->stateIndex + blockSize) > S->stateLen)
+  {
+    memmove(S->pState, S->pState + (S->stateIndex - S->maxDelay), S->maxDelay * sizeof(float32_t));
+    S->stateIndex = S->maxDelay;
+  }
+
+  /* Append the new samples, x[n] is pIn[n] */
+  pIn = S->pState + S->stateIndex;
+  memcpy(pIn, pSrc, blockSize * sizeof(float32_t));
+  S->stateIndex += blockSize;
+
+#if defined(ARM_MATH_NEON)
+
+  /* 4 outputs at a time */
+  while ((i + 4U) <= blockSize)
+  {
+    accV = vdupq_n_f32(0.0f);
+    pb = S->pCoeffs;
+    pr = S->pRuns;
+
+    for (runCnt = numRuns; runCnt > 0U; runCnt--)
+    {
+      /* x[n-d] of the first tap of the run, the next taps are older */
+      px = pIn + i - pr[0];
+      tapCnt = pr[1];
+      pr += 2;
+
+      while (tapCnt > 0U)
+      {
+        accV = vmlaq_n_f32(accV, vld1q_f32(px), *pb++);
+        px--;
+
+        tapCnt--;
+      }
+    }
+
+    vst1q_f32(pDst + i, accV);
+    i += 4U;
+  }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  /* ARM_X86_LANES_F32 outputs at a time */
+  while ((i + ARM_X86_LANES_F32) <= blockSize)
+  {
+    accV = __arm_vec_dup_f32_x86(0.0f);
+    pb = S->pCoeffs;
+    pr = S->pRuns;
+
+    for (runCnt = numRuns; runCnt > 0U; runCnt--)
+    {
+      /* x[n-d] of the first tap of the run, the next taps are older */
+      px = pIn + i - pr[0];
+      tapCnt = pr[1];
+      pr += 2;
+
+      while (tapCnt > 0U)
+      {
+        accV = __arm_vec_mla_f32_x86(accV, __arm_vec_dup_f32_x86(*pb++), __arm_vec_load_f32_x86(px));
+        px--;
+
+        tapCnt--;
+      }
+    }
+
+    __arm_vec_store_f32_x86(pDst + i, accV);
+    i += ARM_X86_LANES_F32;
+  }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 8 outputs at a time */
+  while ((i + 8U) <= blockSize)
+  {
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+    acc4 = 0.0f;
+    acc5 = 0.0f;
+    acc6 = 0.0f;
+    acc7 = 0.0f;
+    pb = S->pCoeffs;
+    pr = S->pRuns;
+
+    for (runCnt = numRuns; runCnt > 0U; runCnt--)
+    {
+      px = pIn + i - pr[0];
+      tapCnt = pr[1];
+      pr += 2;
+
+      /* Samples of the outputs 1 to 7 for the first tap of the run */
+      x1 = px[1];
+      x2 = px[2];
+      x3 = px[3];
+      x4 = px[4];
+      x5 = px[5];
+      x6 = px[6];
+      x7 = px[7];
+
+      /* Each tap needs one new sample, the outputs k are using the sample of
+         the output k-1 for the previous tap */
+      while (tapCnt > 0U)
+      {
+        x0 = *px--;
+        c0 = *pb++;
+
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+        acc4 += x4 * c0;
+        acc5 += x5 * c0;
+        acc6 += x6 * c0;
+        acc7 += x7 * c0;
+
+        x7 = x6;
+        x6 = x5;
+        x5 = x4;
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+
+        tapCnt--;
+      }
+    }
+
+    pDst[i]      = acc0;
+    pDst[i + 1U] = acc1;
+    pDst[i + 2U] = acc2;
+    pDst[i + 3U] = acc3;
+    pDst[i + 4U] = acc4;
+    pDst[i + 5U] = acc5;
+    pDst[i + 6U] = acc6;
+    pDst[i + 7U] = acc7;
+    i += 8U;
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Remaining outputs */
+  while (i < blockSize)
+  {
+    acc0 = 0.0f;
+    pb = S->pCoeffs;
+    pr = S->pRuns;
+
+    for (runCnt = numRuns; runCnt > 0U; runCnt--)
+    {
+      px = pIn + i - pr[0];
+      tapCnt = pr[1];
+      pr += 2;
+
+      while (tapCnt > 0U)
+      {
+        x0 = *px--;
+        c0 = *pb++;
+        acc0 += x0 * c0;
+
+        tapCnt--;
+      }
+    }
+
+    pDst[i] = acc0;
+    i++;
+  }
+}
+
+/**
+  @} end of FIR_Sparse group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_sparse_runs_init_q7.c
+ * Description:  Q7 sparse FIR filter with runs of taps initialization function
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Sparse
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q7 sparse FIR filter with runs of taps.
+  @param[in,out] S           points to an instance of the Q7 sparse FIR runs structure
+  @param[in]     numTaps     number of nonzero coefficients in the filter
+  @param[in]     pCoeffs     points to the array of filter coefficients
+  @param[in]     pTapDelay   points to the array of offset times (in any order)
+  @param[in]     maxDelay    maximum offset time supported
+  @param[out]    pRunCoeffs  points to the coefficients of the runs (<code>numTaps</code> values)
+  @param[out]    pRuns       points to the first delay and the length of each run (<code>2*numTaps</code> values)
+  @param[in]     pState      points to the state buffer (<code>2*maxDelay + blockSize</code> values)
+  @param[in]     blockSize   maximum number of samples processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0 or a delay is not in the range [0, maxDelay]
+
+  @par           Details
+                   The taps are sorted by delay. Taps with the same delay are kept in
+                   separate runs: their coefficients are not added, so a sum of coefficients is never
+                   saturated.
+                   The sorted delays are kept in the second half of <code>pRuns</code> before they are
+                   grouped into runs, so <code>pRuns</code> must have room for <code>2*numTaps</code> values
+                   even if there are less runs. The sort is quadratic in the number of taps.
+ */
+
+arm_status arm_fir_sparse_runs_init_q7(
+        arm_fir_sparse_runs_instance_q7 * S,
+        uint16_t numTaps,
+  const q7_t * pCoeffs,
+  const int32_t * pTapDelay,
+        uint16_t maxDelay,
+        q7_t * pRunCoeffs,
+        uint16_t * pRuns,
+        q7_t * pState,
+        uint32_t blockSize)
+{
+  uint16_t *pDelay = pRuns + numTaps;       /* Sorted delays */
+  uint32_t numRuns = 0U;                    /* Number of runs */
+  uint32_t i, j;                            /* Loop counters */
+  int32_t delay, prevDelay = 0;             /* Delay of the current and previous taps */
+
+  if (numTaps == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Insertion of each tap in the list of coefficients sorted by delay */
+  for (i = 0U; i < numTaps; i++)
+  {
+    delay = pTapDelay[i];
+
+    if ((delay < 0) || (delay > (int32_t) maxDelay))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    j = i;
+    while ((j > 0U) && ((int32_t) pDelay[j - 1U] > delay))
+    {
+      pDelay[j] = pDelay[j - 1U];
+      pRunCoeffs[j] = pRunCoeffs[j - 1U];
+      j--;
+    }
+
+    pDelay[j] = (uint16_t) delay;
+    pRunCoeffs[j] = pCoeffs[i];
+  }
+
+  /* Taps with consecutive delays are grouped into runs. The run r is written
+     in pRuns[2*r] and pRuns[2*r+1], before the delays which are not read yet. */
+  for (i = 0U; i < numTaps; i++)
+  {
+    delay = pDelay[i];
+
+    if ((numRuns > 0U) && (delay == (prevDelay + 1)))
+    {
+      pRuns[(2U * numRuns) - 1U]++;
+    }
+    else
+    {
+      pRuns[2U * numRuns] = (uint16_t) delay;
+      pRuns[(2U * numRuns) + 1U] = 1U;
+      numRuns++;
+    }
+
+    prevDelay = delay;
+  }
+
+  S->numRuns = (uint16_t) numRuns;
+  S->maxDelay = maxDelay;
+  S->pCoeffs = pRunCoeffs;
+  S->pRuns = pRuns;
+  S->pState = pState;
+
+  /* The new samples are written after maxDelay previous samples */
+  S->stateLen = (2U * maxDelay) + blockSize;
+  S->stateIndex = maxDelay;
+
+  /* Clear state buffer */
+  memset(pState, 0, S->stateLen * sizeof(q7_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of FIR_Sparse group
+ */
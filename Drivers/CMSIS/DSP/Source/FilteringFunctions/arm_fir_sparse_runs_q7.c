@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_sparse_runs_q7.c
+ * Description:  Q7 sparse FIR filter with runs of taps
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Sparse
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q7 sparse FIR filter with runs of taps.
+  @param[in,out] S          points to an instance of the Q7 sparse FIR runs structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process (at most the blockSize of the initialization)
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 32-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.7 format and multiplications yield a 2.14 result.
+                   The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
+                   There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   The accumulator is converted to 18.7 format by discarding the low 7 bits.
+                   Finally, the result is saturated to 1.7 format.
+ */
+
+void arm_fir_sparse_runs_q7(
+        arm_fir_sparse_runs_instance_q7 * S,
+  const q7_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize)
+{
+        q7_t *pIn;                                     /* New samples in the state buffer */
+  const q7_t *px;                                      /* Samples of the current tap */
+  const q7_t *pb;                                      /* Coefficient pointer */
+  const uint16_t *pr;                                  /* Runs pointer */
+        uint32_t numRuns = S->numRuns;                 /* Number of runs */
+        uint32_t i = 0U, runCnt, tapCnt;               /* Loop counters */
+        q31_t acc0;                                    /* Accumulator */
+        q7_t x0, c0;                                   /* Sample and coefficient */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q31_t acc1, acc2, acc3;                        /* Accumulators of the outputs 1 to 3 */
+        q7_t x1, x2, x3;                               /* Samples of the outputs 1 to 3 */
+#endif
+
+  /* The last maxDelay samples are moved to the start of the buffer when the block does not fit */
+  if ((S->stateIndex + blockSize) > S->stateLen)
+  {
+    memmove(S->pState, S->pState + (S->stateIndex - S->maxDelay), S->maxDelay * sizeof(q7_t));
+    S->stateIndex = S->maxDelay;
+  }
+
+  /* Append the new samples, x[n] is pIn[n] */
+  pIn = S->pState + S->stateIndex;
+  memcpy(pIn, pSrc, blockSize * sizeof(q7_t));
+  S->stateIndex += blockSize;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  while ((i + 4U) <= blockSize)
+  {
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+    pb = S->pCoeffs;
+    pr = S->pRuns;
+
+    for (runCnt = numRuns; runCnt > 0U; runCnt--)
+    {
+      /* x[n-d] of the first tap of the run, the next taps are older */
+      px = pIn + i - pr[0];
+      tapCnt = pr[1];
+      pr += 2;
+
+      /* Samples of the outputs 1 to 3 for the first tap of the run */
+      x1 = px[1];
+      x2 = px[2];
+      x3 = px[3];
+
+      /* Each tap needs one new sample, the outputs k are using the sample of
+         the output k-1 for the previous tap */
+      while (tapCnt > 0U)
+      {
+        x0 = *px--;
+        c0 = *pb++;
+
+        acc0 += (q15_t) x0 * c0;
+        acc1 += (q15_t) x1 * c0;
+        acc2 += (q15_t) x2 * c0;
+        acc3 += (q15_t) x3 * c0;
+
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+
+        tapCnt--;
+      }
+    }
+
+    pDst[i]      = (q7_t) __SSAT((acc0 >> 7U), 8);
+    pDst[i + 1U] = (q7_t) __SSAT((acc1 >> 7U), 8);
+    pDst[i + 2U] = (q7_t) __SSAT((acc2 >> 7U), 8);
+    pDst[i + 3U] = (q7_t) __SSAT((acc3 >> 7U), 8);
+    i += 4U;
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Remaining outputs */
+  while (i < blockSize)
+  {
+    acc0 = 0;
+    pb = S->pCoeffs;
+    pr = S->pRuns;
+
+    for (runCnt = numRuns; runCnt > 0U; runCnt--)
+    {
+      px = pIn + i - pr[0];
+      tapCnt = pr[1];
+      pr += 2;
+
+      while (tapCnt > 0U)
+      {
+        x0 = *px--;
+        c0 = *pb++;
+        acc0 += (q15_t) x0 * c0;
+
+        tapCnt--;
+      }
+    }
+
+    pDst[i] = (q7_t) __SSAT((acc0 >> 7U), 8);
+    i++;
+  }
+}
+
+/**
+  @} end of FIR_Sparse group
+ */
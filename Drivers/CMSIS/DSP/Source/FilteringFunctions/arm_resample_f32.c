@@ -0,0 +1,246 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_f32.c
+ * Description:  Floating-point rational sample rate converter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Resample Rational Sample Rate Converter
+
+  These functions change the sample rate of a signal by a rational factor <code>L/M</code>
+  (for instance 1/3 from 48 kHz to 16 kHz or 147/160 from 48 kHz to 44.1 kHz).
+  Conceptually, the signal is upsampled by <code>L</code> (zero insertion), filtered
+  by a lowpass FIR filter and downsampled by <code>M</code>.
+  The functions implement it with a polyphase filter bank : only the samples which are
+  kept after the downsampling are computed and the zeros are never multiplied.
+  Chaining ::arm_fir_interpolate_f32 and ::arm_fir_decimate_f32 computes <code>L</code> filter
+  outputs per input sample and discards most of them.
+
+  @par           Algorithm
+                   The filter coefficients are split in <code>L</code> polyphase components of <code>phaseLength = numTaps/L</code> taps.
+                   The output <code>n</code> corresponds to the sample <code>t = n*M + M - 1</code> of the upsampled signal.
+                   It is computed with the component <code>t % L</code> applied to the last <code>phaseLength</code> input
+                   samples ending at input <code>t / L</code>.
+  <pre>
+      y[n] = b[p] * x[i] + b[p+L] * x[i-1] + ... + b[p+(phaseLength-1)*L] * x[i-phaseLength+1]
+      with t = n*M + M - 1, i = t / L and p = t % L
+  </pre>
+  @par
+                   With <code>M = 1</code> the output is the output of the FIR interpolator and with <code>L = 1</code> it is
+                   the output of the FIR decimator with the same coefficients.
+                   As for the interpolator, the gain of the filter must be <code>L</code> to preserve the amplitude of the signal.
+  @par
+                   The functions are streaming : the position of the next output is kept in the instance and
+                   the number of outputs generated by a call varies from call to call.
+                   The functions return the number of output samples written in <code>pDst</code> which must be
+                   able to contain <code>(L*blockSize + M - 1) / M</code> samples.
+
+  @par
+                   <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, stored in
+                   time reversed order as for the other FIR functions. <code>numTaps</code> must be a multiple of <code>L</code>.
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+
+  @par           Instance Structure
+                   The coefficients and state variables for a filter are stored together in an instance data structure.
+                   A separate instance structure must be defined for each filter.
+                   Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+                   There are separate instance structure declarations for each of the supported data types.
+
+  @par           Initialization Functions
+                   There is also an associated initialization function for each data type.
+                   The initialization function performs the following operations:
+                   - Sets the values of the internal structure fields.
+                   - Zeros out the values in the state buffer.
+                   - Checks that <code>numTaps</code> is a multiple of <code>L</code>.
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point rational resampler.
+  @param[in]     S          points to an instance of the floating-point resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written in pDst
+ */
+uint32_t arm_resample_f32(
+        arm_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t *pStateCur;                          /* Points to the current sample of the state */
+        float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t sum0;                                /* Accumulator */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        uint32_t idx, phase;                           /* Input sample and polyphase component of the next output */
+        uint32_t stepIdx, stepPhase;                   /* Increments of idx and phase between two outputs */
+        uint32_t outCnt = 0U;                          /* Number of output samples */
+        uint32_t i, tapCnt;                            /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t acc0, acc1, acc2, acc3;              /* Accumulators */
+#endif
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCur points to the location where the new input data should be written */
+  pStateCur = S->pState + (phaseLen - 1U);
+
+  /* Copy new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCur++ = *pSrc++;
+
+    /* Decrement loop counter */
+    i--;
+  }
+
+  /* The position of the next output in the upsampled block is idx * L + phase */
+  idx = S->pos / L;
+  phase = S->pos % L;
+
+  stepIdx = S->M / L;
+  stepPhase = S->M % L;
+
+  while (idx < blockSize)
+  {
+    /* The oldest sample used by the output is x[idx - phaseLen + 1] */
+    px = pState + idx;
+
+    /* The coefficients of the polyphase component are b[phase + k*L] in time reversed order */
+    pb = pCoeffs + (L - 1U - phase);
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    /* Loop unrolling: Compute 4 taps at a time */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      acc0 += px[0] * pb[0];
+      acc1 += px[1] * pb[L];
+      acc2 += px[2] * pb[2U * L];
+      acc3 += px[3] * pb[3U * L];
+
+      px += 4U;
+      pb += 4U * L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    sum0 = (acc0 + acc1) + (acc2 + acc3);
+
+    /* Loop unrolling: Compute remaining taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    sum0 = 0.0f;
+
+    /* Initialize tapCnt with number of taps */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (tapCnt > 0U)
+    {
+      sum0 += *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = sum0;
+    outCnt++;
+
+    /* Position of the next output : M samples later in the upsampled signal */
+    idx += stepIdx;
+    phase += stepPhase;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      idx++;
+    }
+  }
+
+  /* Position of the next output relative to the next block */
+  S->pos = ((idx - blockSize) * L) + phase;
+
+  /* Processing is complete.
+     Now, copy the last phaseLen - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCur = S->pState;
+
+  /* Points to the last phaseLen - 1 input samples */
+  px = pState + blockSize;
+
+  tapCnt = phaseLen - 1U;
+
+  /* Copy data */
+  while (tapCnt > 0U)
+  {
+    *pStateCur++ = *px++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+  @} end of Resample group
+ */
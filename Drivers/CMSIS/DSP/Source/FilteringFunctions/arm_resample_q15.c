@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_q15.c
+ * Description:  Q15 rational sample rate converter
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 rational resampler.
+  @param[in]     S          points to an instance of the Q15 resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written in pDst
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+uint32_t arm_resample_q15(
+        arm_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        q15_t *pStateCur;                              /* Points to the current sample of the state */
+        q15_t *px;                                     /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q63_t sum0;                                    /* Accumulator */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        uint32_t idx, phase;                           /* Input sample and polyphase component of the next output */
+        uint32_t stepIdx, stepPhase;                   /* Increments of idx and phase between two outputs */
+        uint32_t outCnt = 0U;                          /* Number of output samples */
+        uint32_t i, tapCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCur points to the location where the new input data should be written */
+  pStateCur = S->pState + (phaseLen - 1U);
+
+  /* Copy new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCur++ = *pSrc++;
+
+    /* Decrement loop counter */
+    i--;
+  }
+
+  /* The position of the next output in the upsampled block is idx * L + phase */
+  idx = S->pos / L;
+  phase = S->pos % L;
+
+  stepIdx = S->M / L;
+  stepPhase = S->M % L;
+
+  while (idx < blockSize)
+  {
+    /* The oldest sample used by the output is x[idx - phaseLen + 1] */
+    px = pState + idx;
+
+    /* The coefficients of the polyphase component are b[phase + k*L] in time reversed order */
+    pb = pCoeffs + (L - 1U - phase);
+
+    sum0 = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 taps at a time */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      sum0 += (q31_t) px[0] * pb[0];
+      sum0 += (q31_t) px[1] * pb[L];
+      sum0 += (q31_t) px[2] * pb[2U * L];
+      sum0 += (q31_t) px[3] * pb[3U * L];
+
+      px += 4U;
+      pb += 4U * L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Initialize tapCnt with number of taps */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (tapCnt > 0U)
+    {
+      sum0 += (q31_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result in 1.15 format in the destination buffer */
+    *pDst++ = (q15_t) (__SSAT((sum0 >> 15), 16));
+    outCnt++;
+
+    /* Position of the next output : M samples later in the upsampled signal */
+    idx += stepIdx;
+    phase += stepPhase;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      idx++;
+    }
+  }
+
+  /* Position of the next output relative to the next block */
+  S->pos = ((idx - blockSize) * L) + phase;
+
+  /* Processing is complete.
+     Now, copy the last phaseLen - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCur = S->pState;
+
+  /* Points to the last phaseLen - 1 input samples */
+  px = pState + blockSize;
+
+  tapCnt = phaseLen - 1U;
+
+  /* Copy data */
+  while (tapCnt > 0U)
+  {
+    *pStateCur++ = *px++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
+  return (outCnt);
+}
+
+/**
+  @} end of Resample group
+ */
@@ -29,6 +29,8 @@
 #include "arm_mat_add_f32.c"
 #include "arm_mat_add_q15.c"
 #include "arm_mat_add_q31.c"
+#include "arm_mat_cholesky_f32.c"
+#include "arm_mat_cholesky_f64.c"
 #include "arm_mat_cmplx_mult_f32.c"
 #include "arm_mat_cmplx_mult_q15.c"
 #include "arm_mat_cmplx_mult_q31.c"
@@ -37,6 +39,9 @@
 #include "arm_mat_init_q31.c"
 #include "arm_mat_inverse_f32.c"
 #include "arm_mat_inverse_f64.c"
+#include "arm_mat_lu_f32.c"
+#include "arm_mat_mult_blocked_f32.c"
+#include "arm_mat_mult_blocked_q15.c"
 #include "arm_mat_mult_f32.c"
 #include "arm_mat_mult_fast_q15.c"
 #include "arm_mat_mult_fast_q31.c"
@@ -45,6 +50,10 @@
 #include "arm_mat_scale_f32.c"
 #include "arm_mat_scale_q15.c"
 #include "arm_mat_scale_q31.c"
+#include "arm_mat_solve_lower_triangular_f32.c"
+#include "arm_mat_solve_lower_triangular_f64.c"
+#include "arm_mat_solve_upper_triangular_f32.c"
+#include "arm_mat_solve_upper_triangular_f64.c"
 #include "arm_mat_sub_f32.c"
 #include "arm_mat_sub_q15.c"
 #include "arm_mat_sub_q31.c"
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky factorization
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixChol Cholesky Factorization
+
+  Computes the Cholesky factorization of a symmetric positive definite matrix.
+
+  The lower triangular matrix L verifies:
+  <pre>
+      A = L * L<sup>T</sup>
+  </pre>
+
+  The linear system A * X = B is then solved with two triangular solves
+  (\ref MatrixSolveTri) : L * Y = B and L<sup>T</sup> * X = Y.
+  The factorization costs n<sup>3</sup>/3 multiply-accumulates, a third of the
+  Gauss-Jordan inversion, and does not need any pivoting.
+
+  Only the lower triangular part of the source matrix is read.
+  The factorization fails with ARM_MATH_DECOMPOSITION_FAILURE when a pivot is not
+  strictly positive : the matrix is not positive definite (or not enough for the
+  precision of the computation).
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+  @brief         Floating-point Cholesky factorization.
+  @param[in]     pSrc      points to the instance of the input floating-point matrix structure.
+  @param[out]    pDst      points to the instance of the output floating-point matrix structure.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Input matrix is not positive definite
+
+  @par           In-place
+                   pDst can be the same matrix as pSrc.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pIn = pSrc->pData;            /* input data matrix pointer */
+        float32_t *pOut = pDst->pData;           /* output data matrix pointer */
+  const float32_t *pRowI, *pRowJ;                /* rows of L */
+        float32_t sum;                           /* accumulator */
+        uint32_t n = pSrc->numRows;              /* size of the matrix */
+        uint32_t i, j, k;                        /* loop counters */
+        arm_status status;                       /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Cholesky-Banachiewicz : L is computed row after row.
+       L[i][j] = (A[i][j] - sum(L[i][k] * L[j][k], k < j)) / L[j][j]
+       The rows of L are contiguous, so the sums are dot products of row prefixes. */
+    for (i = 0U; i < n; i++)
+    {
+      pRowI = pOut + (i * n);
+
+      for (j = 0U; j <= i; j++)
+      {
+        pRowJ = pOut + (j * n);
+        sum = pIn[(i * n) + j];
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        {
+          float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+
+          /* Loop unrolling: Compute 4 products at a time */
+          for (k = 0U; (k + 4U) <= j; k += 4U)
+          {
+            acc0 += pRowI[k    ] * pRowJ[k    ];
+            acc1 += pRowI[k + 1] * pRowJ[k + 1];
+            acc2 += pRowI[k + 2] * pRowJ[k + 2];
+            acc3 += pRowI[k + 3] * pRowJ[k + 3];
+          }
+
+          sum -= (acc0 + acc1) + (acc2 + acc3);
+        }
+#else
+        k = 0U;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        for (; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        if (i == j)
+        {
+          /* The pivot of a positive definite matrix is strictly positive.
+             The test is also false for a NaN. */
+          if (!(sum > 0.0f))
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+          pOut[(i * n) + i] = sqrtf(sum);
+        }
+        else
+        {
+          pOut[(i * n) + j] = sum / pRowJ[j];
+        }
+      }
+
+      /* Upper triangular part. For an in-place factorization, those elements of A
+         are never read again. */
+      for (j = i + 1U; j < n; j++)
+      {
+        pOut[(i * n) + j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_f32.c
+ * Description:  Floating-point LU factorization with partial pivoting
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixLU LU Factorization
+
+  Computes the LU factorization with partial pivoting of a square matrix.
+
+  <pre>
+      P * A = L * U
+  </pre>
+  L is a lower triangular matrix with a unit diagonal, U is an upper triangular
+  matrix and P is a permutation matrix. P is returned as an array of row indexes :
+  row i of P * A is row pp[i] of A.
+
+  The linear system A * X = B is then solved with the rows of B permuted by pp
+  and two triangular solves (\ref MatrixSolveTri) : L * Y = P * B and U * X = Y.
+  The factorization costs 2n<sup>3</sup>/3 operations and, contrary to the
+  Gauss-Jordan inversion, only searches the pivot in the current column.
+ */
+
+/**
+  @addtogroup MatrixLU
+  @{
+ */
+
+/**
+  @brief         Floating-point LU factorization with partial pivoting.
+  @param[in]     pSrc      points to the instance of the input floating-point matrix structure.
+  @param[out]    pl        points to the instance of the output lower triangular matrix structure.
+  @param[out]    pu        points to the instance of the output upper triangular matrix structure.
+  @param[out]    pp        points to the output permutation (numRows row indexes).
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular
+
+  @par           In-place
+                   pu can be the same matrix as pSrc.
+ */
+
+arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pl,
+        arm_matrix_instance_f32 * pu,
+        uint16_t * pp)
+{
+  const float32_t *pIn = pSrc->pData;            /* input data matrix pointer */
+        float32_t *pL = pl->pData;               /* lower triangular matrix pointer */
+        float32_t *pU = pu->pData;               /* upper triangular matrix pointer */
+        float32_t *pRowK, *pRowI;                /* rows of U */
+        float32_t maxC, factor, tmp;             /* temporary values */
+        uint32_t n = pSrc->numRows;              /* size of the matrix */
+        uint32_t i, j, k, p;                     /* loop counters */
+        uint16_t tmpIdx;                         /* temporary row index */
+        arm_status status;                       /* status of the factorization */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pl->numRows != pSrc->numRows) || (pl->numCols != pSrc->numCols) ||
+      (pu->numRows != pSrc->numRows) || (pu->numCols != pSrc->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* U starts as a copy of A and L as the identity */
+    if (pU != pIn)
+    {
+      for (i = 0U; i < n * n; i++)
+      {
+        pU[i] = pIn[i];
+      }
+    }
+
+    for (i = 0U; i < n * n; i++)
+    {
+      pL[i] = 0.0f;
+    }
+
+    for (i = 0U; i < n; i++)
+    {
+      pL[(i * n) + i] = 1.0f;
+      pp[i] = (uint16_t) i;
+    }
+
+    /* Gaussian elimination of column k */
+    for (k = 0U; k < n; k++)
+    {
+      /* Search the pivot in column k */
+      p = k;
+      maxC = fabsf(pU[(k * n) + k]);
+      for (i = k + 1U; i < n; i++)
+      {
+        if (fabsf(pU[(i * n) + k]) > maxC)
+        {
+          maxC = fabsf(pU[(i * n) + k]);
+          p = i;
+        }
+      }
+
+      if (maxC == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      /* Exchange rows k and p of U, of the computed columns of L and of the permutation */
+      if (p != k)
+      {
+        for (j = k; j < n; j++)
+        {
+          tmp = pU[(k * n) + j];
+          pU[(k * n) + j] = pU[(p * n) + j];
+          pU[(p * n) + j] = tmp;
+        }
+
+        for (j = 0U; j < k; j++)
+        {
+          tmp = pL[(k * n) + j];
+          pL[(k * n) + j] = pL[(p * n) + j];
+          pL[(p * n) + j] = tmp;
+        }
+
+        tmpIdx = pp[k];
+        pp[k] = pp[p];
+        pp[p] = tmpIdx;
+      }
+
+      /* Remove column k from the rows below the pivot */
+      pRowK = pU + (k * n);
+      for (i = k + 1U; i < n; i++)
+      {
+        pRowI = pU + (i * n);
+        factor = pRowI[k] / pRowK[k];
+        pL[(i * n) + k] = factor;
+        pRowI[k] = 0.0f;
+
+        j = k + 1U;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        /* Loop unrolling: Update 4 columns at a time */
+        for (; (j + 4U) <= n; j += 4U)
+        {
+          pRowI[j    ] -= factor * pRowK[j    ];
+          pRowI[j + 1] -= factor * pRowK[j + 1];
+          pRowI[j + 2] -= factor * pRowK[j + 2];
+          pRowI[j + 3] -= factor * pRowK[j + 3];
+        }
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        for (; j < n; j++)
+        {
+          pRowI[j] -= factor * pRowK[j];
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLU group
+ */
@@ -0,0 +1,351 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_f32.c
+ * Description:  Floating-point matrix multiplication with packed panels
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/* Pack the columns [col, col + nbCols) of B in a panel of ARM_MAT_MULT_BLOCKED_PANEL_COLS columns.
+   The panel is stored row after row and the unused columns of a partial panel are set to zero. */
+static void arm_mat_mult_blocked_pack_f32(
+  const float32_t * pInB,
+        float32_t * pPanel,
+        uint32_t numColsA,
+        uint32_t numColsB,
+        uint32_t col,
+        uint32_t nbCols,
+        uint8_t transposedB)
+{
+  const float32_t *pIn;                          /* Temporary input pointer */
+        uint32_t k, j;                           /* Loop counters */
+
+  for (k = 0U; k < numColsA; k++)
+  {
+    if (transposedB == 0U)
+    {
+      /* Row k of B is contiguous */
+      pIn = pInB + (k * numColsB) + col;
+
+      for (j = 0U; j < nbCols; j++)
+      {
+        pPanel[j] = pIn[j];
+      }
+    }
+    else
+    {
+      /* Column k of the transposed B is strided */
+      pIn = pInB + (col * numColsA) + k;
+
+      for (j = 0U; j < nbCols; j++)
+      {
+        pPanel[j] = *pIn;
+        pIn += numColsA;
+      }
+    }
+
+    for (; j < ARM_MAT_MULT_BLOCKED_PANEL_COLS; j++)
+    {
+      pPanel[j] = 0.0f;
+    }
+
+    pPanel += ARM_MAT_MULT_BLOCKED_PANEL_COLS;
+  }
+}
+
+/**
+  @brief         Floating-point matrix multiplication with packed panels of B.
+  @param[in]     pSrcA       points to the first input matrix structure
+  @param[in]     pSrcB       points to the second input matrix structure
+  @param[out]    pDst        points to output matrix structure
+  @param[in]     pState      points to the array for storing the packed panel of B.
+                             Its size must be at least <code>ARM_MAT_MULT_BLOCKED_PANEL_COLS * numColsA</code>.
+  @param[in]     transposedB when 1, pSrcB contains the transpose of the second matrix (<code>P x N</code> instead of <code>N x P</code>)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Algorithm
+                   B is processed by panels of ARM_MAT_MULT_BLOCKED_PANEL_COLS columns. Each panel is
+                   copied once in pState so that it can be read contiguously. The output is then
+                   computed by tiles of 4 rows: each element read from A or from the panel is used
+                   for several multiply-accumulates held in registers.
+  @par
+                   When B is not transposed and one of the dimensions is smaller than
+                   ARM_MAT_MULT_BLOCKED_MIN_DIM, the packing is not worth it and the function is calling ::arm_mat_mult_f32.
+ */
+arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst,
+        float32_t * pState,
+        uint8_t transposedB)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Input data matrix pointer A */
+  const float32_t *pInB = pSrcB->pData;          /* Input data matrix pointer B */
+        float32_t *pOut = pDst->pData;           /* Output data matrix pointer */
+  const float32_t *pA0;                          /* Pointer to the first row of A of the tile */
+  const float32_t *pPanel;                       /* Pointer in the packed panel */
+        float32_t *pO;                           /* Pointer to the output tile */
+        float32_t sum;                           /* Accumulator */
+        uint16_t numRowsA = pSrcA->numRows;      /* Number of rows of input matrix A */
+        uint16_t numColsA = pSrcA->numCols;      /* Number of columns of input matrix A */
+        uint16_t numColsB;                       /* Number of columns of the second matrix */
+        uint32_t col, nbCols, row, j, k;         /* Loop counters */
+        arm_status status;                       /* Status of matrix multiplication */
+
+#if defined(ARM_MATH_X86_SIMD)
+        arm_x86_f32v_t acc0V, acc1V, acc2V, acc3V;     /* Vector accumulators */
+        arm_x86_f32v_t bV;                             /* Panel vector */
+        float32_t accLanes[4][ARM_X86_LANES_F32];      /* Partial tile */
+        uint32_t h, i;                                 /* Loop counters */
+#elif defined (ARM_MATH_LOOPUNROLL)
+  const float32_t *pA1, *pA2, *pA3;              /* Pointers to the other rows of A of the tile */
+        float32_t a0, a1, a2, a3;                /* Elements of A */
+        float32_t b0, b1, b2, b3;                /* Elements of the panel */
+        float32_t acc00, acc01, acc02, acc03;    /* Accumulators */
+        float32_t acc10, acc11, acc12, acc13;
+        float32_t acc20, acc21, acc22, acc23;
+        float32_t acc30, acc31, acc32, acc33;
+        float32_t accTile[4][4];                 /* Partial tile */
+        uint32_t h, i;                           /* Loop counters */
+#endif
+
+  numColsB = (transposedB == 0U) ? pSrcB->numCols : pSrcB->numRows;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != ((transposedB == 0U) ? pSrcB->numRows : pSrcB->numCols)) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (numColsB       != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((transposedB == 0U) &&
+      ((numRowsA < ARM_MAT_MULT_BLOCKED_MIN_DIM) ||
+       (numColsA < ARM_MAT_MULT_BLOCKED_MIN_DIM) ||
+       (numColsB < ARM_MAT_MULT_BLOCKED_MIN_DIM)))
+  {
+    /* Small matrices : the direct algorithm is faster */
+    status = arm_mat_mult_f32(pSrcA, pSrcB, pDst);
+  }
+  else
+  {
+    /* Panel loop */
+    for (col = 0U; col < numColsB; col += ARM_MAT_MULT_BLOCKED_PANEL_COLS)
+    {
+      nbCols = numColsB - col;
+      if (nbCols > ARM_MAT_MULT_BLOCKED_PANEL_COLS)
+      {
+        nbCols = ARM_MAT_MULT_BLOCKED_PANEL_COLS;
+      }
+
+      arm_mat_mult_blocked_pack_f32(pInB, pState, numColsA, numColsB, col, nbCols, transposedB);
+
+      row = 0U;
+
+#if defined(ARM_MATH_X86_SIMD)
+
+      /* Tiles of 4 rows and ARM_X86_LANES_F32 columns */
+      while ((row + 4U) <= numRowsA)
+      {
+        pA0 = pInA + (row * numColsA);
+        pO = pOut + (row * numColsB) + col;
+
+        for (h = 0U; h < nbCols; h += ARM_X86_LANES_F32)
+        {
+          acc0V = __arm_vec_dup_f32_x86(0.0f);
+          acc1V = __arm_vec_dup_f32_x86(0.0f);
+          acc2V = __arm_vec_dup_f32_x86(0.0f);
+          acc3V = __arm_vec_dup_f32_x86(0.0f);
+
+          pPanel = pState + h;
+
+          for (k = 0U; k < numColsA; k++)
+          {
+            /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+            bV = __arm_vec_load_f32_x86(pPanel);
+
+            acc0V = __arm_vec_mla_f32_x86(acc0V, __arm_vec_dup_f32_x86(pA0[k]), bV);
+            acc1V = __arm_vec_mla_f32_x86(acc1V, __arm_vec_dup_f32_x86(pA0[k + numColsA]), bV);
+            acc2V = __arm_vec_mla_f32_x86(acc2V, __arm_vec_dup_f32_x86(pA0[k + (2U * numColsA)]), bV);
+            acc3V = __arm_vec_mla_f32_x86(acc3V, __arm_vec_dup_f32_x86(pA0[k + (3U * numColsA)]), bV);
+
+            pPanel += ARM_MAT_MULT_BLOCKED_PANEL_COLS;
+          }
+
+          if ((h + ARM_X86_LANES_F32) <= nbCols)
+          {
+            __arm_vec_store_f32_x86(pO + h, acc0V);
+            __arm_vec_store_f32_x86(pO + h + numColsB, acc1V);
+            __arm_vec_store_f32_x86(pO + h + (2U * numColsB), acc2V);
+            __arm_vec_store_f32_x86(pO + h + (3U * numColsB), acc3V);
+          }
+          else
+          {
+            /* Partial tile : only nbCols - h columns are valid */
+            __arm_vec_store_f32_x86(accLanes[0], acc0V);
+            __arm_vec_store_f32_x86(accLanes[1], acc1V);
+            __arm_vec_store_f32_x86(accLanes[2], acc2V);
+            __arm_vec_store_f32_x86(accLanes[3], acc3V);
+
+            for (i = 0U; i < 4U; i++)
+            {
+              for (j = h; j < nbCols; j++)
+              {
+                pO[(i * numColsB) + j] = accLanes[i][j - h];
+              }
+            }
+          }
+        }
+
+        row += 4U;
+      }
+
+#elif defined (ARM_MATH_LOOPUNROLL)
+
+      /* Tiles of 4 rows and 4 columns */
+      while ((row + 4U) <= numRowsA)
+      {
+        pO = pOut + (row * numColsB) + col;
+
+        for (h = 0U; h < nbCols; h += 4U)
+        {
+          acc00 = 0.0f; acc01 = 0.0f; acc02 = 0.0f; acc03 = 0.0f;
+          acc10 = 0.0f; acc11 = 0.0f; acc12 = 0.0f; acc13 = 0.0f;
+          acc20 = 0.0f; acc21 = 0.0f; acc22 = 0.0f; acc23 = 0.0f;
+          acc30 = 0.0f; acc31 = 0.0f; acc32 = 0.0f; acc33 = 0.0f;
+
+          pA0 = pInA + (row * numColsA);
+          pA1 = pA0 + numColsA;
+          pA2 = pA1 + numColsA;
+          pA3 = pA2 + numColsA;
+
+          pPanel = pState + h;
+
+          k = numColsA;
+
+          while (k > 0U)
+          {
+            /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+            b0 = pPanel[0];
+            b1 = pPanel[1];
+            b2 = pPanel[2];
+            b3 = pPanel[3];
+
+            a0 = *pA0++;
+            a1 = *pA1++;
+            a2 = *pA2++;
+            a3 = *pA3++;
+
+            acc00 += a0 * b0; acc01 += a0 * b1; acc02 += a0 * b2; acc03 += a0 * b3;
+            acc10 += a1 * b0; acc11 += a1 * b1; acc12 += a1 * b2; acc13 += a1 * b3;
+            acc20 += a2 * b0; acc21 += a2 * b1; acc22 += a2 * b2; acc23 += a2 * b3;
+            acc30 += a3 * b0; acc31 += a3 * b1; acc32 += a3 * b2; acc33 += a3 * b3;
+
+            pPanel += ARM_MAT_MULT_BLOCKED_PANEL_COLS;
+
+            /* Decrement loop counter */
+            k--;
+          }
+
+          accTile[0][0] = acc00; accTile[0][1] = acc01; accTile[0][2] = acc02; accTile[0][3] = acc03;
+          accTile[1][0] = acc10; accTile[1][1] = acc11; accTile[1][2] = acc12; accTile[1][3] = acc13;
+          accTile[2][0] = acc20; accTile[2][1] = acc21; accTile[2][2] = acc22; accTile[2][3] = acc23;
+          accTile[3][0] = acc30; accTile[3][1] = acc31; accTile[3][2] = acc32; accTile[3][3] = acc33;
+
+          /* Store the valid columns of the tile */
+          for (i = 0U; i < 4U; i++)
+          {
+            for (j = h; (j < (h + 4U)) && (j < nbCols); j++)
+            {
+              pO[(i * numColsB) + j] = accTile[i][j - h];
+            }
+          }
+        }
+
+        row += 4U;
+      }
+
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
+      /* Remaining rows */
+      while (row < numRowsA)
+      {
+        pO = pOut + (row * numColsB) + col;
+
+        for (j = 0U; j < nbCols; j++)
+        {
+          sum = 0.0f;
+
+          pA0 = pInA + (row * numColsA);
+          pPanel = pState + j;
+
+          k = numColsA;
+
+          while (k > 0U)
+          {
+            /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+            sum += *pA0++ * *pPanel;
+
+            pPanel += ARM_MAT_MULT_BLOCKED_PANEL_COLS;
+
+            /* Decrement loop counter */
+            k--;
+          }
+
+          pO[j] = sum;
+        }
+
+        row++;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
@@ -0,0 +1,309 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_q15.c
+ * Description:  Q15 matrix multiplication with packed panels
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/* Pack the columns [col, col + nbCols) of B in a panel of ARM_MAT_MULT_BLOCKED_PANEL_COLS columns.
+   The rows of B are interleaved by pairs so that two consecutive products of a dot product
+   can be computed by a single dual multiply-accumulate:
+   {b(0,0), b(1,0), b(0,1), b(1,1), ... b(2,0), b(3,0), b(2,1), b(3,1) ...}
+   When numColsA is odd, the last row of the panel is not interleaved.
+   The unused columns of a partial panel are set to zero. */
+static void arm_mat_mult_blocked_pack_q15(
+  const q15_t * pInB,
+        q15_t * pPanel,
+        uint32_t numColsA,
+        uint32_t numColsB,
+        uint32_t col,
+        uint32_t nbCols,
+        uint8_t transposedB)
+{
+        uint32_t k, j;                           /* Loop counters */
+        uint32_t offset0, offset1;               /* Offsets of b(k,j) and b(k+1,j) */
+        uint32_t stepK, stepJ;                   /* Distances between two rows and two columns of B */
+
+  if (transposedB == 0U)
+  {
+    stepK = numColsB;
+    stepJ = 1U;
+  }
+  else
+  {
+    stepK = 1U;
+    stepJ = numColsA;
+  }
+
+  for (k = 0U; (k + 2U) <= numColsA; k += 2U)
+  {
+    offset0 = (k * stepK) + (col * stepJ);
+    offset1 = offset0 + stepK;
+
+    for (j = 0U; j < nbCols; j++)
+    {
+      *pPanel++ = pInB[offset0];
+      *pPanel++ = pInB[offset1];
+
+      offset0 += stepJ;
+      offset1 += stepJ;
+    }
+
+    for (; j < ARM_MAT_MULT_BLOCKED_PANEL_COLS; j++)
+    {
+      *pPanel++ = 0;
+      *pPanel++ = 0;
+    }
+  }
+
+  /* Last row when numColsA is odd */
+  if (k < numColsA)
+  {
+    offset0 = (k * stepK) + (col * stepJ);
+
+    for (j = 0U; j < nbCols; j++)
+    {
+      *pPanel++ = pInB[offset0];
+      offset0 += stepJ;
+    }
+
+    for (; j < ARM_MAT_MULT_BLOCKED_PANEL_COLS; j++)
+    {
+      *pPanel++ = 0;
+    }
+  }
+}
+
+/**
+  @brief         Q15 matrix multiplication with packed panels of B.
+  @param[in]     pSrcA       points to the first input matrix structure
+  @param[in]     pSrcB       points to the second input matrix structure
+  @param[out]    pDst        points to output matrix structure
+  @param[in]     pState      points to the array for storing the packed panel of B.
+                             Its size must be at least <code>ARM_MAT_MULT_BLOCKED_PANEL_COLS * numColsA</code>.
+  @param[in]     transposedB when 1, pSrcB contains the transpose of the second matrix (<code>P x N</code> instead of <code>N x P</code>)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator and the results
+                   are bit exact with ::arm_mat_mult_q15.
+  @par
+                   Contrary to ::arm_mat_mult_q15, the scratch buffer does not need to contain all of B :
+                   B is processed by panels of ARM_MAT_MULT_BLOCKED_PANEL_COLS columns and the output is
+                   computed by tiles of 2 rows and 2 columns.
+ */
+arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst,
+        q15_t * pState,
+        uint8_t transposedB)
+{
+        q15_t *pInA = pSrcA->pData;              /* Input data matrix pointer A */
+  const q15_t *pInB = pSrcB->pData;              /* Input data matrix pointer B */
+        q15_t *pOut = pDst->pData;               /* Output data matrix pointer */
+        q15_t *pA0;                              /* Pointer to the first row of A of the tile */
+        q15_t *pPanel;                           /* Pointer in the packed panel */
+        q15_t *pO;                               /* Pointer to the output tile */
+        q63_t sum;                               /* Accumulator */
+        uint16_t numRowsA = pSrcA->numRows;      /* Number of rows of input matrix A */
+        uint16_t numColsA = pSrcA->numCols;      /* Number of columns of input matrix A */
+        uint16_t numColsB;                       /* Number of columns of the second matrix */
+        uint32_t col, nbCols, row, j, k;         /* Loop counters */
+        uint32_t pairStride;                     /* Distance between two pairs of rows in the panel */
+        arm_status status;                       /* Status of matrix multiplication */
+
+#if defined (ARM_MATH_DSP)
+        q15_t *pA1;                              /* Pointer to the second row of A of the tile */
+        q15_t *pB;                               /* Pointer to the pair of columns in the panel */
+        q31_t inA0, inA1, inB0, inB1;            /* Pairs of elements of A and of the panel */
+        q63_t acc00, acc01, acc10, acc11;        /* Accumulators */
+#endif
+
+  numColsB = (transposedB == 0U) ? pSrcB->numCols : pSrcB->numRows;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != ((transposedB == 0U) ? pSrcB->numRows : pSrcB->numCols)) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (numColsB       != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    pairStride = 2U * ARM_MAT_MULT_BLOCKED_PANEL_COLS;
+
+    /* Panel loop */
+    for (col = 0U; col < numColsB; col += ARM_MAT_MULT_BLOCKED_PANEL_COLS)
+    {
+      nbCols = numColsB - col;
+      if (nbCols > ARM_MAT_MULT_BLOCKED_PANEL_COLS)
+      {
+        nbCols = ARM_MAT_MULT_BLOCKED_PANEL_COLS;
+      }
+
+      arm_mat_mult_blocked_pack_q15(pInB, pState, numColsA, numColsB, col, nbCols, transposedB);
+
+      row = 0U;
+
+#if defined (ARM_MATH_DSP)
+
+      /* Tiles of 2 rows and 2 columns */
+      while ((row + 2U) <= numRowsA)
+      {
+        pO = pOut + (row * numColsB) + col;
+
+        for (j = 0U; j < nbCols; j += 2U)
+        {
+          acc00 = 0;
+          acc01 = 0;
+          acc10 = 0;
+          acc11 = 0;
+
+          pA0 = pInA + (row * numColsA);
+          pA1 = pA0 + numColsA;
+          pB = pState + (2U * j);
+
+          k = numColsA >> 1U;
+
+          while (k > 0U)
+          {
+            /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+            inA0 = read_q15x2_ia (&pA0);
+            inA1 = read_q15x2_ia (&pA1);
+
+            inB0 = read_q15x2 (pB);
+            inB1 = read_q15x2 (pB + 2);
+
+            acc00 = __SMLALD(inA0, inB0, acc00);
+            acc01 = __SMLALD(inA0, inB1, acc01);
+            acc10 = __SMLALD(inA1, inB0, acc10);
+            acc11 = __SMLALD(inA1, inB1, acc11);
+
+            pB += pairStride;
+
+            /* Decrement loop counter */
+            k--;
+          }
+
+          /* Last column of A when numColsA is odd */
+          if ((numColsA & 1U) != 0U)
+          {
+            pB = pState + ((numColsA - 1U) * ARM_MAT_MULT_BLOCKED_PANEL_COLS) + j;
+
+            acc00 += (q31_t) *pA0 * pB[0];
+            acc01 += (q31_t) *pA0 * pB[1];
+            acc10 += (q31_t) *pA1 * pB[0];
+            acc11 += (q31_t) *pA1 * pB[1];
+          }
+
+          /* Saturate and store the valid columns of the tile */
+          pO[j] = (q15_t) (__SSAT((acc00 >> 15), 16));
+          pO[j + numColsB] = (q15_t) (__SSAT((acc10 >> 15), 16));
+
+          if ((j + 1U) < nbCols)
+          {
+            pO[j + 1U] = (q15_t) (__SSAT((acc01 >> 15), 16));
+            pO[j + 1U + numColsB] = (q15_t) (__SSAT((acc11 >> 15), 16));
+          }
+        }
+
+        row += 2U;
+      }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      /* Remaining rows */
+      while (row < numRowsA)
+      {
+        pO = pOut + (row * numColsB) + col;
+
+        for (j = 0U; j < nbCols; j++)
+        {
+          sum = 0;
+
+          pA0 = pInA + (row * numColsA);
+          pPanel = pState + (2U * j);
+
+          k = numColsA >> 1U;
+
+          while (k > 0U)
+          {
+            /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+            sum += (q31_t) pA0[0] * pPanel[0];
+            sum += (q31_t) pA0[1] * pPanel[1];
+
+            pA0 += 2U;
+            pPanel += pairStride;
+
+            /* Decrement loop counter */
+            k--;
+          }
+
+          /* Last column of A when numColsA is odd */
+          if ((numColsA & 1U) != 0U)
+          {
+            pPanel = pState + ((numColsA - 1U) * ARM_MAT_MULT_BLOCKED_PANEL_COLS) + j;
+
+            sum += (q31_t) *pA0 * *pPanel;
+          }
+
+          /* Convert result from 34.30 to 1.15 format and store saturated value in destination buffer */
+          pO[j] = (q15_t) (__SSAT((sum >> 15), 16));
+        }
+
+        row++;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
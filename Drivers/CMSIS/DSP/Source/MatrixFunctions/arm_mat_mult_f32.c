@@ -394,6 +394,110 @@ arm_status arm_mat_mult_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_X86_SIMD)
+arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* Input data matrix pointer A */
+  float32_t *pInB = pSrcB->pData;                /* Input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  float32_t *pIn1, *pIn2;                        /* Temporary input data matrix pointers */
+  float32_t sum;                                 /* Accumulator */
+  arm_x86_f32v_t sumV;                           /* Vector accumulator */
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t col, row, colCnt;                     /* Loop counters */
+  arm_status status;                             /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* row loop */
+    for (row = 0U; row < numRowsA; row++)
+    {
+      /* ARM_X86_LANES_F32 columns of the output row are computed at a time :
+         each a(m,k) is broadcast and multiplied with ARM_X86_LANES_F32 consecutive elements of the row k of B */
+      col = 0U;
+
+      while ((col + ARM_X86_LANES_F32) <= numColsB)
+      {
+        sumV = __arm_vec_dup_f32_x86(0.0f);
+
+        pIn1 = pInA;
+        pIn2 = pInB + col;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+          sumV = __arm_vec_mla_f32_x86(sumV, __arm_vec_dup_f32_x86(*pIn1++), __arm_vec_load_f32_x86(pIn2));
+          pIn2 += numColsB;
+
+          /* Decrement loop counter */
+          colCnt--;
+        }
+
+        /* Store result in destination buffer */
+        __arm_vec_store_f32_x86(pOut + col, sumV);
+
+        col += ARM_X86_LANES_F32;
+      }
+
+      /* Remaining columns */
+      while (col < numColsB)
+      {
+        sum = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB + col;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+          sum += *pIn1++ * *pIn2;
+          pIn2 += numColsB;
+
+          /* Decrement loop counter */
+          colCnt--;
+        }
+
+        /* Store result in destination buffer */
+        pOut[col] = sum;
+
+        col++;
+      }
+
+      /* Update pointers to the next row of A and of the destination */
+      pInA += numColsA;
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
 #else
 arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
@@ -138,6 +138,74 @@ arm_status arm_mat_scale_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_X86_SIMD)
+arm_status arm_mat_scale_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        float32_t                 scale,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* Input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  uint32_t numSamples;                           /* Total number of elements in the matrix */
+  uint32_t blkCnt;                               /* Loop counters */
+  arm_status status;                             /* Status of matrix scaling */
+  arm_x86_f32v_t scaleV = __arm_vec_dup_f32_x86(scale);
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pDst->numRows) ||
+      (pSrc->numCols != pDst->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Total number of samples in input matrix */
+    numSamples = (uint32_t) pSrc->numRows * pSrc->numCols;
+
+    /* Compute ARM_X86_LANES_F32 outputs at a time */
+    blkCnt = numSamples / ARM_X86_LANES_F32;
+
+    while (blkCnt > 0U)
+    {
+      /* C(m,n) = A(m,n) * scale */
+
+      /* Scale and store result in destination buffer. */
+      __arm_vec_store_f32_x86(pOut, __arm_vec_mul_f32_x86(__arm_vec_load_f32_x86(pIn), scaleV));
+      pIn += ARM_X86_LANES_F32;
+      pOut += ARM_X86_LANES_F32;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples % ARM_X86_LANES_F32;
+
+    while (blkCnt > 0U)
+    {
+      /* C(m,n) = A(m,n) * scale */
+
+      /* Scale and store result in destination buffer. */
+      *pOut++ = (*pIn++) * scale;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
 #else
 arm_status arm_mat_scale_f32(
   const arm_matrix_instance_f32 * pSrc,
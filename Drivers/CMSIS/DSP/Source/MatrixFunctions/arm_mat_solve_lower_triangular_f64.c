@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_lower_triangular_f64.c
+ * Description:  Solve a floating-point (64 bit) lower triangular system
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixSolveTri
+  @{
+ */
+
+/**
+  @brief         Solve LT . X = A where LT is a lower triangular matrix.
+  @param[in]     pSrcLt    points to the instance of the lower triangular matrix structure.
+  @param[in]     pSrcA     points to the instance of the right hand side matrix structure.
+  @param[out]    pDst      points to the instance of the solution matrix structure.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : A diagonal element of LT is zero
+
+  @par           In-place
+                   pDst can be the same matrix as pSrcA.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcLt,
+  const arm_matrix_instance_f64 * pSrcA,
+        arm_matrix_instance_f64 * pDst)
+{
+  const float64_t *pLt = pSrcLt->pData;          /* triangular matrix pointer */
+  const float64_t *pA = pSrcA->pData;            /* right hand side pointer */
+        float64_t *pX = pDst->pData;             /* solution pointer */
+  const float64_t *pXk;                          /* known row of X */
+        float64_t *pXi;                          /* row of X being computed */
+        float64_t lik, invDiag;                  /* temporary values */
+        uint32_t n = pSrcLt->numRows;            /* size of the triangular matrix */
+        uint32_t numCols = pSrcA->numCols;       /* number of systems to solve */
+        uint32_t i, j, k;                        /* loop counters */
+        arm_status status;                       /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcLt->numRows != pSrcLt->numCols) ||
+      (pSrcA->numRows != pSrcLt->numRows) ||
+      (pDst->numRows != pSrcA->numRows) ||
+      (pDst->numCols != pSrcA->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Forward substitution :
+       X[i] = (A[i] - sum(LT[i][k] * X[k], k < i)) / LT[i][i] */
+    for (i = 0U; i < n; i++)
+    {
+      pXi = pX + (i * numCols);
+
+      if (pLt[(i * n) + i] == 0.0)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      if (pXi != pA + (i * numCols))
+      {
+        for (j = 0U; j < numCols; j++)
+        {
+          pXi[j] = pA[(i * numCols) + j];
+        }
+      }
+
+      for (k = 0U; k < i; k++)
+      {
+        lik = pLt[(i * n) + k];
+        pXk = pX + (k * numCols);
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        /* Loop unrolling: Update 4 columns at a time */
+        for (j = 0U; (j + 4U) <= numCols; j += 4U)
+        {
+          pXi[j    ] -= lik * pXk[j    ];
+          pXi[j + 1] -= lik * pXk[j + 1];
+          pXi[j + 2] -= lik * pXk[j + 2];
+          pXi[j + 3] -= lik * pXk[j + 3];
+        }
+#else
+        j = 0U;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        for (; j < numCols; j++)
+        {
+          pXi[j] -= lik * pXk[j];
+        }
+      }
+
+      invDiag = 1.0 / pLt[(i * n) + i];
+      for (j = 0U; j < numCols; j++)
+      {
+        pXi[j] *= invDiag;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixSolveTri group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_upper_triangular_f32.c
+ * Description:  Solve a floating-point upper triangular system
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixSolveTri
+  @{
+ */
+
+/**
+  @brief         Solve UT . X = A where UT is an upper triangular matrix.
+  @param[in]     pSrcUt    points to the instance of the upper triangular matrix structure.
+  @param[in]     pSrcA     points to the instance of the right hand side matrix structure.
+  @param[out]    pDst      points to the instance of the solution matrix structure.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : A diagonal element of UT is zero
+
+  @par           In-place
+                   pDst can be the same matrix as pSrcA.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcUt,
+  const arm_matrix_instance_f32 * pSrcA,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pUt = pSrcUt->pData;          /* triangular matrix pointer */
+  const float32_t *pA = pSrcA->pData;            /* right hand side pointer */
+        float32_t *pX = pDst->pData;             /* solution pointer */
+  const float32_t *pXk;                          /* known row of X */
+        float32_t *pXi;                          /* row of X being computed */
+        float32_t uik, invDiag;                  /* temporary values */
+        uint32_t n = pSrcUt->numRows;            /* size of the triangular matrix */
+        uint32_t numCols = pSrcA->numCols;       /* number of systems to solve */
+        uint32_t i, j, k;                        /* loop counters */
+        arm_status status;                       /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcUt->numRows != pSrcUt->numCols) ||
+      (pSrcA->numRows != pSrcUt->numRows) ||
+      (pDst->numRows != pSrcA->numRows) ||
+      (pDst->numCols != pSrcA->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Backward substitution :
+       X[i] = (A[i] - sum(UT[i][k] * X[k], k > i)) / UT[i][i] */
+    for (i = n; i > 0U; )
+    {
+      i--;
+      pXi = pX + (i * numCols);
+
+      if (pUt[(i * n) + i] == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      if (pXi != pA + (i * numCols))
+      {
+        for (j = 0U; j < numCols; j++)
+        {
+          pXi[j] = pA[(i * numCols) + j];
+        }
+      }
+
+      for (k = i + 1U; k < n; k++)
+      {
+        uik = pUt[(i * n) + k];
+        pXk = pX + (k * numCols);
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        /* Loop unrolling: Update 4 columns at a time */
+        for (j = 0U; (j + 4U) <= numCols; j += 4U)
+        {
+          pXi[j    ] -= uik * pXk[j    ];
+          pXi[j + 1] -= uik * pXk[j + 1];
+          pXi[j + 2] -= uik * pXk[j + 2];
+          pXi[j + 3] -= uik * pXk[j + 3];
+        }
+#else
+        j = 0U;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+        for (; j < numCols; j++)
+        {
+          pXi[j] -= uik * pXk[j];
+        }
+      }
+
+      invDiag = 1.0f / pUt[(i * n) + i];
+      for (j = 0U; j < numCols; j++)
+      {
+        pXi[j] *= invDiag;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixSolveTri group
+ */
@@ -140,6 +140,78 @@ arm_status arm_mat_sub_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_X86_SIMD)
+arm_status arm_mat_sub_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+
+  uint32_t numSamples;                           /* total number of elements in the matrix */
+  uint32_t blkCnt;                               /* loop counters */
+  arm_status status;                             /* status of matrix subtraction */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcB->numRows) ||
+      (pSrcA->numCols != pSrcB->numCols) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcA->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Total number of samples in input matrix */
+    numSamples = (uint32_t) pSrcA->numRows * pSrcA->numCols;
+
+    /* Compute ARM_X86_LANES_F32 outputs at a time */
+    blkCnt = numSamples / ARM_X86_LANES_F32;
+
+    while (blkCnt > 0U)
+    {
+      /* C(m,n) = A(m,n) - B(m,n) */
+
+      /* Subtract and store result in destination buffer. */
+      __arm_vec_store_f32_x86(pOut, __arm_vec_sub_f32_x86(__arm_vec_load_f32_x86(pInA), __arm_vec_load_f32_x86(pInB)));
+      pInA += ARM_X86_LANES_F32;
+      pInB += ARM_X86_LANES_F32;
+      pOut += ARM_X86_LANES_F32;
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples % ARM_X86_LANES_F32;
+
+    while (blkCnt > 0U)
+    {
+      /* C(m,n) = A(m,n) - B(m,n) */
+
+      /* Subtract and store result in destination buffer. */
+      *pOut++ = (*pInA++) - (*pInB++);
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
 #else
 arm_status arm_mat_sub_f32(
   const arm_matrix_instance_f32 * pSrcA,
@@ -182,6 +182,80 @@ arm_status arm_mat_trans_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_X86_SIMD)
+arm_status arm_mat_trans_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint16_t nRows = pSrc->numRows;                /* number of rows */
+  uint16_t nCols = pSrc->numCols;                /* number of columns */
+  uint32_t col, row;                             /* Loop counters */
+  __m128 r0, r1, r2, r3;                         /* 4 x 4 tile */
+  arm_status status;                             /* status of matrix transpose */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pDst->numCols) ||
+      (pSrc->numCols != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* The matrix is transposed by 4 x 4 tiles. The transposition is only moving
+       data so the SSE tiles are used for both the SSE2 and the AVX2 builds */
+    for (row = 0U; (row + 4U) <= nRows; row += 4U)
+    {
+      for (col = 0U; (col + 4U) <= nCols; col += 4U)
+      {
+        r0 = _mm_loadu_ps(&pIn[(row     ) * nCols + col]);
+        r1 = _mm_loadu_ps(&pIn[(row + 1U) * nCols + col]);
+        r2 = _mm_loadu_ps(&pIn[(row + 2U) * nCols + col]);
+        r3 = _mm_loadu_ps(&pIn[(row + 3U) * nCols + col]);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_storeu_ps(&pOut[(col     ) * nRows + row], r0);
+        _mm_storeu_ps(&pOut[(col + 1U) * nRows + row], r1);
+        _mm_storeu_ps(&pOut[(col + 2U) * nRows + row], r2);
+        _mm_storeu_ps(&pOut[(col + 3U) * nRows + row], r3);
+      }
+
+      /* Remaining columns of the 4 rows */
+      for (; col < nCols; col++)
+      {
+        pOut[col * nRows + row     ] = pIn[(row     ) * nCols + col];
+        pOut[col * nRows + row + 1U] = pIn[(row + 1U) * nCols + col];
+        pOut[col * nRows + row + 2U] = pIn[(row + 2U) * nCols + col];
+        pOut[col * nRows + row + 3U] = pIn[(row + 3U) * nCols + col];
+      }
+    }
+
+    /* Remaining rows */
+    for (; row < nRows; row++)
+    {
+      for (col = 0U; col < nCols; col++)
+      {
+        /* Read and store input element in destination */
+        pOut[col * nRows + row] = pIn[row * nCols + col];
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
 #else
 arm_status arm_mat_trans_f32(
   const arm_matrix_instance_f32 * pSrc,
@@ -45,6 +45,9 @@
 #include "arm_rms_f32.c"
 #include "arm_rms_q15.c"
 #include "arm_rms_q31.c"
+#include "arm_stats_f32.c"
+#include "arm_stats_q15.c"
+#include "arm_stats_q31.c"
 #include "arm_std_f32.c"
 #include "arm_std_q15.c"
 #include "arm_std_q31.c"
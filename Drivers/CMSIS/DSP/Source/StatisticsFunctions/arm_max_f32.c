@@ -167,6 +167,106 @@ void arm_max_f32(
   *pResult = out;
   *pIndex = outIndex;
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_max_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult,
+  uint32_t * pIndex)
+{
+  float32_t maxVal, out;                            /* Temporary variables to store the output value. */
+  uint32_t blkCnt, outIndex, i;                  /* loop counter */
+
+  arm_x86_f32v_t outV, srcV, maskV;
+  arm_x86_u32v_t idxV, countV, deltaV;
+  float32_t outLanes[ARM_X86_LANES_F32];
+  uint32_t countLanes[ARM_X86_LANES_F32];
+
+  /* Initialise the index value to zero. */
+  outIndex = 0U;
+
+  if (blockSize < 2U * ARM_X86_LANES_F32)
+  {
+    /* Load first input value that act as reference value for comparison */
+    out = *pSrc++;
+
+    blkCnt = blockSize - 1U;
+  }
+  else
+  {
+    /* Each lane tracks the maximum of its own samples and the index of its first occurrence */
+    for (i = 0U; i < ARM_X86_LANES_F32; i++)
+    {
+      countLanes[i] = i;
+    }
+
+    outV = __arm_vec_load_f32_x86(pSrc);
+    pSrc += ARM_X86_LANES_F32;
+
+    countV = __arm_vec_load_u32_x86(countLanes);
+    deltaV = __arm_vec_dup_u32_x86(ARM_X86_LANES_F32);
+    idxV = __arm_vec_add_u32_x86(countV, deltaV);
+
+    /* Compute ARM_X86_LANES_F32 outputs at a time */
+    blkCnt = (blockSize - ARM_X86_LANES_F32) / ARM_X86_LANES_F32;
+
+    while (blkCnt > 0U)
+    {
+      srcV = __arm_vec_load_f32_x86(pSrc);
+      pSrc += ARM_X86_LANES_F32;
+
+      maskV = __arm_vec_cmpgt_f32_x86(srcV, outV);
+      outV = __arm_vec_select_f32_x86(maskV, srcV, outV);
+      countV = __arm_vec_select_u32_x86(maskV, idxV, countV);
+
+      idxV = __arm_vec_add_u32_x86(idxV, deltaV);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    __arm_vec_store_f32_x86(outLanes, outV);
+    __arm_vec_store_u32_x86(countLanes, countV);
+
+    /* Reduce the lanes : on equal values the smallest index is kept */
+    out = outLanes[0];
+    outIndex = countLanes[0];
+
+    for (i = 1U; i < ARM_X86_LANES_F32; i++)
+    {
+      if ((outLanes[i] > out) || ((outLanes[i] == out) && (countLanes[i] < outIndex)))
+      {
+        out = outLanes[i];
+        outIndex = countLanes[i];
+      }
+    }
+
+    /* if (blockSize - ARM_X86_LANES_F32) is not multiple of ARM_X86_LANES_F32 */
+    blkCnt = (blockSize - ARM_X86_LANES_F32) % ARM_X86_LANES_F32;
+  }
+
+  while (blkCnt > 0U)
+  {
+    /* Initialize maxVal to the next consecutive values one by one */
+    maxVal = *pSrc++;
+
+    /* compare for the maximum value */
+    if (maxVal > out)
+    {
+      /* Update the maximum value and it's index */
+      out = maxVal;
+      outIndex = blockSize - blkCnt;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the maximum value and it's index into destination pointers */
+  *pResult = out;
+  *pIndex = outIndex;
+}
+
 #else
 void arm_max_f32(
   const float32_t * pSrc,
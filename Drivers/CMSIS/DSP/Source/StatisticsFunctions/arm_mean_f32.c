@@ -107,6 +107,50 @@ void arm_mean_f32(
   /* Store the result to the destination */
   *pResult = sum / (float32_t) blockSize;
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_mean_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t sum;                                 /* Temporary result storage */
+        arm_x86_f32v_t sumV;                           /* Vector accumulator */
+
+  sumV = __arm_vec_dup_f32_x86(0.0f);
+
+  /* Compute ARM_X86_LANES_F32 partial sums at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A[0] + A[1] + A[2] + ... + A[blockSize-1]) */
+    sumV = __arm_vec_add_f32_x86(sumV, __arm_vec_load_f32_x86(pSrc));
+    pSrc += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  sum = __arm_vec_hsum_f32_x86(sumV);
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (A[0] + A[1] + A[2] + ... + A[blockSize-1]) */
+    sum += *pSrc++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* C = (A[0] + A[1] + A[2] + ... + A[blockSize-1]) / blockSize  */
+  /* Store result to destination */
+  *pResult = (sum / blockSize);
+}
+
 #else
 void arm_mean_f32(
   const float32_t * pSrc,
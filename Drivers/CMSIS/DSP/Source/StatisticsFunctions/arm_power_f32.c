@@ -107,6 +107,52 @@ void arm_power_f32(
   /* Store the result to the destination */
   *pResult = sum;
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_power_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t sum;                                 /* Temporary result storage */
+        float32_t in;                                  /* Temporary variable to store input value */
+        arm_x86_f32v_t inV, sumV;                      /* Vector input and accumulator */
+
+  sumV = __arm_vec_dup_f32_x86(0.0f);
+
+  /* Compute ARM_X86_LANES_F32 partial sums at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    inV = __arm_vec_load_f32_x86(pSrc);
+    sumV = __arm_vec_mla_f32_x86(sumV, inV, inV);
+    pSrc += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  sum = __arm_vec_hsum_f32_x86(sumV);
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    in = *pSrc++;
+    sum += in * in;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store result to destination */
+  *pResult = sum;
+}
+
 #else
 void arm_power_f32(
   const float32_t * pSrc,
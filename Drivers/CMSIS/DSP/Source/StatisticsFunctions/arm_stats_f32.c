@@ -0,0 +1,440 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_f32.c
+ * Description:  Mean, variance, RMS, minimum and maximum of a floating-point vector
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup Stats Statistics in one pass
+
+  Computes the mean, the variance, the RMS value, the minimum and the maximum
+  (with their positions) of an array of data while reading it only once.
+  The results are the ones of \ref arm_mean_f32, \ref arm_var_f32, \ref arm_rms_f32,
+  \ref arm_min_f32 and \ref arm_max_f32 called on the same array, but the memory
+  traffic is divided by five.
+
+  The floating-point variance is computed with the Welford update:
+  <pre>
+      delta = x[n] - mean
+      mean  = mean + delta / (n + 1)
+      M2    = M2 + delta * (x[n] - mean)
+
+      Result = M2 / (blockSize - 1)
+  </pre>
+  which is not losing precision when the mean is large compared to the standard deviation.
+  The vector versions are updating one mean and one M2 per lane and the lanes
+  are merged at the end (Chan et al.):
+  <pre>
+      mean = (mean[0] + ... + mean[L-1]) / L
+      M2   = M2[0] + ... + M2[L-1] + n * ((mean[0] - mean)^2 + ... + (mean[L-1] - mean)^2)
+  </pre>
+  where n is the number of samples of each lane.
+
+  The fixed-point sums are exact, so the fixed-point functions are bit exact with
+  the separate functions.
+
+  There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+  @addtogroup Stats
+  @{
+ */
+
+#if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD) || defined(ARM_MATH_LOOPUNROLL)
+/* Merge nbLanes partial statistics of laneCount samples each */
+static void arm_stats_merge_lanes_f32(
+  const float32_t * pMean,
+  const float32_t * pM2,
+        uint32_t nbLanes,
+        float32_t laneCount,
+        float32_t * pResMean,
+        float32_t * pResM2)
+{
+  float32_t mean = 0.0f, m2 = 0.0f, delta, sqDev = 0.0f;
+  uint32_t i;
+
+  for (i = 0U; i < nbLanes; i++)
+  {
+    mean += pMean[i];
+    m2 += pM2[i];
+  }
+  mean = mean / (float32_t) nbLanes;
+
+  for (i = 0U; i < nbLanes; i++)
+  {
+    delta = pMean[i] - mean;
+    sqDev += delta * delta;
+  }
+
+  *pResMean = mean;
+  *pResM2 = m2 + laneCount * sqDev;
+}
+#endif
+
+#if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD)
+/* Reduce the minimum and maximum of nbLanes lanes : on equal values the smallest index is kept */
+static void arm_stats_min_max_lanes_f32(
+  const float32_t * pMin,
+  const uint32_t * pMinIndex,
+  const float32_t * pMax,
+  const uint32_t * pMaxIndex,
+        uint32_t nbLanes,
+        arm_stats_result_f32 * pResult)
+{
+  uint32_t i;
+
+  pResult->min = pMin[0];
+  pResult->minIndex = pMinIndex[0];
+  pResult->max = pMax[0];
+  pResult->maxIndex = pMaxIndex[0];
+
+  for (i = 1U; i < nbLanes; i++)
+  {
+    if ((pMin[i] < pResult->min) || ((pMin[i] == pResult->min) && (pMinIndex[i] < pResult->minIndex)))
+    {
+      pResult->min = pMin[i];
+      pResult->minIndex = pMinIndex[i];
+    }
+
+    if ((pMax[i] > pResult->max) || ((pMax[i] == pResult->max) && (pMaxIndex[i] < pResult->maxIndex)))
+    {
+      pResult->max = pMax[i];
+      pResult->maxIndex = pMaxIndex[i];
+    }
+  }
+}
+#endif
+
+/**
+  @brief         Mean, variance, RMS, minimum and maximum of a floating-point vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    statistics returned here
+  @return        none
+
+  @par
+                   The variance is 0 when blockSize is 1 and all the results are 0
+                   when blockSize is 0.
+ */
+void arm_stats_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_f32 * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t count = 0.0f;                        /* Number of samples in mean and m2 */
+        float32_t mean = 0.0f;                         /* Running mean */
+        float32_t m2 = 0.0f;                           /* Running sum of the squared deviations */
+        float32_t sumsq = 0.0f;                        /* Sum of squares */
+        float32_t in, delta;
+
+  if (blockSize == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  pResult->min = *pSrc;
+  pResult->minIndex = 0U;
+  pResult->max = *pSrc;
+  pResult->maxIndex = 0U;
+
+#if defined(ARM_MATH_NEON)
+  if (blockSize >= 8U)
+  {
+    float32x4_t inV, deltaV, meanV, m2V, sumsqV, minV, maxV;
+    uint32x4_t maskV;
+    uint32x4_t minIdxV = {0,1,2,3};
+    uint32x4_t maxIdxV = {0,1,2,3};
+    uint32x4_t idxV = {4,5,6,7};
+    uint32x4_t deltaIdxV = {4,4,4,4};
+    float32_t laneMean[4], laneM2[4], laneMin[4], laneMax[4];
+    uint32_t laneMinIdx[4], laneMaxIdx[4];
+
+    /* The first samples initialize the statistics of each lane */
+    inV = vld1q_f32(pSrc);
+    pSrc += 4;
+
+    meanV = inV;
+    m2V = vdupq_n_f32(0.0f);
+    sumsqV = vmulq_f32(inV, inV);
+    minV = inV;
+    maxV = inV;
+    count = 1.0f;
+
+    /* Compute 4 samples at a time */
+    blkCnt = (blockSize >> 2U) - 1U;
+
+    while (blkCnt > 0U)
+    {
+      inV = vld1q_f32(pSrc);
+      pSrc += 4;
+
+      /* Welford update of each lane */
+      count += 1.0f;
+      deltaV = vsubq_f32(inV, meanV);
+      meanV = vmlaq_n_f32(meanV, deltaV, 1.0f / count);
+      m2V = vmlaq_f32(m2V, deltaV, vsubq_f32(inV, meanV));
+      sumsqV = vmlaq_f32(sumsqV, inV, inV);
+
+      maskV = vcltq_f32(inV, minV);
+      minV = vbslq_f32(maskV, inV, minV);
+      minIdxV = vbslq_u32(maskV, idxV, minIdxV);
+
+      maskV = vcgtq_f32(inV, maxV);
+      maxV = vbslq_f32(maskV, inV, maxV);
+      maxIdxV = vbslq_u32(maskV, idxV, maxIdxV);
+
+      idxV = vaddq_u32(idxV, deltaIdxV);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    vst1q_f32(laneMean, meanV);
+    vst1q_f32(laneM2, m2V);
+    vst1q_f32(laneMin, minV);
+    vst1q_f32(laneMax, maxV);
+    vst1q_u32(laneMinIdx, minIdxV);
+    vst1q_u32(laneMaxIdx, maxIdxV);
+
+    arm_stats_merge_lanes_f32(laneMean, laneM2, 4U, count, &mean, &m2);
+    arm_stats_min_max_lanes_f32(laneMin, laneMinIdx, laneMax, laneMaxIdx, 4U, pResult);
+
+    sumsq = vgetq_lane_f32(sumsqV, 0) + vgetq_lane_f32(sumsqV, 1)
+          + vgetq_lane_f32(sumsqV, 2) + vgetq_lane_f32(sumsqV, 3);
+    count = count * 4.0f;
+
+    /* If the blockSize is not a multiple of 4, compute any remaining samples here. */
+    blkCnt = blockSize % 0x4U;
+  }
+
+#elif defined(ARM_MATH_X86_SIMD)
+  if (blockSize >= 2U * ARM_X86_LANES_F32)
+  {
+    arm_x86_f32v_t inV, deltaV, meanV, m2V, sumsqV, minV, maxV, maskV;
+    arm_x86_u32v_t idxV, minIdxV, maxIdxV, deltaIdxV;
+    float32_t laneMean[ARM_X86_LANES_F32], laneM2[ARM_X86_LANES_F32];
+    float32_t laneMin[ARM_X86_LANES_F32], laneMax[ARM_X86_LANES_F32];
+    uint32_t laneMinIdx[ARM_X86_LANES_F32], laneMaxIdx[ARM_X86_LANES_F32];
+    uint32_t i;
+
+    for (i = 0U; i < ARM_X86_LANES_F32; i++)
+    {
+      laneMinIdx[i] = i;
+    }
+
+    /* The first samples initialize the statistics of each lane */
+    inV = __arm_vec_load_f32_x86(pSrc);
+    pSrc += ARM_X86_LANES_F32;
+
+    meanV = inV;
+    m2V = __arm_vec_dup_f32_x86(0.0f);
+    sumsqV = __arm_vec_mul_f32_x86(inV, inV);
+    minV = inV;
+    maxV = inV;
+    count = 1.0f;
+
+    minIdxV = __arm_vec_load_u32_x86(laneMinIdx);
+    maxIdxV = minIdxV;
+    deltaIdxV = __arm_vec_dup_u32_x86(ARM_X86_LANES_F32);
+    idxV = __arm_vec_add_u32_x86(minIdxV, deltaIdxV);
+
+    /* Compute ARM_X86_LANES_F32 samples at a time */
+    blkCnt = (blockSize / ARM_X86_LANES_F32) - 1U;
+
+    while (blkCnt > 0U)
+    {
+      inV = __arm_vec_load_f32_x86(pSrc);
+      pSrc += ARM_X86_LANES_F32;
+
+      /* Welford update of each lane */
+      count += 1.0f;
+      deltaV = __arm_vec_sub_f32_x86(inV, meanV);
+      meanV = __arm_vec_mla_f32_x86(meanV, deltaV, __arm_vec_dup_f32_x86(1.0f / count));
+      m2V = __arm_vec_mla_f32_x86(m2V, deltaV, __arm_vec_sub_f32_x86(inV, meanV));
+      sumsqV = __arm_vec_mla_f32_x86(sumsqV, inV, inV);
+
+      maskV = __arm_vec_cmplt_f32_x86(inV, minV);
+      minV = __arm_vec_select_f32_x86(maskV, inV, minV);
+      minIdxV = __arm_vec_select_u32_x86(maskV, idxV, minIdxV);
+
+      maskV = __arm_vec_cmpgt_f32_x86(inV, maxV);
+      maxV = __arm_vec_select_f32_x86(maskV, inV, maxV);
+      maxIdxV = __arm_vec_select_u32_x86(maskV, idxV, maxIdxV);
+
+      idxV = __arm_vec_add_u32_x86(idxV, deltaIdxV);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    __arm_vec_store_f32_x86(laneMean, meanV);
+    __arm_vec_store_f32_x86(laneM2, m2V);
+    __arm_vec_store_f32_x86(laneMin, minV);
+    __arm_vec_store_f32_x86(laneMax, maxV);
+    __arm_vec_store_u32_x86(laneMinIdx, minIdxV);
+    __arm_vec_store_u32_x86(laneMaxIdx, maxIdxV);
+
+    arm_stats_merge_lanes_f32(laneMean, laneM2, ARM_X86_LANES_F32, count, &mean, &m2);
+    arm_stats_min_max_lanes_f32(laneMin, laneMinIdx, laneMax, laneMaxIdx, ARM_X86_LANES_F32, pResult);
+
+    sumsq = __arm_vec_hsum_f32_x86(sumsqV);
+    count = count * (float32_t) ARM_X86_LANES_F32;
+
+    /* Tail */
+    blkCnt = blockSize % ARM_X86_LANES_F32;
+  }
+
+#elif defined (ARM_MATH_LOOPUNROLL)
+  if (blockSize >= 8U)
+  {
+    float32_t laneMean[4], laneM2[4];
+    float32_t rcp, delta1, delta2, delta3, delta4;
+    uint32_t i;
+
+    /* Each of the 4 unrolled samples updates its own running mean so that
+       only one division is needed for 4 samples */
+    for (i = 0U; i < 4U; i++)
+    {
+      laneMean[i] = pSrc[i];
+      laneM2[i] = 0.0f;
+      sumsq += pSrc[i] * pSrc[i];
+
+      if (pSrc[i] < pResult->min)
+      {
+        pResult->min = pSrc[i];
+        pResult->minIndex = i;
+      }
+
+      if (pSrc[i] > pResult->max)
+      {
+        pResult->max = pSrc[i];
+        pResult->maxIndex = i;
+      }
+    }
+    pSrc += 4;
+    count = 1.0f;
+
+    /* Loop unrolling: Compute 4 samples at a time */
+    blkCnt = (blockSize >> 2U) - 1U;
+
+    while (blkCnt > 0U)
+    {
+      count += 1.0f;
+      rcp = 1.0f / count;
+
+      delta1 = pSrc[0] - laneMean[0];
+      delta2 = pSrc[1] - laneMean[1];
+      delta3 = pSrc[2] - laneMean[2];
+      delta4 = pSrc[3] - laneMean[3];
+
+      laneMean[0] += delta1 * rcp;
+      laneMean[1] += delta2 * rcp;
+      laneMean[2] += delta3 * rcp;
+      laneMean[3] += delta4 * rcp;
+
+      laneM2[0] += delta1 * (pSrc[0] - laneMean[0]);
+      laneM2[1] += delta2 * (pSrc[1] - laneMean[1]);
+      laneM2[2] += delta3 * (pSrc[2] - laneMean[2]);
+      laneM2[3] += delta4 * (pSrc[3] - laneMean[3]);
+
+      for (i = 0U; i < 4U; i++)
+      {
+        in = *pSrc++;
+        sumsq += in * in;
+
+        if (in < pResult->min)
+        {
+          pResult->min = in;
+          pResult->minIndex = ((blockSize >> 2U) - blkCnt) * 4U + i;
+        }
+
+        if (in > pResult->max)
+        {
+          pResult->max = in;
+          pResult->maxIndex = ((blockSize >> 2U) - blkCnt) * 4U + i;
+        }
+      }
+
+      /* Decrement loop counter */
+      blkCnt--;
+    }
+
+    arm_stats_merge_lanes_f32(laneMean, laneM2, 4U, count, &mean, &m2);
+    count = count * 4.0f;
+
+    /* Loop unrolling: Compute remaining samples */
+    blkCnt = blockSize % 0x4U;
+  }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Welford update */
+    count += 1.0f;
+    delta = in - mean;
+    mean += delta / count;
+    m2 += delta * (in - mean);
+    sumsq += in * in;
+
+    /* The first sample is compared with itself when blkCnt == blockSize */
+    if (in < pResult->min)
+    {
+      pResult->min = in;
+      pResult->minIndex = blockSize - blkCnt;
+    }
+
+    if (in > pResult->max)
+    {
+      pResult->max = in;
+      pResult->maxIndex = blockSize - blkCnt;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  pResult->mean = mean;
+  pResult->var = (blockSize > 1U) ? m2 / (float32_t) (blockSize - 1U) : 0.0f;
+  arm_sqrt_f32(sumsq / (float32_t) blockSize, &pResult->rms);
+}
+
+/**
+  @} end of Stats group
+ */
@@ -0,0 +1,292 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q15.c
+ * Description:  Mean, variance, RMS, minimum and maximum of a Q15 vector
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Stats
+  @{
+ */
+
+/* Update the minimum and the maximum with the sample at position index */
+__STATIC_FORCEINLINE void arm_stats_min_max_q15(
+  q15_t in,
+  uint32_t index,
+  arm_stats_result_q15 * pResult)
+{
+  if (in < pResult->min)
+  {
+    pResult->min = in;
+    pResult->minIndex = index;
+  }
+
+  if (in > pResult->max)
+  {
+    pResult->max = in;
+    pResult->maxIndex = index;
+  }
+}
+
+/**
+  @brief         Mean, variance, RMS, minimum and maximum of a Q15 vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    statistics returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The results are bit exact with the ones of \ref arm_mean_q15, \ref arm_var_q15,
+                   \ref arm_rms_q15, \ref arm_min_q15 and \ref arm_max_q15 and have the same
+                   scaling and overflow behavior.
+                   The sum of the samples is computed in a 32-bit accumulator and the sum of
+                   squares in a 64-bit accumulator, in 2.30 format.
+  @par
+                   The variance is 0 when blockSize is 1 and all the results are 0
+                   when blockSize is 0.
+ */
+void arm_stats_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_q15 * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t index = 0U;                           /* Index of the current sample */
+        q31_t sum = 0;                                 /* Sum of the samples */
+        q63_t sumOfSquares = 0;                        /* Sum of squares */
+        q31_t meanOfSquares, squareOfMean;             /* Mean of squares and square of mean */
+        q15_t in;                                      /* Temporary variable to store input value */
+
+#if defined (ARM_MATH_LOOPUNROLL) && defined (ARM_MATH_DSP) && !defined (ARM_MATH_X86_SIMD)
+        q31_t in32;                                    /* Temporary variable to store input value */
+#endif
+
+  if (blockSize == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q15));
+    return;
+  }
+
+  pResult->min = *pSrc;
+  pResult->minIndex = 0U;
+  pResult->max = *pSrc;
+  pResult->maxIndex = 0U;
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#if defined(ARM_MATH_X86_SIMD)
+  if (blockSize >= ARM_X86_LANES_Q15)
+  {
+    arm_x86_q63v_t sumOfSquaresV = __arm_vec_zero_q63_x86();
+    arm_x86_u32v_t inV, sumV, idxV, minIdxV, maxIdxV, deltaIdxV;
+    arm_x86_f32v_t inF, minV, maxV, maskV;
+    uint32_t laneSum[ARM_X86_LANES_F32], laneMinIdx[ARM_X86_LANES_F32], laneMaxIdx[ARM_X86_LANES_F32];
+    float32_t laneMin[ARM_X86_LANES_F32], laneMax[ARM_X86_LANES_F32];
+    uint32_t i, usum = 0U;
+
+    /* The q15 values are exactly represented in floating-point, so the comparisons
+       are done in floating-point. All the lanes start from the first sample. */
+    for (i = 0U; i < ARM_X86_LANES_F32; i++)
+    {
+      laneMinIdx[i] = i;
+    }
+
+    idxV = __arm_vec_load_u32_x86(laneMinIdx);
+    deltaIdxV = __arm_vec_dup_u32_x86(ARM_X86_LANES_F32);
+    sumV = __arm_vec_dup_u32_x86(0U);
+    minIdxV = sumV;
+    maxIdxV = sumV;
+    minV = __arm_vec_dup_f32_x86((float32_t) *pSrc);
+    maxV = minV;
+
+    /* Compute ARM_X86_LANES_Q15 samples at a time */
+    blkCnt = blockSize / ARM_X86_LANES_Q15;
+
+    while (blkCnt > 0U)
+    {
+      /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+      sumOfSquaresV = __arm_vec_mlald_q15_x86(sumOfSquaresV, pSrc, pSrc);
+
+      /* C = A[0] + A[1] + ... + A[blockSize-1] */
+      inV = __arm_vec_load_s16_x86(pSrc);
+      pSrc += ARM_X86_LANES_F32;
+      sumV = __arm_vec_add_u32_x86(sumV, inV);
+
+      inF = __arm_vec_cvt_f32_s32_x86(inV);
+      maskV = __arm_vec_cmplt_f32_x86(inF, minV);
+      minV = __arm_vec_select_f32_x86(maskV, inF, minV);
+      minIdxV = __arm_vec_select_u32_x86(maskV, idxV, minIdxV);
+      maskV = __arm_vec_cmpgt_f32_x86(inF, maxV);
+      maxV = __arm_vec_select_f32_x86(maskV, inF, maxV);
+      maxIdxV = __arm_vec_select_u32_x86(maskV, idxV, maxIdxV);
+      idxV = __arm_vec_add_u32_x86(idxV, deltaIdxV);
+
+      inV = __arm_vec_load_s16_x86(pSrc);
+      pSrc += ARM_X86_LANES_F32;
+      sumV = __arm_vec_add_u32_x86(sumV, inV);
+
+      inF = __arm_vec_cvt_f32_s32_x86(inV);
+      maskV = __arm_vec_cmplt_f32_x86(inF, minV);
+      minV = __arm_vec_select_f32_x86(maskV, inF, minV);
+      minIdxV = __arm_vec_select_u32_x86(maskV, idxV, minIdxV);
+      maskV = __arm_vec_cmpgt_f32_x86(inF, maxV);
+      maxV = __arm_vec_select_f32_x86(maskV, inF, maxV);
+      maxIdxV = __arm_vec_select_u32_x86(maskV, idxV, maxIdxV);
+      idxV = __arm_vec_add_u32_x86(idxV, deltaIdxV);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    sumOfSquares = __arm_vec_hsum_q63_x86(sumOfSquaresV);
+
+    __arm_vec_store_u32_x86(laneSum, sumV);
+    __arm_vec_store_f32_x86(laneMin, minV);
+    __arm_vec_store_f32_x86(laneMax, maxV);
+    __arm_vec_store_u32_x86(laneMinIdx, minIdxV);
+    __arm_vec_store_u32_x86(laneMaxIdx, maxIdxV);
+
+    /* Reduce the lanes : on equal values the smallest index is kept */
+    for (i = 0U; i < ARM_X86_LANES_F32; i++)
+    {
+      usum += laneSum[i];
+
+      if (((q15_t) laneMin[i] < pResult->min) || (((q15_t) laneMin[i] == pResult->min) && (laneMinIdx[i] < pResult->minIndex)))
+      {
+        pResult->min = (q15_t) laneMin[i];
+        pResult->minIndex = laneMinIdx[i];
+      }
+
+      if (((q15_t) laneMax[i] > pResult->max) || (((q15_t) laneMax[i] == pResult->max) && (laneMaxIdx[i] < pResult->maxIndex)))
+      {
+        pResult->max = (q15_t) laneMax[i];
+        pResult->maxIndex = laneMaxIdx[i];
+      }
+    }
+    sum = (q31_t) usum;
+
+    /* Tail */
+    blkCnt = blockSize % ARM_X86_LANES_Q15;
+    index = blockSize - blkCnt;
+  }
+
+#elif defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 samples at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    /* C = A[0] + A[1] + ... + A[blockSize-1] */
+
+#if defined (ARM_MATH_DSP)
+    in32 = read_q15x2_ia ((q15_t **) &pSrc);
+    sumOfSquares = __SMLALD(in32, in32, sumOfSquares);
+    sum += ((in32 << 16U) >> 16U);
+    sum +=  (in32 >> 16U);
+    arm_stats_min_max_q15(pSrc[-2], index++, pResult);
+    arm_stats_min_max_q15(pSrc[-1], index++, pResult);
+
+    in32 = read_q15x2_ia ((q15_t **) &pSrc);
+    sumOfSquares = __SMLALD(in32, in32, sumOfSquares);
+    sum += ((in32 << 16U) >> 16U);
+    sum +=  (in32 >> 16U);
+    arm_stats_min_max_q15(pSrc[-2], index++, pResult);
+    arm_stats_min_max_q15(pSrc[-1], index++, pResult);
+#else
+    in = *pSrc++;
+    sumOfSquares += (in * in);
+    sum += in;
+    arm_stats_min_max_q15(in, index++, pResult);
+
+    in = *pSrc++;
+    sumOfSquares += (in * in);
+    sum += in;
+    arm_stats_min_max_q15(in, index++, pResult);
+
+    in = *pSrc++;
+    sumOfSquares += (in * in);
+    sum += in;
+    arm_stats_min_max_q15(in, index++, pResult);
+
+    in = *pSrc++;
+    sumOfSquares += (in * in);
+    sum += in;
+    arm_stats_min_max_q15(in, index++, pResult);
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining samples */
+  blkCnt = blockSize % 0x4U;
+
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    /* C = A[0] + A[1] + ... + A[blockSize-1] */
+
+    in = *pSrc++;
+    sumOfSquares += ((q31_t) in * in);
+    sum += in;
+    arm_stats_min_max_q15(in, index++, pResult);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Mean */
+  pResult->mean = (q15_t) (sum / (int32_t) blockSize);
+
+  /* Variance : mean of squares minus the square of mean */
+  if (blockSize > 1U)
+  {
+    meanOfSquares = (q31_t) (sumOfSquares / (q63_t)(blockSize - 1U));
+    squareOfMean = (q31_t) ((q63_t) sum * sum / (q63_t)(blockSize * (blockSize - 1U)));
+    pResult->var = (meanOfSquares - squareOfMean) >> 15U;
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+
+  /* RMS : truncate and saturate the accumulator to 1.15 format */
+  arm_sqrt_q15(__SSAT((sumOfSquares / (q63_t)blockSize) >> 15, 16), &pResult->rms);
+}
+
+/**
+  @} end of Stats group
+ */
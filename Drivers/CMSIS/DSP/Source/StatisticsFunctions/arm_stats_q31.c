@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q31.c
+ * Description:  Mean, variance, RMS, minimum and maximum of a Q31 vector
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Stats
+  @{
+ */
+
+/* Update the minimum and the maximum with the sample at position index */
+__STATIC_FORCEINLINE void arm_stats_min_max_q31(
+  q31_t in,
+  uint32_t index,
+  arm_stats_result_q31 * pResult)
+{
+  if (in < pResult->min)
+  {
+    pResult->min = in;
+    pResult->minIndex = index;
+  }
+
+  if (in > pResult->max)
+  {
+    pResult->max = in;
+    pResult->maxIndex = index;
+  }
+}
+
+/**
+  @brief         Mean, variance, RMS, minimum and maximum of a Q31 vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    statistics returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The results are bit exact with the ones of \ref arm_mean_q31, \ref arm_var_q31,
+                   \ref arm_rms_q31, \ref arm_min_q31 and \ref arm_max_q31 and have the same
+                   scaling and overflow behavior.
+                   The mean, the variance and the RMS value are computed from 4 internal 64-bit
+                   accumulators: sum and sum of squares of the input in 1.31 format, and sum and
+                   sum of squares of the input downshifted by 8 bits for the variance.
+  @par
+                   The variance is 0 when blockSize is 1 and all the results are 0
+                   when blockSize is 0.
+ */
+void arm_stats_q31(
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_result_q31 * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        uint32_t index = 0U;                           /* Index of the current sample */
+        q63_t sum = 0;                                 /* Sum of the samples */
+        uint64_t sumOfSquares = 0;                     /* Sum of squares (can never be negative) */
+        q63_t sumVar = 0;                              /* Sum of the downshifted samples */
+        q63_t sumOfSquaresVar = 0;                     /* Sum of squares of the downshifted samples */
+        q63_t meanOfSquares, squareOfMean;             /* Mean of squares and square of mean */
+        q31_t in, inVar;                               /* Temporary variables to store input value */
+
+  if (blockSize == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_q31));
+    return;
+  }
+
+  pResult->min = *pSrc;
+  pResult->minIndex = 0U;
+  pResult->max = *pSrc;
+  pResult->maxIndex = 0U;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 samples at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] + A[1] + ... + A[blockSize-1] */
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in);
+    inVar = in >> 8U;
+    sumVar += inVar;
+    sumOfSquaresVar += ((q63_t) inVar * inVar);
+    arm_stats_min_max_q31(in, index++, pResult);
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in);
+    inVar = in >> 8U;
+    sumVar += inVar;
+    sumOfSquaresVar += ((q63_t) inVar * inVar);
+    arm_stats_min_max_q31(in, index++, pResult);
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in);
+    inVar = in >> 8U;
+    sumVar += inVar;
+    sumOfSquaresVar += ((q63_t) inVar * inVar);
+    arm_stats_min_max_q31(in, index++, pResult);
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in);
+    inVar = in >> 8U;
+    sumVar += inVar;
+    sumOfSquaresVar += ((q63_t) inVar * inVar);
+    arm_stats_min_max_q31(in, index++, pResult);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining samples */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] + A[1] + ... + A[blockSize-1] */
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in);
+    inVar = in >> 8U;
+    sumVar += inVar;
+    sumOfSquaresVar += ((q63_t) inVar * inVar);
+    arm_stats_min_max_q31(in, index++, pResult);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Mean */
+  pResult->mean = (q31_t) (sum / blockSize);
+
+  /* Variance : the 18.46 mean of squares minus square of mean is right shifted by 15 bits to yield a 1.31 format value */
+  if (blockSize > 1U)
+  {
+    meanOfSquares = (sumOfSquaresVar / (q63_t)(blockSize - 1U));
+    squareOfMean = ( sumVar * sumVar / (q63_t)(blockSize * (blockSize - 1U)));
+    pResult->var = (meanOfSquares - squareOfMean) >> 15U;
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+
+  /* RMS : convert data in 2.62 to 1.31 by 31 right shifts and saturate */
+  arm_sqrt_q31(clip_q63_to_q31((sumOfSquares / (q63_t) blockSize) >> 31), &pResult->rms);
+}
+
+/**
+  @} end of Stats group
+ */
@@ -60,7 +60,7 @@
   @param[out]    pResult    standard deviation value returned here
   @return        none
  */
-#if defined(ARM_MATH_NEON_EXPERIMENTAL)
+#if defined(ARM_MATH_NEON_EXPERIMENTAL) || defined(ARM_MATH_X86_SIMD)
 void arm_std_f32(
   const float32_t * pSrc,
         uint32_t blockSize,
@@ -181,7 +181,7 @@ void arm_std_f32(
 #endif /* #ifndef ARM_MATH_CM0_FAMILY */
 
 }
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_NEON_EXPERIMENTAL) || defined(ARM_MATH_X86_SIMD) */
 
 /**
   @} end of STD group
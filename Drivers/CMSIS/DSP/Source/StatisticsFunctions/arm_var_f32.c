@@ -120,6 +120,59 @@ void arm_var_f32(
 
 }
 
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_var_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t fSum;
+        float32_t fMean, fValue;
+        arm_x86_f32v_t meanV, diffV, sumV;
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  arm_mean_f32(pSrc, blockSize, &fMean);
+
+  meanV = __arm_vec_dup_f32_x86(fMean);
+  sumV = __arm_vec_dup_f32_x86(0.0f);
+
+  /* Compute ARM_X86_LANES_F32 partial sums at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    diffV = __arm_vec_sub_f32_x86(__arm_vec_load_f32_x86(pSrc), meanV);
+    sumV = __arm_vec_mla_f32_x86(sumV, diffV, diffV);
+    pSrc += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  fSum = __arm_vec_hsum_f32_x86(sumV);
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    fValue = *pSrc++ - fMean;
+    fSum += fValue * fValue;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Variance */
+  *pResult = fSum / (float32_t)(blockSize - 1.0f);
+}
+
 #else
 void arm_var_f32(
   const float32_t * pSrc,
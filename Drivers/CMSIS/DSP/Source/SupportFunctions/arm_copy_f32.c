@@ -98,6 +98,45 @@ void arm_copy_f32(
     blkCnt--;
   }
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_copy_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[n] */
+
+    /* Copy and store result in destination buffer */
+    __arm_vec_store_f32_x86(pDst, __arm_vec_load_f32_x86(pSrc));
+    pSrc += ARM_X86_LANES_F32;
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[n] */
+
+    /* Copy and store result in destination buffer */
+    *pDst++ = *pSrc++;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
 #else
 void arm_copy_f32(
   const float32_t * pSrc,
@@ -149,6 +149,78 @@ void arm_float_to_q15(
     blkCnt--;
   }
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_float_to_q15(
+  const float32_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        arm_x86_f32v_t inV;
+        arm_x86_f32v_t scaleV = __arm_vec_dup_f32_x86(32768.0f);
+        arm_x86_f32v_t minV = __arm_vec_dup_f32_x86(-32768.0f);
+        arm_x86_f32v_t maxV = __arm_vec_dup_f32_x86(32767.0f);
+
+#ifdef ARM_MATH_ROUNDING
+        float32_t in;
+        arm_x86_f32v_t zeroV = __arm_vec_dup_f32_x86(0.0f);
+        arm_x86_f32v_t pHalfV = __arm_vec_dup_f32_x86(0.5f);
+        arm_x86_f32v_t mHalfV = __arm_vec_dup_f32_x86(-0.5f);
+#endif /* #ifdef ARM_MATH_ROUNDING */
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * 32768 */
+    inV = __arm_vec_mul_f32_x86(__arm_vec_load_f32_x86(pIn), scaleV);
+    pIn += ARM_X86_LANES_F32;
+
+#ifdef ARM_MATH_ROUNDING
+    inV = __arm_vec_add_f32_x86(inV, __arm_vec_select_f32_x86(__arm_vec_cmpgt_f32_x86(inV, zeroV), pHalfV, mHalfV));
+#endif /* #ifdef ARM_MATH_ROUNDING */
+
+    /* Saturate before the truncation so that the result is the same as the scalar version */
+    inV = __arm_vec_min_f32_x86(__arm_vec_max_f32_x86(inV, minV), maxV);
+
+    /* Convert from float to Q15 and store result in destination buffer */
+    __arm_vec_store_s16_x86(pDst, __arm_vec_cvtt_s32_f32_x86(inV));
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * 32768 */
+
+    /* convert from float to Q15 and store result in destination buffer */
+#ifdef ARM_MATH_ROUNDING
+
+    in = (*pIn++ * 32768.0f);
+    in += in > 0.0f ? 0.5f : -0.5f;
+    *pDst++ = (q15_t) (__SSAT((q31_t) (in), 16));
+
+#else
+
+    /* C = A * 32768 */
+    /* Convert from float to Q15 and then store the results in the destination buffer */
+    *pDst++ = (q15_t) __SSAT((q31_t) (*pIn++ * 32768.0f), 16);
+
+#endif /* #ifdef ARM_MATH_ROUNDING */
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+}
+
 #else
 void arm_float_to_q15(
   const float32_t * pSrc,
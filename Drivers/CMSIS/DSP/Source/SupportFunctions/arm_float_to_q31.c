@@ -155,6 +155,76 @@ void arm_float_to_q31(
 
 
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_float_to_q31(
+  const float32_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        arm_x86_f32v_t inV;
+        arm_x86_f32v_t scaleV = __arm_vec_dup_f32_x86(2147483648.0f);
+        arm_x86_u32v_t maxV = __arm_vec_dup_u32_x86(0x7FFFFFFFU);
+
+#ifdef ARM_MATH_ROUNDING
+        float32_t in;
+        arm_x86_f32v_t zeroV = __arm_vec_dup_f32_x86(0.0f);
+        arm_x86_f32v_t pHalfV = __arm_vec_dup_f32_x86(0.5f);
+        arm_x86_f32v_t mHalfV = __arm_vec_dup_f32_x86(-0.5f);
+#endif /* #ifdef ARM_MATH_ROUNDING */
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * 2147483648 */
+    inV = __arm_vec_mul_f32_x86(__arm_vec_load_f32_x86(pIn), scaleV);
+    pIn += ARM_X86_LANES_F32;
+
+#ifdef ARM_MATH_ROUNDING
+    inV = __arm_vec_add_f32_x86(inV, __arm_vec_select_f32_x86(__arm_vec_cmpgt_f32_x86(inV, zeroV), pHalfV, mHalfV));
+#endif /* #ifdef ARM_MATH_ROUNDING */
+
+    /* The conversion returns 0x80000000 for out of range values : positive ones are saturated to 0x7FFFFFFF */
+    __arm_vec_store_u32_x86((uint32_t *) pDst,
+                            __arm_vec_select_u32_x86(__arm_vec_cmpgt_f32_x86(inV, __arm_vec_dup_f32_x86(2147483520.0f)),
+                                                     maxV, __arm_vec_cvtt_s32_f32_x86(inV)));
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * 2147483648 */
+
+    /* convert from float to Q31 and store result in destination buffer */
+#ifdef ARM_MATH_ROUNDING
+
+    in = (*pIn++ * 2147483648.0f);
+    in += in > 0.0f ? 0.5f : -0.5f;
+    *pDst++ = clip_q63_to_q31((q63_t) (in));
+
+#else
+
+    /* C = A * 2147483648 */
+    /* Convert from float to Q31 and then store the results in the destination buffer */
+    *pDst++ = clip_q63_to_q31((q63_t) (*pIn++ * 2147483648.0f));
+
+#endif /* #ifdef ARM_MATH_ROUNDING */
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+}
+
 #else
 void arm_float_to_q31(
   const float32_t * pSrc,
@@ -102,6 +102,46 @@ void arm_q31_to_float(
     blkCnt--;
   }
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_q31_to_float(
+  const q31_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+  const q31_t *pIn = pSrc;                             /* Source pointer */
+        arm_x86_f32v_t scaleV = __arm_vec_dup_f32_x86(1.0f / 2147483648.0f);
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (float32_t) A / 2147483648 */
+    /* Convert from q31 to float and store result in destination buffer */
+    __arm_vec_store_f32_x86(pDst, __arm_vec_mul_f32_x86(__arm_vec_cvt_f32_s32_x86(__arm_vec_load_u32_x86((const uint32_t *) pIn)), scaleV));
+    pIn += ARM_X86_LANES_F32;
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (float32_t) A / 2147483648 */
+
+    /* Convert from q31 to float and store result in destination buffer */
+    *pDst++ = ((float32_t) *pIn++ / 2147483648.0f);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
 #else
 void arm_q31_to_float(
   const q31_t * pSrc,
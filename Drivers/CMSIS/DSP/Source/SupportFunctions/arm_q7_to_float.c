@@ -122,6 +122,46 @@ void arm_q7_to_float(
     blkCnt--;
   }
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_q7_to_float(
+  const q7_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+  const q7_t *pIn = pSrc;                             /* Source pointer */
+        arm_x86_f32v_t scaleV = __arm_vec_dup_f32_x86(1.0f / 128.0f);
+
+  /* Compute ARM_X86_LANES_F32 outputs at a time */
+  blkCnt = blockSize / ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (float32_t) A / 128 */
+    /* Convert from q7 to float and store result in destination buffer */
+    __arm_vec_store_f32_x86(pDst, __arm_vec_mul_f32_x86(__arm_vec_cvt_f32_s32_x86(__arm_vec_load_s8_x86(pIn)), scaleV));
+    pIn += ARM_X86_LANES_F32;
+    pDst += ARM_X86_LANES_F32;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Tail */
+  blkCnt = blockSize % ARM_X86_LANES_F32;
+
+  while (blkCnt > 0U)
+  {
+    /* C = (float32_t) A / 128 */
+
+    /* Convert from q7 to float and store result in destination buffer */
+    *pDst++ = ((float32_t) *pIn++ / 128.0f);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+}
+
 #else
 void arm_q7_to_float(
   const q7_t * pSrc,
@@ -549,11 +549,186 @@ void arm_cfft_radix8by4_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
     arm_radix8_butterfly_f32 (pCol4, L, (float32_t *) S->pTwiddle, 4U);
 }
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/*
+  Radix-2 Stockham (autosort) FFT.
+  Each stage is reading one buffer and writing the other one in natural order, so the
+  butterflies are always working on contiguous samples and no bit reversal is needed.
+  During the stage (n, s), the twiddle factor of the butterfly p is exp(-2*pi*i*p/n) and
+  it is shared by the s consecutive samples q :
+
+  y[q + s*2p]     =  x[q + s*p] + x[q + s*(p + n/2)]
+  y[q + s*(2p+1)] = (x[q + s*p] - x[q + s*(p + n/2)]) * exp(-2*pi*i*p/n)
+
+  The first stage (s = 1) is vectorized on p with contiguous twiddles and the other ones on q.
+  exp(-2*pi*i*p/n) is the conjugate of the entry p*s of the twiddle table of the instance.
+*/
+static void arm_cfft_stockham_stages_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        float32_t * pBuffer)
+{
+  float32_t *pX = p1, *pY = pBuffer, *pTmp;              /* Stage input and output */
+  const float32_t *pTwiddle = S->pTwiddle;               /* Twiddle table (cos, sin) */
+  uint32_t L = S->fftLen;                                /* Length of the FFT */
+  uint32_t n, m, s, p, q;                                /* Stage size and loop counters */
+  uint32_t nbCmplx = ARM_X86_LANES_F32 / 2U;             /* Complex numbers in a vector */
+  float32_t xaR, xaI, xbR, xbI, twR, twI;
+  arm_x86_f32v_t xa, xb, sum, diff, tw;
+
+  s = 1U;
+
+  for (n = L; n > 1U; n >>= 1U)
+  {
+    m = n >> 1U;
+
+    if ((s == 1U) && (m >= nbCmplx))
+    {
+      for (p = 0U; p < m; p += nbCmplx)
+      {
+        xa = __arm_vec_load_f32_x86(pX + 2U * p);
+        xb = __arm_vec_load_f32_x86(pX + 2U * (p + m));
+        tw = __arm_vec_cmplx_conj_f32_x86(__arm_vec_load_f32_x86(pTwiddle + 2U * p));
+
+        sum = __arm_vec_add_f32_x86(xa, xb);
+        diff = __arm_vec_cmplx_mult_f32_x86(__arm_vec_sub_f32_x86(xa, xb), tw);
+
+        /* y[2p] and y[2p+1] are interleaved */
+        __arm_vec_store_f32_x86(pY + 4U * p, __arm_vec_cmplx_zip_lo_f32_x86(sum, diff));
+        __arm_vec_store_f32_x86(pY + 4U * p + ARM_X86_LANES_F32, __arm_vec_cmplx_zip_hi_f32_x86(sum, diff));
+      }
+    }
+    else if (s >= nbCmplx)
+    {
+      for (p = 0U; p < m; p++)
+      {
+        tw = __arm_vec_cmplx_conj_f32_x86(__arm_vec_cmplx_dup_f32_x86(pTwiddle + 2U * p * s));
+
+        for (q = 0U; q < s; q += nbCmplx)
+        {
+          xa = __arm_vec_load_f32_x86(pX + 2U * (q + s * p));
+          xb = __arm_vec_load_f32_x86(pX + 2U * (q + s * (p + m)));
+
+          sum = __arm_vec_add_f32_x86(xa, xb);
+          diff = __arm_vec_cmplx_mult_f32_x86(__arm_vec_sub_f32_x86(xa, xb), tw);
+
+          __arm_vec_store_f32_x86(pY + 2U * (q + s * 2U * p), sum);
+          __arm_vec_store_f32_x86(pY + 2U * (q + s * (2U * p + 1U)), diff);
+        }
+      }
+    }
+    else
+    {
+      /* Stages with less than a vector of consecutive samples (AVX2 only) */
+      for (p = 0U; p < m; p++)
+      {
+        twR =  pTwiddle[2U * p * s];
+        twI = -pTwiddle[2U * p * s + 1U];
+
+        for (q = 0U; q < s; q++)
+        {
+          xaR = pX[2U * (q + s * p)];
+          xaI = pX[2U * (q + s * p) + 1U];
+          xbR = pX[2U * (q + s * (p + m))];
+          xbI = pX[2U * (q + s * (p + m)) + 1U];
+
+          pY[2U * (q + s * 2U * p)] = xaR + xbR;
+          pY[2U * (q + s * 2U * p) + 1U] = xaI + xbI;
+
+          xaR = xaR - xbR;
+          xaI = xaI - xbI;
+
+          pY[2U * (q + s * (2U * p + 1U))] = (xaR * twR) - (xaI * twI);
+          pY[2U * (q + s * (2U * p + 1U)) + 1U] = (xaR * twI) + (xaI * twR);
+        }
+      }
+    }
+
+    /* The output of the stage is the input of the next one */
+    pTmp = pX;
+    pX = pY;
+    pY = pTmp;
+
+    s <<= 1U;
+  }
+
+  /* Odd number of stages : the result is in the work buffer */
+  if (pX != p1)
+  {
+    for (p = 0U; p < 2U * L; p += ARM_X86_LANES_F32)
+    {
+      __arm_vec_store_f32_x86(p1 + p, __arm_vec_load_f32_x86(pX + p));
+    }
+  }
+}
+
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
 /**
   @addtogroup ComplexFFT
   @{
  */
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/**
+  @brief         Processing function for the floating-point complex FFT with a work buffer (x86 SIMD only).
+  @param[in]     S              points to an instance of the floating-point CFFT structure
+  @param[in,out] p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     pBuffer        points to a work buffer of size <code>2*fftLen</code>
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+
+  @par           Description
+                   This function only exists when the library is built with ARM_MATH_X86_SIMD.
+                   It computes the same transform as arm_cfft_f32() with bitReverseFlag set,
+                   using a vectorized radix-2 Stockham FFT. The output is in natural order
+                   without a bit reversal pass, but the FFT is not computed in-place : the
+                   stages alternate between p1 and pBuffer.
+ */
+
+void arm_cfft_stockham_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        float32_t * pBuffer,
+        uint8_t ifftFlag)
+{
+  uint32_t  L = S->fftLen, l;
+  float32_t invL, * pSrc;
+
+  if (ifftFlag == 1U)
+  {
+    /* Conjugate input data */
+    pSrc = p1 + 1;
+    for (l = 0; l < L; l++)
+    {
+      *pSrc = -*pSrc;
+      pSrc += 2;
+    }
+  }
+
+  arm_cfft_stockham_stages_f32 (S, p1, pBuffer);
+
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t)L;
+
+    /* Conjugate and scale output data */
+    pSrc = p1;
+    for (l= 0; l < L; l++)
+    {
+      *pSrc++ *=   invL ;
+      *pSrc    = -(*pSrc) * invL;
+      pSrc++;
+    }
+  }
+}
+
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
 /**
   @brief         Processing function for the floating-point complex FFT.
   @param[in]     S              points to an instance of the floating-point CFFT structure
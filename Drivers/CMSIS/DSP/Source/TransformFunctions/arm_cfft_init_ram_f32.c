@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_ram_f32.c
+ * Description:  Initialization function of the floating-point CFFT with tables in RAM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/* Twiddle factors computed by the single precision recurrence between two
+   values of the double precision recurrence (log2) */
+#define CFFT_RAM_ANCHOR_SHIFT_F32 4U
+
+extern void arm_cfft_ram_sincos(
+  uint32_t halvings,
+  float64_t * pCos,
+  float64_t * pSin);
+
+extern uint16_t arm_cfft_ram_bitrev(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint8_t radix8Flag);
+
+/**
+  @brief         Initialization function for the floating-point complex FFT with tables in RAM.
+  @param[out]    S             points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen        length of the FFT (16 to 4096, power of 2)
+  @param[out]    pTwiddle      points to the twiddle factor buffer of <code>2*fftLen</code> values
+  @param[out]    pBitRevTable  points to the bit reversal buffer of <code>2*fftLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Description
+                   The twiddle factors and the bit reversal table are computed in the
+                   buffers instead of using the constant tables of arm_const_structs.h,
+                   so the tables are not needed in flash. The instance can then be used
+                   with arm_cfft_f32 like the constant instances.
+                   The buffers must be kept while the instance is used.
+  @par
+                   Only the twiddle factors of the first octant (angles 0 to pi/4) are
+                   computed, the others are deduced from the symmetries of cos and sin.
+                   A recurrence computes the next twiddle factor from the previous one
+                   with a multiplication by the rotation of one step. Its rounding errors
+                   are growing with the number of steps, so the recurrence is corrected
+                   every 16 twiddle factors with a value of a double precision recurrence.
+                   The maximum error compared to the constant tables is 2.4e-7.
+  @par
+                   The bit reversal table has the same length (bitRevLength) as the
+                   constant table but the order of the swaps may be different.
+ */
+
+arm_status arm_cfft_init_ram_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  uint32_t log2Len, n4, octant, j, k;
+  float64_t cosA, sinA, alphaA, betaA, tmpA;
+  float64_t cosStep, sinStep;
+  float32_t c, s, alpha, beta, tmp;
+
+  switch (fftLen)
+  {
+  case 4096U:
+  case 2048U:
+  case 1024U:
+  case 512U:
+  case 256U:
+  case 128U:
+  case 64U:
+  case 32U:
+  case 16U:
+    break;
+
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  log2Len = 31U - __CLZ(fftLen);
+  n4 = (uint32_t) fftLen >> 2U;
+  octant = (uint32_t) fftLen >> 3U;
+
+  /* Rotation of one step of 2*pi/fftLen = (pi/4) / 2^(log2Len-3) :
+     cos(x + d) = cos(x) - (alpha*cos(x) + beta*sin(x))
+     sin(x + d) = sin(x) + (beta*cos(x) - alpha*sin(x))
+     with alpha = 2*sin(d/2)^2 = 1 - cos(d) and beta = sin(d) */
+  arm_cfft_ram_sincos(log2Len - 3U, &cosStep, &sinStep);
+  beta = (float32_t) sinStep;
+  arm_cfft_ram_sincos(log2Len - 2U, &cosStep, &sinStep);
+  alpha = (float32_t) (2.0 * sinStep * sinStep);
+
+  /* Rotation of the double precision recurrence */
+  alphaA = 0.0;
+  betaA = 0.0;
+  if (octant >= (1U << CFFT_RAM_ANCHOR_SHIFT_F32))
+  {
+    arm_cfft_ram_sincos(log2Len - 3U - CFFT_RAM_ANCHOR_SHIFT_F32, &cosStep, &sinStep);
+    betaA = sinStep;
+    arm_cfft_ram_sincos(log2Len - 2U - CFFT_RAM_ANCHOR_SHIFT_F32, &cosStep, &sinStep);
+    alphaA = 2.0 * sinStep * sinStep;
+  }
+
+  cosA = 1.0;
+  sinA = 0.0;
+
+  for (j = 0U; j <= octant; j += (1U << CFFT_RAM_ANCHOR_SHIFT_F32))
+  {
+    c = (float32_t) cosA;
+    s = (float32_t) sinA;
+
+    for (k = j; (k < j + (1U << CFFT_RAM_ANCHOR_SHIFT_F32)) && (k <= octant); k++)
+    {
+      /* Symmetries of the angles k, pi/2 - k, pi/2 + k ... 2*pi - k */
+      pTwiddle[2U * k]                   =  c;
+      pTwiddle[2U * k + 1U]              =  s;
+      pTwiddle[2U * (n4 - k)]            =  s;
+      pTwiddle[2U * (n4 - k) + 1U]       =  c;
+      pTwiddle[2U * (n4 + k)]            = -s;
+      pTwiddle[2U * (n4 + k) + 1U]       =  c;
+      pTwiddle[2U * (2U * n4 - k)]       = -c;
+      pTwiddle[2U * (2U * n4 - k) + 1U]  =  s;
+      pTwiddle[2U * (2U * n4 + k)]       = -c;
+      pTwiddle[2U * (2U * n4 + k) + 1U]  = -s;
+      pTwiddle[2U * (3U * n4 - k)]       = -s;
+      pTwiddle[2U * (3U * n4 - k) + 1U]  = -c;
+      pTwiddle[2U * (3U * n4 + k)]       =  s;
+      pTwiddle[2U * (3U * n4 + k) + 1U]  = -c;
+      if (k > 0U)
+      {
+        pTwiddle[2U * (fftLen - k)]      =  c;
+        pTwiddle[2U * (fftLen - k) + 1U] = -s;
+      }
+
+      tmp = c - (alpha * c + beta * s);
+      s = s + (beta * c - alpha * s);
+      c = tmp;
+    }
+
+    tmpA = cosA - (alphaA * cosA + betaA * sinA);
+    sinA = sinA + (betaA * cosA - alphaA * sinA);
+    cosA = tmpA;
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = arm_cfft_ram_bitrev(pBitRevTable, fftLen, 1U);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of ComplexFFT group
+ */
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_ram_q31.c
+ * Description:  Initialization function of the Q31 CFFT with tables in RAM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/* Twiddle factors computed by the recurrence between two corrected values (log2) */
+#define CFFT_RAM_ANCHOR_SHIFT_Q31 4U
+
+extern void arm_cfft_ram_sincos(
+  uint32_t halvings,
+  float64_t * pCos,
+  float64_t * pSin);
+
+extern uint16_t arm_cfft_ram_bitrev(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint8_t radix8Flag);
+
+/* Rounding to the nearest Q31 value, 1.0 is saturated */
+static q31_t arm_cfft_ram_to_q31(float64_t x)
+{
+  x = x * 2147483648.0;
+  x = (x > 0.0) ? (x + 0.5) : (x - 0.5);
+
+  return ((x >= 2147483647.0) ? (q31_t) 0x7FFFFFFF : (q31_t) x);
+}
+
+/**
+  @brief         Initialization function for the Q31 complex FFT with tables in RAM.
+  @param[out]    S             points to an instance of the Q31 CFFT structure
+  @param[in]     fftLen        length of the FFT (16 to 4096, power of 2)
+  @param[out]    pTwiddle      points to the twiddle factor buffer of <code>3*fftLen/2</code> values
+  @param[out]    pBitRevTable  points to the bit reversal buffer of <code>fftLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Description
+                   The twiddle factors and the bit reversal table are computed in the
+                   buffers instead of using the constant tables of arm_const_structs.h.
+                   The instance can then be used with arm_cfft_q31 like the constant
+                   instances. The buffers must be kept while the instance is used.
+  @par
+                   Like in arm_cfft_init_ram_f32, the twiddle factors of the first octant
+                   are computed by a recurrence corrected every 16 values and the others
+                   are deduced from the symmetries. The recurrence is in double precision,
+                   the twiddle factors are rounded to the nearest Q31 value and are
+                   within 1 LSB of the constant tables.
+  @par
+                   The bit reversal table is identical to the constant table.
+ */
+
+arm_status arm_cfft_init_ram_q31(
+  arm_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  uint32_t log2Len, n4, octant, j, k;
+  float64_t cosA, sinA, alphaA, betaA;
+  float64_t c, s, alpha, beta, tmp;
+  q31_t cq, sq;
+
+  switch (fftLen)
+  {
+  case 4096U:
+  case 2048U:
+  case 1024U:
+  case 512U:
+  case 256U:
+  case 128U:
+  case 64U:
+  case 32U:
+  case 16U:
+    break;
+
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  log2Len = 31U - __CLZ(fftLen);
+  n4 = (uint32_t) fftLen >> 2U;
+  octant = (uint32_t) fftLen >> 3U;
+
+  /* Rotations of one step and of the corrected steps, see arm_cfft_init_ram_f32 */
+  arm_cfft_ram_sincos(log2Len - 3U, &c, &beta);
+  arm_cfft_ram_sincos(log2Len - 2U, &c, &s);
+  alpha = 2.0 * s * s;
+
+  alphaA = 0.0;
+  betaA = 0.0;
+  if (octant >= (1U << CFFT_RAM_ANCHOR_SHIFT_Q31))
+  {
+    arm_cfft_ram_sincos(log2Len - 3U - CFFT_RAM_ANCHOR_SHIFT_Q31, &c, &betaA);
+    arm_cfft_ram_sincos(log2Len - 2U - CFFT_RAM_ANCHOR_SHIFT_Q31, &c, &s);
+    alphaA = 2.0 * s * s;
+  }
+
+  cosA = 1.0;
+  sinA = 0.0;
+
+  for (j = 0U; j <= octant; j += (1U << CFFT_RAM_ANCHOR_SHIFT_Q31))
+  {
+    c = cosA;
+    s = sinA;
+
+    for (k = j; (k < j + (1U << CFFT_RAM_ANCHOR_SHIFT_Q31)) && (k <= octant); k++)
+    {
+      cq = arm_cfft_ram_to_q31(c);
+      sq = arm_cfft_ram_to_q31(s);
+
+      /* Symmetries of the angles k, pi/2 - k, pi/2 + k ... 3*pi/2 - k,
+         the table stops at 3*pi/2 */
+      pTwiddle[2U * k]                   =  cq;
+      pTwiddle[2U * k + 1U]              =  sq;
+      pTwiddle[2U * (n4 - k)]            =  sq;
+      pTwiddle[2U * (n4 - k) + 1U]       =  cq;
+      pTwiddle[2U * (n4 + k)]            = arm_cfft_ram_to_q31(-s);
+      pTwiddle[2U * (n4 + k) + 1U]       =  cq;
+      pTwiddle[2U * (2U * n4 - k)]       = arm_cfft_ram_to_q31(-c);
+      pTwiddle[2U * (2U * n4 - k) + 1U]  =  sq;
+      pTwiddle[2U * (2U * n4 + k)]       = arm_cfft_ram_to_q31(-c);
+      pTwiddle[2U * (2U * n4 + k) + 1U]  = arm_cfft_ram_to_q31(-s);
+      if (k > 0U)
+      {
+        pTwiddle[2U * (3U * n4 - k)]      = arm_cfft_ram_to_q31(-s);
+        pTwiddle[2U * (3U * n4 - k) + 1U] = arm_cfft_ram_to_q31(-c);
+      }
+
+      tmp = c - (alpha * c + beta * s);
+      s = s + (beta * c - alpha * s);
+      c = tmp;
+    }
+
+    tmp = cosA - (alphaA * cosA + betaA * sinA);
+    sinA = sinA + (betaA * cosA - alphaA * sinA);
+    cosA = tmp;
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = arm_cfft_ram_bitrev(pBitRevTable, fftLen, 0U);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of ComplexFFT group
+ */
@@ -0,0 +1,242 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_ram_common.c
+ * Description:  Bit reversal table and angles of the CFFT tables computed in RAM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @brief         Bit reversal of an index.
+  @param[in]     i          index
+  @param[in]     log2Len    number of bits of the index
+  @return        index with the order of its bits reversed
+ */
+
+static uint32_t arm_cfft_ram_bit_reverse(
+  uint32_t i,
+  uint32_t log2Len)
+{
+  i = ((i >> 1U) & 0x55555555U) | ((i & 0x55555555U) << 1U);
+  i = ((i >> 2U) & 0x33333333U) | ((i & 0x33333333U) << 2U);
+  i = ((i >> 4U) & 0x0F0F0F0FU) | ((i & 0x0F0F0F0FU) << 4U);
+  i = ((i >> 8U) & 0x00FF00FFU) | ((i & 0x00FF00FFU) << 8U);
+  i = (i >> 16U) | (i << 16U);
+
+  return (i >> (32U - log2Len));
+}
+
+/**
+  @brief         Digit reversal of an index.
+  @param[in]     i          index
+  @param[in]     log2Len    number of bits of the index
+  @param[in]     inverse    0 when the least significant digit has log2Len%3 bits
+                            and the others 3 bits, 1 when the most significant
+                            digit has log2Len%3 bits
+  @return        index with the order of its digits reversed
+
+  @par           Description
+                   The bits of the index are reversed, then the bits of each digit
+                   are reversed again : the bits 0 and 2 of the 3-bit digits and
+                   the 2 bits of a 2-bit digit are exchanged.
+ */
+
+static uint32_t arm_cfft_ram_digit_reverse(
+  uint32_t i,
+  uint32_t log2Len,
+  uint32_t inverse)
+{
+  uint32_t r = log2Len % 3U;
+  uint32_t mask, pos, d;
+
+  i = arm_cfft_ram_bit_reverse(i, log2Len);
+
+  /* Bit 0 of the 3-bit digits, the short digit is at the top of the
+     reversed index when it was the least significant digit */
+  pos = (inverse != 0U) ? r : 0U;
+  mask = (0x49249249U & ((1U << (log2Len - r)) - 1U)) << pos;
+  i = (i & ~(mask | (mask << 2U))) | ((i & mask) << 2U) | ((i >> 2U) & mask);
+
+  if (r == 2U)
+  {
+    pos = (inverse != 0U) ? 0U : (log2Len - 2U);
+    d = (i >> pos) & 3U;
+    if ((d == 1U) || (d == 2U))
+    {
+      i ^= 3U << pos;
+    }
+  }
+
+  return (i);
+}
+
+/**
+  @brief         Computes a bit reversal table in RAM.
+  @param[out]    pBitRevTable  points to the table of <code>2*fftLen</code> values
+                               (<code>fftLen</code> values for the bit reversal)
+  @param[in]     fftLen        length of the complex FFT (16 to 4096, power of 2)
+  @param[in]     radix8Flag    1 for the digit reversal of the radix-8 floating-point
+                               CFFT, 0 for the bit reversal of the fixed-point CFFT
+  @return        length of the table
+
+  @par           Description
+                   The table contains pairs of byte offsets of complex 32-bit values
+                   (or of the offsets divided by 2 for 16-bit values) which are
+                   swapped by arm_bitreversal_32 and arm_bitreversal_16.
+                   The length of the table is the same as the length of the constant
+                   table of the FFT.
+  @par
+                   The bit reversal is made of disjoint swaps. The digit reversal of
+                   the radix-8 CFFT is split in cycles. A cycle c0 -> c1 ... -> c(m-1)
+                   is done with two sets of disjoint swaps : (ck, c(1-k)) first, then
+                   (ck, c(m-k)). The second set is written at the end of the buffer and
+                   moved after the first one. So two consecutive swaps never use the
+                   same element, as required by the unrolled arm_bitreversal_32 of the
+                   Cortex-M assembly version.
+ */
+
+uint16_t arm_cfft_ram_bitrev(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint8_t radix8Flag)
+{
+  uint32_t log2Len;
+  uint32_t i, k, m, a, b, t;
+  uint32_t n = 0U;
+  uint32_t end = 2U * (uint32_t) fftLen;
+  uint16_t tmp;
+
+  log2Len = 31U - __CLZ(fftLen);
+
+  if (radix8Flag == 0U)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      k = arm_cfft_ram_bit_reverse(i, log2Len);
+      if (k > i)
+      {
+        pBitRevTable[n++] = (uint16_t) (i << 3U);
+        pBitRevTable[n++] = (uint16_t) (k << 3U);
+      }
+    }
+
+    return ((uint16_t) n);
+  }
+
+  /* Radix-8 stages of the CFFT, after a first radix-2 or radix-4 stage.
+     The inverse permutation is reversing the digits in the other order. */
+    for (i = 0U; i < fftLen; i++)
+  {
+    /* i is the first element of its cycle when all the other elements are greater */
+    k = arm_cfft_ram_digit_reverse(i, log2Len, 0U);
+    m = 1U;
+    while (k > i)
+    {
+      k = arm_cfft_ram_digit_reverse(k, log2Len, 0U);
+      m++;
+    }
+
+    if ((k != i) || (m == 1U))
+    {
+      continue;
+    }
+
+    /* Swaps (ck, c(1-k)) */
+    a = i;
+    b = arm_cfft_ram_digit_reverse(i, log2Len, 0U);
+    for (t = 0U; t < (m >> 1U); t++)
+    {
+      pBitRevTable[n++] = (uint16_t) (a << 3U);
+      pBitRevTable[n++] = (uint16_t) (b << 3U);
+      a = arm_cfft_ram_digit_reverse(a, log2Len, 1U);
+      b = arm_cfft_ram_digit_reverse(b, log2Len, 0U);
+    }
+
+    /* Swaps (ck, c(m-k)) */
+    a = arm_cfft_ram_digit_reverse(i, log2Len, 0U);
+    b = arm_cfft_ram_digit_reverse(i, log2Len, 1U);
+    for (t = 0U; t < ((m - 1U) >> 1U); t++)
+    {
+      pBitRevTable[--end] = (uint16_t) (b << 3U);
+      pBitRevTable[--end] = (uint16_t) (a << 3U);
+      a = arm_cfft_ram_digit_reverse(a, log2Len, 0U);
+      b = arm_cfft_ram_digit_reverse(b, log2Len, 1U);
+    }
+  }
+
+  /* Order of the cycles of the second set, like in the first set */
+  a = end;
+  b = 2U * (uint32_t) fftLen - 2U;
+  while (a < b)
+  {
+    tmp = pBitRevTable[a];
+    pBitRevTable[a] = pBitRevTable[b];
+    pBitRevTable[b] = tmp;
+    tmp = pBitRevTable[a + 1U];
+    pBitRevTable[a + 1U] = pBitRevTable[b + 1U];
+    pBitRevTable[b + 1U] = tmp;
+    a += 2U;
+    b -= 2U;
+  }
+
+  for (k = end; k < 2U * (uint32_t) fftLen; k++)
+  {
+    pBitRevTable[n++] = pBitRevTable[k];
+  }
+
+  return ((uint16_t) n);
+}
+
+/**
+  @brief         Cosine and sine of pi/4 divided by a power of 2.
+  @param[in]     halvings   exponent of the power of 2
+  @param[out]    pCos       cosine of the angle
+  @param[out]    pSin       sine of the angle
+
+  @par           Description
+                   The values are computed from cos(pi/4) = sin(pi/4) = sqrt(1/2)
+                   with the half angle formulas, which do not lose precision for
+                   the small angles : cos(x/2) = sqrt((1 + cos(x))/2) and
+                   sin(x/2) = sin(x) / (2*cos(x/2)).
+ */
+
+void arm_cfft_ram_sincos(
+  uint32_t halvings,
+  float64_t * pCos,
+  float64_t * pSin)
+{
+  float64_t c = 0.70710678118654752440;
+  float64_t s = 0.70710678118654752440;
+
+  while (halvings > 0U)
+  {
+    c = sqrt(0.5 + 0.5 * c);
+    s = s / (2.0 * c);
+    halvings--;
+  }
+
+  *pCos = c;
+  *pSin = s;
+}
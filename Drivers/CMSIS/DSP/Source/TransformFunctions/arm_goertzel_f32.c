@@ -0,0 +1,258 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel filters
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Filters
+
+  The Goertzel algorithm computes the power of a block of samples at a few
+  frequencies, without computing the other bins of a full FFT (DTMF decoding,
+  pilot tone detection, tuners).
+  For each frequency, a second order resonator is run over the block:
+  <pre>
+      s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]
+  </pre>
+  and the DFT at the angular frequency <code>w</code> is obtained from the last two states:
+  <pre>
+      power = (s[N-1] - cos(w)*s[N-2])^2 + (sin(w)*s[N-2])^2 = |X(w)|^2
+  </pre>
+  The frequencies do not have to be bins of a DFT of length <code>blockSize</code>:
+  <code>w = 2*pi*f/fs</code> for any frequency <code>f</code> below <code>fs/2</code>.
+
+  @par           Cost compared to an FFT
+                   The resonator is one multiply-accumulate per sample and per frequency, so
+                   the Goertzel filters are cheaper than ::arm_rfft_fast_f32 followed by
+                   ::arm_cmplx_mag_squared_f32 when the number of frequencies is small.
+                   The frequencies are processed in parallel by the SIMD lanes (4 with Neon,
+                   ARM_X86_LANES_F32 with the x86 extensions) and the crossover point is higher
+                   when the number of frequencies is a multiple of the lanes.
+                   The cycles of the Goertzel tests (1 to 16 frequencies) can be compared with
+                   the cycles of the RFFT tests of the same length to find the crossover point
+                   of a target.
+  @par
+                   ::arm_sdft_f32 is updating the bins at each sample instead of once per block.
+
+  @par           Coefficient Ordering
+                   The coefficients are the cosines of the <code>numBins</code> angular frequencies,
+                   followed by their sines:
+  <pre>
+      {cos(w0), cos(w1), ..., cos(wK-1), sin(w0), sin(w1), ..., sin(wK-1)}
+  </pre>
+
+  @par           Instance Structure
+                   The number of frequencies and the coefficients are stored in an instance
+                   data structure. The filters have no state kept between two blocks.
+                   There is also an associated initialization function.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Power of a block of floating-point samples at a few frequencies.
+  @param[in]     S          points to an instance of the floating-point Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the <code>numBins</code> powers
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pCos = S->pCoeffs;                  /* Cosines of the frequencies */
+  const float32_t *pSin = S->pCoeffs + S->numBins;     /* Sines of the frequencies */
+  const float32_t *px;                                 /* Input pointer */
+        float32_t coef0, s00, s10, s20, re0, im0;      /* Coefficient, states and DFT */
+        uint32_t numBins = S->numBins;                 /* Number of frequencies */
+        uint32_t sample, k = 0U;                       /* Loop counters */
+
+#if defined(ARM_MATH_NEON)
+        float32x4_t coefV, s0V, s1V, s2V, reV, imV;    /* 4 frequencies */
+#elif defined(ARM_MATH_X86_SIMD)
+        arm_x86_f32v_t coefV, s0V, s1V, s2V, reV, imV; /* ARM_X86_LANES_F32 frequencies */
+#endif
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t coef1, s01, s11, s21, re1, im1;      /* Second frequency */
+#endif
+
+#if defined(ARM_MATH_NEON)
+
+  /* 4 frequencies at a time */
+  while ((k + 4U) <= numBins)
+  {
+    coefV = vld1q_f32(pCos + k);
+    coefV = vaddq_f32(coefV, coefV);
+    s1V = vdupq_n_f32(0.0f);
+    s2V = vdupq_n_f32(0.0f);
+
+    px = pSrc;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* s[n] = (x[n] - s[n-2]) + 2*cos(w)*s[n-1], one multiply-accumulate after s[n-1] */
+      s0V = vmlaq_f32(vsubq_f32(vdupq_n_f32(*px++), s2V), coefV, s1V);
+      s2V = s1V;
+      s1V = s0V;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* re = s[N-1] - cos(w)*s[N-2], im = sin(w)*s[N-2] */
+    reV = vmlsq_f32(s1V, vld1q_f32(pCos + k), s2V);
+    imV = vmulq_f32(vld1q_f32(pSin + k), s2V);
+    vst1q_f32(pDst + k, vmlaq_f32(vmulq_f32(reV, reV), imV, imV));
+
+    k += 4U;
+  }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  /* ARM_X86_LANES_F32 frequencies at a time */
+  while ((k + ARM_X86_LANES_F32) <= numBins)
+  {
+    coefV = __arm_vec_load_f32_x86(pCos + k);
+    coefV = __arm_vec_add_f32_x86(coefV, coefV);
+    s1V = __arm_vec_dup_f32_x86(0.0f);
+    s2V = __arm_vec_dup_f32_x86(0.0f);
+
+    px = pSrc;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* s[n] = (x[n] - s[n-2]) + 2*cos(w)*s[n-1] */
+      s0V = __arm_vec_mla_f32_x86(__arm_vec_sub_f32_x86(__arm_vec_dup_f32_x86(*px++), s2V), coefV, s1V);
+      s2V = s1V;
+      s1V = s0V;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* re = s[N-1] - cos(w)*s[N-2], im = sin(w)*s[N-2] */
+    reV = __arm_vec_sub_f32_x86(s1V, __arm_vec_mul_f32_x86(__arm_vec_load_f32_x86(pCos + k), s2V));
+    imV = __arm_vec_mul_f32_x86(__arm_vec_load_f32_x86(pSin + k), s2V);
+    __arm_vec_store_f32_x86(pDst + k, __arm_vec_mla_f32_x86(__arm_vec_mul_f32_x86(reV, reV), imV, imV));
+
+    k += ARM_X86_LANES_F32;
+  }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* 2 frequencies at a time */
+  while ((k + 2U) <= numBins)
+  {
+    coef0 = 2.0f * pCos[k];
+    coef1 = 2.0f * pCos[k + 1U];
+    s10 = 0.0f;
+    s11 = 0.0f;
+    s20 = 0.0f;
+    s21 = 0.0f;
+
+    px = pSrc;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* s[n] = (x[n] - s[n-2]) + 2*cos(w)*s[n-1] */
+      s00 = (*px - s20) + (coef0 * s10);
+      s01 = (*px - s21) + (coef1 * s11);
+      px++;
+
+      s20 = s10;
+      s21 = s11;
+      s10 = s00;
+      s11 = s01;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* re = s[N-1] - cos(w)*s[N-2], im = sin(w)*s[N-2] */
+    re0 = s10 - (pCos[k] * s20);
+    re1 = s11 - (pCos[k + 1U] * s21);
+    im0 = pSin[k] * s20;
+    im1 = pSin[k + 1U] * s21;
+
+    pDst[k]      = (re0 * re0) + (im0 * im0);
+    pDst[k + 1U] = (re1 * re1) + (im1 * im1);
+
+    k += 2U;
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Remaining frequencies */
+  while (k < numBins)
+  {
+    coef0 = 2.0f * pCos[k];
+    s10 = 0.0f;
+    s20 = 0.0f;
+
+    px = pSrc;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* s[n] = (x[n] - s[n-2]) + 2*cos(w)*s[n-1] */
+      s00 = (*px++ - s20) + (coef0 * s10);
+      s20 = s10;
+      s10 = s00;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* re = s[N-1] - cos(w)*s[N-2], im = sin(w)*s[N-2] */
+    re0 = s10 - (pCos[k] * s20);
+    im0 = pSin[k] * s20;
+
+    pDst[k] = (re0 * re0) + (im0 * im0);
+
+    k++;
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Initialization function of the Q31 Goertzel filters
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 Goertzel filters.
+  @param[out]    S          points to an instance of the Q31 Goertzel structure
+  @param[in]     numBins    number of frequencies
+  @param[in]     pCoeffs    points to the cosines then the sines of the <code>numBins</code>
+                            angular frequencies (<code>2*numBins</code> values)
+  @return        none
+ */
+
+void arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const q31_t * pCoeffs)
+{
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel filters
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Power of a block of Q31 samples at a few frequencies.
+  @param[in]     S          points to an instance of the Q31 Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the <code>numBins</code> powers
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The states of the resonators are kept in 64 bits (the Q31 input values
+                   are accumulated without shift). The DFT is then divided by <code>2^b</code>,
+                   <code>b</code> being the number of bits of <code>blockSize-1</code> (the DFT
+                   divided by <code>blockSize</code> when it is a power of 2), and the power is
+                   computed in Q31 format, so <code>pDst</code> is <code>|X(w)|^2 / 2^(2*b)</code>.
+  @par
+                   The states are bounded by <code>blockSize/sin(w)</code>: very low frequencies
+                   (<code>sin(w) < blockSize/2^32</code>) may overflow.
+ */
+void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pCos = S->pCoeffs;                      /* Cosines of the frequencies */
+  const q31_t *pSin = S->pCoeffs + S->numBins;         /* Sines of the frequencies */
+  const q31_t *px;                                     /* Input pointer */
+        q31_t coef0;                                   /* Cosine */
+        q63_t s00, s10, s20, re0, im0;                 /* States and DFT */
+        uint32_t numBins = S->numBins;                 /* Number of frequencies */
+        uint32_t shift;                                /* Scaling of the DFT */
+        uint32_t sample, k = 0U;                       /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q31_t coef1;                                   /* Cosine of the second frequency */
+        q63_t s01, s11, s21, re1, im1;                 /* States and DFT of the second frequency */
+#endif
+
+  shift = (blockSize > 1U) ? (32U - __CLZ(blockSize - 1U)) : 0U;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* 2 frequencies at a time */
+  while ((k + 2U) <= numBins)
+  {
+    coef0 = pCos[k];
+    coef1 = pCos[k + 1U];
+    s10 = 0;
+    s11 = 0;
+    s20 = 0;
+    s21 = 0;
+
+    px = pSrc;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* s[n] = (x[n] - s[n-2]) + 2*cos(w)*s[n-1] */
+      s00 = ((q63_t) *px - s20) + (mult32x64(s10, coef0) << 2);
+      s01 = ((q63_t) *px - s21) + (mult32x64(s11, coef1) << 2);
+      px++;
+
+      s20 = s10;
+      s21 = s11;
+      s10 = s00;
+      s11 = s01;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* re = s[N-1] - cos(w)*s[N-2], im = sin(w)*s[N-2] */
+    re0 = clip_q63_to_q31((s10 - (mult32x64(s20, coef0) << 1)) >> shift);
+    re1 = clip_q63_to_q31((s11 - (mult32x64(s21, coef1) << 1)) >> shift);
+    im0 = clip_q63_to_q31((mult32x64(s20, pSin[k]) << 1) >> shift);
+    im1 = clip_q63_to_q31((mult32x64(s21, pSin[k + 1U]) << 1) >> shift);
+
+    pDst[k]      = clip_q63_to_q31(((re0 * re0) >> 31) + ((im0 * im0) >> 31));
+    pDst[k + 1U] = clip_q63_to_q31(((re1 * re1) >> 31) + ((im1 * im1) >> 31));
+
+    k += 2U;
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Remaining frequencies */
+  while (k < numBins)
+  {
+    coef0 = pCos[k];
+    s10 = 0;
+    s20 = 0;
+
+    px = pSrc;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* s[n] = (x[n] - s[n-2]) + 2*cos(w)*s[n-1] */
+      s00 = ((q63_t) *px++ - s20) + (mult32x64(s10, coef0) << 2);
+      s20 = s10;
+      s10 = s00;
+
+      /* Decrement loop counter */
+      sample--;
+    }
+
+    /* re = s[N-1] - cos(w)*s[N-2], im = sin(w)*s[N-2] */
+    re0 = clip_q63_to_q31((s10 - (mult32x64(s20, coef0) << 1)) >> shift);
+    im0 = clip_q63_to_q31((mult32x64(s20, pSin[k]) << 1) >> shift);
+
+    pDst[k] = clip_q63_to_q31(((re0 * re0) >> 31) + ((im0 * im0) >> 31));
+
+    k++;
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_f32.c
+ * Description:  MFCC of a frame of floating-point samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MFCC Mel-Frequency Cepstral Coefficients
+
+  These functions compute the Mel-Frequency Cepstral Coefficients (MFCC) of a frame of samples.
+  They are the usual features of keyword spotting and audio classification networks.
+
+  @par           Algorithm
+                   The frame of <code>fftLen</code> samples is processed as follows :
+                   - multiplication by the window ;
+                   - real FFT and magnitude of the <code>fftLen/2+1</code> bins ;
+                   - energy of each of the <code>nbMelFilters</code> Mel filters, which is the weighted sum of the
+                     magnitudes of the bins of the filter ;
+                   - natural logarithm of the energies ;
+                   - DCT-II of the logarithms, limited to the first <code>nbDctOutputs</code> coefficients.
+
+  @par           Sparse Mel Filters
+                   A Mel filter is only non zero on a few bins. Only these coefficients are stored :
+                   <code>filterPos[i]</code> is the first bin of filter <code>i</code>,
+                   <code>filterLengths[i]</code> is its number of bins, and
+                   <code>filterCoefs</code> contains the coefficients of filter 0, followed by those of filter 1 and so on.
+                   ::arm_mfcc_sparse_filters_f32 is building these arrays from a dense Mel matrix.
+                   For 40 filters and a 512 point FFT, the sparse filters are using about 500 coefficients instead of 10280.
+
+  @par           DCT
+                   The DCT-II is computed as a matrix product : <code>dctCoefs</code> is a matrix of
+                   <code>nbDctOutputs</code> rows and <code>nbMelFilters</code> columns.
+                   The MFCC usually keep around 13 coefficients of 40 energies, which is cheaper than a fast DCT
+                   computing all the coefficients. With the orthonormal DCT-II, the coefficients are
+                   <code>dctCoefs[j*nbMelFilters+i] = sqrt(2/nbMelFilters) * cos(PI/nbMelFilters * (i+0.5) * j)</code>,
+                   the first row being scaled by <code>sqrt(1/2)</code>.
+
+  @par           Instance Structure
+                   The tables and the real FFT instance are stored in an instance data structure.
+                   The tables are not modified and can be shared among several instances.
+
+  @par           Initialization Functions
+                   The initialization function checks the parameters and initializes the real FFT.
+                   The tables of the real FFT of length <code>fftLen</code> must be included in the build.
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/* Offset of the Mel energies before the logarithm */
+#define MFCC_LOG_OFFSET_F32 1.0e-6f
+
+/**
+  @brief         MFCC of a frame of floating-point samples.
+  @param[in]     S      points to an instance of the floating-point MFCC structure
+  @param[in,out] pSrc   points to the frame of <code>fftLen</code> samples. It is modified by the function.
+  @param[out]    pDst   points to the <code>nbDctOutputs</code> MFCC
+  @param[in,out] pTmp   points to a temporary buffer of <code>fftLen+2</code> values
+  @return        none
+
+  @par           Logarithm
+                   A small offset is added to the Mel energies so that a frame of zeros is giving a finite result.
+                   The logarithms of all the energies are computed at once by ::arm_vlog_f32.
+ */
+void arm_mfcc_f32(
+  const arm_mfcc_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+        uint32_t fftLen = S->fftLen;                   /* Length of the frame */
+        uint32_t nbMelFilters = S->nbMelFilters;       /* Number of Mel filters */
+  const float32_t *pCoefs = S->filterCoefs;            /* Coefficients of the current filter */
+  const float32_t *pDct = S->dctCoefs;                 /* Current row of the DCT */
+        float32_t energy;                              /* Energy of a filter */
+        uint32_t i;                                    /* Loop counter */
+
+  /* Window the frame */
+  arm_mult_f32(pSrc, S->windowCoefs, pSrc, fftLen);
+
+  /* Spectrum of the frame. The input of the real FFT is used as a working buffer. */
+  arm_rfft_fast_f32((arm_rfft_fast_instance_f32 *) &S->rfft, pSrc, pTmp, 0);
+
+  /* The real Nyquist bin is packed in the imaginary part of the DC bin :
+     it is moved after the other bins so that the fftLen/2+1 magnitudes are computed at once */
+  pTmp[fftLen] = pTmp[1];
+  pTmp[fftLen + 1U] = 0.0f;
+  pTmp[1] = 0.0f;
+
+  arm_cmplx_mag_f32(pTmp, pSrc, (fftLen >> 1U) + 1U);
+
+  /* Energies of the Mel filters */
+  for (i = 0U; i < nbMelFilters; i++)
+  {
+    arm_dot_prod_f32(pSrc + S->filterPos[i], pCoefs, S->filterLengths[i], &energy);
+    pCoefs += S->filterLengths[i];
+
+    pTmp[i] = energy + MFCC_LOG_OFFSET_F32;
+  }
+
+  arm_vlog_f32(pTmp, pTmp, nbMelFilters);
+
+  /* DCT-II of the logarithms */
+  for (i = 0U; i < S->nbDctOutputs; i++)
+  {
+    arm_dot_prod_f32(pDct, pTmp, nbMelFilters, pDst + i);
+    pDct += nbMelFilters;
+  }
+}
+
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_init_f32.c
+ * Description:  Initialization function of the floating-point MFCC
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point MFCC.
+  @param[out]    S              points to an instance of the floating-point MFCC structure
+  @param[in]     fftLen         length of a frame (32 to 4096, power of 2)
+  @param[in]     nbMelFilters   number of Mel filters
+  @param[in]     nbDctOutputs   number of MFCC (1 to <code>nbMelFilters</code>)
+  @param[in]     dctCoefs       points to the DCT matrix of <code>nbDctOutputs*nbMelFilters</code> values
+  @param[in]     filterPos      points to the first bin of each Mel filter
+  @param[in]     filterLengths  points to the number of bins of each Mel filter
+  @param[in]     filterCoefs    points to the coefficients of the Mel filters
+  @param[in]     windowCoefs    points to the window of <code>fftLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length,
+                     the number of filters or outputs is out of range or a filter is not in the bins 0 to <code>fftLen/2</code>
+ */
+
+arm_status arm_mfcc_init_f32(
+        arm_mfcc_instance_f32 * S,
+        uint32_t fftLen,
+        uint32_t nbMelFilters,
+        uint32_t nbDctOutputs,
+  const float32_t * dctCoefs,
+  const uint32_t * filterPos,
+  const uint32_t * filterLengths,
+  const float32_t * filterCoefs,
+  const float32_t * windowCoefs)
+{
+  arm_status status;
+  uint32_t i;
+
+  if ((fftLen > 4096U) || (nbMelFilters == 0U) || (nbMelFilters > (fftLen >> 1U) + 1U) ||
+      (nbDctOutputs == 0U) || (nbDctOutputs > nbMelFilters))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < nbMelFilters; i++)
+  {
+    if ((filterPos[i] + filterLengths[i]) > (fftLen >> 1U) + 1U)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->nbMelFilters = nbMelFilters;
+  S->nbDctOutputs = nbDctOutputs;
+  S->dctCoefs = dctCoefs;
+  S->filterPos = filterPos;
+  S->filterLengths = filterLengths;
+  S->filterCoefs = filterCoefs;
+  S->windowCoefs = windowCoefs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @brief         Sparse storage of a dense Mel matrix.
+  @param[in]     pMel           points to the dense Mel matrix of <code>nbMelFilters</code> rows and <code>nbBins</code> columns
+  @param[in]     nbMelFilters   number of Mel filters
+  @param[in]     nbBins         number of bins of a filter (<code>fftLen/2+1</code>)
+  @param[out]    filterPos      points to the first bin of each Mel filter
+  @param[out]    filterLengths  points to the number of bins of each Mel filter
+  @param[out]    filterCoefs    points to the coefficients of the Mel filters.
+                                The array must be large enough for all the non zero coefficients
+  @return        number of coefficients written in <code>filterCoefs</code>
+
+  @par           Details
+                   A filter is stored from its first to its last non zero coefficient.
+                   The coefficients of a Q15 instance can be converted with ::arm_float_to_q15.
+ */
+
+uint32_t arm_mfcc_sparse_filters_f32(
+  const float32_t * pMel,
+        uint32_t nbMelFilters,
+        uint32_t nbBins,
+        uint32_t * filterPos,
+        uint32_t * filterLengths,
+        float32_t * filterCoefs)
+{
+  uint32_t nbCoefs = 0U;                         /* Number of coefficients written */
+  uint32_t first, last;                          /* Non zero bins of a filter */
+  uint32_t i, k;                                 /* Loop counters */
+
+  for (i = 0U; i < nbMelFilters; i++)
+  {
+    first = 0U;
+    while ((first < nbBins) && (pMel[first] == 0.0f))
+    {
+      first++;
+    }
+
+    last = nbBins;
+    while ((last > first) && (pMel[last - 1U] == 0.0f))
+    {
+      last--;
+    }
+
+    filterPos[i] = (first < nbBins) ? first : 0U;
+    filterLengths[i] = last - first;
+
+    for (k = first; k < last; k++)
+    {
+      filterCoefs[nbCoefs++] = pMel[k];
+    }
+
+    pMel += nbBins;
+  }
+
+  return (nbCoefs);
+}
+
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_init_q15.c
+ * Description:  Initialization function of the Q15 MFCC
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 MFCC.
+  @param[out]    S              points to an instance of the Q15 MFCC structure
+  @param[in]     fftLen         length of a frame (32 to 8192, power of 2)
+  @param[in]     nbMelFilters   number of Mel filters (1 to <code>fftLen/2-1</code>)
+  @param[in]     nbDctOutputs   number of MFCC (1 to <code>nbMelFilters</code>)
+  @param[in]     dctCoefs       points to the DCT matrix of <code>nbDctOutputs*nbMelFilters</code> values
+  @param[in]     filterPos      points to the first bin of each Mel filter
+  @param[in]     filterLengths  points to the number of bins of each Mel filter
+  @param[in]     filterCoefs    points to the coefficients of the Mel filters
+  @param[in]     windowCoefs    points to the window of <code>fftLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length,
+                     the number of filters or outputs is out of range or a filter is not in the bins 0 to <code>fftLen/2</code>
+ */
+
+arm_status arm_mfcc_init_q15(
+        arm_mfcc_instance_q15 * S,
+        uint32_t fftLen,
+        uint32_t nbMelFilters,
+        uint32_t nbDctOutputs,
+  const q15_t * dctCoefs,
+  const uint32_t * filterPos,
+  const uint32_t * filterLengths,
+  const q15_t * filterCoefs,
+  const q15_t * windowCoefs)
+{
+  arm_status status;
+  uint32_t i;
+
+  if ((nbMelFilters == 0U) || (nbMelFilters > (fftLen >> 1U) - 1U) ||
+      (nbDctOutputs == 0U) || (nbDctOutputs > nbMelFilters))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < nbMelFilters; i++)
+  {
+    if ((filterPos[i] + filterLengths[i]) > (fftLen >> 1U) + 1U)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  status = arm_rfft_init_q15(&S->rfft, fftLen, 0U, 1U);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->nbMelFilters = nbMelFilters;
+  S->nbDctOutputs = nbDctOutputs;
+  S->dctCoefs = dctCoefs;
+  S->filterPos = filterPos;
+  S->filterLengths = filterLengths;
+  S->filterCoefs = filterCoefs;
+  S->windowCoefs = windowCoefs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MFCC group
+ */
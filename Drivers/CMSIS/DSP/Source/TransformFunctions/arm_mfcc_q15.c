@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_q15.c
+ * Description:  MFCC of a frame of Q15 samples
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/* log2(1 + k/32) in 8.24 format for k = 0 to 32 */
+static const q31_t mfccLog2Table[33] = {
+         0,   744810,  1467383,  2169009,  2850868,  3514044,  4159533,  4788255,
+   5401057,  5998727,  6581994,  7151536,  7707984,  8251926,  8783912,  9304457,
+   9814042, 10313120, 10802114, 11281425, 11751428, 12212479, 12664911, 13109041,
+  13545168, 13973576, 14394532, 14808293, 15215099, 15615181, 16008758, 16396036,
+  16777216
+};
+
+/* ln(2) in 1.31 format */
+#define MFCC_LN2_Q31 1488522236
+
+/**
+  @brief         Base 2 logarithm of a positive 64-bit integer.
+  @param[in]     x      value to convert (must be greater than 0)
+  @return        log2(x) in 8.24 format
+ */
+static q31_t mfcc_log2_q63(
+  q63_t x)
+{
+  uint32_t high = (uint32_t) ((uint64_t) x >> 32);
+  uint32_t n;                                    /* Position of the leading one */
+  uint64_t m;                                    /* Normalized mantissa */
+  uint32_t idx, frac;                            /* Table index and interpolation factor */
+
+  if (high != 0U)
+  {
+    n = 63U - __CLZ(high);
+  }
+  else
+  {
+    n = 31U - __CLZ((uint32_t) x);
+  }
+
+  /* The leading one is moved to bit 63 : the next 5 bits are the table index
+     and the 24 following ones are the interpolation factor */
+  m = (uint64_t) x << (63U - n);
+  idx = (uint32_t) (m >> 58) & 0x1FU;
+  frac = (uint32_t) (m >> 34) & 0xFFFFFFU;
+
+  return ((q31_t) (n << 24) + mfccLog2Table[idx] +
+          (q31_t) (((q63_t) (mfccLog2Table[idx + 1U] - mfccLog2Table[idx]) * frac) >> 24));
+}
+
+/**
+  @brief         MFCC of a frame of Q15 samples.
+  @param[in]     S      points to an instance of the Q15 MFCC structure
+  @param[in,out] pSrc   points to the frame of <code>fftLen</code> samples. It is modified by the function.
+  @param[out]    pDst   points to the <code>nbDctOutputs</code> MFCC in 8.7 format
+  @param[in,out] pTmp   points to a temporary buffer of <code>fftLen</code> Q31 values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The frame is scaled up by a power of 2 so that its largest sample is using all the bits of the Q15 format.
+                   This scaling is removed from the logarithm of the energies, so the result does not depend on the level
+                   of the frame but the quiet frames are keeping their resolution in the real FFT.
+  @par
+                   The magnitudes of the bins are computed on 31 bits and the energies of the Mel filters are
+                   accumulated on 64 bits, so there is no overflow before the logarithm.
+                   The natural logarithm is computed in 8.24 format with a table of 33 values and a linear interpolation
+                   (the error is below 2e-4).
+                   The DCT is accumulated on 64 bits and the MFCC are saturated to the 8.7 format.
+ */
+void arm_mfcc_q15(
+  const arm_mfcc_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst,
+        q31_t * pTmp)
+{
+        uint32_t fftLen = S->fftLen;                   /* Length of the frame */
+        uint32_t numBins = (fftLen >> 1U) + 1U;        /* Number of bins of the spectrum */
+        uint32_t nbMelFilters = S->nbMelFilters;       /* Number of Mel filters */
+        q31_t *pMag = pTmp;                            /* Magnitudes of the bins, over the spectrum */
+        q31_t *pLog = pTmp + numBins;                  /* Logarithms of the energies of the filters */
+  const q15_t *pCoefs = S->filterCoefs;                /* Coefficients of the current filter */
+  const q15_t *pDct = S->dctCoefs;                     /* Current row of the DCT */
+  const q31_t *pIn;                                    /* Bins of the current filter */
+        q15_t absMax = 0;                              /* Largest magnitude of the samples */
+        q15_t val;                                     /* Sample of the frame */
+        q31_t bin;                                     /* Real and imaginary parts of a bin */
+        q31_t root;                                    /* Magnitude of a bin */
+        q31_t logOffset;                               /* Scaling of the energies in 8.24 format */
+        q63_t acc;                                     /* Accumulator */
+        int32_t shift = 0;                             /* Normalization of the frame */
+        uint32_t i, k;                                 /* Loop counters */
+
+  /* Normalization of the frame */
+  for (k = 0U; k < fftLen; k++)
+  {
+    val = pSrc[k];
+    val = (val > 0) ? val : (q15_t) __SSAT(-val, 16);
+
+    if (val > absMax)
+    {
+      absMax = val;
+    }
+  }
+
+  if (absMax != 0)
+  {
+    shift = (int32_t) __CLZ((uint32_t) absMax) - 17;
+    arm_shift_q15(pSrc, (int8_t) shift, pSrc, fftLen);
+  }
+
+  /* Window the frame */
+  arm_mult_q15(pSrc, S->windowCoefs, pSrc, fftLen);
+
+  /* Spectrum of the frame, scaled down by fftLen. The bins 0 to fftLen/2 are the first complex values. */
+  arm_rfft_q15((arm_rfft_instance_q15 *) &S->rfft, pSrc, (q15_t *) pTmp);
+
+  /* Each magnitude is written over the bin it is computed from */
+  for (k = 0U; k < numBins; k++)
+  {
+    bin = read_q15x2((q15_t *) &pMag[k]);
+
+    /* 1.31 square root of a quarter of the squared magnitude : the magnitude scaled by 2^30 */
+    arm_sqrt_q31((((q31_t) (q15_t) bin * (q15_t) bin) >> 1) +
+                 (((q31_t) (q15_t) (bin >> 16) * (q15_t) (bin >> 16)) >> 1), &root);
+
+    pMag[k] = root;
+  }
+
+  /* The energies are the magnitudes scaled by 2^45, fftLen and the normalization of the frame */
+  logOffset = (45 + shift - (31 - (int32_t) __CLZ(fftLen))) << 24;
+
+  for (i = 0U; i < nbMelFilters; i++)
+  {
+    pIn = pMag + S->filterPos[i];
+    acc = 0;
+
+    for (k = 0U; k < S->filterLengths[i]; k++)
+    {
+      acc += (q63_t) *pIn++ * *pCoefs++;
+    }
+
+    /* Natural logarithm in 8.24 format. The 1 is avoiding the logarithm of 0. */
+    pLog[i] = (q31_t) (((q63_t) (mfcc_log2_q63(acc + 1) - logOffset) * MFCC_LN2_Q31) >> 31);
+  }
+
+  /* DCT-II of the logarithms */
+  for (i = 0U; i < S->nbDctOutputs; i++)
+  {
+    acc = 0;
+
+    for (k = 0U; k < nbMelFilters; k++)
+    {
+      acc += (q63_t) pDct[k] * pLog[k];
+    }
+
+    /* 1.15 coefficients by 8.24 logarithms to 8.7 */
+    pDst[i] = (q15_t) __SSAT((q31_t) ((acc + 0x80000000LL) >> 32), 16);
+    pDct += nbMelFilters;
+  }
+}
+
+/**
+  @} end of MFCC group
+ */
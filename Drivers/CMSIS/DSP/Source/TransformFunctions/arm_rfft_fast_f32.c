@@ -285,6 +285,11 @@ void merge_rfft_f32(
                    - value = 0: RFFT
                    - value = 1: RIFFT
   @return        none
+
+  @par           Buffers
+                   Both buffers have <code>fftLen</code> values. The input buffer is modified by the forward transform.
+                   With ARM_MATH_X86_SIMD, the complex FFT is arm_cfft_stockham_f32() and the unused buffer is its
+                   work buffer : the inverse transform then also modifies the input buffer.
 */
 
 void arm_rfft_fast_f32(
@@ -303,12 +308,20 @@ void arm_rfft_fast_f32(
       merge_rfft_f32(S, p, pOut);
 
       /* Complex radix-4 IFFT process */
+#if defined(ARM_MATH_X86_SIMD)
+      arm_cfft_stockham_f32( Sint, pOut, p, ifftFlag);
+#else
       arm_cfft_f32( Sint, pOut, ifftFlag, 1);
+#endif /* defined(ARM_MATH_X86_SIMD) */
    }
    else
    {
       /* Calculation of RFFT of input */
+#if defined(ARM_MATH_X86_SIMD)
+      arm_cfft_stockham_f32( Sint, p, pOut, ifftFlag);
+#else
       arm_cfft_f32( Sint, p, ifftFlag, 1);
+#endif /* defined(ARM_MATH_X86_SIMD) */
 
       /*  Real FFT extraction */
       stage_rfft_f32(S, p, pOut);
@@ -0,0 +1,293 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SlidingDFT Sliding DFT
+
+  The sliding DFT updates a few bins of the DFT of the last <code>windowLen</code>
+  samples at each new sample, so a detector can react at any sample without computing
+  an FFT at each hop. Each bin <code>k</code> of angular frequency
+  <code>w = 2*pi*k/windowLen</code> is updated with one complex multiplication per sample:
+  <pre>
+      X[n] = exp(i*w) * (r*X[n-1] + x[n] - r^windowLen*x[n-windowLen])
+  </pre>
+  With the damping factor <code>r = 1</code>, the bins are the bins of the DFT of the
+  window <code>{x[n-windowLen+1], ..., x[n]}</code>, as computed by ::arm_rfft_fast_f32
+  with <code>fftLen = windowLen</code>. The bins are complex values (real and imaginary parts).
+
+  @par           Damping
+                   The rounding errors of the recurrence are not removed by the subtraction of
+                   the old sample, so the bins are slowly drifting when they are updated for a
+                   long time. A damping factor slightly below 1 makes the errors decay; the
+                   bins are then the DFT of the window weighted by <code>r^m</code>,
+                   <code>m</code> being the age of the sample.
+
+  @par           Cost
+                   The cost is one complex multiply-accumulate per sample and per bin. The bins
+                   are processed in parallel by the SIMD lanes (4 with Neon, ARM_X86_LANES_F32
+                   with the x86 extensions). ::arm_goertzel_f32 is cheaper (one multiply-accumulate
+                   per sample and per frequency) when the power is only needed once per block.
+
+  @par           Coefficient Ordering
+                   The coefficients are the cosines of the <code>numBins</code> angular frequencies,
+                   followed by their sines, like for the Goertzel filters. The frequencies must be
+                   bins of a DFT of length <code>windowLen</code>.
+
+  @par           Instance Structure
+                   The coefficients, the window of the last input samples and the bins are
+                   stored in an instance data structure. The initialization function clears the
+                   window and the bins.
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Sliding DFT of a block of floating-point samples.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the <code>numBins</code> complex bins (<code>2*numBins</code>
+                            values) of the last <code>windowLen</code> samples
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pCos = S->pCoeffs;                  /* Cosines of the frequencies */
+  const float32_t *pSin = S->pCoeffs + S->numBins;     /* Sines of the frequencies */
+        float32_t *pRe = S->pBins;                     /* Real parts of the bins */
+        float32_t *pIm = S->pBins + S->numBins;        /* Imaginary parts of the bins */
+  const float32_t *px;                                 /* New samples */
+  const float32_t *pOld;                               /* Samples leaving the window */
+        float32_t r = S->damping;                      /* Damping factor */
+        float32_t rN = S->dampingN;                    /* Damping factor of the old samples */
+        float32_t c, s, rc, rs, re, im, a, d;          /* Coefficients, bin and temporaries */
+        uint32_t numBins = S->numBins;                 /* Number of bins */
+        uint32_t windowLen = S->windowLen;             /* Length of the window */
+        uint32_t index = S->stateIndex;                /* Oldest sample of the window */
+        uint32_t blkCnt, sample, k;                    /* Loop counters */
+
+#if defined(ARM_MATH_NEON)
+        float32x4_t cV, sV, rcV, rsV, reV, imV, aV, dV; /* 4 bins */
+#elif defined(ARM_MATH_X86_SIMD)
+        arm_x86_f32v_t cV, sV, rcV, rsV, reV, imV, aV, dV; /* ARM_X86_LANES_F32 bins */
+#endif
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t c1, s1, rc1, rs1, re1, im1, a1;      /* Second bin */
+#endif
+
+  while (blockSize > 0U)
+  {
+    /* The samples are processed up to the end of the circular window buffer */
+    blkCnt = windowLen - index;
+    blkCnt = (blockSize < blkCnt) ? blockSize : blkCnt;
+    pOld = S->pState + index;
+
+    k = 0U;
+
+#if defined(ARM_MATH_NEON)
+
+    /* 4 bins at a time */
+    while ((k + 4U) <= numBins)
+    {
+      cV = vld1q_f32(pCos + k);
+      sV = vld1q_f32(pSin + k);
+      rcV = vmulq_n_f32(cV, r);
+      rsV = vmulq_n_f32(sV, r);
+      reV = vld1q_f32(pRe + k);
+      imV = vld1q_f32(pIm + k);
+
+      px = pSrc;
+      sample = 0U;
+
+      while (sample < blkCnt)
+      {
+        /* X[n] = r*exp(i*w)*X[n-1] + exp(i*w)*(x[n] - r^N*x[n-N]) */
+        dV = vdupq_n_f32(px[sample] - (rN * pOld[sample]));
+        aV = vmlaq_f32(vmlsq_f32(vmulq_f32(cV, dV), rsV, imV), rcV, reV);
+        imV = vmlaq_f32(vmlaq_f32(vmulq_f32(sV, dV), rcV, imV), rsV, reV);
+        reV = aV;
+
+        sample++;
+      }
+
+      vst1q_f32(pRe + k, reV);
+      vst1q_f32(pIm + k, imV);
+
+      k += 4U;
+    }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+    /* ARM_X86_LANES_F32 bins at a time */
+    while ((k + ARM_X86_LANES_F32) <= numBins)
+    {
+      cV = __arm_vec_load_f32_x86(pCos + k);
+      sV = __arm_vec_load_f32_x86(pSin + k);
+      rcV = __arm_vec_mul_f32_x86(cV, __arm_vec_dup_f32_x86(r));
+      rsV = __arm_vec_mul_f32_x86(sV, __arm_vec_dup_f32_x86(r));
+      reV = __arm_vec_load_f32_x86(pRe + k);
+      imV = __arm_vec_load_f32_x86(pIm + k);
+
+      px = pSrc;
+      sample = 0U;
+
+      while (sample < blkCnt)
+      {
+        /* X[n] = r*exp(i*w)*X[n-1] + exp(i*w)*(x[n] - r^N*x[n-N]) */
+        dV = __arm_vec_dup_f32_x86(px[sample] - (rN * pOld[sample]));
+        aV = __arm_vec_mla_f32_x86(__arm_vec_sub_f32_x86(__arm_vec_mul_f32_x86(cV, dV),
+                                                         __arm_vec_mul_f32_x86(rsV, imV)), rcV, reV);
+        imV = __arm_vec_mla_f32_x86(__arm_vec_mla_f32_x86(__arm_vec_mul_f32_x86(sV, dV), rcV, imV), rsV, reV);
+        reV = aV;
+
+        sample++;
+      }
+
+      __arm_vec_store_f32_x86(pRe + k, reV);
+      __arm_vec_store_f32_x86(pIm + k, imV);
+
+      k += ARM_X86_LANES_F32;
+    }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* 2 bins at a time */
+    while ((k + 2U) <= numBins)
+    {
+      c = pCos[k];
+      s = pSin[k];
+      c1 = pCos[k + 1U];
+      s1 = pSin[k + 1U];
+      rc = r * c;
+      rs = r * s;
+      rc1 = r * c1;
+      rs1 = r * s1;
+      re = pRe[k];
+      im = pIm[k];
+      re1 = pRe[k + 1U];
+      im1 = pIm[k + 1U];
+
+      px = pSrc;
+      sample = 0U;
+
+      while (sample < blkCnt)
+      {
+        /* X[n] = r*exp(i*w)*X[n-1] + exp(i*w)*(x[n] - r^N*x[n-N]) */
+        d = px[sample] - (rN * pOld[sample]);
+        a = ((c * d) - (rs * im)) + (rc * re);
+        im = ((s * d) + (rc * im)) + (rs * re);
+        re = a;
+        a1 = ((c1 * d) - (rs1 * im1)) + (rc1 * re1);
+        im1 = ((s1 * d) + (rc1 * im1)) + (rs1 * re1);
+        re1 = a1;
+
+        sample++;
+      }
+
+      pRe[k] = re;
+      pIm[k] = im;
+      pRe[k + 1U] = re1;
+      pIm[k + 1U] = im1;
+
+      k += 2U;
+    }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    /* Remaining bins */
+    while (k < numBins)
+    {
+      c = pCos[k];
+      s = pSin[k];
+      rc = r * c;
+      rs = r * s;
+      re = pRe[k];
+      im = pIm[k];
+
+      px = pSrc;
+      sample = 0U;
+
+      while (sample < blkCnt)
+      {
+        /* X[n] = r*exp(i*w)*X[n-1] + exp(i*w)*(x[n] - r^N*x[n-N]) */
+        d = px[sample] - (rN * pOld[sample]);
+        a = ((c * d) - (rs * im)) + (rc * re);
+        im = ((s * d) + (rc * im)) + (rs * re);
+        re = a;
+
+        sample++;
+      }
+
+      pRe[k] = re;
+      pIm[k] = im;
+
+      k++;
+    }
+
+    /* The new samples replace the oldest samples of the window */
+    memcpy(S->pState + index, pSrc, blkCnt * sizeof(float32_t));
+
+    index += blkCnt;
+    if (index == windowLen)
+    {
+      index = 0U;
+    }
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+  }
+
+  S->stateIndex = (uint16_t) index;
+
+  /* Bins of the last window, as complex values */
+  for (k = 0U; k < numBins; k++)
+  {
+    pDst[2U * k]      = pRe[k];
+    pDst[2U * k + 1U] = pIm[k];
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
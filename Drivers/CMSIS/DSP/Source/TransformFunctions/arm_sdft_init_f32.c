@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_f32.c
+ * Description:  Initialization function of the floating-point sliding DFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding DFT.
+  @param[out]    S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     windowLen  length of the sliding window
+  @param[in]     numBins    number of bins
+  @param[in]     pCoeffs    points to the cosines then the sines of the <code>numBins</code>
+                            angular frequencies <code>2*pi*k/windowLen</code> (<code>2*numBins</code> values)
+  @param[in]     damping    damping factor of the recurrence (0 to 1, 1 for no damping)
+  @param[in]     pState     points to the window buffer of <code>windowLen</code> values
+  @param[in]     pBins      points to the bins buffer of <code>2*numBins</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>windowLen</code> is 0 or
+                     <code>damping</code> is not in the range ]0, 1]
+ */
+
+arm_status arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t windowLen,
+        uint16_t numBins,
+  const float32_t * pCoeffs,
+        float32_t damping,
+        float32_t * pState,
+        float32_t * pBins)
+{
+  float32_t dampingN = 1.0f;
+  uint32_t i;
+
+  if ((windowLen == 0U) || !(damping > 0.0f) || (damping > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < windowLen; i++)
+  {
+    dampingN *= damping;
+  }
+
+  S->windowLen = windowLen;
+  S->numBins = numBins;
+  S->stateIndex = 0U;
+  S->damping = damping;
+  S->dampingN = dampingN;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pBins = pBins;
+
+  /* Clear the window and the bins */
+  memset(pState, 0, windowLen * sizeof(float32_t));
+  memset(pBins, 0, 2U * numBins * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of SlidingDFT group
+ */
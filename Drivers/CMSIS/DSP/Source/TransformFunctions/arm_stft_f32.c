@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point short-time Fourier transform
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFT Short-Time Fourier Transform
+
+  These functions compute the short-time Fourier transform (spectrogram) of a stream of samples.
+  They are the first stage of spectral analysis, pitch detection or MFCC feature extraction.
+  A frame of <code>fftLen</code> samples is analysed every <code>hopSize</code> samples :
+  the frame is multiplied by a window, transformed with a real FFT and the magnitude or
+  the power of its <code>fftLen/2+1</code> bins (DC to Nyquist) is written into a ring of frames.
+
+  @par           Algorithm
+                   The last <code>fftLen</code> input samples are kept in a circular buffer.
+                   Each new sample is copied once into this buffer, whatever the overlap of the frames is.
+                   When <code>hopSize</code> new samples have been received, the window is applied
+                   while reading the circular buffer in time order. The product is written directly
+                   into the input of the real FFT, which is also its working buffer,
+                   so there is no other copy of the frame.
+  @par
+                   The processing function accepts any number of samples (the half of a DMA buffer for instance),
+                   which does not need to be related to <code>hopSize</code>. It returns the number of new frames.
+                   The circular buffer is cleared by the initialization function : the first frame is computed after
+                   <code>hopSize</code> samples, as if the input was preceded by <code>fftLen-hopSize</code> zeros.
+
+  @par           Frame Ring
+                   <code>pFrames</code> contains <code>numFrames</code> frames of <code>fftLen/2+1</code> values.
+                   The frames are written one after the other and the ring wraps around when it is full :
+                   <code>frameIdx</code> in the instance is the index of the next frame to be written,
+                   so the most recent frame is at index <code>(frameIdx+numFrames-1) % numFrames</code>.
+                   With <code>numFrames=1</code>, only the last frame is kept.
+
+  @par           Window
+                   The window is a table of <code>fftLen</code> values provided by the application
+                   (a Hann window for instance). It is not modified and can be shared among several instances.
+                   With a rectangular window (all coefficients equal to 1), the function is computing the
+                   spectrum of consecutive frames.
+
+  @par           Instance Structure
+                   The buffers, the window, the parameters and the real FFT instance are stored in an instance data structure.
+                   A separate instance structure must be defined for each stream.
+
+  @par           Initialization Functions
+                   The initialization function checks the parameters, initializes the real FFT and clears the circular buffer.
+                   The tables of the real FFT of length <code>fftLen</code> must be included in the build.
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point short-time Fourier transform.
+  @param[in,out] S          points to an instance of the floating-point STFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames written into the frame ring
+ */
+uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t fftLen = S->fftLen;                   /* Length of a frame */
+        uint32_t hopSize = S->hopSize;                 /* Number of samples between two frames */
+        uint32_t numBins = (fftLen >> 1U) + 1U;        /* Number of bins of a frame */
+        uint32_t writeIdx = S->writeIdx;               /* Position of the next sample in the circular buffer */
+        uint32_t hopCnt = S->hopCnt;                   /* Number of samples since the last frame */
+        uint32_t frameIdx = S->frameIdx;               /* Position of the next frame in the ring */
+        float32_t *pBuf = S->pState;                   /* Last fftLen input samples */
+        float32_t *pWork = pBuf + fftLen;              /* Windowed frame (input of the real FFT) */
+        float32_t *pSpec = pWork + fftLen;             /* Packed spectrum of the frame */
+        float32_t *pFrame;                             /* Output frame */
+        uint32_t blkCnt, first;                        /* Number of samples */
+        uint32_t nbFrames = 0U;                        /* Number of new frames */
+
+  while (blockSize > 0U)
+  {
+    /* Copy the samples up to the next frame or the end of the circular buffer */
+    blkCnt = hopSize - hopCnt;
+
+    if (blkCnt > (fftLen - writeIdx))
+    {
+      blkCnt = fftLen - writeIdx;
+    }
+
+    if (blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+
+    arm_copy_f32(pSrc, pBuf + writeIdx, blkCnt);
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    hopCnt += blkCnt;
+    writeIdx += blkCnt;
+
+    if (writeIdx == fftLen)
+    {
+      writeIdx = 0U;
+    }
+
+    if (hopCnt == hopSize)
+    {
+      /* The oldest sample is at writeIdx : apply the window in time order */
+      first = fftLen - writeIdx;
+
+      arm_mult_f32(pBuf + writeIdx, S->pWindow, pWork, first);
+      arm_mult_f32(pBuf, S->pWindow + first, pWork + first, writeIdx);
+
+      arm_rfft_fast_f32(&S->rfft, pWork, pSpec, 0);
+
+      /* The first complex value of the packed real spectrum contains the real DC and Nyquist bins */
+      pFrame = S->pFrames + (frameIdx * numBins);
+
+      if (S->powerFlag == 0U)
+      {
+        pFrame[0] = fabsf(pSpec[0]);
+        pFrame[numBins - 1U] = fabsf(pSpec[1]);
+        arm_cmplx_mag_f32(pSpec + 2, pFrame + 1, numBins - 2U);
+      }
+      else
+      {
+        pFrame[0] = pSpec[0] * pSpec[0];
+        pFrame[numBins - 1U] = pSpec[1] * pSpec[1];
+        arm_cmplx_mag_squared_f32(pSpec + 2, pFrame + 1, numBins - 2U);
+      }
+
+      /* Next frame of the ring */
+      frameIdx++;
+      if (frameIdx == S->numFrames)
+      {
+        frameIdx = 0U;
+      }
+
+      hopCnt = 0U;
+      nbFrames++;
+    }
+  }
+
+  S->writeIdx = (uint16_t) writeIdx;
+  S->hopCnt = (uint16_t) hopCnt;
+  S->frameIdx = (uint16_t) frameIdx;
+
+  return (nbFrames);
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_q15.c
+ * Description:  Initialization function for the Q15 short-time Fourier transform
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 short-time Fourier transform.
+  @param[in,out] S          points to an instance of the Q15 STFT structure
+  @param[in]     fftLen     length of a frame (32 to 8192, power of 2)
+  @param[in]     hopSize    number of samples between two frames (1 to <code>fftLen</code>)
+  @param[in]     pWindow    points to the window of <code>fftLen</code> values
+  @param[in]     pState     points to the state buffer of <code>4*fftLen</code> values
+  @param[out]    pFrames    points to the frame ring of <code>numFrames*(fftLen/2+1)</code> values
+  @param[in]     numFrames  number of frames of the ring
+  @param[in]     powerFlag  0 for magnitude frames, 1 for power frames
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+                     or <code>hopSize</code> or <code>numFrames</code> is out of range
+ */
+
+arm_status arm_stft_init_q15(
+        arm_stft_instance_q15 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const q15_t * pWindow,
+        q15_t * pState,
+        q15_t * pFrames,
+        uint16_t numFrames,
+        uint8_t powerFlag)
+{
+  arm_status status;
+
+  if ((hopSize == 0U) || (hopSize > fftLen) || (numFrames == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_rfft_init_q15(&S->rfft, fftLen, 0U, 1U);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->numFrames = numFrames;
+  S->powerFlag = powerFlag;
+  S->pWindow = pWindow;
+  S->pState = pState;
+  S->pFrames = pFrames;
+
+  /* Clear the circular buffer of the input samples */
+  memset(pState, 0, fftLen * sizeof(q15_t));
+
+  S->writeIdx = 0U;
+  S->hopCnt = 0U;
+  S->frameIdx = 0U;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_q15.c
+ * Description:  Q15 short-time Fourier transform
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 short-time Fourier transform.
+  @param[in,out] S          points to an instance of the Q15 STFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+  @return        number of frames written into the frame ring
+
+  @par           Scaling and Overflow Behavior
+                   The window is applied with ::arm_mult_q15 and the frame is transformed with ::arm_rfft_q15,
+                   which is scaling its output down by <code>fftLen</code>.
+                   The magnitude frames are in 2.14 format like the output of ::arm_cmplx_mag_q15,
+                   but the squared magnitude is not truncated to 16 bits before the square root.
+                   The power frames are computed with ::arm_cmplx_mag_squared_q15 and are in 3.13 format.
+ */
+uint32_t arm_stft_q15(
+        arm_stft_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t fftLen = S->fftLen;                   /* Length of a frame */
+        uint32_t hopSize = S->hopSize;                 /* Number of samples between two frames */
+        uint32_t numBins = (fftLen >> 1U) + 1U;        /* Number of bins of a frame */
+        uint32_t writeIdx = S->writeIdx;               /* Position of the next sample in the circular buffer */
+        uint32_t hopCnt = S->hopCnt;                   /* Number of samples since the last frame */
+        uint32_t frameIdx = S->frameIdx;               /* Position of the next frame in the ring */
+        q15_t *pBuf = S->pState;                       /* Last fftLen input samples */
+        q15_t *pWork = pBuf + fftLen;                  /* Windowed frame (input of the real FFT) */
+        q15_t *pSpec = pWork + fftLen;                 /* Spectrum of the frame */
+        q15_t *pFrame;                                 /* Output frame */
+        q15_t real, imag;                              /* Bin of the spectrum */
+        q31_t root;                                    /* Magnitude of a bin */
+        uint32_t blkCnt, first, k;                     /* Number of samples, bin counter */
+        uint32_t nbFrames = 0U;                        /* Number of new frames */
+
+  while (blockSize > 0U)
+  {
+    /* Copy the samples up to the next frame or the end of the circular buffer */
+    blkCnt = hopSize - hopCnt;
+
+    if (blkCnt > (fftLen - writeIdx))
+    {
+      blkCnt = fftLen - writeIdx;
+    }
+
+    if (blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+
+    arm_copy_q15(pSrc, pBuf + writeIdx, blkCnt);
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    hopCnt += blkCnt;
+    writeIdx += blkCnt;
+
+    if (writeIdx == fftLen)
+    {
+      writeIdx = 0U;
+    }
+
+    if (hopCnt == hopSize)
+    {
+      /* The oldest sample is at writeIdx : apply the window in time order */
+      first = fftLen - writeIdx;
+
+      arm_mult_q15(pBuf + writeIdx, S->pWindow, pWork, first);
+      arm_mult_q15(pBuf, S->pWindow + first, pWork + first, writeIdx);
+
+      arm_rfft_q15(&S->rfft, pWork, pSpec);
+
+      /* The bins 0 to fftLen/2 are the first complex values of the spectrum */
+      pFrame = S->pFrames + (frameIdx * numBins);
+
+      if (S->powerFlag == 0U)
+      {
+        /* The squared magnitude is kept on 31 bits before the square root :
+           the small bins are losing most of their resolution with arm_cmplx_mag_q15 */
+        for (k = 0U; k < numBins; k++)
+        {
+          real = pSpec[2U * k];
+          imag = pSpec[(2U * k) + 1U];
+
+          arm_sqrt_q31((((q31_t) real * real) >> 1) + (((q31_t) imag * imag) >> 1), &root);
+
+          /* 1.31 square root of a quarter of the squared magnitude to 2.14 */
+          pFrame[k] = (q15_t) (root >> 16);
+        }
+      }
+      else
+      {
+        arm_cmplx_mag_squared_q15(pSpec, pFrame, numBins);
+      }
+
+      /* Next frame of the ring */
+      frameIdx++;
+      if (frameIdx == S->numFrames)
+      {
+        frameIdx = 0U;
+      }
+
+      hopCnt = 0U;
+      nbFrames++;
+    }
+  }
+
+  S->writeIdx = (uint16_t) writeIdx;
+  S->hopCnt = (uint16_t) hopCnt;
+  S->frameIdx = (uint16_t) frameIdx;
+
+  return (nbFrames);
+}
+
+/**
+  @} end of STFT group
+ */
@@ -5,6 +5,9 @@ SET(CORTEXM ON)
 option(FASTMATHCOMPUTATIONS "Fast Math enabled" ON)
 option(NEON "Neon acceleration" OFF)
 option(NEONEXPERIMENTAL "Neon experimental acceleration" OFF)
+option(HOST "Native host build without SIMD acceleration" OFF)
+option(X86SIMD "x86 SSE2 acceleration for host builds" OFF)
+option(X86AVX2 "x86 AVX2 and FMA acceleration for host builds" OFF)
 option(LOOPUNROLL "Loop unrolling" ON)
 option(ROUNDING "Rounding" OFF)
 option(MATRIXCHECK "Matrix Checks" OFF)
@@ -15,7 +18,9 @@ option(MATRIXCHECK "Matrix Checks" OFF)
 #
 
 function(configdsp PROJECTNAME DSP)
-  target_compile_options(${PROJECTNAME} PUBLIC "-mfloat-abi=hard;-mlittle-endian")
+  if (NOT (HOST OR X86SIMD OR X86AVX2))
+    target_compile_options(${PROJECTNAME} PUBLIC "-mfloat-abi=hard;-mlittle-endian")
+  endif()
 
   if (CONFIGTABLE)
       # Public because initialization for FFT may be defined in client code 
@@ -138,4 +143,22 @@ function(configdsp PROJECTNAME DSP)
   if (NEONEXPERIMENTAL AND NOT CORTEXM)
     target_compile_definitions(${PROJECTNAME} PRIVATE ARM_MATH_NEON_EXPERIMENTAL __FPU_PRESENT)
   endif()
+
+  ###################
+  #
+  # NATIVE HOST
+  #
+
+  if (HOST OR X86SIMD OR X86AVX2)
+    target_include_directories(${PROJECTNAME} PUBLIC "${DSP}/../../Core/Include")
+  endif()
+
+  if (X86SIMD OR X86AVX2)
+    # Public : the df2T f32 coefficient layout depends on it
+    target_compile_definitions(${PROJECTNAME} PUBLIC ARM_MATH_X86_SIMD)
+  endif()
+
+  if (X86AVX2)
+    target_compile_options(${PROJECTNAME} PUBLIC "-mavx2;-mfma")
+  endif()
 endfunction()
\ No newline at end of file
@@ -0,0 +1,38 @@
+# Selection of the FFT tables from the sources of an application.
+#
+# fftconfig(main.c src/dsp.c ...)
+#
+# The sources (files or folders) are scanned by fftconfig.py for the FFT
+# initializations and the constant CFFT instances. CONFIGTABLE and the
+# CFFT_*, RFFT_* and DCT4_* options of these FFTs are set in the cache, the
+# other FFT options are set to OFF. The macro must be used before the
+# add_subdirectory of the CMSIS-DSP Source folder.
+#
+# The tables used and the size saved compared to all the FFT tables are
+# printed. The configuration is done again when a source is modified.
+
+SET(FFTCONFIG_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/fftconfig.py)
+
+macro(fftconfig)
+  find_package(PythonInterp 3 REQUIRED)
+
+  SET(FFTCONFIG_SOURCES)
+  foreach(SRC ${ARGN})
+    get_filename_component(SRCPATH ${SRC} ABSOLUTE)
+    list(APPEND FFTCONFIG_SOURCES ${SRCPATH})
+    if (NOT IS_DIRECTORY ${SRCPATH})
+      set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${SRCPATH})
+    endif()
+  endforeach()
+
+  execute_process(COMMAND ${PYTHON_EXECUTABLE} ${FFTCONFIG_SCRIPT}
+                          ${FFTCONFIG_SOURCES}
+                          -o ${CMAKE_BINARY_DIR}/fftconfig_generated.cmake
+                  RESULT_VARIABLE FFTCONFIG_RESULT)
+
+  if (NOT FFTCONFIG_RESULT EQUAL 0)
+    message(FATAL_ERROR "fftconfig.py failed")
+  endif()
+
+  include(${CMAKE_BINARY_DIR}/fftconfig_generated.cmake)
+endmacro()
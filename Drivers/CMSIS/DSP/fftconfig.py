@@ -0,0 +1,278 @@
+#!/usr/bin/python3
+
+# Select the FFT tables used by an application.
+#
+# The sources of the application are scanned for the FFT initializations
+# (arm_rfft_fast_init_f32, arm_rfft_init_q15, arm_dct4_init_f32 ...) and the
+# constant CFFT instances (arm_cfft_sR_f32_len256 ...). The corresponding
+# CFFT_*, RFFT_*, DCT4_* options of fft.cmake are written to a cmake file
+# with CONFIGTABLE, so only the twiddle and bit reversal tables of these
+# FFTs are compiled in arm_common_tables.c.
+#
+# The size of the selected tables is computed from arm_common_tables.h and
+# compared with the size of all the FFT tables (default build without
+# CONFIGTABLE, or ALLFFT).
+#
+# e.g.: fftconfig.py main.c src/ -o fftconfig.cmake
+#
+# The generated file is used by the fftconfig macro of fftconfig.cmake.
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+
+# Initialization functions : option prefix, index of the length argument
+# and factor between this argument and the length of the FFT.
+INIT_FUNCTIONS = {
+    "arm_rfft_fast_init_f32": ("RFFT_FAST_F32", 1, 1),
+    "arm_rfft_init_f32":      ("RFFT_F32", 2, 1),
+    "arm_rfft_init_q31":      ("RFFT_Q31", 1, 1),
+    "arm_rfft_init_q15":      ("RFFT_Q15", 1, 1),
+    "arm_dct4_init_f32":      ("DCT4_F32", 3, 1),
+    "arm_dct4_init_q31":      ("DCT4_Q31", 3, 1),
+    "arm_dct4_init_q15":      ("DCT4_Q15", 3, 1),
+    "arm_stft_init_f32":      ("RFFT_FAST_F32", 1, 1),
+    "arm_stft_init_q15":      ("RFFT_Q15", 1, 1),
+    "arm_mfcc_init_f32":      ("RFFT_FAST_F32", 1, 1),
+    "arm_mfcc_init_q15":      ("RFFT_Q15", 1, 1),
+    "arm_fir_fft_init_f32":   ("RFFT_FAST_F32", 5, 2),
+}
+
+# The length is part of the name of the symbol
+NAMED_TABLES = [
+    (re.compile(r"\barm_cfft_sR_(f32|q31|q15)_len(\d+)\b"),
+     lambda m: "CFFT_{0}_{1}".format(m.group(1).upper(), m.group(2))),
+    (re.compile(r"\barm_rfft_(\d+)_fast_init_f32\b"),
+     lambda m: "RFFT_FAST_F32_{0}".format(m.group(1))),
+]
+
+# Using the tables of the 4096 point CFFT, which have no option of their own
+NOT_CONFIGURABLE = re.compile(r"\barm_cfft_radix[24]_init_(f32|q31|q15)\b")
+
+TYPE_SIZES = {"float32_t": 4, "q31_t": 4, "q15_t": 2, "uint16_t": 2}
+
+SOURCE_EXT = (".c", ".h", ".cpp", ".cc", ".hpp")
+
+
+def stripComments(text):
+    text = re.sub(r"/\*.*?\*/", lambda m: "\n" * m.group(0).count("\n"), text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def sourceFiles(paths):
+    for p in paths:
+        if os.path.isdir(p):
+            for root, dirs, files in os.walk(p):
+                for f in sorted(files):
+                    if f.endswith(SOURCE_EXT):
+                        yield os.path.join(root, f)
+        else:
+            yield p
+
+
+def callArguments(text, pos):
+    """Arguments of the call whose opening parenthesis is at pos."""
+    depth = 0
+    args = []
+    current = ""
+    for c in text[pos:]:
+        if c == "(":
+            depth += 1
+            if depth == 1:
+                continue
+        elif c == ")":
+            depth -= 1
+            if depth == 0:
+                args.append(current.strip())
+                return args
+        elif c == "," and depth == 1:
+            args.append(current.strip())
+            current = ""
+            continue
+        current += c
+    return None
+
+
+def evalLength(expr, defines, depth=0):
+    """Value of a length argument, or None if it is not a constant."""
+    expr = re.sub(r"\(\s*(?:const\s+)?u?int(?:8|16|32)_t\s*\)", "", expr)
+    expr = re.sub(r"\b(\d+)[uUlL]+\b", r"\1", expr)
+    if depth < 8:
+        for name in set(re.findall(r"\b[A-Za-z_]\w*\b", expr)):
+            if name in defines:
+                value = evalLength(defines[name], defines, depth + 1)
+                if value is None:
+                    return None
+                expr = re.sub(r"\b{0}\b".format(name), str(value), expr)
+    if not re.fullmatch(r"[\d\s+\-*/()<>]+", expr):
+        return None
+    try:
+        return int(eval(expr.replace("/", "//")))
+    except Exception:
+        return None
+
+
+def scanSources(paths):
+    """Options used by the sources : {option: [locations]}, warnings."""
+    texts = {}
+    defines = {}
+    for f in sourceFiles(paths):
+        with open(f, errors="replace") as src:
+            texts[f] = stripComments(src.read())
+        for m in re.finditer(r"^\s*#\s*define\s+(\w+)\s+([^\n]+)$", texts[f], flags=re.M):
+            defines[m.group(1)] = m.group(2).strip()
+
+    used = {}
+    warnings = []
+    initCall = re.compile(r"\b({0})\s*\(".format("|".join(INIT_FUNCTIONS)))
+
+    for f, text in texts.items():
+        def where(pos):
+            return "{0}:{1}".format(f, text.count("\n", 0, pos) + 1)
+
+        for regexp, option in NAMED_TABLES:
+            for m in regexp.finditer(text):
+                used.setdefault(option(m), []).append(where(m.start()))
+
+        for m in initCall.finditer(text):
+            prefix, argIdx, factor = INIT_FUNCTIONS[m.group(1)]
+            args = callArguments(text, m.end() - 1)
+            if args is None or len(args) <= argIdx:
+                # Declaration or macro which is not a call
+                continue
+            length = evalLength(args[argIdx], defines)
+            if length is None:
+                warnings.append("{0}: length '{1}' of {2} is not a constant, "
+                                "all the {3} lengths are selected".format(
+                                    where(m.start()), args[argIdx], m.group(1), prefix))
+                used.setdefault(prefix + "_*", []).append(where(m.start()))
+            else:
+                used.setdefault("{0}_{1}".format(prefix, length * factor), []).append(where(m.start()))
+
+        for m in NOT_CONFIGURABLE.finditer(text):
+            warnings.append("{0}: {1} is using the tables of the 4096 point FFT "
+                            "which have no option, use ALLFFT".format(where(m.start()), m.group(0)))
+
+    return used, warnings
+
+
+def parseFftCmake(path):
+    """Tables of each option of fft.cmake : {option: [ARM_TABLE symbols]}."""
+    options = {}
+    current = None
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"\s*if\s*\(\s*CONFIGTABLE\s+AND\s+(\w+)\s*\)", line)
+            if m:
+                current = options.setdefault(m.group(1), [])
+                continue
+            if re.match(r"\s*endif", line):
+                current = None
+                continue
+            m = re.search(r"\b(ARM_TABLE_\w+)", line)
+            if m and current is not None and m.group(1) not in current:
+                current.append(m.group(1))
+    return options
+
+
+def parseTables(path):
+    """Arrays of each table symbol of arm_common_tables.h : {symbol: [(name, bytes)]}."""
+    macros = {"FAST_MATH_TABLE_SIZE": "512"}
+    tables = {}
+    current = None
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"\s*#\s*if\b.*defined\((ARM_TABLE_\w+)\)", line)
+            if m:
+                current = tables.setdefault(m.group(1), [])
+                continue
+            if re.match(r"\s*#\s*endif", line):
+                current = None
+                continue
+            m = re.match(r"\s*#\s*define\s+(\w+)\s+\(\(uint16_t\)\s*(\d+)\)", line)
+            if m:
+                macros[m.group(1)] = m.group(2)
+                continue
+            m = re.match(r"\s*extern\s+const\s+(\w+)\s+(\w+)\s*\[(.*)\]\s*;", line)
+            if m and current is not None:
+                size = evalLength(m.group(3), macros)
+                current.append((m.group(2), size * TYPE_SIZES[m.group(1)]))
+    return tables
+
+
+def tablesBytes(symbols, tables):
+    return sum(b for s in symbols for _, b in tables.get(s, []))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Select the FFT tables used by an application")
+    parser.add_argument("sources", nargs="+", help="source files or folders of the application")
+    parser.add_argument("-o", "--output", help="generated cmake file (default stdout)")
+    parser.add_argument("--fft-cmake", default=os.path.join(ROOT, "fft.cmake"),
+                        help="fft.cmake of CMSIS-DSP")
+    parser.add_argument("--tables", default=os.path.join(ROOT, "Include", "arm_common_tables.h"),
+                        help="arm_common_tables.h of CMSIS-DSP")
+    args = parser.parse_args()
+
+    options = parseFftCmake(args.fft_cmake)
+    tables = parseTables(args.tables)
+    used, warnings = scanSources(args.sources)
+
+    selected = {}
+    for option, where in sorted(used.items()):
+        if option.endswith("_*"):
+            names = [o for o in options if o.startswith(option[:-1])
+                     and o[len(option) - 1:].isdigit()]
+        elif option in options:
+            names = [option]
+        else:
+            warnings.append("{0}: {1} is not a supported FFT".format(where[0], option))
+            names = []
+        for name in names:
+            selected.setdefault(name, []).extend(where)
+
+    symbols = []
+    for name in sorted(selected):
+        symbols += [s for s in options[name] if s not in symbols]
+    allSymbols = []
+    for name in options:
+        allSymbols += [s for s in options[name] if s not in allSymbols]
+
+    # Generated cmake file : all the FFT options are reset, so that an FFT
+    # which is no more used by the application is removed.
+    lines = ["# Generated by fftconfig.py from the sources of the application",
+             "set(CONFIGTABLE ON CACHE BOOL \"Configuration of table allowed\" FORCE)"]
+    for name in sorted(options):
+        lines.append("set({0} {1} CACHE BOOL \"\" FORCE)".format(name, "ON" if name in selected else "OFF"))
+    cmake = "\n".join(lines) + "\n"
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(cmake)
+    else:
+        sys.stdout.write(cmake)
+
+    # The report is printed on stderr so that the cmake file can be redirected
+    report = sys.stderr if not args.output else sys.stdout
+    for w in warnings:
+        print("Warning: " + w, file=report)
+    print("FFT options:", file=report)
+    for name in sorted(selected):
+        print("  {0:20} {1}".format(name, ", ".join(sorted(set(selected[name])))), file=report)
+    print("FFT tables:", file=report)
+    for s in symbols:
+        for t, b in tables.get(s, []):
+            print("  {0:32} {1:8} bytes".format(t, b), file=report)
+    usedBytes = tablesBytes(symbols, tables)
+    totalBytes = tablesBytes(allSymbols, tables)
+    print("Selected tables  : {0:8} bytes".format(usedBytes), file=report)
+    print("All FFT tables   : {0:8} bytes".format(totalBytes), file=report)
+    print("Saving           : {0:8} bytes of constant data ({1:.1f}%)".format(
+        totalBytes - usedBytes, 100.0 * (totalBytes - usedBytes) / totalBytes if totalBytes else 0.0), file=report)
+
+
+if __name__ == "__main__":
+    main()
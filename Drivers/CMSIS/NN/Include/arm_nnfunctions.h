@@ -119,6 +119,19 @@ extern    "C"
  * Each iteration, only a few column (i.e., patches) are generated and
  * computed with GEMM kernels similar to CMSIS-DSP arm_mat_mult functions.
  *
+ * The q7 and q15 functions use a power-of-two scaling for the bias and the
+ * output of a layer. The s8 functions (arm_convolve_s8, arm_depthwise_conv_s8)
+ * use the per-channel quantization of int8 models: symmetric weights with a
+ * scale per output channel, asymmetric activations with a zero-point. The
+ * accumulator of each output channel is requantized with a Q31 multiplier
+ * and a shift.
+ *
+ * The fused functions arm_convolve_HWC_q7_fast_relu_maxpool_2x2 and
+ * arm_convolve_HWC_q7_fast_relu_avepool_2x2 apply the ReLU and a 2x2
+ * pooling to each 2x2 tile of the convolution output as it is computed,
+ * so the convolution output is not stored and read back by the activation
+ * and pooling functions.
+ *
  */
 
   /**
@@ -335,6 +348,88 @@ extern    "C"
                                                   q15_t * bufferA,
                                                   q7_t * bufferB);
 
+  /**
+   * @brief Fast Q7 convolution function fused with ReLU and 2x2 max pooling
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension, i.e. after the pooling
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in,out]   bufferB     pointer to buffer space for output
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * Same output as arm_convolve_HWC_q7_fast, arm_relu_q7 and arm_maxpool_q7_HWC
+   * with a 2x2 kernel and a stride of 2, without the convolution output buffer.
+   * Same contraints as arm_convolve_HWC_q7_fast.
+   */
+
+    arm_status arm_convolve_HWC_q7_fast_relu_maxpool_2x2(const q7_t * Im_in,
+                                                         const uint16_t dim_im_in,
+                                                         const uint16_t ch_im_in,
+                                                         const q7_t * wt,
+                                                         const uint16_t ch_im_out,
+                                                         const uint16_t dim_kernel,
+                                                         const uint16_t padding,
+                                                         const uint16_t stride,
+                                                         const q7_t * bias,
+                                                         const uint16_t bias_shift,
+                                                         const uint16_t out_shift,
+                                                         q7_t * Im_out,
+                                                         const uint16_t dim_im_out,
+                                                         q15_t * bufferA,
+                                                         q7_t * bufferB);
+
+  /**
+   * @brief Fast Q7 convolution function fused with ReLU and 2x2 average pooling
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension, i.e. after the pooling
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in,out]   bufferB     pointer to buffer space for output
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * Same output as arm_convolve_HWC_q7_fast, arm_relu_q7 and a 2x2 average
+   * pooling with a stride of 2, without the convolution output buffer.
+   * Same contraints as arm_convolve_HWC_q7_fast.
+   */
+
+    arm_status arm_convolve_HWC_q7_fast_relu_avepool_2x2(const q7_t * Im_in,
+                                                         const uint16_t dim_im_in,
+                                                         const uint16_t ch_im_in,
+                                                         const q7_t * wt,
+                                                         const uint16_t ch_im_out,
+                                                         const uint16_t dim_kernel,
+                                                         const uint16_t padding,
+                                                         const uint16_t stride,
+                                                         const q7_t * bias,
+                                                         const uint16_t bias_shift,
+                                                         const uint16_t out_shift,
+                                                         q7_t * Im_out,
+                                                         const uint16_t dim_im_out,
+                                                         q15_t * bufferA,
+                                                         q7_t * bufferB);
+
   /**
    * @brief Fast Q7 version of 1x1 convolution (non-sqaure shape)
    * @param[in]       Im_in        pointer to input tensor
@@ -455,6 +550,7 @@ extern    "C"
    * some contraints:
    *   ch_im_in is multiple of 2
    *   ch_im_out is multiple of 2
+   *   dim_im_out is a multiple of 2
    */
 
     arm_status arm_convolve_HWC_q15_fast(const q15_t * Im_in,
@@ -512,6 +608,8 @@ extern    "C"
    *
    * ch_im_out is multipe of 2
    *
+   * dim_im_out_x is a multiple of 2
+   *
    */
 
     arm_status
@@ -629,6 +727,114 @@ extern    "C"
                                                              q15_t * bufferA,
                                                              q7_t * bufferB);
 
+  /**
+   * @brief s8 convolution function with per-channel requantization
+   * @param[in]       Im_in              pointer to input tensor
+   * @param[in]       dim_im_in_x        input tensor dimention x
+   * @param[in]       dim_im_in_y        input tensor dimention y
+   * @param[in]       ch_im_in           number of input tensor channels
+   * @param[in]       wt                 pointer to kernel weights
+   * @param[in]       ch_im_out          number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel_x       filter kernel size x
+   * @param[in]       dim_kernel_y       filter kernel size y
+   * @param[in]       padding_x          padding size x
+   * @param[in]       padding_y          padding size y
+   * @param[in]       stride_x           convolution stride x
+   * @param[in]       stride_y           convolution stride y
+   * @param[in]       bias               pointer to the per-channel bias, or NULL
+   * @param[in]       out_shift          pointer to the per-channel shifts of the output
+   * @param[in]       out_mult           pointer to the per-channel multipliers of the output
+   * @param[in]       input_offset       offset added to the input, i.e. the negated input zero-point.
+   *                                     Range: [-127, 128]
+   * @param[in]       out_offset         zero-point of the output. Range: [-128, 127]
+   * @param[in]       out_activation_min minimum value of the output. Range: [-128, 127]
+   * @param[in]       out_activation_max maximum value of the output. Range: [-128, 127]
+   * @param[in,out]   Im_out             pointer to output tensor
+   * @param[in]       dim_im_out_x       output tensor dimension x
+   * @param[in]       dim_im_out_y       output tensor dimension y
+   * @param[in,out]   bufferA            pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel_x*dim_kernel_y
+   */
+
+    arm_status arm_convolve_s8(const q7_t * Im_in,
+                               const uint16_t dim_im_in_x,
+                               const uint16_t dim_im_in_y,
+                               const uint16_t ch_im_in,
+                               const q7_t * wt,
+                               const uint16_t ch_im_out,
+                               const uint16_t dim_kernel_x,
+                               const uint16_t dim_kernel_y,
+                               const uint16_t padding_x,
+                               const uint16_t padding_y,
+                               const uint16_t stride_x,
+                               const uint16_t stride_y,
+                               const int32_t * bias,
+                               const int32_t * out_shift,
+                               const int32_t * out_mult,
+                               const int32_t input_offset,
+                               const int32_t out_offset,
+                               const int32_t out_activation_min,
+                               const int32_t out_activation_max,
+                               q7_t * Im_out,
+                               const uint16_t dim_im_out_x,
+                               const uint16_t dim_im_out_y,
+                               q15_t * bufferA);
+
+  /**
+   * @brief s8 depthwise convolution function with per-channel requantization
+   * @param[in]       Im_in              pointer to input tensor
+   * @param[in]       dim_im_in_x        input tensor dimention x
+   * @param[in]       dim_im_in_y        input tensor dimention y
+   * @param[in]       ch_im_in           number of input tensor channels
+   * @param[in]       wt                 pointer to kernel weights
+   * @param[in]       ch_mult            channel multiplier, i.e. number of output channels per input channel
+   * @param[in]       dim_kernel_x       filter kernel size x
+   * @param[in]       dim_kernel_y       filter kernel size y
+   * @param[in]       padding_x          padding size x
+   * @param[in]       padding_y          padding size y
+   * @param[in]       stride_x           convolution stride x
+   * @param[in]       stride_y           convolution stride y
+   * @param[in]       bias               pointer to the per-channel bias, or NULL
+   * @param[in]       out_shift          pointer to the per-channel shifts of the output
+   * @param[in]       out_mult           pointer to the per-channel multipliers of the output
+   * @param[in]       input_offset       offset added to the input, i.e. the negated input zero-point.
+   *                                     Range: [-127, 128]
+   * @param[in]       out_offset         zero-point of the output. Range: [-128, 127]
+   * @param[in]       out_activation_min minimum value of the output. Range: [-128, 127]
+   * @param[in]       out_activation_max maximum value of the output. Range: [-128, 127]
+   * @param[in,out]   Im_out             pointer to output tensor
+   * @param[in]       dim_im_out_x       output tensor dimension x
+   * @param[in]       dim_im_out_y       output tensor dimension y
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * The output tensor has ch_im_in*ch_mult channels.
+   */
+
+    arm_status arm_depthwise_conv_s8(const q7_t * Im_in,
+                                     const uint16_t dim_im_in_x,
+                                     const uint16_t dim_im_in_y,
+                                     const uint16_t ch_im_in,
+                                     const q7_t * wt,
+                                     const uint16_t ch_mult,
+                                     const uint16_t dim_kernel_x,
+                                     const uint16_t dim_kernel_y,
+                                     const uint16_t padding_x,
+                                     const uint16_t padding_y,
+                                     const uint16_t stride_x,
+                                     const uint16_t stride_y,
+                                     const int32_t * bias,
+                                     const int32_t * out_shift,
+                                     const int32_t * out_mult,
+                                     const int32_t input_offset,
+                                     const int32_t out_offset,
+                                     const int32_t out_activation_min,
+                                     const int32_t out_activation_max,
+                                     q7_t * Im_out,
+                                     const uint16_t dim_im_out_x,
+                                     const uint16_t dim_im_out_y);
+
 
 /**
  * @defgroup FC Fully-connected Layer Functions
@@ -644,6 +850,9 @@ extern    "C"
  * implements the function using regular GEMV approach. The opt functions
  * operates with weights in interleaved formats.
  *
+ * The s8 function arm_fully_connected_s8 uses the per-channel quantization
+ * of the s8 convolution functions, with a multiplier and a shift per row.
+ *
  */
 
   /**
@@ -796,6 +1005,40 @@ extern    "C"
                                                       q15_t * pOut,
                                                       q15_t * vec_buffer);
 
+  /**
+   * @brief s8 fully-connected layer function with per-channel requantization
+   * @param[in]       pV                 pointer to input vector
+   * @param[in]       pM                 pointer to matrix weights
+   * @param[in]       dim_vec            length of the vector
+   * @param[in]       num_of_rows        number of rows in weight matrix
+   * @param[in]       bias               pointer to the per-row bias, or NULL
+   * @param[in]       out_shift          pointer to the per-row shifts of the output
+   * @param[in]       out_mult           pointer to the per-row multipliers of the output
+   * @param[in]       input_offset       offset added to the input, i.e. the negated input zero-point.
+   *                                     Range: [-127, 128]
+   * @param[in]       out_offset         zero-point of the output. Range: [-128, 127]
+   * @param[in]       out_activation_min minimum value of the output. Range: [-128, 127]
+   * @param[in]       out_activation_max maximum value of the output. Range: [-128, 127]
+   * @param[in,out]   pOut               pointer to output vector
+   * @param[in,out]   vec_buffer         pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+    arm_status arm_fully_connected_s8(const q7_t * pV,
+                                      const q7_t * pM,
+                                      const uint16_t dim_vec,
+                                      const uint16_t num_of_rows,
+                                      const int32_t * bias,
+                                      const int32_t * out_shift,
+                                      const int32_t * out_mult,
+                                      const int32_t input_offset,
+                                      const int32_t out_offset,
+                                      const int32_t out_activation_min,
+                                      const int32_t out_activation_max,
+                                      q7_t * pOut,
+                                      q15_t * vec_buffer);
+
 /**
  * @brief Matrix-Multiplication Kernels for Convolution
  *
@@ -852,6 +1095,34 @@ extern    "C"
                                                       const q7_t * bias,
                                                       q7_t * pOut);
 
+  /**
+   * @brief Matrix-multiplication function for convolution with per-channel requantization
+   * @param[in]       pA             pointer to operand A
+   * @param[in]       pInBuffer      pointer to operand B, always conssists of 2 vectors
+   * @param[in]       ch_im_out      numRow of A
+   * @param[in]       numCol_A       numCol of A
+   * @param[in]       out_shift      pointer to the per-channel shifts of the output
+   * @param[in]       out_mult       pointer to the per-channel multipliers of the output
+   * @param[in]       out_offset     zero-point of the output
+   * @param[in]       activation_min minimum value of the output
+   * @param[in]       activation_max maximum value of the output
+   * @param[in]       bias           the per-channel bias, or NULL
+   * @param[in,out]   pOut           pointer to output
+   * @return     The function returns the incremented output pointer
+   */
+
+    q7_t     *arm_nn_mat_mult_kernel_s8_s16(const q7_t * pA,
+                                            const q15_t * pInBuffer,
+                                            const uint16_t ch_im_out,
+                                            const uint16_t numCol_A,
+                                            const int32_t * out_shift,
+                                            const int32_t * out_mult,
+                                            const int32_t out_offset,
+                                            const int16_t activation_min,
+                                            const int16_t activation_max,
+                                            const int32_t * bias,
+                                            q7_t * pOut);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1068,6 +1339,286 @@ extern    "C"
                                                 const int32_t output_activation_max,
                                                 const int32_t out_shift,
                                                 const int32_t out_mult);
+
+/**
+ * @defgroup NNGraph Neural Network Graph Functions
+ *
+ * Run a network described by a list of layers
+ *
+ * The network is a list of layers, run in order. Each layer calls one of the
+ * q7 kernels above and reads its input tensor and writes its output tensor,
+ * both given by their index. The list is constant and can be stored in flash
+ * with the weights.
+ *
+ * The activations and the scratch buffers of the kernels (bufferA, vec_buffer)
+ * are placed in one arena by arm_nn_graph_plan_q7. A buffer is live from the
+ * first to the last layer using it, and buffers which are never live at the
+ * same time share the same memory. The arena is then much smaller than the sum
+ * of the buffers, and no buffer has to be allocated for each model.
+ *
+ * For instance, the first layers of the cifar10 example are:
+ *
+ * <pre>
+ *     static const arm_nn_layer_q7 layers[] = {
+ *         {ARM_NN_CONV_HWC_Q7_RGB, 0, 1, 32, 3, 32, 5, 2, 1, 32, 6, 9, conv1_wt, conv1_bias},
+ *         {ARM_NN_RELU_Q7, 1, 1, 32, 32},
+ *         {ARM_NN_MAXPOOL_Q7_HWC, 1, 2, 32, 32, 0, 3, 0, 2, 16},
+ *         ...
+ *     };
+ *     static const arm_nn_graph_q7 graph = {11, 8, 0, 7, layers};
+ *
+ *     arm_nn_graph_plan_q7(&graph, plan, &arena_size);
+ *     input = arm_nn_graph_tensor_q7(plan, arena, graph.input);
+ *     ...
+ *     arm_nn_graph_run_q7(&graph, plan, arena, arena_size);
+ * </pre>
+ *
+ * The arena of the cifar10 network is 40960 bytes, instead of the 44160 bytes of
+ * the buffers of the example.
+ *
+ */
+
+/**
+ * @brief Kernel called by a layer of a graph
+ */
+typedef enum
+{
+    ARM_NN_CONV_HWC_Q7_BASIC = 0,
+                /**< arm_convolve_HWC_q7_basic */
+    ARM_NN_CONV_HWC_Q7_FAST = 1,
+                /**< arm_convolve_HWC_q7_fast */
+    ARM_NN_CONV_HWC_Q7_RGB = 2,
+                /**< arm_convolve_HWC_q7_RGB */
+    ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7 = 3,
+                /**< arm_depthwise_separable_conv_HWC_q7 */
+    ARM_NN_FULLY_CONNECTED_Q7 = 4,
+                /**< arm_fully_connected_q7 */
+    ARM_NN_FULLY_CONNECTED_Q7_OPT = 5,
+                /**< arm_fully_connected_q7_opt */
+    ARM_NN_RELU_Q7 = 6,
+                /**< arm_relu_q7, in-place */
+    ARM_NN_MAXPOOL_Q7_HWC = 7,
+                /**< arm_maxpool_q7_HWC */
+    ARM_NN_AVEPOOL_Q7_HWC = 8,
+                /**< arm_avepool_q7_HWC */
+    ARM_NN_SOFTMAX_Q7 = 9,
+                /**< arm_softmax_q7, can be in-place */
+} arm_nn_layer_type;
+
+/**
+ * @brief Layer of a q7 graph
+ *
+ * The input tensor is dim_im_in x dim_im_in x ch_im_in (HWC). The output tensor is
+ * dim_im_out x dim_im_out x ch_im_out for the convolutions, dim_im_out x dim_im_out x ch_im_in
+ * for the pooling, ch_im_out values for the fully-connected layers, and has the size of the
+ * input for the activation and softmax layers. The fields which are not used by the kernel
+ * of the layer are ignored.
+ */
+typedef struct
+{
+    arm_nn_layer_type type;
+                /**< kernel called by the layer */
+    uint16_t  input;
+                /**< index of the input tensor */
+    uint16_t  output;
+                /**< index of the output tensor, can be the input tensor for the in-place layers */
+    uint16_t  dim_im_in;
+                /**< input tensor dimension */
+    uint16_t  ch_im_in;
+                /**< number of input tensor channels */
+    uint16_t  ch_im_out;
+                /**< number of output tensor channels, or rows of the fully-connected weights */
+    uint16_t  dim_kernel;
+                /**< filter or pooling kernel size */
+    uint16_t  padding;
+                /**< padding sizes */
+    uint16_t  stride;
+                /**< convolution or pooling stride */
+    uint16_t  dim_im_out;
+                /**< output tensor dimension */
+    uint16_t  bias_shift;
+                /**< amount of left-shift for bias */
+    uint16_t  out_shift;
+                /**< amount of right-shift for output */
+    const q7_t *wt;
+                /**< kernel or matrix weights */
+    const q7_t *bias;
+                /**< bias */
+} arm_nn_layer_q7;
+
+/**
+ * @brief q7 graph
+ */
+typedef struct
+{
+    uint16_t  num_layers;
+                /**< number of layers */
+    uint16_t  num_tensors;
+                /**< number of tensors, including the input and output of the graph */
+    uint16_t  input;
+                /**< index of the input tensor of the graph */
+    uint16_t  output;
+                /**< index of the output tensor of the graph */
+    const arm_nn_layer_q7 *layers;
+                /**< layers, in execution order */
+} arm_nn_graph_q7;
+
+/**
+ * @brief Buffer of the memory plan of a graph
+ */
+typedef struct
+{
+    uint32_t  offset;
+                /**< offset of the buffer in the arena, in bytes */
+    uint32_t  size;
+                /**< size of the buffer, in bytes */
+    uint16_t  first;
+                /**< first layer using the buffer */
+    uint16_t  last;
+                /**< last layer using the buffer */
+} arm_nn_buffer;
+
+  /**
+   * @brief Memory plan of a q7 graph
+   * @param[in]       graph       pointer to the graph
+   * @param[out]      plan        pointer to the buffers of the plan, num_tensors + num_layers values
+   * @param[out]      arena_size  size of the arena needed by the graph, in bytes
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of graph checking.
+   *
+   * The plan can be computed once, offline or at startup, and used for each run of the graph.
+   */
+
+    arm_status arm_nn_graph_plan_q7(const arm_nn_graph_q7 * graph,
+                                    arm_nn_buffer * plan,
+                                    uint32_t * arena_size);
+
+  /**
+   * @brief Run a q7 graph
+   * @param[in]       graph       pointer to the graph
+   * @param[in]       plan        pointer to the buffers of the plan computed by arm_nn_graph_plan_q7
+   * @param[in,out]   arena       pointer to the arena, 4-byte aligned
+   * @param[in]       arena_size  size of the arena, in bytes
+   * @return     The function returns
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> when the arena is smaller than the plan,
+   * otherwise <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of the kernels.
+   *
+   * The input of the graph must be written in its tensor before the run. The output is read
+   * from its tensor after the run.
+   */
+
+    arm_status arm_nn_graph_run_q7(const arm_nn_graph_q7 * graph,
+                                   const arm_nn_buffer * plan,
+                                   q7_t * arena,
+                                   uint32_t arena_size);
+
+  /**
+   * @brief Tensor of a q7 graph in the arena
+   * @param[in]       plan        pointer to the buffers of the plan
+   * @param[in]       arena       pointer to the arena
+   * @param[in]       tensor      index of the tensor
+   * @return     The function returns the pointer to the tensor.
+   */
+
+    q7_t     *arm_nn_graph_tensor_q7(const arm_nn_buffer * plan,
+                                     q7_t * arena,
+                                     uint16_t tensor);
+
+/**
+ * @brief Magic number of a q7 model ("NNQ7" in little endian)
+ */
+#define ARM_NN_MODEL_MAGIC   0x37514E4EU
+
+/**
+ * @brief Version of the q7 model format
+ */
+#define ARM_NN_MODEL_VERSION 1U
+
+/**
+ * @brief Header of a q7 model
+ *
+ * A model is the header, followed by num_layers layer records and by the weights and
+ * biases. All the values are little endian and the weights and biases are 4-byte aligned.
+ * The models are written by Scripts/NNFunctions/nn_model_converter.py.
+ */
+typedef struct
+{
+    uint32_t  magic;
+                /**< ARM_NN_MODEL_MAGIC */
+    uint16_t  version;
+                /**< ARM_NN_MODEL_VERSION */
+    uint16_t  num_layers;
+                /**< number of layers */
+    uint16_t  num_tensors;
+                /**< number of tensors */
+    uint16_t  input;
+                /**< index of the input tensor of the graph */
+    uint16_t  output;
+                /**< index of the output tensor of the graph */
+    uint16_t  reserved;
+                /**< 0 */
+    uint32_t  size;
+                /**< size of the model, in bytes */
+} arm_nn_model_header;
+
+/**
+ * @brief Layer record of a q7 model
+ *
+ * The fields are the fields of arm_nn_layer_q7, with the offsets of the weights and bias
+ * from the start of the model instead of pointers (0 if the layer has no weights).
+ */
+typedef struct
+{
+    uint16_t  type;
+                /**< arm_nn_layer_type */
+    uint16_t  input;
+                /**< index of the input tensor */
+    uint16_t  output;
+                /**< index of the output tensor */
+    uint16_t  dim_im_in;
+                /**< input tensor dimension */
+    uint16_t  ch_im_in;
+                /**< number of input tensor channels */
+    uint16_t  ch_im_out;
+                /**< number of output tensor channels */
+    uint16_t  dim_kernel;
+                /**< filter or pooling kernel size */
+    uint16_t  padding;
+                /**< padding sizes */
+    uint16_t  stride;
+                /**< convolution or pooling stride */
+    uint16_t  dim_im_out;
+                /**< output tensor dimension */
+    uint16_t  bias_shift;
+                /**< amount of left-shift for bias */
+    uint16_t  out_shift;
+                /**< amount of right-shift for output */
+    uint32_t  wt_offset;
+                /**< offset of the weights */
+    uint32_t  bias_offset;
+                /**< offset of the bias */
+} arm_nn_model_layer;
+
+  /**
+   * @brief Load a q7 model
+   * @param[in]       model       pointer to the model, 4-byte aligned
+   * @param[in]       model_size  size of the memory holding the model, in bytes
+   * @param[out]      layers      pointer to the layers of the graph
+   * @param[in]       max_layers  number of layers which can be written in layers
+   * @param[out]      graph       pointer to the graph
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of model checking.
+   *
+   * The weights and biases are not copied: the layers are pointing to them in the model,
+   * which can be in a memory mapped flash.
+   */
+
+    arm_status arm_nn_model_load_q7(const uint8_t * model,
+                                    uint32_t model_size,
+                                    arm_nn_layer_q7 * layers,
+                                    uint16_t max_layers,
+                                    arm_nn_graph_q7 * graph);
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,18 @@ void      arm_q7_to_q15_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t block
 
 void      arm_q7_to_q15_reordered_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize);
 
+/**
+ * @brief Converts the elements of the Q7 vector to Q15 vector with an added offset
+ * @param[in]       *pSrc points to the Q7 input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       offset offset added to each element, in the range [-255, 255]
+ * @return none.
+ *
+ */
+
+void      arm_q7_to_q15_with_offset(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize, q15_t offset);
+
 #if defined (ARM_MATH_DSP)
 
 /**
@@ -194,7 +206,7 @@ void arm_nn_mult_q7(
  * @brief macro for adding rounding offset
  */
 #ifndef ARM_NN_TRUNCATE
-    #define NN_ROUND(out_shift) ( (0x1u << out_shift) >> 1 )
+    #define NN_ROUND(out_shift) ( (q31_t) ((0x1u << out_shift) >> 1) )
 #else
     #define NN_ROUND(out_shift) 0
 #endif
@@ -222,7 +234,7 @@ __STATIC_FORCEINLINE q31_t arm_nn_sat_doubling_high_mult(const q31_t m1, const q
 
     // Utilize all of the upper 32 bits. This is the doubling step
     // as well.
-    result = mult / (1UL << 31);
+    result = (q31_t)(mult / ((q63_t)1 << 31));
 
     if ((m1 == m2) && (m1 == Q31_MIN))
     {
@@ -262,6 +274,53 @@ __STATIC_FORCEINLINE q31_t arm_nn_divide_by_power_of_two(const q31_t dividend, c
     return result;
 }
 
+/**
+ * @brief           Requantization of an accumulator with a multiplier and a shift
+ * @param[in]       val         Accumulator
+ * @param[in]       multiplier  Multiplier in Q31, in the range [0x40000000 0x7FFFFFFF]
+ * @param[in]       shift       Amount of left-shift (positive) or right-shift (negative)
+ * @return          Rounded <code>val * multiplier * 2^shift / 2^31</code>
+ *
+ * The real scale <code>input_scale * weight_scale / output_scale</code> of an output
+ * channel is represented as <code>multiplier * 2^(shift - 31)</code>.
+ */
+__STATIC_FORCEINLINE q31_t arm_nn_requantize(const q31_t val, const q31_t multiplier, const q31_t shift)
+{
+    return arm_nn_divide_by_power_of_two(arm_nn_sat_doubling_high_mult(val * (1 << LEFT_SHIFT(shift)), multiplier),
+                                         RIGHT_SHIFT(shift));
+}
+
+/**
+ * @brief           Requantization of an accumulator to a Q7 output with a zero-point and clamping
+ * @param[in]       val         Accumulator
+ * @param[in]       multiplier  Multiplier in Q31, as for arm_nn_requantize
+ * @param[in]       shift       Amount of left-shift (positive) or right-shift (negative)
+ * @param[in]       out_offset  Zero-point of the output
+ * @param[in]       act_min     Minimum value of the output, in the range [-128, 127]
+ * @param[in]       act_max     Maximum value of the output, in the range [-128, 127]
+ * @return          Requantized output
+ *
+ */
+__STATIC_FORCEINLINE q7_t arm_nn_requantize_q7(const q31_t val,
+                                               const q31_t multiplier,
+                                               const q31_t shift,
+                                               const q31_t out_offset,
+                                               const q31_t act_min,
+                                               const q31_t act_max)
+{
+    q31_t     out = arm_nn_requantize(val, multiplier, shift) + out_offset;
+
+    if (out < act_min)
+    {
+        out = act_min;
+    }
+    if (out > act_max)
+    {
+        out = act_max;
+    }
+    return (q7_t) out;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_bench.c
+ * Description:  Benchmark of the layers of a q7 network on a host
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * usage: nn_bench [-r measurements] [model]
+ *
+ * The model is a file written by Scripts/NNFunctions/nn_model_converter.py.
+ * Without model, the network of the cifar10 example is benchmarked.
+ *
+ * Each layer is run alone, as a graph of one layer with its own memory plan,
+ * on random activations. A measurement is the mean time of enough runs of the
+ * layer to last 1 ms, and the minimum of the measurements is printed with the
+ * number of MACs of the layer and the MACs per second. The whole network is
+ * then measured in the same way with arm_nn_graph_run_q7.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "nn_host.h"
+#include "nn_cifar10.h"
+
+#define BENCH_MAX_LAYERS     256
+#define BENCH_MIN_TIME_NS    1000000U
+
+static const char *const layer_names[] = {
+    "conv_q7_basic", "conv_q7_fast", "conv_q7_RGB", "depthwise_separable_q7", "fully_connected_q7",
+    "fully_connected_q7_opt", "relu_q7", "maxpool_q7", "avepool_q7", "softmax_q7"
+};
+
+/* MACs of the convolutions and fully-connected layers, 0 for the others */
+static uint64_t layer_macs(const arm_nn_layer_q7 * layer)
+{
+    uint64_t  out = (uint64_t) layer->dim_im_out * layer->dim_im_out;
+    uint64_t  kernel = (uint64_t) layer->dim_kernel * layer->dim_kernel;
+
+    switch (layer->type)
+    {
+    case ARM_NN_CONV_HWC_Q7_BASIC:
+    case ARM_NN_CONV_HWC_Q7_FAST:
+    case ARM_NN_CONV_HWC_Q7_RGB:
+        return out * layer->ch_im_out * kernel * layer->ch_im_in;
+    case ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7:
+        return out * layer->ch_im_out * kernel;
+    case ARM_NN_FULLY_CONNECTED_Q7:
+    case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+        return (uint64_t) layer->dim_im_in * layer->dim_im_in * layer->ch_im_in * layer->ch_im_out;
+    default:
+        return 0;
+    }
+}
+
+/* Memory plan and arena of a graph, with random activations */
+static q7_t *bench_arena(const arm_nn_graph_q7 * graph, arm_nn_buffer ** plan, uint32_t * arena_size)
+{
+    q7_t     *arena;
+
+    *plan = (arm_nn_buffer *) malloc(((size_t) graph->num_tensors + graph->num_layers) * sizeof(arm_nn_buffer));
+    if (*plan == NULL || arm_nn_graph_plan_q7(graph, *plan, arena_size) != ARM_MATH_SUCCESS)
+    {
+        free(*plan);
+        return NULL;
+    }
+
+    /* malloc is returning a buffer aligned for any type, so 4-byte aligned */
+    arena = (q7_t *) malloc(*arena_size + 4);
+    if (arena == NULL)
+    {
+        free(*plan);
+        return NULL;
+    }
+    nn_host_fill_q7(arena, *arena_size, -128, 127);
+
+    return arena;
+}
+
+/* Minimum time of a run of a graph over the measurements, in ns */
+static double bench_graph(const arm_nn_graph_q7 * graph, uint32_t measurements, arm_status * status)
+{
+    arm_nn_buffer *plan;
+    uint32_t  arena_size;
+    q7_t     *arena = bench_arena(graph, &plan, &arena_size);
+    double    best = 0.0;
+    uint32_t  runs = 1;
+    uint32_t  m, r;
+
+    if (arena == NULL)
+    {
+        *status = ARM_MATH_ARGUMENT_ERROR;
+        return 0.0;
+    }
+
+    /* number of runs lasting at least BENCH_MIN_TIME_NS */
+    *status = arm_nn_graph_run_q7(graph, plan, arena, arena_size);
+    for (;;)
+    {
+        uint64_t  start = nn_host_time_ns();
+
+        for (r = 0; r < runs; r++)
+        {
+            arm_nn_graph_run_q7(graph, plan, arena, arena_size);
+        }
+        if (nn_host_time_ns() - start >= BENCH_MIN_TIME_NS || runs >= (1U << 24))
+        {
+            break;
+        }
+        runs *= 2;
+    }
+
+    for (m = 0; m < measurements; m++)
+    {
+        uint64_t  start = nn_host_time_ns();
+        double    t;
+
+        for (r = 0; r < runs; r++)
+        {
+            arm_nn_graph_run_q7(graph, plan, arena, arena_size);
+        }
+        t = (double)(nn_host_time_ns() - start) / runs;
+        if (m == 0 || t < best)
+        {
+            best = t;
+        }
+    }
+
+    free(arena);
+    free(plan);
+    return best;
+}
+
+static uint8_t *bench_read_model(const char *path, uint32_t * size)
+{
+    FILE     *f = fopen(path, "rb");
+    uint8_t  *model;
+    long      length;
+
+    if (f == NULL)
+    {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    model = (uint8_t *) malloc(length > 0 ? (size_t) length : 1U);
+    if (model != NULL && fread(model, 1, (size_t) length, f) != (size_t) length)
+    {
+        free(model);
+        model = NULL;
+    }
+    fclose(f);
+
+    *size = (uint32_t) length;
+    return model;
+}
+
+int main(int argc, char **argv)
+{
+    static arm_nn_layer_q7 layers[BENCH_MAX_LAYERS];
+    arm_nn_graph_q7 graph = nn_cifar10_graph;
+    const char *name = "cifar10 example";
+    uint8_t  *model = NULL;
+    uint32_t  measurements = 20;
+    uint64_t  total_macs = 0;
+    double    total_ns = 0.0;
+    arm_status status;
+    uint16_t  i;
+    int       arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (!strcmp(argv[arg], "-r") && arg + 1 < argc)
+        {
+            measurements = (uint32_t) strtoul(argv[++arg], NULL, 0);
+        }
+        else
+        {
+            uint32_t  size;
+
+            name = argv[arg];
+            model = bench_read_model(name, &size);
+            if (model == NULL
+                || arm_nn_model_load_q7(model, size, layers, BENCH_MAX_LAYERS, &graph) != ARM_MATH_SUCCESS)
+            {
+                printf("Cannot load the model %s\n", name);
+                free(model);
+                return 1;
+            }
+        }
+    }
+    if (measurements == 0)
+    {
+        measurements = 1;
+    }
+
+    printf("CMSIS-NN layers of %s, %s\n\n", name, nn_host_kernels());
+    printf("%5s %-24s %16s %12s %12s %10s\n", "layer", "kernel", "output", "MACs", "time (us)", "MMAC/s");
+
+    for (i = 0; i < graph.num_layers; i++)
+    {
+        const arm_nn_layer_q7 *layer = &graph.layers[i];
+        arm_nn_graph_q7 one = { 1, graph.num_tensors, layer->input, layer->output, layer };
+        uint64_t  macs = layer_macs(layer);
+        uint16_t  dim = layer->dim_im_in;
+        uint16_t  ch = layer->ch_im_in;
+        char      output[32];
+        double    ns;
+
+        ns = bench_graph(&one, measurements, &status);
+        if (status != ARM_MATH_SUCCESS)
+        {
+            printf("Layer %u failed with %d\n", i, status);
+            free(model);
+            return 1;
+        }
+
+        switch (layer->type)
+        {
+        case ARM_NN_FULLY_CONNECTED_Q7:
+        case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+            dim = 1;
+            ch = layer->ch_im_out;
+            break;
+        case ARM_NN_MAXPOOL_Q7_HWC:
+        case ARM_NN_AVEPOOL_Q7_HWC:
+            dim = layer->dim_im_out;
+            break;
+        case ARM_NN_RELU_Q7:
+        case ARM_NN_SOFTMAX_Q7:
+            break;
+        default:
+            dim = layer->dim_im_out;
+            ch = layer->ch_im_out;
+            break;
+        }
+        snprintf(output, sizeof(output), "%ux%ux%u", dim, dim, ch);
+
+        if (macs)
+        {
+            printf("%5u %-24s %16s %12llu %12.2f %10.1f\n", i, layer_names[layer->type], output,
+                   (unsigned long long)macs, ns / 1000.0, (double)macs * 1000.0 / ns);
+        }
+        else
+        {
+            printf("%5u %-24s %16s %12s %12.2f %10s\n", i, layer_names[layer->type], output, "-", ns / 1000.0, "-");
+        }
+        total_macs += macs;
+        total_ns += ns;
+    }
+
+    printf("%5s %-24s %16s %12llu %12.2f %10.1f\n", "", "sum of the layers", "", (unsigned long long)total_macs,
+           total_ns / 1000.0, (double)total_macs * 1000.0 / total_ns);
+
+    total_ns = bench_graph(&graph, measurements, &status);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        printf("The network failed with %d\n", status);
+        free(model);
+        return 1;
+    }
+    printf("%5s %-24s %16s %12llu %12.2f %10.1f\n", "", "network", "", (unsigned long long)total_macs,
+           total_ns / 1000.0, (double)total_macs * 1000.0 / total_ns);
+
+    free(model);
+    return 0;
+}
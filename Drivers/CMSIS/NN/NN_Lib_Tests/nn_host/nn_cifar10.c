@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_cifar10.c
+ * Description:  Network of the cifar10 example as a graph and as a chain of kernels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "nn_cifar10.h"
+
+#include "arm_nnexamples_cifar10_parameter.h"
+#include "arm_nnexamples_cifar10_weights.h"
+
+/* Network of the cifar10 example */
+static const q7_t conv1_wt[CONV1_IM_CH * CONV1_KER_DIM * CONV1_KER_DIM * CONV1_OUT_CH] = CONV1_WT;
+static const q7_t conv1_bias[CONV1_OUT_CH] = CONV1_BIAS;
+static const q7_t conv2_wt[CONV2_IM_CH * CONV2_KER_DIM * CONV2_KER_DIM * CONV2_OUT_CH] = CONV2_WT;
+static const q7_t conv2_bias[CONV2_OUT_CH] = CONV2_BIAS;
+static const q7_t conv3_wt[CONV3_IM_CH * CONV3_KER_DIM * CONV3_KER_DIM * CONV3_OUT_CH] = CONV3_WT;
+static const q7_t conv3_bias[CONV3_OUT_CH] = CONV3_BIAS;
+static const q7_t ip1_wt[IP1_DIM * IP1_OUT] = IP1_WT;
+static const q7_t ip1_bias[IP1_OUT] = IP1_BIAS;
+
+static const arm_nn_layer_q7 cifar10_layers[] = {
+    {ARM_NN_CONV_HWC_Q7_RGB, 0, 1, CONV1_IM_DIM, CONV1_IM_CH, CONV1_OUT_CH, CONV1_KER_DIM, CONV1_PADDING,
+     CONV1_STRIDE, CONV1_OUT_DIM, CONV1_BIAS_LSHIFT, CONV1_OUT_RSHIFT, conv1_wt, conv1_bias},
+    {ARM_NN_RELU_Q7, 1, 1, CONV1_OUT_DIM, CONV1_OUT_CH},
+    {ARM_NN_MAXPOOL_Q7_HWC, 1, 2, CONV1_OUT_DIM, CONV1_OUT_CH, 0, POOL1_KER_DIM, POOL1_PADDING, POOL1_STRIDE,
+     POOL1_OUT_DIM},
+    {ARM_NN_CONV_HWC_Q7_FAST, 2, 3, CONV2_IM_DIM, CONV2_IM_CH, CONV2_OUT_CH, CONV2_KER_DIM, CONV2_PADDING,
+     CONV2_STRIDE, CONV2_OUT_DIM, CONV2_BIAS_LSHIFT, CONV2_OUT_RSHIFT, conv2_wt, conv2_bias},
+    {ARM_NN_RELU_Q7, 3, 3, CONV2_OUT_DIM, CONV2_OUT_CH},
+    {ARM_NN_MAXPOOL_Q7_HWC, 3, 4, CONV2_OUT_DIM, CONV2_OUT_CH, 0, POOL2_KER_DIM, POOL2_PADDING, POOL2_STRIDE,
+     POOL2_OUT_DIM},
+    {ARM_NN_CONV_HWC_Q7_FAST, 4, 5, CONV3_IM_DIM, CONV3_IM_CH, CONV3_OUT_CH, CONV3_KER_DIM, CONV3_PADDING,
+     CONV3_STRIDE, CONV3_OUT_DIM, CONV3_BIAS_LSHIFT, CONV3_OUT_RSHIFT, conv3_wt, conv3_bias},
+    {ARM_NN_RELU_Q7, 5, 5, CONV3_OUT_DIM, CONV3_OUT_CH},
+    {ARM_NN_MAXPOOL_Q7_HWC, 5, 6, CONV3_OUT_DIM, CONV3_OUT_CH, 0, POOL3_KER_DIM, POOL3_PADDING, POOL3_STRIDE,
+     POOL3_OUT_DIM},
+    {ARM_NN_FULLY_CONNECTED_Q7_OPT, 6, 7, IP1_IM_DIM, IP1_IM_CH, IP1_OUT, 0, 0, 0, 0, IP1_BIAS_LSHIFT,
+     IP1_OUT_RSHIFT, ip1_wt, ip1_bias},
+    {ARM_NN_SOFTMAX_Q7, 7, 7, 1, IP1_OUT},
+};
+
+const arm_nn_graph_q7 nn_cifar10_graph = {
+    sizeof(cifar10_layers) / sizeof(cifar10_layers[0]), 8, 0, 7, cifar10_layers
+};
+
+/* Activations and scratch buffer of the example */
+static q7_t img_buffer1[32 * 32 * 32];
+static q7_t img_buffer2[32 * 32 * 32];
+static q7_t col_buffer[2 * 5 * 5 * 32 * 2];
+
+void nn_cifar10_kernels(const q7_t * input, q7_t * output)
+{
+    memcpy(img_buffer2, input, CONV1_IM_DIM * CONV1_IM_DIM * CONV1_IM_CH);
+
+    arm_convolve_HWC_q7_RGB(img_buffer2, CONV1_IM_DIM, CONV1_IM_CH, conv1_wt, CONV1_OUT_CH, CONV1_KER_DIM,
+                            CONV1_PADDING, CONV1_STRIDE, conv1_bias, CONV1_BIAS_LSHIFT, CONV1_OUT_RSHIFT,
+                            img_buffer1, CONV1_OUT_DIM, (q15_t *) col_buffer, NULL);
+    arm_relu_q7(img_buffer1, CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH);
+    arm_maxpool_q7_HWC(img_buffer1, CONV1_OUT_DIM, CONV1_OUT_CH, POOL1_KER_DIM, POOL1_PADDING, POOL1_STRIDE,
+                       POOL1_OUT_DIM, NULL, img_buffer2);
+
+    arm_convolve_HWC_q7_fast(img_buffer2, CONV2_IM_DIM, CONV2_IM_CH, conv2_wt, CONV2_OUT_CH, CONV2_KER_DIM,
+                             CONV2_PADDING, CONV2_STRIDE, conv2_bias, CONV2_BIAS_LSHIFT, CONV2_OUT_RSHIFT,
+                             img_buffer1, CONV2_OUT_DIM, (q15_t *) col_buffer, NULL);
+    arm_relu_q7(img_buffer1, CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH);
+    arm_maxpool_q7_HWC(img_buffer1, CONV2_OUT_DIM, CONV2_OUT_CH, POOL2_KER_DIM, POOL2_PADDING, POOL2_STRIDE,
+                       POOL2_OUT_DIM, col_buffer, img_buffer2);
+
+    arm_convolve_HWC_q7_fast(img_buffer2, CONV3_IM_DIM, CONV3_IM_CH, conv3_wt, CONV3_OUT_CH, CONV3_KER_DIM,
+                             CONV3_PADDING, CONV3_STRIDE, conv3_bias, CONV3_BIAS_LSHIFT, CONV3_OUT_RSHIFT,
+                             img_buffer1, CONV3_OUT_DIM, (q15_t *) col_buffer, NULL);
+    arm_relu_q7(img_buffer1, CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH);
+    arm_maxpool_q7_HWC(img_buffer1, CONV3_OUT_DIM, CONV3_OUT_CH, POOL3_KER_DIM, POOL3_PADDING, POOL3_STRIDE,
+                       POOL3_OUT_DIM, col_buffer, img_buffer2);
+
+    arm_fully_connected_q7_opt(img_buffer2, ip1_wt, IP1_DIM, IP1_OUT, IP1_BIAS_LSHIFT, IP1_OUT_RSHIFT, ip1_bias,
+                               output, (q15_t *) img_buffer1);
+    arm_softmax_q7(output, IP1_OUT, output);
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_cifar10.h
+ * Description:  Network of the cifar10 example as a graph and as a chain of kernels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _NN_CIFAR10_H_
+#define _NN_CIFAR10_H_
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#ifdef __cplusplus
+extern    "C"
+{
+#endif
+
+/* Size of the input image (32x32x3) and of the output (10 classes) */
+#define NN_CIFAR10_INPUT_SIZE  (32 * 32 * 3)
+#define NN_CIFAR10_OUTPUT_SIZE 10
+
+/* Network of the cifar10 example, 11 layers and 8 tensors */
+    extern const arm_nn_graph_q7 nn_cifar10_graph;
+
+/* Same network as the kernel calls of arm_nnexamples_cifar10.cpp, with its buffers */
+    void      nn_cifar10_kernels(const q7_t * input, q7_t * output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_graph_test.c
+ * Description:  Checks of the memory plan and of the run of q7 graphs
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * The plans of the cifar10 network and of random graphs are checked: the
+ * buffers which are live at the same time must not overlap in the arena.
+ * Each error of arm_nn_graph_plan_q7 and arm_nn_graph_run_q7 is triggered by
+ * a small graph. The output of the cifar10 graph must be the same bytes as
+ * the kernels of the example called one after the other. The exit code is 1
+ * when a check fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "nn_host.h"
+#include "nn_cifar10.h"
+
+#define GRAPH_MAX_LAYERS     16
+#define GRAPH_RANDOM_CASES   200
+#define GRAPH_CIFAR10_IMAGES 8
+
+/* Arena of the cifar10 example, given by the documentation of NNGraph */
+#define GRAPH_CIFAR10_ARENA  40960U
+
+static arm_nn_buffer plan[2 * GRAPH_MAX_LAYERS + 1];
+
+static uint32_t num_fails = 0;
+
+static void check(const char *name, int condition)
+{
+    if (!condition)
+    {
+        printf("  FAIL %s\n", name);
+        num_fails++;
+    }
+}
+
+/* Aligned buffers inside the arena, and no overlap of the buffers live at the same time */
+static int plan_valid(const arm_nn_graph_q7 * graph, uint32_t arena_size)
+{
+    uint32_t  num_buffers = (uint32_t) graph->num_tensors + graph->num_layers;
+    uint32_t  i, j;
+
+    for (i = 0; i < num_buffers; i++)
+    {
+        if (plan[i].size == 0)
+        {
+            continue;
+        }
+        if ((plan[i].offset & 3U) != 0 || plan[i].offset + plan[i].size > arena_size)
+        {
+            return 0;
+        }
+        for (j = i + 1; j < num_buffers; j++)
+        {
+            if (plan[j].size > 0
+                && plan[i].first <= plan[j].last && plan[j].first <= plan[i].last
+                && plan[i].offset < plan[j].offset + plan[j].size
+                && plan[j].offset < plan[i].offset + plan[i].size)
+            {
+                printf("  buffers %u and %u overlap\n", (unsigned) i, (unsigned) j);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Chain of fully-connected layers reading random tensors already written, with in-place relu */
+static void random_graph(arm_nn_layer_q7 * layers, arm_nn_graph_q7 * graph)
+{
+    uint16_t  num_layers = (uint16_t) nn_host_rand(1, GRAPH_MAX_LAYERS);
+    uint16_t  num_tensors = 1;
+    uint16_t  i;
+
+    memset(layers, 0, num_layers * sizeof(arm_nn_layer_q7));
+
+    for (i = 0; i < num_layers; i++)
+    {
+        layers[i].input = (uint16_t) nn_host_rand(0, num_tensors - 1);
+        layers[i].dim_im_in = 1;
+        layers[i].ch_im_in = (uint16_t) nn_host_rand(1, 300);
+
+        if (i > 0 && nn_host_rand(0, 3) == 0)
+        {
+            layers[i].type = ARM_NN_RELU_Q7;
+            layers[i].output = layers[i].input;
+        }
+        else
+        {
+            layers[i].type = ARM_NN_FULLY_CONNECTED_Q7;
+            layers[i].output = num_tensors++;
+            layers[i].ch_im_out = (uint16_t) nn_host_rand(1, 300);
+        }
+    }
+
+    graph->num_layers = num_layers;
+    graph->num_tensors = num_tensors;
+    graph->input = 0;
+    graph->output = layers[num_layers - 1].output;
+    graph->layers = layers;
+}
+
+static void check_plan_error(const char *name, const arm_nn_layer_q7 * layers, uint16_t num_layers,
+                             uint16_t num_tensors, uint16_t output)
+{
+    arm_nn_graph_q7 graph = { num_layers, num_tensors, 0, output, layers };
+    uint32_t  arena_size;
+
+    check(name, arm_nn_graph_plan_q7(&graph, plan, &arena_size) == ARM_MATH_ARGUMENT_ERROR);
+}
+
+static void check_plan_errors(void)
+{
+    /* The second layer reads tensor 2, which is never written */
+    static const arm_nn_layer_q7 unwritten[] = {
+        {ARM_NN_FULLY_CONNECTED_Q7, 0, 1, 1, 8, 8},
+        {ARM_NN_FULLY_CONNECTED_Q7, 2, 3, 1, 8, 8},
+    };
+    /* Only the relu and softmax layers can be in-place */
+    static const arm_nn_layer_q7 in_place[] = {
+        {ARM_NN_FULLY_CONNECTED_Q7, 0, 0, 1, 8, 8},
+    };
+    /* The relu layers must be in-place */
+    static const arm_nn_layer_q7 relu_copy[] = {
+        {ARM_NN_RELU_Q7, 0, 1, 1, 8},
+    };
+    /* The maxpool kernel overwrites its input, which is read again by the fully-connected layer */
+    static const arm_nn_layer_q7 pool_reused[] = {
+        {ARM_NN_MAXPOOL_Q7_HWC, 0, 1, 4, 2, 0, 2, 0, 2, 2},
+        {ARM_NN_FULLY_CONNECTED_Q7, 0, 2, 4, 2, 8},
+    };
+    /* Same graph with the pooling input read before the pooling */
+    static const arm_nn_layer_q7 pool_last[] = {
+        {ARM_NN_FULLY_CONNECTED_Q7, 0, 2, 4, 2, 8},
+        {ARM_NN_MAXPOOL_Q7_HWC, 0, 1, 4, 2, 0, 2, 0, 2, 2},
+    };
+    arm_nn_graph_q7 graph = { 2, 3, 0, 1, pool_last };
+    uint32_t  arena_size;
+
+    check_plan_error("tensor read before it is written", unwritten, 2, 4, 3);
+    check_plan_error("in-place fully-connected layer", in_place, 1, 1, 0);
+    check_plan_error("relu layer not in-place", relu_copy, 1, 2, 1);
+    check_plan_error("pooling input read by a next layer", pool_reused, 2, 3, 2);
+    check_plan_error("graph output never written", unwritten, 1, 4, 3);
+    check_plan_error("no layer", unwritten, 0, 4, 1);
+
+    check("pooling input read by a previous layer",
+          arm_nn_graph_plan_q7(&graph, plan, &arena_size) == ARM_MATH_SUCCESS && plan_valid(&graph, arena_size));
+}
+
+static void check_cifar10(void)
+{
+    static q7_t input[NN_CIFAR10_INPUT_SIZE];
+    static q7_t output[NN_CIFAR10_OUTPUT_SIZE];
+    uint32_t  arena_size;
+    q7_t     *arena;
+    q7_t     *copy;
+    uint32_t  image;
+
+    if (arm_nn_graph_plan_q7(&nn_cifar10_graph, plan, &arena_size) != ARM_MATH_SUCCESS)
+    {
+        check("cifar10 plan", 0);
+        return;
+    }
+    check("cifar10 plan without overlap", plan_valid(&nn_cifar10_graph, arena_size));
+    check("cifar10 arena size", arena_size == GRAPH_CIFAR10_ARENA);
+
+    /* malloc is returning a buffer aligned for any type, so 4-byte aligned */
+    arena = (q7_t *) malloc(arena_size);
+    copy = (q7_t *) malloc(arena_size);
+    if (arena == NULL || copy == NULL)
+    {
+        check("cifar10 arena allocation", 0);
+        free(arena);
+        free(copy);
+        return;
+    }
+
+    /* No layer is run when the arena is too small */
+    nn_host_fill_q7(arena, arena_size, -128, 127);
+    memcpy(copy, arena, arena_size);
+    check("arena too small", arm_nn_graph_run_q7(&nn_cifar10_graph, plan, arena, arena_size - 4)
+          == ARM_MATH_ARGUMENT_ERROR);
+    check("arena not modified when too small", memcmp(arena, copy, arena_size) == 0);
+
+    for (image = 0; image < GRAPH_CIFAR10_IMAGES; image++)
+    {
+        nn_host_fill_q7(input, NN_CIFAR10_INPUT_SIZE, -128, 127);
+        nn_cifar10_kernels(input, output);
+
+        nn_host_fill_q7(arena, arena_size, -128, 127);
+        memcpy(arm_nn_graph_tensor_q7(plan, arena, nn_cifar10_graph.input), input, NN_CIFAR10_INPUT_SIZE);
+        check("cifar10 run", arm_nn_graph_run_q7(&nn_cifar10_graph, plan, arena, arena_size) == ARM_MATH_SUCCESS);
+        check("cifar10 output equal to the kernels of the example",
+              memcmp(arm_nn_graph_tensor_q7(plan, arena, nn_cifar10_graph.output), output,
+                     NN_CIFAR10_OUTPUT_SIZE) == 0);
+    }
+
+    free(arena);
+    free(copy);
+}
+
+int main(void)
+{
+    static arm_nn_layer_q7 layers[GRAPH_MAX_LAYERS];
+    arm_nn_graph_q7 graph;
+    uint32_t  arena_size;
+    uint32_t  c;
+
+    printf("arm_nn_graph_plan_q7 and arm_nn_graph_run_q7 checks\n");
+
+    nn_host_seed(1);
+
+    for (c = 0; c < GRAPH_RANDOM_CASES; c++)
+    {
+        random_graph(layers, &graph);
+        if (arm_nn_graph_plan_q7(&graph, plan, &arena_size) != ARM_MATH_SUCCESS || !plan_valid(&graph, arena_size))
+        {
+            printf("  FAIL random graph %u\n", (unsigned) c);
+            num_fails++;
+        }
+    }
+
+    check_plan_errors();
+    check_cifar10();
+
+    if (num_fails)
+    {
+        printf("%u checks failed\n", (unsigned) num_fails);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_host.c
+ * Description:  Timer and random data of the host tests of CMSIS-NN
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+
+#include "nn_host.h"
+
+/* State of the xorshift32 generator, never 0 */
+static uint32_t nn_host_state = 0x12345678U;
+
+uint64_t nn_host_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000U + (uint64_t) ts.tv_nsec;
+}
+
+void nn_host_seed(uint32_t seed)
+{
+    nn_host_state = seed ? seed : 0x12345678U;
+}
+
+int32_t nn_host_rand(int32_t min, int32_t max)
+{
+    uint32_t  x = nn_host_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    nn_host_state = x;
+
+    return min + (int32_t) (x % (uint32_t) (max - min + 1));
+}
+
+void nn_host_fill_q7(q7_t * data, uint32_t size, int32_t min, int32_t max)
+{
+    uint32_t  i;
+
+    for (i = 0; i < size; i++)
+    {
+        data[i] = (q7_t) nn_host_rand(min, max);
+    }
+}
+
+void nn_host_fill_q15(q15_t * data, uint32_t size, int32_t min, int32_t max)
+{
+    uint32_t  i;
+
+    for (i = 0; i < size; i++)
+    {
+        data[i] = (q15_t) nn_host_rand(min, max);
+    }
+}
+
+void nn_host_fill_s32(int32_t * data, uint32_t size, int32_t min, int32_t max)
+{
+    uint32_t  i;
+
+    for (i = 0; i < size; i++)
+    {
+        data[i] = nn_host_rand(min, max);
+    }
+}
+
+const char *nn_host_kernels(void)
+{
+#if defined (ARM_MATH_DSP_EMULATION)
+    return "Cortex-M4/M7 kernels, emulated SIMD intrinsics";
+#elif defined (ARM_MATH_DSP)
+    return "Cortex-M4/M7 kernels";
+#else
+    return "Cortex-M0/M3 kernels";
+#endif
+}
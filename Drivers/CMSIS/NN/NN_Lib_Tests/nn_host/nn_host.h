@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_host.h
+ * Description:  Timer and random data of the host tests of CMSIS-NN
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _NN_HOST_H_
+#define _NN_HOST_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern    "C"
+{
+#endif
+
+/* Time of the monotonic clock, in ns */
+    uint64_t  nn_host_time_ns(void);
+
+/* Deterministic random numbers, so a failing case can be reproduced from its seed */
+    void      nn_host_seed(uint32_t seed);
+
+/* Random integer in [min, max] */
+    int32_t   nn_host_rand(int32_t min, int32_t max);
+
+    void      nn_host_fill_q7(q7_t * data, uint32_t size, int32_t min, int32_t max);
+
+    void      nn_host_fill_q15(q15_t * data, uint32_t size, int32_t min, int32_t max);
+
+    void      nn_host_fill_s32(int32_t * data, uint32_t size, int32_t min, int32_t max);
+
+/* Name of the version of the kernels which is built */
+    const char *nn_host_kernels(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
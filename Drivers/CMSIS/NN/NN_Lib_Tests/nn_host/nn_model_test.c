@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_model_test.c
+ * Description:  Checks of arm_nn_model_load_q7 on invalid models
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * A model with one fully-connected layer is written in memory, then each
+ * case damages one field of the header or of the layer record and checks
+ * that the loader rejects it. The model is only valid when it is loaded
+ * without modification. The exit code is 1 when a case fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#define MODEL_CH_IN    4
+#define MODEL_CH_OUT   2
+#define MODEL_WT       (sizeof(arm_nn_model_header) + sizeof(arm_nn_model_layer))
+#define MODEL_BIAS     (MODEL_WT + MODEL_CH_IN * MODEL_CH_OUT)
+#define MODEL_SIZE     (MODEL_BIAS + 4)
+
+/* 4-byte aligned storage of the model, with room after it */
+static uint32_t model_words[64];
+
+static arm_nn_layer_q7 layers[2];
+
+static uint32_t num_fails = 0;
+
+static void model_write(void)
+{
+    arm_nn_model_header *header = (arm_nn_model_header *) model_words;
+    arm_nn_model_layer *record = (arm_nn_model_layer *) (header + 1);
+
+    memset(model_words, 0, sizeof(model_words));
+
+    header->magic = ARM_NN_MODEL_MAGIC;
+    header->version = ARM_NN_MODEL_VERSION;
+    header->num_layers = 1;
+    header->num_tensors = 2;
+    header->input = 0;
+    header->output = 1;
+    header->size = MODEL_SIZE;
+
+    record->type = ARM_NN_FULLY_CONNECTED_Q7;
+    record->input = 0;
+    record->output = 1;
+    record->dim_im_in = 1;
+    record->ch_im_in = MODEL_CH_IN;
+    record->ch_im_out = MODEL_CH_OUT;
+    record->wt_offset = MODEL_WT;
+    record->bias_offset = MODEL_BIAS;
+}
+
+static void model_check(const char *name, const uint8_t * model, uint32_t model_size, uint16_t max_layers,
+                        arm_status expected)
+{
+    arm_nn_graph_q7 graph;
+    arm_status status = arm_nn_model_load_q7(model, model_size, layers, max_layers, &graph);
+
+    if (status != expected)
+    {
+        printf("  FAIL %s: status %d, expected %d\n", name, (int) status, (int) expected);
+        num_fails++;
+    }
+}
+
+int main(void)
+{
+    uint8_t  *model = (uint8_t *) model_words;
+    arm_nn_model_header *header = (arm_nn_model_header *) model_words;
+    arm_nn_model_layer *record = (arm_nn_model_layer *) (header + 1);
+    uint8_t  *copy;
+
+    printf("arm_nn_model_load_q7 checks\n");
+
+    model_write();
+    model_check("valid model", model, MODEL_SIZE, 1, ARM_MATH_SUCCESS);
+    if (layers[0].wt != (const q7_t *) (model + MODEL_WT) || layers[0].bias != (const q7_t *) (model + MODEL_BIAS))
+    {
+        printf("  FAIL valid model: weights and bias are not pointing into the model\n");
+        num_fails++;
+    }
+
+    model_check("model not aligned", model + 1, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+    model_check("memory smaller than the header", model, sizeof(arm_nn_model_header) - 1, 1,
+                ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->magic ^= 1U;
+    model_check("magic", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->version++;
+    model_check("version", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->size = 0;
+    model_check("size 0", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->size = sizeof(arm_nn_model_header) - 1;
+    model_check("size smaller than the header", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->size = MODEL_WT - 1;
+    model_check("size truncating the layer records", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->size = MODEL_SIZE + 4;
+    model_check("size larger than the memory", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->num_layers = 0;
+    model_check("no layer", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    header->num_layers = 2;
+    model_check("more layers than max_layers", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+    model_check("more layer records than the size", model, MODEL_SIZE, 2, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->type = 0xFFFFU;
+    model_check("layer type", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->wt_offset = 0;
+    model_check("weights offset 0", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->wt_offset = 4;
+    model_check("weights in the header", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->wt_offset = MODEL_WT + 1;
+    model_check("weights not aligned", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->wt_offset = MODEL_SIZE - 4;
+    model_check("weights after the model", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->wt_offset = 0xFFFFFFFCU;
+    model_check("weights offset wrapping", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->bias_offset = MODEL_BIAS + 2;
+    model_check("bias not aligned", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    model_write();
+    record->bias_offset = MODEL_SIZE;
+    model_check("bias after the model", model, MODEL_SIZE, 1, ARM_MATH_ARGUMENT_ERROR);
+
+    /* header alone in a buffer of its size, so any read of a layer record is out of bounds */
+    model_write();
+    header->size = 0;
+    copy = (uint8_t *) malloc(sizeof(arm_nn_model_header));
+    if (copy != NULL)
+    {
+        memcpy(copy, model, sizeof(arm_nn_model_header));
+        model_check("header alone, size 0", copy, sizeof(arm_nn_model_header), 1, ARM_MATH_ARGUMENT_ERROR);
+        free(copy);
+    }
+
+    if (num_fails)
+    {
+        printf("%u checks failed\n", (unsigned) num_fails);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,954 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        nn_sweep.c
+ * Description:  Correctness sweeps of the CMSIS-NN kernels on a host
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  x86 and other hosts
+ *
+ * -------------------------------------------------------------------- */
+
+/*
+ * Each kernel is run on random shapes (dimensions, channels, kernel sizes,
+ * strides and paddings which are meeting the constraints of the kernel) and
+ * random data, and its output is compared with the one of its reference
+ * implementation of Ref_Implementations. The cases are generated from a seed,
+ * so a failing case can be reproduced.
+ *
+ * usage: nn_sweep [-n cases] [-s seed] [-v] [kernel ...]
+ *
+ * The kernels whose name contains one of the arguments are run (all the
+ * kernels by default). For each kernel, the number of cases and failures and
+ * the throughput of the optimized kernel are printed: millions of MACs per
+ * second for the convolutions and fully-connected layers, millions of
+ * elements per second for the others. The exit code is 1 when a case fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "arm_nnsupportfunctions.h"
+#include "ref_functions.h"
+#include "nn_host.h"
+
+/* Largest tensors of the sweeps */
+#define SWEEP_MAX_DIM      24
+#define SWEEP_MAX_CH       32
+#define SWEEP_MAX_KERNEL   5
+#define SWEEP_MAX_VEC      512
+#define SWEEP_MAX_ROWS     64
+#define SWEEP_MAX_ELEM     2048
+
+#define SWEEP_BUF_SIZE     65536
+#define SWEEP_GUARD        16
+#define SWEEP_GUARD_VALUE  0x25
+
+/* Shape and parameters of a case */
+typedef struct
+{
+    uint16_t  in_x, in_y, ch_in, ch_out;
+    uint16_t  k_x, k_y, pad_x, pad_y, stride_x, stride_y;
+    uint16_t  out_x, out_y;
+    /* output of the convolution before the pooling of the fused kernels */
+    uint16_t  conv_x, conv_y;
+    uint16_t  bias_shift, out_shift;
+    int32_t   input_offset, out_offset, act_min, act_max;
+    uint32_t  in_len, wt_len, out_len;
+    uint64_t  ops;
+} sweep_case;
+
+/* Kinds of shapes */
+typedef enum
+{
+    SWEEP_CONV,            /* square convolution */
+    SWEEP_CONV_NONSQUARE,  /* non-square convolution */
+    SWEEP_FC,              /* fully-connected layer */
+    SWEEP_POOL,            /* square pooling */
+    SWEEP_ELEMENTWISE      /* activation or multiplication */
+} sweep_kind;
+
+/* Constraints of the shapes */
+#define SWEEP_RGB          0x01U  /* ch_in is 3 */
+#define SWEEP_DEPTHWISE    0x02U  /* ch_out is ch_in */
+#define SWEEP_1X1          0x04U  /* kernel 1x1, no padding, stride 1 */
+#define SWEEP_POOLED       0x08U  /* output pooled by 2x2 */
+#define SWEEP_CH_MULT      0x10U  /* ch_out is ch_in times a channel multiplier */
+#define SWEEP_S8           0x20U  /* per-channel requantization */
+#define SWEEP_Q15          0x40U  /* q15 input and output */
+#define SWEEP_Q15_WEIGHTS  0x80U  /* q15 weights */
+#define SWEEP_INPLACE      0x100U /* the output is written in the input */
+#define SWEEP_CLOBBER      0x200U /* the input is overwritten */
+#define SWEEP_EVEN_OUT     0x400U /* out_x is a multiple of 2 */
+
+typedef arm_status (*sweep_run) (const sweep_case * c, int opt, void *in, void *out);
+
+typedef struct
+{
+    const char *name;
+    sweep_kind kind;
+    uint32_t  flags;
+    uint16_t  ch_in_mult;      /* ch_in is a multiple of it */
+    uint16_t  ch_out_mult;     /* ch_out is a multiple of it */
+    uint16_t  tolerance;       /* largest difference with the reference */
+    const char *unit;
+    sweep_run run;
+} sweep_kernel;
+
+/* Data of the cases */
+static q7_t in_q7[SWEEP_BUF_SIZE];
+static q15_t in_q15[SWEEP_BUF_SIZE];
+static q7_t in_b_q7[SWEEP_BUF_SIZE];
+static q15_t in_b_q15[SWEEP_BUF_SIZE];
+static q7_t wt_q7[SWEEP_BUF_SIZE];
+static q15_t wt_q15[SWEEP_BUF_SIZE];
+static q7_t bias_q7[SWEEP_MAX_ROWS];
+static q15_t bias_q15[SWEEP_MAX_ROWS];
+static int32_t bias_s32[SWEEP_BUF_SIZE / 64];
+static int32_t mult_s32[SWEEP_BUF_SIZE / 64];
+static int32_t shift_s32[SWEEP_BUF_SIZE / 64];
+
+static q15_t bufferA[SWEEP_BUF_SIZE];
+static q7_t bufferB[SWEEP_BUF_SIZE];
+
+/* Copies of the input of the kernels which are overwriting it, and outputs */
+static q15_t work[SWEEP_BUF_SIZE / 2 + SWEEP_GUARD];
+static q15_t out_ref[SWEEP_BUF_SIZE / 2 + SWEEP_GUARD];
+static q15_t out_opt[SWEEP_BUF_SIZE / 2 + SWEEP_GUARD];
+
+/*
+ * Kernels
+ */
+
+static arm_status run_conv_q7_basic(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_convolve_HWC_q7_ref((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x, c->pad_x, c->stride_x,
+                                bias_q7, c->bias_shift, c->out_shift, (q7_t *) out, c->out_x, bufferA, bufferB);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_convolve_HWC_q7_basic((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x, c->pad_x, c->stride_x,
+                                     bias_q7, c->bias_shift, c->out_shift, (q7_t *) out, c->out_x, bufferA, bufferB);
+}
+
+static arm_status run_conv_q7_fast(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        return run_conv_q7_basic(c, opt, in, out);
+    }
+    return arm_convolve_HWC_q7_fast((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x, c->pad_x, c->stride_x,
+                                    bias_q7, c->bias_shift, c->out_shift, (q7_t *) out, c->out_x, bufferA, bufferB);
+}
+
+static arm_status run_conv_q7_rgb(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        return run_conv_q7_basic(c, opt, in, out);
+    }
+    return arm_convolve_HWC_q7_RGB((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x, c->pad_x, c->stride_x,
+                                   bias_q7, c->bias_shift, c->out_shift, (q7_t *) out, c->out_x, bufferA, bufferB);
+}
+
+static arm_status run_conv_q7_nonsquare(const sweep_case * c, int opt, void *in, void *out, int fast)
+{
+    if (!opt)
+    {
+        arm_convolve_HWC_q7_ref_nonsquare((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out, c->k_x, c->k_y,
+                                          c->pad_x, c->pad_y, c->stride_x, c->stride_y, bias_q7, c->bias_shift,
+                                          c->out_shift, (q7_t *) out, c->out_x, c->out_y, bufferA, bufferB);
+        return ARM_MATH_SUCCESS;
+    }
+    if (fast == 2)
+    {
+        return arm_convolve_1x1_HWC_q7_fast_nonsquare((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out,
+                                                      c->k_x, c->k_y, c->pad_x, c->pad_y, c->stride_x, c->stride_y,
+                                                      bias_q7, c->bias_shift, c->out_shift, (q7_t *) out,
+                                                      c->out_x, c->out_y, bufferA, bufferB);
+    }
+    if (fast)
+    {
+        return arm_convolve_HWC_q7_fast_nonsquare((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out,
+                                                  c->k_x, c->k_y, c->pad_x, c->pad_y, c->stride_x, c->stride_y,
+                                                  bias_q7, c->bias_shift, c->out_shift, (q7_t *) out,
+                                                  c->out_x, c->out_y, bufferA, bufferB);
+    }
+    return arm_convolve_HWC_q7_basic_nonsquare((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out,
+                                               c->k_x, c->k_y, c->pad_x, c->pad_y, c->stride_x, c->stride_y,
+                                               bias_q7, c->bias_shift, c->out_shift, (q7_t *) out,
+                                               c->out_x, c->out_y, bufferA, bufferB);
+}
+
+static arm_status run_conv_q7_basic_nonsquare(const sweep_case * c, int opt, void *in, void *out)
+{
+    return run_conv_q7_nonsquare(c, opt, in, out, 0);
+}
+
+static arm_status run_conv_q7_fast_nonsquare(const sweep_case * c, int opt, void *in, void *out)
+{
+    return run_conv_q7_nonsquare(c, opt, in, out, 1);
+}
+
+static arm_status run_conv_1x1_q7_fast_nonsquare(const sweep_case * c, int opt, void *in, void *out)
+{
+    return run_conv_q7_nonsquare(c, opt, in, out, 2);
+}
+
+static arm_status run_conv_q7_fast_relu_pool(const sweep_case * c, int opt, void *in, void *out, int ave)
+{
+    if (!opt)
+    {
+        /* q7 output of the convolution in the work buffer */
+        q7_t     *conv = (q7_t *) work;
+
+        arm_convolve_HWC_q7_ref((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x, c->pad_x, c->stride_x,
+                                bias_q7, c->bias_shift, c->out_shift, conv, c->conv_x, bufferA, bufferB);
+        arm_relu_q7_ref(conv, c->conv_x * c->conv_x * c->ch_out);
+        if (ave)
+        {
+            arm_avepool_q7_HWC_ref(conv, c->conv_x, c->ch_out, 2, 0, 2, c->out_x, NULL, (q7_t *) out);
+        }
+        else
+        {
+            arm_maxpool_q7_HWC_ref(conv, c->conv_x, c->ch_out, 2, 0, 2, c->out_x, NULL, (q7_t *) out);
+        }
+        return ARM_MATH_SUCCESS;
+    }
+    if (ave)
+    {
+        return arm_convolve_HWC_q7_fast_relu_avepool_2x2((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x,
+                                                         c->pad_x, c->stride_x, bias_q7, c->bias_shift, c->out_shift,
+                                                         (q7_t *) out, c->out_x, bufferA, bufferB);
+    }
+    return arm_convolve_HWC_q7_fast_relu_maxpool_2x2((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x,
+                                                     c->pad_x, c->stride_x, bias_q7, c->bias_shift, c->out_shift,
+                                                     (q7_t *) out, c->out_x, bufferA, bufferB);
+}
+
+static arm_status run_conv_q7_fast_relu_maxpool(const sweep_case * c, int opt, void *in, void *out)
+{
+    return run_conv_q7_fast_relu_pool(c, opt, in, out, 0);
+}
+
+static arm_status run_conv_q7_fast_relu_avepool(const sweep_case * c, int opt, void *in, void *out)
+{
+    return run_conv_q7_fast_relu_pool(c, opt, in, out, 1);
+}
+
+static arm_status run_conv_q15(const sweep_case * c, int opt, void *in, void *out, int fast)
+{
+    if (!opt)
+    {
+        arm_convolve_HWC_q15_ref((q15_t *) in, c->in_x, c->ch_in, wt_q15, c->ch_out, c->k_x, c->pad_x, c->stride_x,
+                                 bias_q15, c->bias_shift, c->out_shift, (q15_t *) out, c->out_x, bufferA, bufferB);
+        return ARM_MATH_SUCCESS;
+    }
+    if (fast)
+    {
+        return arm_convolve_HWC_q15_fast((q15_t *) in, c->in_x, c->ch_in, wt_q15, c->ch_out, c->k_x, c->pad_x,
+                                         c->stride_x, bias_q15, c->bias_shift, c->out_shift, (q15_t *) out, c->out_x,
+                                         bufferA, bufferB);
+    }
+    return arm_convolve_HWC_q15_basic((q15_t *) in, c->in_x, c->ch_in, wt_q15, c->ch_out, c->k_x, c->pad_x,
+                                      c->stride_x, bias_q15, c->bias_shift, c->out_shift, (q15_t *) out, c->out_x,
+                                      bufferA, bufferB);
+}
+
+static arm_status run_conv_q15_basic(const sweep_case * c, int opt, void *in, void *out)
+{
+    return run_conv_q15(c, opt, in, out, 0);
+}
+
+static arm_status run_conv_q15_fast(const sweep_case * c, int opt, void *in, void *out)
+{
+    return run_conv_q15(c, opt, in, out, 1);
+}
+
+static arm_status run_conv_q15_fast_nonsquare(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_convolve_HWC_q15_nonsquare_ref((q15_t *) in, c->in_x, c->in_y, c->ch_in, wt_q15, c->ch_out, c->k_x,
+                                           c->k_y, c->pad_x, c->pad_y, c->stride_x, c->stride_y, bias_q15,
+                                           c->bias_shift, c->out_shift, (q15_t *) out, c->out_x, c->out_y,
+                                           bufferA, bufferB);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_convolve_HWC_q15_fast_nonsquare((q15_t *) in, c->in_x, c->in_y, c->ch_in, wt_q15, c->ch_out, c->k_x,
+                                               c->k_y, c->pad_x, c->pad_y, c->stride_x, c->stride_y, bias_q15,
+                                               c->bias_shift, c->out_shift, (q15_t *) out, c->out_x, c->out_y,
+                                               bufferA, bufferB);
+}
+
+static arm_status run_depthwise_separable(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_depthwise_separable_conv_HWC_q7_ref((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x, c->pad_x,
+                                                c->stride_x, bias_q7, c->bias_shift, c->out_shift, (q7_t *) out,
+                                                c->out_x, bufferA, bufferB);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_depthwise_separable_conv_HWC_q7((q7_t *) in, c->in_x, c->ch_in, wt_q7, c->ch_out, c->k_x, c->pad_x,
+                                               c->stride_x, bias_q7, c->bias_shift, c->out_shift, (q7_t *) out,
+                                               c->out_x, bufferA, bufferB);
+}
+
+static arm_status run_depthwise_separable_nonsquare(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_depthwise_separable_conv_HWC_q7_ref_nonsquare((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out,
+                                                          c->k_x, c->k_y, c->pad_x, c->pad_y, c->stride_x,
+                                                          c->stride_y, bias_q7, c->bias_shift, c->out_shift,
+                                                          (q7_t *) out, c->out_x, c->out_y, bufferA, bufferB);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_depthwise_separable_conv_HWC_q7_nonsquare((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out,
+                                                         c->k_x, c->k_y, c->pad_x, c->pad_y, c->stride_x,
+                                                         c->stride_y, bias_q7, c->bias_shift, c->out_shift,
+                                                         (q7_t *) out, c->out_x, c->out_y, bufferA, bufferB);
+}
+
+static arm_status run_conv_s8(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_convolve_s8_ref((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out, c->k_x, c->k_y, c->pad_x,
+                            c->pad_y, c->stride_x, c->stride_y, bias_s32, shift_s32, mult_s32, c->input_offset,
+                            c->out_offset, c->act_min, c->act_max, (q7_t *) out, c->out_x, c->out_y, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_convolve_s8((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, c->ch_out, c->k_x, c->k_y, c->pad_x,
+                           c->pad_y, c->stride_x, c->stride_y, bias_s32, shift_s32, mult_s32, c->input_offset,
+                           c->out_offset, c->act_min, c->act_max, (q7_t *) out, c->out_x, c->out_y, bufferA);
+}
+
+static arm_status run_depthwise_s8(const sweep_case * c, int opt, void *in, void *out)
+{
+    uint16_t  ch_mult = c->ch_out / c->ch_in;
+
+    if (!opt)
+    {
+        arm_depthwise_conv_s8_ref((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, ch_mult, c->k_x, c->k_y, c->pad_x,
+                                  c->pad_y, c->stride_x, c->stride_y, bias_s32, shift_s32, mult_s32,
+                                  c->input_offset, c->out_offset, c->act_min, c->act_max, (q7_t *) out, c->out_x,
+                                  c->out_y);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_depthwise_conv_s8((q7_t *) in, c->in_x, c->in_y, c->ch_in, wt_q7, ch_mult, c->k_x, c->k_y, c->pad_x,
+                                 c->pad_y, c->stride_x, c->stride_y, bias_s32, shift_s32, mult_s32, c->input_offset,
+                                 c->out_offset, c->act_min, c->act_max, (q7_t *) out, c->out_x, c->out_y);
+}
+
+/* For the fully-connected layers, ch_in is the length of the vector and ch_out the number of rows */
+
+static arm_status run_fc_q7(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_fully_connected_q7_ref((q7_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift, c->out_shift, bias_q7,
+                                   (q7_t *) out, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_fully_connected_q7((q7_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift, c->out_shift, bias_q7,
+                                  (q7_t *) out, bufferA);
+}
+
+static arm_status run_fc_q7_opt(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_fully_connected_q7_opt_ref((q7_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift, c->out_shift,
+                                       bias_q7, (q7_t *) out, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_fully_connected_q7_opt((q7_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift, c->out_shift, bias_q7,
+                                      (q7_t *) out, bufferA);
+}
+
+static arm_status run_fc_q15(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_fully_connected_q15_ref((q15_t *) in, wt_q15, c->ch_in, c->ch_out, c->bias_shift, c->out_shift,
+                                    bias_q15, (q15_t *) out, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_fully_connected_q15((q15_t *) in, wt_q15, c->ch_in, c->ch_out, c->bias_shift, c->out_shift, bias_q15,
+                                   (q15_t *) out, bufferA);
+}
+
+static arm_status run_fc_q15_opt(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_fully_connected_q15_opt_ref((q15_t *) in, wt_q15, c->ch_in, c->ch_out, c->bias_shift, c->out_shift,
+                                        bias_q15, (q15_t *) out, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_fully_connected_q15_opt((q15_t *) in, wt_q15, c->ch_in, c->ch_out, c->bias_shift, c->out_shift,
+                                       bias_q15, (q15_t *) out, bufferA);
+}
+
+static arm_status run_fc_mat_q7_vec_q15(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_fully_connected_mat_q7_vec_q15_ref((q15_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift, c->out_shift,
+                                               bias_q7, (q15_t *) out, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_fully_connected_mat_q7_vec_q15((q15_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift, c->out_shift,
+                                              bias_q7, (q15_t *) out, bufferA);
+}
+
+static arm_status run_fc_mat_q7_vec_q15_opt(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_fully_connected_mat_q7_vec_q15_opt_ref((q15_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift,
+                                                   c->out_shift, bias_q7, (q15_t *) out, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_fully_connected_mat_q7_vec_q15_opt((q15_t *) in, wt_q7, c->ch_in, c->ch_out, c->bias_shift,
+                                                  c->out_shift, bias_q7, (q15_t *) out, bufferA);
+}
+
+static arm_status run_fc_s8(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_fully_connected_s8_ref((q7_t *) in, wt_q7, c->ch_in, c->ch_out, bias_s32, shift_s32, mult_s32,
+                                   c->input_offset, c->out_offset, c->act_min, c->act_max, (q7_t *) out, bufferA);
+        return ARM_MATH_SUCCESS;
+    }
+    return arm_fully_connected_s8((q7_t *) in, wt_q7, c->ch_in, c->ch_out, bias_s32, shift_s32, mult_s32,
+                                  c->input_offset, c->out_offset, c->act_min, c->act_max, (q7_t *) out, bufferA);
+}
+
+static arm_status run_maxpool(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_maxpool_q7_HWC_ref((q7_t *) in, c->in_x, c->ch_in, c->k_x, c->pad_x, c->stride_x, c->out_x, NULL,
+                               (q7_t *) out);
+    }
+    else
+    {
+        arm_maxpool_q7_HWC((q7_t *) in, c->in_x, c->ch_in, c->k_x, c->pad_x, c->stride_x, c->out_x, NULL,
+                           (q7_t *) out);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_avepool(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_avepool_q7_HWC_ref((q7_t *) in, c->in_x, c->ch_in, c->k_x, c->pad_x, c->stride_x, c->out_x, NULL,
+                               (q7_t *) out);
+    }
+    else
+    {
+        arm_avepool_q7_HWC((q7_t *) in, c->in_x, c->ch_in, c->k_x, c->pad_x, c->stride_x, c->out_x,
+                           (q7_t *) bufferA, (q7_t *) out);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_relu_q7(const sweep_case * c, int opt, void *in, void *out)
+{
+    (void)out;
+    if (!opt)
+    {
+        arm_relu_q7_ref((q7_t *) in, c->in_len);
+    }
+    else
+    {
+        arm_relu_q7((q7_t *) in, c->in_len);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_relu_q15(const sweep_case * c, int opt, void *in, void *out)
+{
+    (void)out;
+    if (!opt)
+    {
+        arm_relu_q15_ref((q15_t *) in, c->in_len);
+    }
+    else
+    {
+        arm_relu_q15((q15_t *) in, c->in_len);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_mult_q7(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_nn_mult_q7_ref((q7_t *) in, in_b_q7, (q7_t *) out, c->out_shift, c->in_len);
+    }
+    else
+    {
+        arm_nn_mult_q7((q7_t *) in, in_b_q7, (q7_t *) out, c->out_shift, c->in_len);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+static arm_status run_mult_q15(const sweep_case * c, int opt, void *in, void *out)
+{
+    if (!opt)
+    {
+        arm_nn_mult_q15_ref((q15_t *) in, in_b_q15, (q15_t *) out, c->out_shift, c->in_len);
+    }
+    else
+    {
+        arm_nn_mult_q15((q15_t *) in, in_b_q15, (q15_t *) out, c->out_shift, c->in_len);
+    }
+    return ARM_MATH_SUCCESS;
+}
+
+static const sweep_kernel kernels[] = {
+    {"arm_convolve_HWC_q7_basic", SWEEP_CONV, 0, 1, 1, 0, "MAC", run_conv_q7_basic},
+    {"arm_convolve_HWC_q7_fast", SWEEP_CONV, 0, 4, 2, 0, "MAC", run_conv_q7_fast},
+    {"arm_convolve_HWC_q7_RGB", SWEEP_CONV, SWEEP_RGB, 1, 1, 0, "MAC", run_conv_q7_rgb},
+    {"arm_convolve_HWC_q7_basic_nonsquare", SWEEP_CONV_NONSQUARE, 0, 1, 1, 0, "MAC", run_conv_q7_basic_nonsquare},
+    {"arm_convolve_HWC_q7_fast_nonsquare", SWEEP_CONV_NONSQUARE, 0, 4, 2, 0, "MAC", run_conv_q7_fast_nonsquare},
+    {"arm_convolve_1x1_HWC_q7_fast_nonsquare", SWEEP_CONV_NONSQUARE, SWEEP_1X1, 4, 2, 0, "MAC",
+     run_conv_1x1_q7_fast_nonsquare},
+    {"arm_convolve_HWC_q7_fast_relu_maxpool_2x2", SWEEP_CONV, SWEEP_POOLED, 4, 2, 0, "MAC",
+     run_conv_q7_fast_relu_maxpool},
+    {"arm_convolve_HWC_q7_fast_relu_avepool_2x2", SWEEP_CONV, SWEEP_POOLED, 4, 2, 0, "MAC",
+     run_conv_q7_fast_relu_avepool},
+    {"arm_convolve_HWC_q15_basic", SWEEP_CONV, SWEEP_Q15 | SWEEP_Q15_WEIGHTS, 1, 1, 0, "MAC", run_conv_q15_basic},
+    {"arm_convolve_HWC_q15_fast", SWEEP_CONV, SWEEP_Q15 | SWEEP_Q15_WEIGHTS | SWEEP_EVEN_OUT, 2, 2, 0, "MAC",
+     run_conv_q15_fast},
+    {"arm_convolve_HWC_q15_fast_nonsquare", SWEEP_CONV_NONSQUARE, SWEEP_Q15 | SWEEP_Q15_WEIGHTS | SWEEP_EVEN_OUT, 2, 2,
+     0, "MAC", run_conv_q15_fast_nonsquare},
+    {"arm_depthwise_separable_conv_HWC_q7", SWEEP_CONV, SWEEP_DEPTHWISE, 2, 2, 0, "MAC", run_depthwise_separable},
+    {"arm_depthwise_separable_conv_HWC_q7_nonsquare", SWEEP_CONV_NONSQUARE, SWEEP_DEPTHWISE, 2, 2, 0, "MAC",
+     run_depthwise_separable_nonsquare},
+    {"arm_convolve_s8", SWEEP_CONV_NONSQUARE, SWEEP_S8, 1, 1, 0, "MAC", run_conv_s8},
+    {"arm_depthwise_conv_s8", SWEEP_CONV_NONSQUARE, SWEEP_S8 | SWEEP_CH_MULT, 1, 1, 0, "MAC", run_depthwise_s8},
+    {"arm_fully_connected_q7", SWEEP_FC, 0, 1, 1, 0, "MAC", run_fc_q7},
+    {"arm_fully_connected_q7_opt", SWEEP_FC, 0, 1, 1, 0, "MAC", run_fc_q7_opt},
+    {"arm_fully_connected_q15", SWEEP_FC, SWEEP_Q15 | SWEEP_Q15_WEIGHTS, 1, 1, 0, "MAC", run_fc_q15},
+    {"arm_fully_connected_q15_opt", SWEEP_FC, SWEEP_Q15 | SWEEP_Q15_WEIGHTS, 1, 1, 0, "MAC", run_fc_q15_opt},
+    {"arm_fully_connected_mat_q7_vec_q15", SWEEP_FC, SWEEP_Q15, 1, 1, 0, "MAC", run_fc_mat_q7_vec_q15},
+    {"arm_fully_connected_mat_q7_vec_q15_opt", SWEEP_FC, SWEEP_Q15, 1, 1, 0, "MAC", run_fc_mat_q7_vec_q15_opt},
+    {"arm_fully_connected_s8", SWEEP_FC, SWEEP_S8, 1, 1, 0, "MAC", run_fc_s8},
+    {"arm_maxpool_q7_HWC", SWEEP_POOL, SWEEP_CLOBBER, 1, 1, 0, "elem", run_maxpool},
+    /* the Cortex-M4/M7 average is rounded differently from the reference one */
+    {"arm_avepool_q7_HWC", SWEEP_POOL, SWEEP_CLOBBER, 1, 1, 1, "elem", run_avepool},
+    {"arm_relu_q7", SWEEP_ELEMENTWISE, SWEEP_INPLACE, 1, 1, 0, "elem", run_relu_q7},
+    {"arm_relu_q15", SWEEP_ELEMENTWISE, SWEEP_INPLACE | SWEEP_Q15, 1, 1, 0, "elem", run_relu_q15},
+    {"arm_nn_mult_q7", SWEEP_ELEMENTWISE, 0, 1, 1, 0, "elem", run_mult_q7},
+    {"arm_nn_mult_q15", SWEEP_ELEMENTWISE, SWEEP_Q15, 1, 1, 0, "elem", run_mult_q15},
+};
+
+#define NUM_KERNELS (sizeof(kernels) / sizeof(kernels[0]))
+
+/*
+ * Shapes
+ */
+
+/* Random output dimension of a convolution or pooling, 0 when the kernel is larger than the padded input */
+static uint16_t sweep_dim(uint16_t * in, uint16_t * k, uint16_t * pad, uint16_t * stride, uint32_t flags)
+{
+    if (flags & SWEEP_1X1)
+    {
+        *k = 1;
+        *pad = 0;
+        *stride = 1;
+    }
+    else
+    {
+        *k = (uint16_t) nn_host_rand(1, SWEEP_MAX_KERNEL);
+        *pad = (uint16_t) nn_host_rand(0, *k - 1);
+        *stride = (uint16_t) nn_host_rand(1, 3);
+    }
+    *in = (uint16_t) nn_host_rand(1, SWEEP_MAX_DIM);
+
+    if (*in + 2 * *pad < *k)
+    {
+        return 0;
+    }
+    return (uint16_t) ((*in + 2 * *pad - *k) / *stride + 1);
+}
+
+static uint16_t sweep_channels(uint16_t mult)
+{
+    return (uint16_t) (mult * nn_host_rand(1, SWEEP_MAX_CH / mult));
+}
+
+/* Shape of a case, returns 0 when the random shape is not valid for the kernel */
+static int sweep_shape(const sweep_kernel * kernel, sweep_case * c)
+{
+    uint32_t  flags = kernel->flags;
+
+    memset(c, 0, sizeof(*c));
+
+    switch (kernel->kind)
+    {
+    case SWEEP_CONV:
+    case SWEEP_CONV_NONSQUARE:
+        c->out_x = sweep_dim(&c->in_x, &c->k_x, &c->pad_x, &c->stride_x, flags);
+        if (kernel->kind == SWEEP_CONV)
+        {
+            c->in_y = c->in_x;
+            c->k_y = c->k_x;
+            c->pad_y = c->pad_x;
+            c->stride_y = c->stride_x;
+            c->out_y = c->out_x;
+        }
+        else
+        {
+            c->out_y = sweep_dim(&c->in_y, &c->k_y, &c->pad_y, &c->stride_y, flags);
+        }
+
+        c->ch_in = (flags & SWEEP_RGB) ? 3 : sweep_channels(kernel->ch_in_mult);
+        if (flags & SWEEP_DEPTHWISE)
+        {
+            c->ch_out = c->ch_in;
+        }
+        else if (flags & SWEEP_CH_MULT)
+        {
+            c->ch_in = (uint16_t) nn_host_rand(1, SWEEP_MAX_CH / 2);
+            c->ch_out = (uint16_t) (c->ch_in * nn_host_rand(1, 3));
+        }
+        else
+        {
+            c->ch_out = sweep_channels(kernel->ch_out_mult);
+        }
+
+        if (flags & SWEEP_POOLED)
+        {
+            c->conv_x = c->out_x;
+            c->conv_y = c->out_y;
+            c->out_x /= 2;
+            c->out_y /= 2;
+        }
+        else
+        {
+            c->conv_x = c->out_x;
+            c->conv_y = c->out_y;
+        }
+        if (c->out_x == 0 || c->out_y == 0 || ((flags & SWEEP_EVEN_OUT) && (c->out_x & 0x1)))
+        {
+            return 0;
+        }
+
+        c->in_len = (uint32_t) c->in_x * c->in_y * c->ch_in;
+        c->out_len = (uint32_t) c->out_x * c->out_y * c->ch_out;
+        if (flags & (SWEEP_DEPTHWISE | SWEEP_CH_MULT))
+        {
+            c->wt_len = (uint32_t) c->k_x * c->k_y * c->ch_out;
+        }
+        else
+        {
+            c->wt_len = (uint32_t) c->k_x * c->k_y * c->ch_in * c->ch_out;
+        }
+        c->ops = (uint64_t) c->conv_x * c->conv_y * c->wt_len;
+        break;
+
+    case SWEEP_FC:
+        c->ch_in = (uint16_t) nn_host_rand(1, SWEEP_MAX_VEC);
+        c->ch_out = (uint16_t) nn_host_rand(1, SWEEP_MAX_ROWS);
+        c->in_len = c->ch_in;
+        c->out_len = c->ch_out;
+        c->wt_len = (uint32_t) c->ch_in * c->ch_out;
+        c->ops = c->wt_len;
+        break;
+
+    case SWEEP_POOL:
+        c->out_x = sweep_dim(&c->in_x, &c->k_x, &c->pad_x, &c->stride_x, flags);
+#if defined (ARM_MATH_DSP)
+        /* the Cortex-M4/M7 versions pool along x in place, the padded windows would read pooled pixels */
+        c->pad_x = 0;
+        c->out_x = c->in_x < c->k_x ? 0 : (uint16_t) ((c->in_x - c->k_x) / c->stride_x + 1);
+#endif
+        if (c->out_x == 0)
+        {
+            return 0;
+        }
+        c->in_y = c->in_x;
+        c->out_y = c->out_x;
+        c->ch_in = c->ch_out = sweep_channels(1);
+        c->in_len = (uint32_t) c->in_x * c->in_x * c->ch_in;
+        c->out_len = (uint32_t) c->out_x * c->out_x * c->ch_in;
+        c->ops = (uint64_t) c->out_len * c->k_x * c->k_x;
+        break;
+
+    case SWEEP_ELEMENTWISE:
+        c->in_len = (uint32_t) nn_host_rand(1, SWEEP_MAX_ELEM);
+        c->out_len = c->in_len;
+        c->ops = c->in_len;
+        break;
+    }
+
+    /* bias and output shifts keeping the accumulators in range, like the layers of a network */
+    if (flags & SWEEP_Q15)
+    {
+        c->bias_shift = (uint16_t) nn_host_rand(0, 8);
+        c->out_shift = (uint16_t) nn_host_rand(kernel->kind == SWEEP_ELEMENTWISE ? 1 : 8, 16);
+    }
+    else
+    {
+        c->bias_shift = (uint16_t) nn_host_rand(0, 6);
+        c->out_shift = (uint16_t) nn_host_rand(kernel->kind == SWEEP_ELEMENTWISE ? 1 : 5, 10);
+    }
+    c->input_offset = nn_host_rand(-127, 128);
+    c->out_offset = nn_host_rand(-128, 127);
+    c->act_min = nn_host_rand(-128, 0);
+    c->act_max = nn_host_rand(0, 127);
+
+    return 1;
+}
+
+/* Random data of a case */
+static void sweep_data(const sweep_kernel * kernel, const sweep_case * c)
+{
+    uint32_t  flags = kernel->flags;
+    uint32_t  i;
+
+    if (flags & SWEEP_Q15)
+    {
+        if (kernel->kind == SWEEP_ELEMENTWISE)
+        {
+            nn_host_fill_q15(in_q15, c->in_len, -32768, 32767);
+            nn_host_fill_q15(in_b_q15, c->in_len, -32768, 32767);
+        }
+        else
+        {
+            /* q15 values are limited so that the products are accumulated without overflow */
+            nn_host_fill_q15(in_q15, c->in_len, -1024, 1024);
+        }
+    }
+    else
+    {
+        nn_host_fill_q7(in_q7, c->in_len, -128, 127);
+        nn_host_fill_q7(in_b_q7, c->in_len, -128, 127);
+    }
+
+    if (flags & SWEEP_Q15_WEIGHTS)
+    {
+        nn_host_fill_q15(wt_q15, c->wt_len, -1024, 1024);
+        nn_host_fill_q15(bias_q15, SWEEP_MAX_ROWS, -1024, 1024);
+    }
+    else
+    {
+        /* symmetric weights for the s8 kernels */
+        nn_host_fill_q7(wt_q7, c->wt_len, (flags & SWEEP_S8) ? -127 : -128, 127);
+        nn_host_fill_q7(bias_q7, SWEEP_MAX_ROWS, -128, 127);
+    }
+
+    if (flags & SWEEP_S8)
+    {
+        /* per-channel scales: multiplier in [0.5, 1) and shift in [-12, -6] */
+        for (i = 0; i < c->ch_out; i++)
+        {
+            bias_s32[i] = nn_host_rand(-5000, 5000);
+            shift_s32[i] = nn_host_rand(-12, -6);
+            mult_s32[i] = nn_host_rand(0x40000000, 0x7FFFFFFF);
+        }
+    }
+}
+
+static void sweep_print_case(const sweep_kernel * kernel, const sweep_case * c, uint32_t seed)
+{
+    printf("  FAIL seed %u: in %ux%ux%u, out %ux%ux%u, kernel %ux%u, padding %ux%u, stride %ux%u, "
+           "shifts %u/%u\n", (unsigned)seed, c->in_x, c->in_y, c->ch_in, c->out_x, c->out_y, c->ch_out,
+           c->k_x, c->k_y, c->pad_x, c->pad_y, c->stride_x, c->stride_y, c->bias_shift, c->out_shift);
+    (void)kernel;
+}
+
+/* Runs a case, returns 0 when the outputs match */
+static int sweep_run_case(const sweep_kernel * kernel, const sweep_case * c, uint64_t * time_ns)
+{
+    uint32_t  elem = (kernel->flags & SWEEP_Q15) ? sizeof(q15_t) : sizeof(q7_t);
+    void     *in = (kernel->flags & SWEEP_Q15) ? (void *)in_q15 : (void *)in_q7;
+    void     *ref_in = in;
+    void     *opt_in = in;
+    uint64_t  start;
+    arm_status status;
+    uint32_t  i;
+
+    memset(out_ref, 0, c->out_len * elem);
+    memset(out_opt, SWEEP_GUARD_VALUE, c->out_len * elem + SWEEP_GUARD);
+
+    if (kernel->flags & SWEEP_INPLACE)
+    {
+        memcpy(out_ref, in, c->in_len * elem);
+        memcpy(out_opt, in, c->in_len * elem);
+        ref_in = out_ref;
+        opt_in = out_opt;
+    }
+
+    if (kernel->flags & SWEEP_CLOBBER)
+    {
+        memcpy(work, in, c->in_len * elem);
+        ref_in = work;
+    }
+    kernel->run(c, 0, ref_in, out_ref);
+
+    if (kernel->flags & SWEEP_CLOBBER)
+    {
+        memcpy(work, in, c->in_len * elem);
+        opt_in = work;
+    }
+    start = nn_host_time_ns();
+    status = kernel->run(c, 1, opt_in, out_opt);
+    *time_ns += nn_host_time_ns() - start;
+
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return 1;
+    }
+
+    for (i = 0; i < c->out_len; i++)
+    {
+        int32_t   ref = elem == 1 ? ((q7_t *) out_ref)[i] : out_ref[i];
+        int32_t   opt = elem == 1 ? ((q7_t *) out_opt)[i] : out_opt[i];
+
+        if (ref - opt > kernel->tolerance || opt - ref > kernel->tolerance)
+        {
+            return 1;
+        }
+    }
+
+    /* nothing is written after the output */
+    for (i = 0; i < SWEEP_GUARD; i++)
+    {
+        if (((uint8_t *) out_opt)[c->out_len * elem + i] != SWEEP_GUARD_VALUE)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t  num_cases = 200;
+    uint32_t  seed = 1;
+    int       verbose = 0;
+    int       num_filters = 0;
+    char    **filters = argv + 1;
+    uint32_t  total_fails = 0;
+    uint32_t  k;
+    int       i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            num_cases = (uint32_t) strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+        {
+            seed = (uint32_t) strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(argv[i], "-v"))
+        {
+            verbose = 1;
+        }
+        else
+        {
+            filters[num_filters++] = argv[i];
+        }
+    }
+
+    printf("CMSIS-NN sweeps, %s, %u cases per kernel, seed %u\n\n", nn_host_kernels(), (unsigned)num_cases,
+           (unsigned)seed);
+    printf("%-46s %6s %6s %12s %16s\n", "kernel", "cases", "fails", "ops", "throughput");
+
+    for (k = 0; k < NUM_KERNELS; k++)
+    {
+        const sweep_kernel *kernel = &kernels[k];
+        uint32_t  cases = 0;
+        uint32_t  fails = 0;
+        uint64_t  ops = 0;
+        uint64_t  time_ns = 0;
+        uint32_t  n;
+
+        if (num_filters)
+        {
+            for (i = 0; i < num_filters; i++)
+            {
+                if (strstr(kernel->name, filters[i]))
+                {
+                    break;
+                }
+            }
+            if (i == num_filters)
+            {
+                continue;
+            }
+        }
+
+        for (n = 0; n < num_cases; n++)
+        {
+            /* one seed per case, so a case can be run alone with -n 1 -s <seed> */
+            uint32_t  case_seed = seed + n;
+            sweep_case c;
+
+            nn_host_seed(case_seed * 2654435761U + k);
+            if (!sweep_shape(kernel, &c))
+            {
+                continue;
+            }
+            sweep_data(kernel, &c);
+
+            cases++;
+            ops += c.ops;
+            if (sweep_run_case(kernel, &c, &time_ns))
+            {
+                if (fails < 3 || verbose)
+                {
+                    sweep_print_case(kernel, &c, case_seed);
+                }
+                fails++;
+            }
+        }
+
+        printf("%-46s %6u %6u %12llu %9.1f M%s/s\n", kernel->name, (unsigned)cases, (unsigned)fails,
+               (unsigned long long)ops, time_ns ? (double)ops * 1000.0 / (double)time_ns : 0.0, kernel->unit);
+        total_fails += fails;
+    }
+
+    if (total_fails)
+    {
+        printf("\n%u cases failed\n", (unsigned)total_fails);
+        return 1;
+    }
+    printf("\nAll cases passed\n");
+    return 0;
+}
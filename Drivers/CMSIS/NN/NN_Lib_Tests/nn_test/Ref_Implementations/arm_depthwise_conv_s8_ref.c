@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+void arm_depthwise_conv_s8_ref(const q7_t * Im_in,  // input image
+                               const uint16_t dim_im_in_x,  // input image dimention x
+                               const uint16_t dim_im_in_y,  // input image dimention y
+                               const uint16_t ch_im_in, // number of input image channels
+                               const q7_t * wt, // kernel weights
+                               const uint16_t ch_mult,  // channel multiplier
+                               const uint16_t dim_kernel_x, // filter kernel size x
+                               const uint16_t dim_kernel_y, // filter kernel size y
+                               const uint16_t padding_x,    // padding sizes x
+                               const uint16_t padding_y,    // padding sizes y
+                               const uint16_t stride_x, // stride x
+                               const uint16_t stride_y, // stride y
+                               const int32_t * bias,    // per-channel bias
+                               const int32_t * out_shift,   // per-channel output shifts
+                               const int32_t * out_mult,    // per-channel output multipliers
+                               const int32_t input_offset,  // negated zero-point of the input
+                               const int32_t out_offset,    // zero-point of the output
+                               const int32_t out_activation_min, const int32_t out_activation_max, q7_t * Im_out, // output image
+                               const uint16_t dim_im_out_x, // output image dimension x
+                               const uint16_t dim_im_out_y  // output image dimension y
+    )
+{
+    int       i, j, k, m, n;
+    q31_t     conv_out;
+    int       in_row, in_col;
+    int       ch_im_out = ch_im_in * ch_mult;
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out_y; j++)
+        {
+            for (k = 0; k < dim_im_out_x; k++)
+            {
+                conv_out = bias ? bias[i] : 0;
+                for (m = 0; m < dim_kernel_y; m++)
+                {
+                    for (n = 0; n < dim_kernel_x; n++)
+                    {
+                        // if-for implementation
+                        in_row = stride_y * j + m - padding_y;
+                        in_col = stride_x * k + n - padding_x;
+                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in_y && in_col < dim_im_in_x)
+                        {
+                            conv_out += (Im_in[(in_row * dim_im_in_x + in_col) * ch_im_in + i / ch_mult] + input_offset) *
+                                wt[(m * dim_kernel_x + n) * ch_im_out + i];
+                        }
+                    }
+                }
+                Im_out[i + (j * dim_im_out_x + k) * ch_im_out] =
+                    arm_nn_requantize_s8_ref(conv_out, out_mult[i], out_shift[i], out_offset,
+                                             out_activation_min, out_activation_max);
+            }
+        }
+    }
+}
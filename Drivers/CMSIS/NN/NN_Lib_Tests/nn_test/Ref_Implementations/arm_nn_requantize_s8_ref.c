@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+q7_t arm_nn_requantize_s8_ref(const q31_t acc,  // accumulator
+                              const q31_t mult, // multiplier in Q31
+                              const q31_t shift,    // left-shift (positive) or right-shift (negative)
+                              const q31_t out_offset,   // zero-point of the output
+                              const q31_t act_min, const q31_t act_max) // range of the output
+{
+    int       left = shift > 0 ? shift : 0;
+    int       right = shift > 0 ? 0 : -shift;
+    q63_t     x = (q63_t) acc * ((q63_t) 1 << left) * mult;
+    q63_t     half = ((q63_t) 1 << right) >> 1;
+    q63_t     out;
+
+    // rounding doubling high multiply: x / 2^31, rounded to nearest, halves upward
+    x = (x + ((q63_t) 1 << 30)) >> 31;
+
+    // rounding right-shift, halves away from zero
+    out = x >= 0 ? (x + half) >> right : -((-x + half) >> right);
+
+    out += out_offset;
+    if (out < act_min)
+    {
+        out = act_min;
+    }
+    if (out > act_max)
+    {
+        out = act_max;
+    }
+    return (q7_t) out;
+}
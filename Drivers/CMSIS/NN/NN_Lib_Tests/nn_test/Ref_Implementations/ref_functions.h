@@ -143,6 +143,51 @@ extern    "C"
                                                                 q7_t * bufferB  //buffer space for output
         );
 
+    void      arm_convolve_s8_ref(const q7_t * Im_in,   // input image
+                                  const uint16_t dim_im_in_x,   // input image dimention x
+                                  const uint16_t dim_im_in_y,   // input image dimention y
+                                  const uint16_t ch_im_in,  // number of input image channels
+                                  const q7_t * wt,  // kernel weights
+                                  const uint16_t ch_im_out, // number of filters, i.e., output image channels
+                                  const uint16_t dim_kernel_x,  // filter kernel size x
+                                  const uint16_t dim_kernel_y,  // filter kernel size y
+                                  const uint16_t padding_x, // padding sizes x
+                                  const uint16_t padding_y, // padding sizes y
+                                  const uint16_t stride_x,  // stride x
+                                  const uint16_t stride_y,  // stride y
+                                  const int32_t * bias, // per-channel bias
+                                  const int32_t * out_shift,    // per-channel output shifts
+                                  const int32_t * out_mult, // per-channel output multipliers
+                                  const int32_t input_offset,   // negated zero-point of the input
+                                  const int32_t out_offset, // zero-point of the output
+                                  const int32_t out_activation_min, const int32_t out_activation_max, q7_t * Im_out,  // output image
+                                  const uint16_t dim_im_out_x,  // output image dimension x
+                                  const uint16_t dim_im_out_y,  // output image dimension y
+                                  q15_t * bufferA   //buffer space for input
+        );
+
+    void      arm_depthwise_conv_s8_ref(const q7_t * Im_in, // input image
+                                        const uint16_t dim_im_in_x, // input image dimention x
+                                        const uint16_t dim_im_in_y, // input image dimention y
+                                        const uint16_t ch_im_in,    // number of input image channels
+                                        const q7_t * wt,    // kernel weights
+                                        const uint16_t ch_mult, // channel multiplier
+                                        const uint16_t dim_kernel_x,    // filter kernel size x
+                                        const uint16_t dim_kernel_y,    // filter kernel size y
+                                        const uint16_t padding_x,   // padding sizes x
+                                        const uint16_t padding_y,   // padding sizes y
+                                        const uint16_t stride_x,    // stride x
+                                        const uint16_t stride_y,    // stride y
+                                        const int32_t * bias,   // per-channel bias
+                                        const int32_t * out_shift,  // per-channel output shifts
+                                        const int32_t * out_mult,   // per-channel output multipliers
+                                        const int32_t input_offset, // negated zero-point of the input
+                                        const int32_t out_offset,   // zero-point of the output
+                                        const int32_t out_activation_min, const int32_t out_activation_max, q7_t * Im_out,    // output image
+                                        const uint16_t dim_im_out_x,    // output image dimension x
+                                        const uint16_t dim_im_out_y // output image dimension y
+        );
+
 /*
  *
  * Fully-connected reference implemenation
@@ -203,6 +248,18 @@ extern    "C"
                                                          const q7_t * bias, q15_t * pOut,   // output operand
                                                          q15_t * vec_buffer);
 
+    void      arm_fully_connected_s8_ref(const q7_t * pV,   // pointer to vector
+                                         const q7_t * pM,   // pointer to matrix
+                                         const uint16_t dim_vec,    // length of the vector
+                                         const uint16_t num_of_rows,    // numCol of A
+                                         const int32_t * bias,  // per-row bias
+                                         const int32_t * out_shift, // per-row output shifts
+                                         const int32_t * out_mult,  // per-row output multipliers
+                                         const int32_t input_offset,    // negated zero-point of the input
+                                         const int32_t out_offset,  // zero-point of the output
+                                         const int32_t out_activation_min, const int32_t out_activation_max, q7_t * pOut,   // output operand
+                                         q15_t * vec_buffer);
+
 /*
  *
  * Pooling reference implemenation
@@ -241,6 +298,9 @@ extern    "C"
 
     void      arm_nn_mult_q7_ref(q7_t * pSrcA, q7_t * pSrcB, q7_t * pDst, const uint16_t out_shift, uint32_t blockSize);
 
+    q7_t      arm_nn_requantize_s8_ref(const q31_t acc, const q31_t mult, const q31_t shift,
+                                       const q31_t out_offset, const q31_t act_min, const q31_t act_max);
+
     void      arm_nn_mult_q15_ref(q15_t * pSrcA, q15_t * pSrcB, q15_t * pDst, const uint16_t out_shift, uint32_t blockSize);
 
 #ifdef __cplusplus
@@ -46,6 +46,8 @@
 #define TEST_CONV
 #define TEST_NONSQUARE
 #define TEST_NNMULT
+#define TEST_S8
+#define TEST_FUSED
 
 int test_index = 0;
 q7_t test_flags[50];
@@ -781,6 +783,235 @@ int main()
     delete[]test3;
     delete[]test4;
 
+#endif
+
+#ifdef TEST_S8
+
+/* odd shapes to test the left-over columns, rows and pixels */
+
+#define S8_IM_DIM_X 9
+#define S8_IM_DIM_Y 7
+#define S8_IM_CH 5
+#define S8_KER_DIM_X 3
+#define S8_KER_DIM_Y 3
+#define S8_STRIDE_X 2
+#define S8_STRIDE_Y 1
+#define S8_PADDING_X 1
+#define S8_PADDING_Y 1
+#define S8_OUT_CH 7
+#define S8_CH_MULT 2
+#define S8_OUT_DIM_X 5
+#define S8_OUT_DIM_Y 7
+#define S8_IP_COL_DIM 75
+#define S8_IP_ROW_DIM 31
+
+/* the depthwise convolution has the most output channels, the fully-connected layer the most weights */
+#define S8_MAX_CH (S8_IM_CH * S8_CH_MULT)
+#define S8_WT_SIZE (S8_IP_ROW_DIM * S8_IP_COL_DIM)
+#define S8_IN_OFFSET 13
+#define S8_OUT_OFFSET -7
+#define S8_ACT_MIN -100
+#define S8_ACT_MAX 127
+
+    test1 = new q7_t[S8_WT_SIZE];
+    test2 = new q15_t[2 * S8_KER_DIM_Y * S8_KER_DIM_X * S8_IM_CH];
+    test3 = new q7_t[S8_IM_DIM_Y * S8_IM_DIM_X * S8_IM_CH + 2 * S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_MAX_CH];
+
+    int32_t  *s8_bias = new int32_t[S8_IP_ROW_DIM];
+    int32_t  *s8_out_shift = new int32_t[S8_IP_ROW_DIM];
+    int32_t  *s8_out_mult = new int32_t[S8_IP_ROW_DIM];
+
+    for (int i = 0; i < S8_WT_SIZE; i++)
+    {
+        test1[i] = rand() % 255 - 127;
+    }
+
+    for (int i = 0; i < S8_IM_DIM_Y * S8_IM_DIM_X * S8_IM_CH + 2 * S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_MAX_CH; i++)
+    {
+        test3[i] = rand() % 256 - 128;
+    }
+
+    /* per-channel scales: multiplier in [0.5, 1) and shift in [-12, -8] */
+    for (int i = 0; i < S8_IP_ROW_DIM; i++)
+    {
+        s8_bias[i] = rand() % 10000 - 5000;
+        s8_out_shift[i] = -8 - rand() % 5;
+        s8_out_mult[i] = 0x40000000 + (rand() % 0x4000) * 0x10000 + rand() % 0x10000;
+    }
+
+    q7_t     *s8_weight = test1;
+    q15_t    *s8_buf = test2;
+
+    q7_t     *s8_im_in = test3;
+    q7_t     *s8_im_out_ref = test3 + S8_IM_DIM_Y * S8_IM_DIM_X * S8_IM_CH;
+    q7_t     *s8_im_out_opt = s8_im_out_ref + S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_MAX_CH;
+
+    initialize_results_q7(s8_im_out_ref, s8_im_out_opt, S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_OUT_CH);
+
+    printf("start conv s8 ref implementation\n");
+    arm_convolve_s8_ref(s8_im_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weight, S8_OUT_CH, S8_KER_DIM_X,
+                        S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, S8_STRIDE_X, S8_STRIDE_Y, s8_bias, s8_out_shift,
+                        s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX, s8_im_out_ref,
+                        S8_OUT_DIM_X, S8_OUT_DIM_Y, s8_buf);
+
+    printf("start conv s8 implementation\n");
+    arm_convolve_s8(s8_im_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weight, S8_OUT_CH, S8_KER_DIM_X,
+                    S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, S8_STRIDE_X, S8_STRIDE_Y, s8_bias, s8_out_shift,
+                    s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX, s8_im_out_opt,
+                    S8_OUT_DIM_X, S8_OUT_DIM_Y, s8_buf);
+
+    verify_results_q7(s8_im_out_ref, s8_im_out_opt, S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_OUT_CH);
+
+    initialize_results_q7(s8_im_out_ref, s8_im_out_opt, S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_OUT_CH);
+
+    printf("start conv s8 implementation without bias\n");
+    arm_convolve_s8_ref(s8_im_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weight, S8_OUT_CH, S8_KER_DIM_X,
+                        S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, S8_STRIDE_X, S8_STRIDE_Y, NULL, s8_out_shift,
+                        s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX, s8_im_out_ref,
+                        S8_OUT_DIM_X, S8_OUT_DIM_Y, s8_buf);
+
+    arm_convolve_s8(s8_im_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weight, S8_OUT_CH, S8_KER_DIM_X,
+                    S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, S8_STRIDE_X, S8_STRIDE_Y, NULL, s8_out_shift,
+                    s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX, s8_im_out_opt,
+                    S8_OUT_DIM_X, S8_OUT_DIM_Y, s8_buf);
+
+    verify_results_q7(s8_im_out_ref, s8_im_out_opt, S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_OUT_CH);
+
+    initialize_results_q7(s8_im_out_ref, s8_im_out_opt, S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_MAX_CH);
+
+    printf("start depthwise conv s8 ref implementation\n");
+    arm_depthwise_conv_s8_ref(s8_im_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weight, S8_CH_MULT, S8_KER_DIM_X,
+                              S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, S8_STRIDE_X, S8_STRIDE_Y, s8_bias,
+                              s8_out_shift, s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX,
+                              s8_im_out_ref, S8_OUT_DIM_X, S8_OUT_DIM_Y);
+
+    printf("start depthwise conv s8 implementation\n");
+    arm_depthwise_conv_s8(s8_im_in, S8_IM_DIM_X, S8_IM_DIM_Y, S8_IM_CH, s8_weight, S8_CH_MULT, S8_KER_DIM_X,
+                          S8_KER_DIM_Y, S8_PADDING_X, S8_PADDING_Y, S8_STRIDE_X, S8_STRIDE_Y, s8_bias,
+                          s8_out_shift, s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX,
+                          s8_im_out_opt, S8_OUT_DIM_X, S8_OUT_DIM_Y);
+
+    verify_results_q7(s8_im_out_ref, s8_im_out_opt, S8_OUT_DIM_Y * S8_OUT_DIM_X * S8_MAX_CH);
+
+    initialize_results_q7(s8_im_out_ref, s8_im_out_opt, S8_IP_ROW_DIM);
+
+    printf("start fully-connected s8 ref implementation\n");
+    arm_fully_connected_s8_ref(s8_im_in, s8_weight, S8_IP_COL_DIM, S8_IP_ROW_DIM, s8_bias, s8_out_shift,
+                               s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX, s8_im_out_ref,
+                               s8_buf);
+
+    printf("start fully-connected s8 implementation\n");
+    arm_fully_connected_s8(s8_im_in, s8_weight, S8_IP_COL_DIM, S8_IP_ROW_DIM, s8_bias, s8_out_shift,
+                           s8_out_mult, S8_IN_OFFSET, S8_OUT_OFFSET, S8_ACT_MIN, S8_ACT_MAX, s8_im_out_opt,
+                           s8_buf);
+
+    verify_results_q7(s8_im_out_ref, s8_im_out_opt, S8_IP_ROW_DIM);
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+    delete[]s8_bias;
+    delete[]s8_out_shift;
+    delete[]s8_out_mult;
+
+#endif
+
+#ifdef TEST_FUSED
+
+/* conv + ReLU + 2x2 pooling, the odd last row and column of the conv output are dropped */
+
+#define FUSED_IM_DIM 15
+#define FUSED_IM_CH 8
+#define FUSED_KER_DIM 3
+#define FUSED_PADDING 1
+#define FUSED_STRIDE 1
+#define FUSED_OUT_CH 10
+#define FUSED_CONV_DIM 15
+#define FUSED_OUT_DIM 7
+#define FUSED_BIAS_SHIFT 6
+#define FUSED_OUT_SHIFT 9
+
+    test1 = new q7_t[FUSED_OUT_CH * FUSED_IM_CH * FUSED_KER_DIM * FUSED_KER_DIM + FUSED_OUT_CH];
+    test2 = new q15_t[2 * FUSED_IM_CH * FUSED_KER_DIM * FUSED_KER_DIM];
+    test3 = new q7_t[FUSED_IM_DIM * FUSED_IM_DIM * FUSED_IM_CH + FUSED_CONV_DIM * FUSED_CONV_DIM * FUSED_OUT_CH
+                     + 2 * FUSED_OUT_DIM * FUSED_OUT_DIM * FUSED_OUT_CH + 4 * FUSED_OUT_CH];
+
+    for (int i = 0; i < FUSED_OUT_CH * FUSED_IM_CH * FUSED_KER_DIM * FUSED_KER_DIM + FUSED_OUT_CH; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    for (int i = 0; i < FUSED_IM_DIM * FUSED_IM_DIM * FUSED_IM_CH; i++)
+    {
+        test3[i] = rand() % 256 - 128;
+    }
+
+    q7_t     *fused_weight = test1;
+    q7_t     *fused_bias = test1 + FUSED_OUT_CH * FUSED_IM_CH * FUSED_KER_DIM * FUSED_KER_DIM;
+    q15_t    *fused_bufA = test2;
+
+    q7_t     *fused_im_in = test3;
+    q7_t     *fused_conv_out = test3 + FUSED_IM_DIM * FUSED_IM_DIM * FUSED_IM_CH;
+    q7_t     *fused_out_ref = fused_conv_out + FUSED_CONV_DIM * FUSED_CONV_DIM * FUSED_OUT_CH;
+    q7_t     *fused_out_opt = fused_out_ref + FUSED_OUT_DIM * FUSED_OUT_DIM * FUSED_OUT_CH;
+    q7_t     *fused_bufB = fused_out_opt + FUSED_OUT_DIM * FUSED_OUT_DIM * FUSED_OUT_CH;
+
+    uint32_t  unfused_cycles, fused_cycles;
+
+    start_cycle_counter();
+
+    initialize_results_q7(fused_out_ref, fused_out_opt, FUSED_OUT_DIM * FUSED_OUT_DIM * FUSED_OUT_CH);
+
+    printf("start unfused conv + relu + maxpool implementation\n");
+
+    unfused_cycles = get_cycle_count();
+    arm_convolve_HWC_q7_fast(fused_im_in, FUSED_IM_DIM, FUSED_IM_CH, fused_weight, FUSED_OUT_CH, FUSED_KER_DIM,
+                             FUSED_PADDING, FUSED_STRIDE, fused_bias, FUSED_BIAS_SHIFT, FUSED_OUT_SHIFT,
+                             fused_conv_out, FUSED_CONV_DIM, fused_bufA, NULL);
+    arm_relu_q7(fused_conv_out, FUSED_CONV_DIM * FUSED_CONV_DIM * FUSED_OUT_CH);
+    arm_maxpool_q7_HWC(fused_conv_out, FUSED_CONV_DIM, FUSED_OUT_CH, 2, 0, 2, FUSED_OUT_DIM, NULL, fused_out_ref);
+    unfused_cycles = get_cycle_count() - unfused_cycles;
+
+    printf("start fused conv + relu + maxpool implementation\n");
+
+    fused_cycles = get_cycle_count();
+    arm_convolve_HWC_q7_fast_relu_maxpool_2x2(fused_im_in, FUSED_IM_DIM, FUSED_IM_CH, fused_weight, FUSED_OUT_CH,
+                                              FUSED_KER_DIM, FUSED_PADDING, FUSED_STRIDE, fused_bias,
+                                              FUSED_BIAS_SHIFT, FUSED_OUT_SHIFT, fused_out_opt, FUSED_OUT_DIM,
+                                              fused_bufA, fused_bufB);
+    fused_cycles = get_cycle_count() - fused_cycles;
+
+    verify_results_q7(fused_out_ref, fused_out_opt, FUSED_OUT_DIM * FUSED_OUT_DIM * FUSED_OUT_CH);
+
+    /* the bufferA of the conv is the same for both */
+    printf("conv output buffer: unfused %d bytes, fused %d bytes\n",
+           FUSED_CONV_DIM * FUSED_CONV_DIM * FUSED_OUT_CH, 4 * FUSED_OUT_CH);
+    printf("cycles: unfused %u, fused %u\n\n", (unsigned int)unfused_cycles, (unsigned int)fused_cycles);
+
+    initialize_results_q7(fused_out_ref, fused_out_opt, FUSED_OUT_DIM * FUSED_OUT_DIM * FUSED_OUT_CH);
+
+    printf("start conv + relu + avepool ref implementation\n");
+
+    arm_convolve_HWC_q7_ref(fused_im_in, FUSED_IM_DIM, FUSED_IM_CH, fused_weight, FUSED_OUT_CH, FUSED_KER_DIM,
+                            FUSED_PADDING, FUSED_STRIDE, fused_bias, FUSED_BIAS_SHIFT, FUSED_OUT_SHIFT,
+                            fused_conv_out, FUSED_CONV_DIM, fused_bufA, NULL);
+    arm_relu_q7_ref(fused_conv_out, FUSED_CONV_DIM * FUSED_CONV_DIM * FUSED_OUT_CH);
+    arm_avepool_q7_HWC_ref(fused_conv_out, FUSED_CONV_DIM, FUSED_OUT_CH, 2, 0, 2, FUSED_OUT_DIM, NULL,
+                           fused_out_ref);
+
+    printf("start fused conv + relu + avepool implementation\n");
+
+    arm_convolve_HWC_q7_fast_relu_avepool_2x2(fused_im_in, FUSED_IM_DIM, FUSED_IM_CH, fused_weight, FUSED_OUT_CH,
+                                              FUSED_KER_DIM, FUSED_PADDING, FUSED_STRIDE, fused_bias,
+                                              FUSED_BIAS_SHIFT, FUSED_OUT_SHIFT, fused_out_opt, FUSED_OUT_DIM,
+                                              fused_bufA, fused_bufB);
+
+    verify_results_q7(fused_out_ref, fused_out_opt, FUSED_OUT_DIM * FUSED_OUT_DIM * FUSED_OUT_CH);
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+
 #endif
 
     test_pass = true;
@@ -797,5 +1028,5 @@ int main()
         printf("Test failed passed\n");
     }
 
-    return 0;
+    return test_pass ? 0 : 1;
 }
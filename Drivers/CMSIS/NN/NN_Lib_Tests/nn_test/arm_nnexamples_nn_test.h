@@ -25,6 +25,25 @@ void initialize_results_q15(q15_t * ref, q15_t * opt, int length)
     arm_fill_q15(0x5F5, opt, length);
 }
 
+/* cycle counter of the DWT, reads 0 on the cores without it */
+void start_cycle_counter(void)
+{
+#if defined (DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t get_cycle_count(void)
+{
+#if defined (DWT)
+    return DWT->CYCCNT;
+#else
+    return 0;
+#endif
+}
+
 void verify_results_q7(q7_t * ref, q7_t * opt, int length)
 {
 
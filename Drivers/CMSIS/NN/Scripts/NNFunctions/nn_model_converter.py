@@ -0,0 +1,224 @@
+#!/usr/bin/python3
+
+# Convert a q7 network to the model format of arm_nn_model_load_q7.
+#
+# The network is described by a JSON file:
+#
+# {
+#   "headers": ["arm_nnexamples_cifar10_parameter.h", "arm_nnexamples_cifar10_weights.h"],
+#   "layers": [
+#     {"type": "ARM_NN_CONV_HWC_Q7_RGB", "input": 0, "output": 1,
+#      "dim_im_in": "CONV1_IM_DIM", "ch_im_in": "CONV1_IM_CH", ...
+#      "wt": "CONV1_WT", "bias": "CONV1_BIAS"},
+#     ...
+#   ]
+# }
+#
+# The fields of a layer are the fields of arm_nn_layer_q7. A value is a
+# number, a list of numbers, or the name of a #define of the headers (paths
+# relative to the JSON file), so the weights generated for the examples can be
+# used directly. "input" and "output" of the graph default to the input of
+# the first layer and the output of the last layer.
+#
+# The weights of the ARM_NN_FULLY_CONNECTED_Q7_OPT layers are given in row
+# order and are reordered for arm_fully_connected_q7_opt, unless the layer
+# has "reordered": true.
+#
+# e.g.: nn_model_converter.py cifar10_model.json -o cifar10.bin
+#       nn_model_converter.py cifar10_model.json -c cifar10_model.c --name cifar10_model
+#
+# The binary file can be written in a memory mapped flash and loaded in place
+# by arm_nn_model_load_q7. The C file defines a 4-byte aligned constant array.
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+
+MODEL_MAGIC = 0x37514E4E
+MODEL_VERSION = 1
+
+HEADER_FORMAT = "<IHHHHHHI"
+LAYER_FORMAT = "<12HII"
+
+LAYER_FIELDS = ["input", "output", "dim_im_in", "ch_im_in", "ch_im_out", "dim_kernel",
+                "padding", "stride", "dim_im_out", "bias_shift", "out_shift"]
+
+CONV_TYPES = ["ARM_NN_CONV_HWC_Q7_BASIC", "ARM_NN_CONV_HWC_Q7_FAST", "ARM_NN_CONV_HWC_Q7_RGB"]
+FC_TYPES = ["ARM_NN_FULLY_CONNECTED_Q7", "ARM_NN_FULLY_CONNECTED_Q7_OPT"]
+
+
+def parseLayerTypes(path):
+    """Values of the arm_nn_layer_type enum of arm_nnfunctions.h."""
+    with open(path) as f:
+        text = f.read()
+    m = re.search(r"typedef\s+enum\s*\{(.*?)\}\s*arm_nn_layer_type\s*;", text, flags=re.S)
+    if not m:
+        sys.exit("arm_nn_layer_type not found in " + path)
+    return {name: int(value) for name, value in re.findall(r"\b(ARM_NN_\w+)\s*=\s*(\d+)", m.group(1))}
+
+
+def parseDefines(paths):
+    defines = {}
+    for p in paths:
+        with open(p, errors="replace") as f:
+            text = f.read()
+        text = re.sub(r"\\\n", " ", text)
+        for m in re.finditer(r"^\s*#\s*define\s+(\w+)\s+([^\n]+)$", text, flags=re.M):
+            defines[m.group(1)] = m.group(2).strip()
+    return defines
+
+
+def evalValue(value, defines, depth=0):
+    """Number or list of numbers of a JSON value."""
+    if isinstance(value, (int, list)):
+        return value
+    if not isinstance(value, str) or depth > 8:
+        raise ValueError("invalid value {0!r}".format(value))
+    expr = value.strip()
+    if expr in defines:
+        return evalValue(defines[expr], defines, depth + 1)
+    if expr.startswith("{"):
+        return [int(v, 0) for v in re.split(r"[\s,]+", expr.strip("{} ")) if v]
+    for name in set(re.findall(r"\b[A-Za-z_]\w*\b", expr)):
+        if name not in defines:
+            raise ValueError("unknown name {0}".format(name))
+        expr = re.sub(r"\b{0}\b".format(name), "({0})".format(evalValue(name, defines, depth + 1)), expr)
+    if not re.fullmatch(r"[\d\s+\-*/()<>x]+", expr):
+        raise ValueError("invalid expression {0!r}".format(value))
+    return int(eval(expr.replace("/", "//")))
+
+
+def reorderQ7Opt(weights, rows, cols):
+    """Weights in the order of arm_fully_connected_q7_opt (groups of 4 rows)."""
+    out = []
+    for base in range(0, rows - rows % 4, 4):
+        r = [weights[(base + k) * cols:(base + k + 1) * cols] for k in range(4)]
+        for c in range(0, cols - cols % 4, 4):
+            out += [r[0][c], r[1][c], r[0][c + 2], r[1][c + 2],
+                    r[2][c], r[3][c], r[2][c + 2], r[3][c + 2],
+                    r[0][c + 1], r[1][c + 1], r[0][c + 3], r[1][c + 3],
+                    r[2][c + 1], r[3][c + 1], r[2][c + 3], r[3][c + 3]]
+        for c in range(cols - cols % 4, cols):
+            out += [r[0][c], r[1][c], r[2][c], r[3][c]]
+    # The remaining rows are in order
+    out += weights[(rows - rows % 4) * cols:]
+    return out
+
+
+def expectedSizes(layerType, p):
+    """Number of weights and biases of a layer, as checked by arm_nn_model_load_q7."""
+    if layerType in CONV_TYPES:
+        return p["ch_im_out"] * p["dim_kernel"] * p["dim_kernel"] * p["ch_im_in"], p["ch_im_out"]
+    if layerType == "ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7":
+        return p["ch_im_in"] * p["dim_kernel"] * p["dim_kernel"], p["ch_im_in"]
+    if layerType in FC_TYPES:
+        return p["ch_im_out"] * p["dim_im_in"] * p["dim_im_in"] * p["ch_im_in"], p["ch_im_out"]
+    return 0, 0
+
+
+def convert(model, defines, layerTypes):
+    """Bytes of the model, and a report line per layer."""
+    layers = model["layers"]
+    records = []
+    data = bytearray()
+    report = []
+    dataOffset = struct.calcsize(HEADER_FORMAT) + len(layers) * struct.calcsize(LAYER_FORMAT)
+
+    def addArray(values, name):
+        if any(v < -128 or v > 127 for v in values):
+            raise ValueError("{0} is not q7".format(name))
+        offset = dataOffset + len(data)
+        data.extend(struct.pack("<{0}b".format(len(values)), *values))
+        data.extend(b"\0" * (-len(data) % 4))
+        return offset
+
+    for i, layer in enumerate(layers):
+        where = "layer {0}".format(i)
+        try:
+            layerType = layer["type"]
+            if layerType not in layerTypes:
+                raise ValueError("unknown type {0}".format(layerType))
+            p = {f: evalValue(layer.get(f, 0), defines) for f in LAYER_FIELDS}
+            for f, v in p.items():
+                if not isinstance(v, int) or v < 0 or v > 0xFFFF:
+                    raise ValueError("{0} is not a uint16_t".format(f))
+            numWeights, numBias = expectedSizes(layerType, p)
+            wtOffset = biasOffset = 0
+            if numWeights:
+                wt = evalValue(layer["wt"], defines)
+                bias = evalValue(layer["bias"], defines)
+                if len(wt) != numWeights or len(bias) != numBias:
+                    raise ValueError("{0} weights and {1} biases instead of {2} and {3}".format(
+                        len(wt), len(bias), numWeights, numBias))
+                if layerType == "ARM_NN_FULLY_CONNECTED_Q7_OPT" and not layer.get("reordered", False):
+                    wt = reorderQ7Opt(wt, p["ch_im_out"], numWeights // p["ch_im_out"])
+                wtOffset = addArray(wt, "wt")
+                biasOffset = addArray(bias, "bias")
+        except (KeyError, ValueError) as e:
+            sys.exit("{0}: {1}".format(where, e))
+        records.append(struct.pack(LAYER_FORMAT, layerTypes[layerType],
+                                   *[p[f] for f in LAYER_FIELDS], wtOffset, biasOffset))
+        report.append("  {0:3} {1:40} {2:3} -> {3:3} {4:8} bytes".format(
+            i, layerType, p["input"], p["output"], numWeights + numBias))
+
+    indices = [evalValue(l.get(f, 0), defines) for l in layers for f in ("input", "output")]
+    graphInput = evalValue(model.get("input", layers[0].get("input", 0)), defines)
+    graphOutput = evalValue(model.get("output", layers[-1].get("output", 0)), defines)
+    size = dataOffset + len(data)
+    header = struct.pack(HEADER_FORMAT, MODEL_MAGIC, MODEL_VERSION, len(layers), max(indices) + 1,
+                         graphInput, graphOutput, 0, size)
+    return header + b"".join(records) + bytes(data), report
+
+
+def writeCSource(path, name, blob):
+    lines = ["/* Generated by nn_model_converter.py */",
+             "",
+             "#include \"arm_math.h\"",
+             "",
+             "const uint32_t {0}_size = {1};".format(name, len(blob)),
+             "",
+             "const uint8_t {0}[{1}] __ALIGNED(4) = {{".format(name, len(blob))]
+    for i in range(0, len(blob), 16):
+        lines.append("    " + ", ".join("0x{0:02X}".format(b) for b in blob[i:i + 16]) + ",")
+    lines.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a q7 network to a CMSIS-NN model")
+    parser.add_argument("model", help="JSON description of the network")
+    parser.add_argument("-o", "--output", help="binary model")
+    parser.add_argument("-c", "--c-source", help="C source defining the model as a constant array")
+    parser.add_argument("--name", default="nn_model", help="name of the array of the C source")
+    parser.add_argument("-I", "--header", action="append", default=[],
+                        help="C header with the #define of the values, in addition to the headers of the JSON file")
+    parser.add_argument("--nnfunctions", default=os.path.join(ROOT, "..", "..", "Include", "arm_nnfunctions.h"),
+                        help="arm_nnfunctions.h of CMSIS-NN")
+    args = parser.parse_args()
+
+    with open(args.model) as f:
+        model = json.load(f)
+    base = os.path.dirname(os.path.abspath(args.model))
+    headers = [os.path.join(base, h) for h in model.get("headers", [])] + args.header
+
+    blob, report = convert(model, parseDefines(headers), parseLayerTypes(args.nnfunctions))
+
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(blob)
+    if args.c_source:
+        writeCSource(args.c_source, args.name, blob)
+
+    print("Layers:")
+    print("\n".join(report))
+    print("Model size : {0:8} bytes".format(len(blob)))
+
+
+if __name__ == "__main__":
+    main()
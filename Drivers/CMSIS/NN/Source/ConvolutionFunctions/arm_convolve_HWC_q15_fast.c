@@ -74,6 +74,8 @@
    *
    * ch_im_out is multipe of 2
    *
+   * dim_im_out is a multiple of 2
+   *
    */
 
 arm_status
@@ -101,7 +103,7 @@ arm_convolve_HWC_q15_fast(const q15_t * Im_in,
     q15_t    *im_buffer = bufferA;
     q15_t    *pOut = Im_out;
 
-    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0)
+    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0 || dim_im_out % 2 != 0)
     {
         /* check if the input dimension meets the constraints */
         return ARM_MATH_SIZE_MISMATCH;
@@ -208,7 +210,7 @@ arm_convolve_HWC_q15_fast(const q15_t * Im_in,
     int       conv_out;
     signed char in_row, in_col;
 
-    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0)
+    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0 || dim_im_out % 2 != 0)
     {
         /* check if the input dimension meets the constraints */
         return ARM_MATH_SIZE_MISMATCH;
@@ -79,6 +79,8 @@
    *
    * ch_im_out is multipe of 2
    *
+   * dim_im_out_x is a multiple of 2
+   *
    */
 
 arm_status
@@ -111,7 +113,7 @@ arm_convolve_HWC_q15_fast_nonsquare(const q15_t * Im_in,
     q15_t    *im_buffer = bufferA;
     q15_t    *pOut = Im_out;
 
-    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0)
+    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0 || dim_im_out_x % 2 != 0)
     {
         /* check if the input dimension meets the constraints */
         return ARM_MATH_SIZE_MISMATCH;
@@ -218,7 +220,7 @@ arm_convolve_HWC_q15_fast_nonsquare(const q15_t * Im_in,
     int       conv_out;
     signed char in_row, in_col;
 
-    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0)
+    if (ch_im_in % 2 != 0 || ch_im_out % 2 != 0 || dim_im_out_x % 2 != 0)
     {
         /* check if the input dimension meets the constraints */
         return ARM_MATH_SIZE_MISMATCH;
@@ -133,7 +133,7 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
      */
 
     /* top part */
-    for (i_out_y = 0; i_out_y < padding; i_out_y++)
+    for (i_out_y = 0; i_out_y < padding && i_out_y < dim_im_out; i_out_y++)
     {
         for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
         {
@@ -175,7 +175,7 @@ arm_convolve_HWC_q7_fast(const q7_t * Im_in,
     {
 
         /* left part */
-        for (i_out_x = 0; i_out_x < padding; i_out_x++)
+        for (i_out_x = 0; i_out_x < padding && i_out_x < dim_im_out; i_out_x++)
         {
             /* This part implements the im2col function */
             for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
@@ -120,7 +120,7 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
      */
 
     /* top part */
-    for (i_out_y = 0; i_out_y < padding_y; i_out_y++)
+    for (i_out_y = 0; i_out_y < padding_y && i_out_y < dim_im_out_y; i_out_y++)
     {
         for (i_out_x = 0; i_out_x < dim_im_out_x; i_out_x++)
         {
@@ -160,7 +160,7 @@ arm_status arm_convolve_HWC_q7_fast_nonsquare(const q7_t * Im_in,
     {
 
         /* left part */
-        for (i_out_x = 0; i_out_x < padding_x; i_out_x++)
+        for (i_out_x = 0; i_out_x < padding_x && i_out_x < dim_im_out_x; i_out_x++)
         {
             /* This part implements the im2col function */
             for (i_ker_y = i_out_y * stride_y - padding_y; i_ker_y < i_out_y * stride_y - padding_y + dim_kernel_y;
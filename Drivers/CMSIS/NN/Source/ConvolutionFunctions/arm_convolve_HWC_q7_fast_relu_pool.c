@@ -0,0 +1,518 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_q7_fast_relu_pool.c
+ * Description:  Fast Q7 convolution fused with ReLU and 2x2 pooling
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#if defined (ARM_MATH_DSP)
+
+/**
+ * @brief A few utility functions used by the fused convolution functions
+ *
+ *
+ */
+
+static q15_t *im2col_pixel_q7_reordered(const q7_t * Im_in,
+                                        const uint16_t dim_im_in,
+                                        const uint16_t ch_im_in,
+                                        const uint16_t dim_kernel,
+                                        const uint16_t padding,
+                                        const uint16_t stride,
+                                        const int16_t i_out_y,
+                                        const int16_t i_out_x,
+                                        q15_t * pBuffer)
+{
+    const int16_t base_y = i_out_y * stride - padding;
+    const int16_t base_x = i_out_x * stride - padding;
+    int16_t   i_ker_y, i_ker_x;
+
+    if (base_y >= 0 && base_x >= 0 && base_y + dim_kernel <= dim_im_in && base_x + dim_kernel <= dim_im_in)
+    {
+        /* the window is inside the input, copy the kernel rows at once */
+        for (i_ker_y = base_y; i_ker_y < base_y + dim_kernel; i_ker_y++)
+        {
+            arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in + (i_ker_y * dim_im_in + base_x) * ch_im_in,
+                                             pBuffer, ch_im_in * dim_kernel);
+            pBuffer += ch_im_in * dim_kernel;
+        }
+    } else
+    {
+        for (i_ker_y = base_y; i_ker_y < base_y + dim_kernel; i_ker_y++)
+        {
+            for (i_ker_x = base_x; i_ker_x < base_x + dim_kernel; i_ker_x++)
+            {
+                if (i_ker_y < 0 || i_ker_y >= dim_im_in || i_ker_x < 0 || i_ker_x >= dim_im_in)
+                {
+                    memset(pBuffer, 0, sizeof(q15_t)*ch_im_in);
+                } else
+                {
+                    arm_q7_to_q15_reordered_no_shift((q7_t *) Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in,
+                                                     pBuffer, ch_im_in);
+                }
+                pBuffer += ch_im_in;
+            }
+        }
+    }
+
+    return pBuffer;
+}
+
+static void replace_if_larger_q7x4(union arm_nnword * max, const q31_t value)
+{
+    union arm_nnword in;
+
+    in.word = value;
+
+    if (in.bytes[0] > max->bytes[0])
+        max->bytes[0] = in.bytes[0];
+    if (in.bytes[1] > max->bytes[1])
+        max->bytes[1] = in.bytes[1];
+    if (in.bytes[2] > max->bytes[2])
+        max->bytes[2] = in.bytes[2];
+    if (in.bytes[3] > max->bytes[3])
+        max->bytes[3] = in.bytes[3];
+}
+
+static void conv_tile_2x2_q7(const q7_t * Im_in,
+                             const uint16_t dim_im_in,
+                             const uint16_t ch_im_in,
+                             const q7_t * wt,
+                             const uint16_t ch_im_out,
+                             const uint16_t dim_kernel,
+                             const uint16_t padding,
+                             const uint16_t stride,
+                             const q7_t * bias,
+                             const uint16_t bias_shift,
+                             const uint16_t out_shift,
+                             const int16_t i_y,
+                             const int16_t i_x,
+                             q15_t * bufferA,
+                             q7_t * bufferB)
+{
+    const uint16_t numCol_A = ch_im_in * dim_kernel * dim_kernel;
+    int16_t   i_tile_y;
+
+    /* each row of the tile is a pair of columns for the 2x2 mat_mult kernel */
+    for (i_tile_y = 0; i_tile_y < 2; i_tile_y++)
+    {
+        q15_t    *pBuffer = bufferA;
+
+        pBuffer = im2col_pixel_q7_reordered(Im_in, dim_im_in, ch_im_in, dim_kernel, padding, stride,
+                                            2 * i_y + i_tile_y, 2 * i_x, pBuffer);
+        im2col_pixel_q7_reordered(Im_in, dim_im_in, ch_im_in, dim_kernel, padding, stride,
+                                  2 * i_y + i_tile_y, 2 * i_x + 1, pBuffer);
+
+        bufferB = arm_nn_mat_mult_kernel_q7_q15_reordered(wt, bufferA, ch_im_out, numCol_A,
+                                                          bias_shift, out_shift, bias, bufferB);
+    }
+}
+
+#endif                          // ARM_MATH_DSP
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Fast Q7 convolution function fused with ReLU and 2x2 max pooling
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension, i.e. after the pooling
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in,out]   bufferB     pointer to buffer space for output
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel*dim_kernel
+   *
+   * bufferB size: 4*ch_im_out
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * ch_im_in is multiple of 4    ( because of the SIMD32 read and swap )
+   *
+   * ch_im_out is multipe of 2    ( bacause 2x2 mat_mult kernel )
+   *
+   * This function gives the same output as arm_convolve_HWC_q7_fast, then
+   * arm_relu_q7, then arm_maxpool_q7_HWC with a 2x2 kernel, a stride of 2
+   * and no padding. The convolution output has the dimension
+   * 2*dim_im_out; an odd last row and column of the convolution are not
+   * computed, like they are dropped by the pooling.
+   *
+   * The convolution is computed one 2x2 tile of its output at a time into
+   * bufferB, and the ReLU and the pooling are done on the tile, so the
+   * convolution output is never stored in full. As the ReLU is monotonic,
+   * it is applied once to the maximum of the tile.
+   */
+
+arm_status
+arm_convolve_HWC_q7_fast_relu_maxpool_2x2(const q7_t * Im_in,
+                                          const uint16_t dim_im_in,
+                                          const uint16_t ch_im_in,
+                                          const q7_t * wt,
+                                          const uint16_t ch_im_out,
+                                          const uint16_t dim_kernel,
+                                          const uint16_t padding,
+                                          const uint16_t stride,
+                                          const q7_t * bias,
+                                          const uint16_t bias_shift,
+                                          const uint16_t out_shift,
+                                          q7_t * Im_out,
+                                          const uint16_t dim_im_out,
+                                          q15_t * bufferA,
+                                          q7_t * bufferB)
+{
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    int16_t   i_y, i_x;
+    q7_t     *pOut = Im_out;
+
+    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
+    {
+        /* check if the input dimension meets the constraints */
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i_y = 0; i_y < dim_im_out; i_y++)
+    {
+        for (i_x = 0; i_x < dim_im_out; i_x++)
+        {
+            const q7_t *pA = bufferB;
+            const q7_t *pB = bufferB + ch_im_out;
+            const q7_t *pC = bufferB + 2 * ch_im_out;
+            const q7_t *pD = bufferB + 3 * ch_im_out;
+            uint16_t  cnt = ch_im_out >> 2;
+
+            conv_tile_2x2_q7(Im_in, dim_im_in, ch_im_in, wt, ch_im_out, dim_kernel, padding, stride,
+                             bias, bias_shift, out_shift, i_y, i_x, bufferA, bufferB);
+
+            /* maximum of the 4 pixels and of 0, 4 channels at a time */
+            while (cnt > 0u)
+            {
+                union arm_nnword max;
+
+                max.word = 0;
+                replace_if_larger_q7x4(&max, *__SIMD32(pA)++);
+                replace_if_larger_q7x4(&max, *__SIMD32(pB)++);
+                replace_if_larger_q7x4(&max, *__SIMD32(pC)++);
+                replace_if_larger_q7x4(&max, *__SIMD32(pD)++);
+
+                *__SIMD32(pOut)++ = max.word;
+
+                cnt--;
+            }
+
+            cnt = ch_im_out & 0x3;
+            while (cnt > 0u)
+            {
+                q7_t      max = 0;
+
+                if (*pA > max)
+                    max = *pA;
+                if (*pB > max)
+                    max = *pB;
+                if (*pC > max)
+                    max = *pC;
+                if (*pD > max)
+                    max = *pD;
+                *pOut++ = max;
+
+                pA++;
+                pB++;
+                pC++;
+                pD++;
+                cnt--;
+            }
+        }
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    uint16_t  i, j, k, l, m, n, t;
+    int       conv_out;
+    int       in_row, in_col;
+
+    (void)bufferA;
+    (void)bufferB;
+
+    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
+    {
+        /* check if the input dimension meets the constraints */
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out; j++)
+        {
+            for (k = 0; k < dim_im_out; k++)
+            {
+                /* the ReLU is the maximum with 0 */
+                q7_t      max = 0;
+
+                for (t = 0; t < 4; t++)
+                {
+                    const uint16_t out_y = 2 * j + (t >> 1);
+                    const uint16_t out_x = 2 * k + (t & 0x1);
+
+                    conv_out = ((q31_t)bias[i] << bias_shift) + NN_ROUND(out_shift);
+                    for (m = 0; m < dim_kernel; m++)
+                    {
+                        for (n = 0; n < dim_kernel; n++)
+                        {
+                            in_row = stride * out_y + m - padding;
+                            in_col = stride * out_x + n - padding;
+                            if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                            {
+                                for (l = 0; l < ch_im_in; l++)
+                                {
+                                    conv_out +=
+                                        Im_in[(in_row * dim_im_in + in_col) * ch_im_in +
+                                              l] * wt[i * ch_im_in * dim_kernel * dim_kernel + (m * dim_kernel +
+                                                                                                n) * ch_im_in + l];
+                                }
+                            }
+                        }
+                    }
+                    conv_out = __SSAT((conv_out >> out_shift), 8);
+                    if (conv_out > max)
+                    {
+                        max = (q7_t) conv_out;
+                    }
+                }
+                Im_out[i + (j * dim_im_out + k) * ch_im_out] = max;
+            }
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+  /**
+   * @brief Fast Q7 convolution function fused with ReLU and 2x2 average pooling
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension, i.e. after the pooling
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in,out]   bufferB     pointer to buffer space for output
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel*dim_kernel
+   *
+   * bufferB size: 4*ch_im_out
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * ch_im_in is multiple of 4    ( because of the SIMD32 read and swap )
+   *
+   * ch_im_out is multipe of 2    ( bacause 2x2 mat_mult kernel )
+   *
+   * The tiling is the same as in arm_convolve_HWC_q7_fast_relu_maxpool_2x2.
+   * The ReLU is applied to the 4 pixels of the tile, and the output is their
+   * sum divided by 4, rounded down. This is the output of
+   * arm_avepool_q7_HWC_ref on the activated convolution output; the
+   * arm_avepool_q7_HWC function divides along x then along y, and may
+   * differ from it by 1.
+   */
+
+arm_status
+arm_convolve_HWC_q7_fast_relu_avepool_2x2(const q7_t * Im_in,
+                                          const uint16_t dim_im_in,
+                                          const uint16_t ch_im_in,
+                                          const q7_t * wt,
+                                          const uint16_t ch_im_out,
+                                          const uint16_t dim_kernel,
+                                          const uint16_t padding,
+                                          const uint16_t stride,
+                                          const q7_t * bias,
+                                          const uint16_t bias_shift,
+                                          const uint16_t out_shift,
+                                          q7_t * Im_out,
+                                          const uint16_t dim_im_out,
+                                          q15_t * bufferA,
+                                          q7_t * bufferB)
+{
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    int16_t   i_y, i_x;
+    q7_t     *pOut = Im_out;
+
+    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
+    {
+        /* check if the input dimension meets the constraints */
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i_y = 0; i_y < dim_im_out; i_y++)
+    {
+        for (i_x = 0; i_x < dim_im_out; i_x++)
+        {
+            const q7_t *pA = bufferB;
+            const q7_t *pB = bufferB + ch_im_out;
+            const q7_t *pC = bufferB + 2 * ch_im_out;
+            const q7_t *pD = bufferB + 3 * ch_im_out;
+            uint16_t  cnt = ch_im_out;
+
+            conv_tile_2x2_q7(Im_in, dim_im_in, ch_im_in, wt, ch_im_out, dim_kernel, padding, stride,
+                             bias, bias_shift, out_shift, i_y, i_x, bufferA, bufferB);
+
+            while (cnt > 0u)
+            {
+                q15_t     sum = 0;
+
+                if (*pA > 0)
+                    sum += *pA;
+                if (*pB > 0)
+                    sum += *pB;
+                if (*pC > 0)
+                    sum += *pC;
+                if (*pD > 0)
+                    sum += *pD;
+                *pOut++ = (q7_t) (sum >> 2);
+
+                pA++;
+                pB++;
+                pC++;
+                pD++;
+                cnt--;
+            }
+        }
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    uint16_t  i, j, k, l, m, n, t;
+    int       conv_out;
+    int       in_row, in_col;
+
+    (void)bufferA;
+    (void)bufferB;
+
+    if (ch_im_in % 4 != 0 || ch_im_out % 2 != 0)
+    {
+        /* check if the input dimension meets the constraints */
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out; j++)
+        {
+            for (k = 0; k < dim_im_out; k++)
+            {
+                int       sum = 0;
+
+                for (t = 0; t < 4; t++)
+                {
+                    const uint16_t out_y = 2 * j + (t >> 1);
+                    const uint16_t out_x = 2 * k + (t & 0x1);
+
+                    conv_out = ((q31_t)bias[i] << bias_shift) + NN_ROUND(out_shift);
+                    for (m = 0; m < dim_kernel; m++)
+                    {
+                        for (n = 0; n < dim_kernel; n++)
+                        {
+                            in_row = stride * out_y + m - padding;
+                            in_col = stride * out_x + n - padding;
+                            if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                            {
+                                for (l = 0; l < ch_im_in; l++)
+                                {
+                                    conv_out +=
+                                        Im_in[(in_row * dim_im_in + in_col) * ch_im_in +
+                                              l] * wt[i * ch_im_in * dim_kernel * dim_kernel + (m * dim_kernel +
+                                                                                                n) * ch_im_in + l];
+                                }
+                            }
+                        }
+                    }
+                    conv_out = __SSAT((conv_out >> out_shift), 8);
+                    if (conv_out > 0)
+                    {
+                        sum += conv_out;
+                    }
+                }
+                Im_out[i + (j * dim_im_out + k) * ch_im_out] = (q7_t) (sum >> 2);
+            }
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_s8.c
+ * Description:  s8 depthwise convolution with per-channel requantization
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief s8 depthwise convolution function with per-channel requantization
+   * @param[in]       Im_in              pointer to input tensor
+   * @param[in]       dim_im_in_x        input tensor dimention x
+   * @param[in]       dim_im_in_y        input tensor dimention y
+   * @param[in]       ch_im_in           number of input tensor channels
+   * @param[in]       wt                 pointer to kernel weights
+   * @param[in]       ch_mult            channel multiplier, i.e. number of output channels per input channel
+   * @param[in]       dim_kernel_x       filter kernel size x
+   * @param[in]       dim_kernel_y       filter kernel size y
+   * @param[in]       padding_x          padding size x
+   * @param[in]       padding_y          padding size y
+   * @param[in]       stride_x           convolution stride x
+   * @param[in]       stride_y           convolution stride y
+   * @param[in]       bias               pointer to the per-channel bias, or NULL
+   * @param[in]       out_shift          pointer to the per-channel shifts of the output
+   * @param[in]       out_mult           pointer to the per-channel multipliers of the output
+   * @param[in]       input_offset       offset added to the input, i.e. the negated input zero-point.
+   *                                     Range: [-127, 128]
+   * @param[in]       out_offset         zero-point of the output. Range: [-128, 127]
+   * @param[in]       out_activation_min minimum value of the output. Range: [-128, 127]
+   * @param[in]       out_activation_max maximum value of the output. Range: [-128, 127]
+   * @param[in,out]   Im_out             pointer to output tensor
+   * @param[in]       dim_im_out_x       output tensor dimension x
+   * @param[in]       dim_im_out_y       output tensor dimension y
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * The output tensor has <code>ch_im_in*ch_mult</code> channels; the output
+   * channel <code>c*ch_mult + m</code> is computed from the input channel
+   * <code>c</code>. The weights are in the layout
+   * [dim_kernel_y][dim_kernel_x][ch_im_in*ch_mult], symmetric (zero-point 0),
+   * and the outputs are requantized per channel like in arm_convolve_s8.
+   *
+   * The kernel window is clipped to the input once per output pixel, so there
+   * is no bound check in the inner loops and no buffer is needed.
+   */
+
+arm_status arm_depthwise_conv_s8(const q7_t * Im_in,
+                                 const uint16_t dim_im_in_x,
+                                 const uint16_t dim_im_in_y,
+                                 const uint16_t ch_im_in,
+                                 const q7_t * wt,
+                                 const uint16_t ch_mult,
+                                 const uint16_t dim_kernel_x,
+                                 const uint16_t dim_kernel_y,
+                                 const uint16_t padding_x,
+                                 const uint16_t padding_y,
+                                 const uint16_t stride_x,
+                                 const uint16_t stride_y,
+                                 const int32_t * bias,
+                                 const int32_t * out_shift,
+                                 const int32_t * out_mult,
+                                 const int32_t input_offset,
+                                 const int32_t out_offset,
+                                 const int32_t out_activation_min,
+                                 const int32_t out_activation_max,
+                                 q7_t * Im_out,
+                                 const uint16_t dim_im_out_x,
+                                 const uint16_t dim_im_out_y)
+{
+    const int32_t ch_im_out = ch_im_in * ch_mult;
+    int32_t   i_out_y, i_out_x, i_ch_in, i_mult, i_ker_y, i_ker_x;
+    q7_t     *pOut = Im_out;
+
+    for (i_out_y = 0; i_out_y < dim_im_out_y; i_out_y++)
+    {
+        const int32_t base_y = i_out_y * stride_y - padding_y;
+        /* Rows of the kernel inside the input */
+        const int32_t ker_y_start = base_y < 0 ? -base_y : 0;
+        const int32_t ker_y_end = dim_im_in_y - base_y < dim_kernel_y ? dim_im_in_y - base_y : dim_kernel_y;
+
+        for (i_out_x = 0; i_out_x < dim_im_out_x; i_out_x++)
+        {
+            const int32_t base_x = i_out_x * stride_x - padding_x;
+            /* Columns of the kernel inside the input */
+            const int32_t ker_x_start = base_x < 0 ? -base_x : 0;
+            const int32_t ker_x_end = dim_im_in_x - base_x < dim_kernel_x ? dim_im_in_x - base_x : dim_kernel_x;
+
+            for (i_ch_in = 0; i_ch_in < ch_im_in; i_ch_in++)
+            {
+                for (i_mult = 0; i_mult < ch_mult; i_mult++)
+                {
+                    const int32_t i_ch_out = i_ch_in * ch_mult + i_mult;
+                    q31_t     sum = bias ? bias[i_ch_out] : 0;
+
+                    for (i_ker_y = ker_y_start; i_ker_y < ker_y_end; i_ker_y++)
+                    {
+                        const q7_t *pIn = Im_in + ((base_y + i_ker_y) * dim_im_in_x + base_x + ker_x_start) * ch_im_in
+                            + i_ch_in;
+                        const q7_t *pWt = wt + (i_ker_y * dim_kernel_x + ker_x_start) * ch_im_out + i_ch_out;
+
+                        for (i_ker_x = ker_x_start; i_ker_x < ker_x_end; i_ker_x++)
+                        {
+                            sum += (*pIn + input_offset) * *pWt;
+                            pIn += ch_im_in;
+                            pWt += ch_im_out;
+                        }
+                    }
+
+                    *pOut++ = arm_nn_requantize_q7(sum, out_mult[i_ch_out], out_shift[i_ch_out], out_offset,
+                                                   out_activation_min, out_activation_max);
+                }
+            }
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_s8.c
+ * Description:  s8 fully-connected layer function with per-channel requantization
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+  /**
+   * @brief s8 fully-connected layer function with per-channel requantization
+   * @param[in]       pV                 pointer to input vector
+   * @param[in]       pM                 pointer to matrix weights
+   * @param[in]       dim_vec            length of the vector
+   * @param[in]       num_of_rows        number of rows in weight matrix
+   * @param[in]       bias               pointer to the per-row bias, or NULL
+   * @param[in]       out_shift          pointer to the per-row shifts of the output
+   * @param[in]       out_mult           pointer to the per-row multipliers of the output
+   * @param[in]       input_offset       offset added to the input, i.e. the negated input zero-point.
+   *                                     Range: [-127, 128]
+   * @param[in]       out_offset         zero-point of the output. Range: [-128, 127]
+   * @param[in]       out_activation_min minimum value of the output. Range: [-128, 127]
+   * @param[in]       out_activation_max maximum value of the output. Range: [-128, 127]
+   * @param[in,out]   pOut               pointer to output vector
+   * @param[in,out]   vec_buffer         pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * vec_buffer size: dim_vec
+   *
+   * The weights are a regular matrix without interleaving, symmetric
+   * (zero-point 0). The accumulator of each row is requantized with its
+   * multiplier and shift like in arm_convolve_s8. A per-tensor quantization
+   * uses the same multiplier and shift for all rows.
+   *
+   */
+
+arm_status
+arm_fully_connected_s8(const q7_t * pV,
+                       const q7_t * pM,
+                       const uint16_t dim_vec,
+                       const uint16_t num_of_rows,
+                       const int32_t * bias,
+                       const int32_t * out_shift,
+                       const int32_t * out_mult,
+                       const int32_t input_offset,
+                       const int32_t out_offset,
+                       const int32_t out_activation_min,
+                       const int32_t out_activation_max,
+                       q7_t * pOut,
+                       q15_t * vec_buffer)
+{
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    const q7_t *pB = pM;
+    const q7_t *pB2;
+    q7_t     *pO = pOut;
+    q15_t    *pA;
+    uint16_t  row = 0;
+    uint16_t  rowCnt = num_of_rows >> 1;
+
+    /* expand the vector into the buffer, with the input offset */
+    arm_q7_to_q15_with_offset(pV, vec_buffer, dim_vec, (q15_t) input_offset);
+
+    while (rowCnt)
+    {
+        q31_t     sum = bias ? bias[row] : 0;
+        q31_t     sum2 = bias ? bias[row + 1] : 0;
+        uint16_t  colCnt = dim_vec >> 2;
+
+        pA = vec_buffer;
+        pB2 = pB + dim_vec;
+
+        while (colCnt)
+        {
+            q31_t     inV, inM11, inM12, inM21, inM22;
+            pB = (q7_t *) read_and_pad((void *)pB, &inM11, &inM12);
+            pB2 = (q7_t *) read_and_pad((void *)pB2, &inM21, &inM22);
+
+            inV = *__SIMD32(pA)++;
+
+            sum = __SMLAD(inV, inM11, sum);
+            sum2 = __SMLAD(inV, inM21, sum2);
+
+            inV = *__SIMD32(pA)++;
+
+            sum = __SMLAD(inV, inM12, sum);
+            sum2 = __SMLAD(inV, inM22, sum2);
+
+            colCnt--;
+        }
+        colCnt = dim_vec & 0x3;
+        while (colCnt)
+        {
+            q15_t     inV = *pA++;
+            q7_t      inM = *pB++;
+            q7_t      inM2 = *pB2++;
+
+            sum += inV * inM;
+            sum2 += inV * inM2;
+            colCnt--;
+        }                       /* while over colCnt */
+        *pO++ = arm_nn_requantize_q7(sum, out_mult[row], out_shift[row], out_offset,
+                                     out_activation_min, out_activation_max);
+        *pO++ = arm_nn_requantize_q7(sum2, out_mult[row + 1], out_shift[row + 1], out_offset,
+                                     out_activation_min, out_activation_max);
+
+        /* adjust the pointers and counters */
+        pB += dim_vec;
+        row += 2;
+        rowCnt--;
+    }
+
+    /* left-over part of the rows */
+    if (num_of_rows & 0x1)
+    {
+        uint16_t  colCnt = dim_vec >> 2;
+        q31_t     sum = bias ? bias[row] : 0;
+
+        pA = vec_buffer;
+
+        while (colCnt)
+        {
+            q31_t     inV1, inV2, inM11, inM12;
+
+            pB = (q7_t *) read_and_pad((void *)pB, &inM11, &inM12);
+
+            inV1 = *__SIMD32(pA)++;
+            sum = __SMLAD(inV1, inM11, sum);
+
+            inV2 = *__SIMD32(pA)++;
+            sum = __SMLAD(inV2, inM12, sum);
+
+            colCnt--;
+        }
+
+        /* left-over of the vector */
+        colCnt = dim_vec & 0x3;
+        while (colCnt)
+        {
+            q15_t     inV = *pA++;
+            q7_t      inM = *pB++;
+            sum += inV * inM;
+            colCnt--;
+        }
+
+        *pO++ = arm_nn_requantize_q7(sum, out_mult[row], out_shift[row], out_offset,
+                                     out_activation_min, out_activation_max);
+    }
+
+#else
+    int       i, j;
+
+    (void)vec_buffer;
+
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+    for (i = 0; i < num_of_rows; i++)
+    {
+        q31_t     ip_out = bias ? bias[i] : 0;
+        for (j = 0; j < dim_vec; j++)
+        {
+            ip_out += (pV[j] + input_offset) * pM[i * dim_vec + j];
+        }
+        pOut[i] = arm_nn_requantize_q7(ip_out, out_mult[i], out_shift[i], out_offset,
+                                       out_activation_min, out_activation_max);
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to ARM_MATH_SUCCESS */
+    return (ARM_MATH_SUCCESS);
+
+}
+
+/**
+ * @} end of FC group
+ */
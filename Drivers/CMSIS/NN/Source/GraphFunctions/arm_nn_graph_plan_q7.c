@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_plan_q7.c
+ * Description:  Memory plan of the activations of a Q7 graph
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/* Offset of a buffer which is not placed in the arena yet */
+#define ARM_NN_UNPLACED 0xFFFFFFFFU
+
+/* The buffers are 4-byte aligned for the SIMD accesses of the kernels */
+#define ARM_NN_ALIGN(_size) (((_size) + 3U) & ~3U)
+
+/**
+ * @brief A few utility functions used by the memory planner
+ *
+ *
+ */
+
+static uint32_t layer_input_size(const arm_nn_layer_q7 * layer)
+{
+    return (uint32_t) layer->dim_im_in * layer->dim_im_in * layer->ch_im_in;
+}
+
+static uint32_t layer_output_size(const arm_nn_layer_q7 * layer)
+{
+    switch (layer->type)
+    {
+    case ARM_NN_CONV_HWC_Q7_BASIC:
+    case ARM_NN_CONV_HWC_Q7_FAST:
+    case ARM_NN_CONV_HWC_Q7_RGB:
+    case ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7:
+        return (uint32_t) layer->dim_im_out * layer->dim_im_out * layer->ch_im_out;
+    case ARM_NN_MAXPOOL_Q7_HWC:
+    case ARM_NN_AVEPOOL_Q7_HWC:
+        return (uint32_t) layer->dim_im_out * layer->dim_im_out * layer->ch_im_in;
+    case ARM_NN_FULLY_CONNECTED_Q7:
+    case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+        return layer->ch_im_out;
+    default:
+        return layer_input_size(layer);
+    }
+}
+
+/* Size of bufferA or vec_buffer, in bytes */
+static uint32_t layer_scratch_size(const arm_nn_layer_q7 * layer)
+{
+    switch (layer->type)
+    {
+    case ARM_NN_CONV_HWC_Q7_BASIC:
+    case ARM_NN_CONV_HWC_Q7_FAST:
+    case ARM_NN_CONV_HWC_Q7_RGB:
+    case ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7:
+        return 2U * layer->ch_im_in * layer->dim_kernel * layer->dim_kernel * sizeof(q15_t);
+    case ARM_NN_FULLY_CONNECTED_Q7:
+    case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+        return layer_input_size(layer) * sizeof(q15_t);
+    case ARM_NN_AVEPOOL_Q7_HWC:
+        return (uint32_t) layer->dim_im_out * layer->ch_im_in * sizeof(q15_t);
+    default:
+        return 0;
+    }
+}
+
+static void use_buffer(arm_nn_buffer * buffer, uint16_t layer, uint32_t size)
+{
+    /* First use of the buffer */
+    if (buffer->size == 0)
+    {
+        buffer->first = layer;
+    }
+    buffer->last = layer;
+    if (size > buffer->size)
+    {
+        buffer->size = size;
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+  /**
+   * @brief Memory plan of a q7 graph
+   * @param[in]       graph       pointer to the graph
+   * @param[out]      plan        pointer to the buffers of the plan, num_tensors + num_layers values
+   * @param[out]      arena_size  size of the arena needed by the graph, in bytes
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of graph checking.
+   *
+   * @details
+   *
+   * The buffers of the plan are the tensors (plan[0] to plan[num_tensors-1]) followed
+   * by the scratch buffer of each layer (plan[num_tensors] to plan[num_tensors+num_layers-1]).
+   * A tensor is live from the layer writing it to the last layer reading it. The input of
+   * the graph is live from the first layer, the output up to the last layer. A scratch
+   * buffer is only live during its layer.
+   *
+   * The buffers are placed in the arena from the largest one to the smallest one, each one
+   * at the lowest offset where it does not overlap a placed buffer which is live at the
+   * same time. All the offsets are multiple of 4.
+   *
+   * <b>Graph constraints:</b>
+   *
+   * A tensor is written before it is read, except the input of the graph.
+   *
+   * The output of a layer is a different tensor from its input, except for the relu
+   * layers (which must be in-place) and the softmax layers.
+   *
+   * The pooling kernels are overwriting their input, so the input of a pooling layer
+   * is not read by the next layers.
+   *
+   * The relu and softmax tensors and the input of the fully-connected layers have at most
+   * 65535 values.
+   *
+   */
+
+arm_status arm_nn_graph_plan_q7(const arm_nn_graph_q7 * graph, arm_nn_buffer * plan, uint32_t * arena_size)
+{
+    const arm_nn_layer_q7 *layer;
+    uint16_t  num_tensors = graph->num_tensors;
+    uint16_t  num_layers = graph->num_layers;
+    uint32_t  num_buffers = (uint32_t) num_tensors + num_layers;
+    uint32_t  i, j, k;
+    uint32_t  offset, size;
+    uint32_t  arena = 0;
+    int       moved;
+
+    if (num_layers == 0 || graph->input >= num_tensors || graph->output >= num_tensors)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (i = 0; i < num_buffers; i++)
+    {
+        plan[i].offset = ARM_NN_UNPLACED;
+        plan[i].size = 0;
+        plan[i].first = 0;
+        plan[i].last = 0;
+    }
+
+    /* The input of the graph is written before the first layer */
+    plan[graph->input].size = layer_input_size(&graph->layers[0]);
+
+    /* Lifetime and size of each buffer */
+    for (i = 0; i < num_layers; i++)
+    {
+        layer = &graph->layers[i];
+
+        if (layer->type > ARM_NN_SOFTMAX_Q7 || layer->input >= num_tensors || layer->output >= num_tensors)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        if ((layer->input == layer->output) != (layer->type == ARM_NN_RELU_Q7)
+            && layer->type != ARM_NN_SOFTMAX_Q7)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        if ((layer->type == ARM_NN_RELU_Q7 || layer->type == ARM_NN_SOFTMAX_Q7
+             || layer->type == ARM_NN_FULLY_CONNECTED_Q7 || layer->type == ARM_NN_FULLY_CONNECTED_Q7_OPT)
+            && layer_input_size(layer) > 0xFFFFU)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        /* The input must have been written by a previous layer */
+        if (plan[layer->input].size == 0)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        use_buffer(&plan[layer->input], i, layer_input_size(layer));
+        use_buffer(&plan[layer->output], i, layer_output_size(layer));
+        use_buffer(&plan[num_tensors + i], i, layer_scratch_size(layer));
+    }
+
+    /* The output of the graph is read after the last layer */
+    if (plan[graph->output].size == 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    plan[graph->output].last = num_layers - 1;
+
+    for (i = 0; i < num_layers; i++)
+    {
+        layer = &graph->layers[i];
+
+        if ((layer->type == ARM_NN_MAXPOOL_Q7_HWC || layer->type == ARM_NN_AVEPOOL_Q7_HWC)
+            && plan[layer->input].last != i)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    /* Greedy placement, by decreasing size */
+    for (k = 0; k < num_buffers; k++)
+    {
+        j = num_buffers;
+        for (i = 0; i < num_buffers; i++)
+        {
+            if (plan[i].offset == ARM_NN_UNPLACED && (j == num_buffers || plan[i].size > plan[j].size))
+            {
+                j = i;
+            }
+        }
+
+        size = ARM_NN_ALIGN(plan[j].size);
+        offset = 0;
+
+        if (size > 0)
+        {
+            /* Move the buffer after the placed buffers it overlaps, until it overlaps none */
+            do
+            {
+                moved = 0;
+                for (i = 0; i < num_buffers; i++)
+                {
+                    if (plan[i].offset != ARM_NN_UNPLACED && plan[i].size > 0
+                        && plan[i].first <= plan[j].last && plan[j].first <= plan[i].last
+                        && plan[i].offset < offset + size
+                        && offset < plan[i].offset + ARM_NN_ALIGN(plan[i].size))
+                    {
+                        offset = plan[i].offset + ARM_NN_ALIGN(plan[i].size);
+                        moved = 1;
+                    }
+                }
+            }
+            while (moved);
+        }
+
+        plan[j].offset = offset;
+        if (offset + size > arena)
+        {
+            arena = offset + size;
+        }
+    }
+
+    *arena_size = arena;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNGraph group
+ */
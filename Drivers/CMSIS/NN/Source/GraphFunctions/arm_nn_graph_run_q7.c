@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_run_q7.c
+ * Description:  Execution of a Q7 graph
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+  /**
+   * @brief Run a q7 graph
+   * @param[in]       graph       pointer to the graph
+   * @param[in]       plan        pointer to the buffers of the plan computed by arm_nn_graph_plan_q7
+   * @param[in,out]   arena       pointer to the arena, 4-byte aligned
+   * @param[in]       arena_size  size of the arena, in bytes
+   * @return     The function returns
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> when the arena is smaller than the plan,
+   * otherwise <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of the kernels.
+   *
+   * @details
+   *
+   * The layers are run in order. The run stops at the first kernel returning an error,
+   * e.g. a fast convolution whose number of channels is not supported.
+   *
+   * No layer is run when a buffer of the plan is not inside the arena.
+   *
+   */
+
+arm_status arm_nn_graph_run_q7(const arm_nn_graph_q7 * graph, const arm_nn_buffer * plan, q7_t * arena,
+                               uint32_t arena_size)
+{
+    const arm_nn_layer_q7 *layer;
+    q7_t     *in;
+    q7_t     *out;
+    q7_t     *buffer;
+    uint32_t  num_buffers = (uint32_t) graph->num_tensors + graph->num_layers;
+    uint32_t  j;
+    uint16_t  i;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for (j = 0; j < num_buffers; j++)
+    {
+        if (plan[j].offset > arena_size || plan[j].size > arena_size - plan[j].offset)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    for (i = 0; i < graph->num_layers && status == ARM_MATH_SUCCESS; i++)
+    {
+        layer = &graph->layers[i];
+        in = arena + plan[layer->input].offset;
+        out = arena + plan[layer->output].offset;
+        buffer = arena + plan[graph->num_tensors + i].offset;
+
+        switch (layer->type)
+        {
+        case ARM_NN_CONV_HWC_Q7_BASIC:
+            status = arm_convolve_HWC_q7_basic(in, layer->dim_im_in, layer->ch_im_in, layer->wt, layer->ch_im_out,
+                                               layer->dim_kernel, layer->padding, layer->stride, layer->bias,
+                                               layer->bias_shift, layer->out_shift, out, layer->dim_im_out,
+                                               (q15_t *) buffer, NULL);
+            break;
+
+        case ARM_NN_CONV_HWC_Q7_FAST:
+            status = arm_convolve_HWC_q7_fast(in, layer->dim_im_in, layer->ch_im_in, layer->wt, layer->ch_im_out,
+                                              layer->dim_kernel, layer->padding, layer->stride, layer->bias,
+                                              layer->bias_shift, layer->out_shift, out, layer->dim_im_out,
+                                              (q15_t *) buffer, NULL);
+            break;
+
+        case ARM_NN_CONV_HWC_Q7_RGB:
+            status = arm_convolve_HWC_q7_RGB(in, layer->dim_im_in, layer->ch_im_in, layer->wt, layer->ch_im_out,
+                                             layer->dim_kernel, layer->padding, layer->stride, layer->bias,
+                                             layer->bias_shift, layer->out_shift, out, layer->dim_im_out,
+                                             (q15_t *) buffer, NULL);
+            break;
+
+        case ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7:
+            status = arm_depthwise_separable_conv_HWC_q7(in, layer->dim_im_in, layer->ch_im_in, layer->wt,
+                                                         layer->ch_im_out, layer->dim_kernel, layer->padding,
+                                                         layer->stride, layer->bias, layer->bias_shift,
+                                                         layer->out_shift, out, layer->dim_im_out,
+                                                         (q15_t *) buffer, NULL);
+            break;
+
+        case ARM_NN_FULLY_CONNECTED_Q7:
+            status = arm_fully_connected_q7(in, layer->wt, layer->dim_im_in * layer->dim_im_in * layer->ch_im_in,
+                                            layer->ch_im_out, layer->bias_shift, layer->out_shift, layer->bias,
+                                            out, (q15_t *) buffer);
+            break;
+
+        case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+            status = arm_fully_connected_q7_opt(in, layer->wt, layer->dim_im_in * layer->dim_im_in * layer->ch_im_in,
+                                                layer->ch_im_out, layer->bias_shift, layer->out_shift, layer->bias,
+                                                out, (q15_t *) buffer);
+            break;
+
+        case ARM_NN_RELU_Q7:
+            arm_relu_q7(out, layer->dim_im_in * layer->dim_im_in * layer->ch_im_in);
+            break;
+
+        case ARM_NN_MAXPOOL_Q7_HWC:
+            arm_maxpool_q7_HWC(in, layer->dim_im_in, layer->ch_im_in, layer->dim_kernel, layer->padding,
+                               layer->stride, layer->dim_im_out, buffer, out);
+            break;
+
+        case ARM_NN_AVEPOOL_Q7_HWC:
+            arm_avepool_q7_HWC(in, layer->dim_im_in, layer->ch_im_in, layer->dim_kernel, layer->padding,
+                               layer->stride, layer->dim_im_out, buffer, out);
+            break;
+
+        case ARM_NN_SOFTMAX_Q7:
+            arm_softmax_q7(in, layer->dim_im_in * layer->dim_im_in * layer->ch_im_in, out);
+            break;
+
+        default:
+            status = ARM_MATH_ARGUMENT_ERROR;
+            break;
+        }
+    }
+
+    return status;
+}
+
+  /**
+   * @brief Tensor of a q7 graph in the arena
+   * @param[in]       plan        pointer to the buffers of the plan
+   * @param[in]       arena       pointer to the arena
+   * @param[in]       tensor      index of the tensor
+   * @return     The function returns the pointer to the tensor.
+   *
+   */
+
+q7_t     *arm_nn_graph_tensor_q7(const arm_nn_buffer * plan, q7_t * arena, uint16_t tensor)
+{
+    return arena + plan[tensor].offset;
+}
+
+/**
+ * @} end of NNGraph group
+ */
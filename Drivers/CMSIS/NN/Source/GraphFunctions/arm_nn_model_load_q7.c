@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_model_load_q7.c
+ * Description:  Loading of a Q7 model in place
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief A few utility functions used by the model loader
+ *
+ *
+ */
+
+/* Number of weights of a layer */
+static uint32_t layer_weights_size(const arm_nn_model_layer * layer)
+{
+    switch (layer->type)
+    {
+    case ARM_NN_CONV_HWC_Q7_BASIC:
+    case ARM_NN_CONV_HWC_Q7_FAST:
+    case ARM_NN_CONV_HWC_Q7_RGB:
+        return (uint32_t) layer->ch_im_out * layer->dim_kernel * layer->dim_kernel * layer->ch_im_in;
+    case ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7:
+        return (uint32_t) layer->ch_im_in * layer->dim_kernel * layer->dim_kernel;
+    case ARM_NN_FULLY_CONNECTED_Q7:
+    case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+        return (uint32_t) layer->ch_im_out * layer->dim_im_in * layer->dim_im_in * layer->ch_im_in;
+    default:
+        return 0;
+    }
+}
+
+/* Number of biases of a layer */
+static uint32_t layer_bias_size(const arm_nn_model_layer * layer)
+{
+    switch (layer->type)
+    {
+    case ARM_NN_CONV_HWC_Q7_BASIC:
+    case ARM_NN_CONV_HWC_Q7_FAST:
+    case ARM_NN_CONV_HWC_Q7_RGB:
+    case ARM_NN_FULLY_CONNECTED_Q7:
+    case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+        return layer->ch_im_out;
+    case ARM_NN_DEPTHWISE_SEPARABLE_CONV_HWC_Q7:
+        return layer->ch_im_in;
+    default:
+        return 0;
+    }
+}
+
+/* Pointer to an array of the model, NULL if it is not in the model */
+static const q7_t *model_array(const uint8_t * model, uint32_t size, uint32_t offset, uint32_t length)
+{
+    if (length == 0)
+    {
+        return NULL;
+    }
+    if (offset < sizeof(arm_nn_model_header) || (offset & 3U) != 0 || offset > size || length > size - offset)
+    {
+        return NULL;
+    }
+    return (const q7_t *) (model + offset);
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+  /**
+   * @brief Load a q7 model
+   * @param[in]       model       pointer to the model, 4-byte aligned
+   * @param[in]       model_size  size of the memory holding the model, in bytes
+   * @param[out]      layers      pointer to the layers of the graph
+   * @param[in]       max_layers  number of layers which can be written in layers
+   * @param[out]      graph       pointer to the graph
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of model checking.
+   *
+   * @details
+   *
+   * The header and the layer records are checked: magic number, version, size of the model,
+   * and weights and biases inside the model. The layers are then written with pointers to
+   * the weights and biases in the model, so only the layers (a few tens of bytes each) are
+   * in RAM. The graph can be planned and run as a graph written in the sources.
+   *
+   * A new model can be written in the flash and loaded without recompiling the application,
+   * as long as the arena is large enough for its plan.
+   *
+   */
+
+arm_status arm_nn_model_load_q7(const uint8_t * model,
+                                uint32_t model_size,
+                                arm_nn_layer_q7 * layers,
+                                uint16_t max_layers,
+                                arm_nn_graph_q7 * graph)
+{
+    const arm_nn_model_header *header = (const arm_nn_model_header *) model;
+    const arm_nn_model_layer *record;
+    arm_nn_layer_q7 *layer;
+    uint32_t  size;
+    uint16_t  i;
+
+    if (((uint32_t) (uintptr_t) model & 3U) != 0 || model_size < sizeof(arm_nn_model_header))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    size = header->size;
+    if (header->magic != ARM_NN_MODEL_MAGIC || header->version != ARM_NN_MODEL_VERSION
+        || size < sizeof(arm_nn_model_header) || size > model_size
+        || header->num_layers == 0 || header->num_layers > max_layers
+        || (size - sizeof(arm_nn_model_header)) / sizeof(arm_nn_model_layer) < header->num_layers)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    record = (const arm_nn_model_layer *) (model + sizeof(arm_nn_model_header));
+
+    for (i = 0; i < header->num_layers; i++, record++)
+    {
+        layer = &layers[i];
+
+        if (record->type > ARM_NN_SOFTMAX_Q7)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        layer->type = (arm_nn_layer_type) record->type;
+        layer->input = record->input;
+        layer->output = record->output;
+        layer->dim_im_in = record->dim_im_in;
+        layer->ch_im_in = record->ch_im_in;
+        layer->ch_im_out = record->ch_im_out;
+        layer->dim_kernel = record->dim_kernel;
+        layer->padding = record->padding;
+        layer->stride = record->stride;
+        layer->dim_im_out = record->dim_im_out;
+        layer->bias_shift = record->bias_shift;
+        layer->out_shift = record->out_shift;
+        layer->wt = model_array(model, size, record->wt_offset, layer_weights_size(record));
+        layer->bias = model_array(model, size, record->bias_offset, layer_bias_size(record));
+
+        if ((layer->wt == NULL && layer_weights_size(record) != 0)
+            || (layer->bias == NULL && layer_bias_size(record) != 0))
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    graph->num_layers = header->num_layers;
+    graph->num_tensors = header->num_tensors;
+    graph->input = header->input;
+    graph->output = header->output;
+    graph->layers = layers;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNGraph group
+ */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2010-2019 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_q7_to_q15_with_offset.c
+ * Description:  Converts the elements of the Q7 vector to Q15 vector with an added offset
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup nndata_convert
+ * @{
+ */
+
+/**
+ * @brief Converts the elements of the Q7 vector to Q15 vector with an added offset
+ * @param[in]       *pSrc points to the Q7 input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       offset offset added to each element, in the range [-255, 255]
+ * @return none.
+ *
+ * \par Description:
+ *
+ * The equation used for the conversion process is:
+ *
+ * <pre>
+ * 	pDst[n] = (q15_t) pSrc[n] + offset;   0 <= n < blockSize.
+ * </pre>
+ *
+ * The offset is the negated zero-point of an asymmetric quantized input, so
+ * the elements of the output are the input values relative to their zero.
+ *
+ */
+
+void arm_q7_to_q15_with_offset(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize, q15_t offset)
+{
+    const q7_t *pIn = pSrc;     /* Src pointer */
+    uint32_t  blkCnt;           /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+    q31_t     in;
+    q31_t     in1, in2;
+    q31_t     out1, out2;
+
+    /* offset in the two halfwords */
+    const q31_t offset_q15x2 = __PKHBT(offset, offset, 16);
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0u)
+    {
+        in = *__SIMD32(pIn)++;
+
+        /* rotatate in by 8, extend two q7_t values to q15_t values and add the offset */
+        in1 = __SXTAB16(offset_q15x2, __ROR(in, 8));
+
+        /* extend remainig two q7_t values to q15_t values and add the offset */
+        in2 = __SXTAB16(offset_q15x2, in);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+        out2 = __PKHTB(in1, in2, 16);
+        out1 = __PKHBT(in2, in1, 16);
+
+#else
+
+        out1 = __PKHTB(in1, in2, 16);
+        out2 = __PKHBT(in2, in1, 16);
+
+#endif
+
+        *__SIMD32(pDst)++ = out1;
+        *__SIMD32(pDst)++ = out2;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+#else
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif                          /* ARM_MATH_DSP */
+
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q15_t) * pIn++ + offset;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+}
+
+/**
+ * @} end of nndata_convert group
+ */